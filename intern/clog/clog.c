@@ -78,6 +78,15 @@ typedef struct CLG_IDFilter {
   char match[0];
 } CLG_IDFilter;
 
+#ifdef WITH_CLOG_PTHREADS
+typedef struct CLogPendingMsg {
+  struct CLogPendingMsg *next;
+  uint len;
+  /** Over alloc. */
+  char data[0];
+} CLogPendingMsg;
+#endif
+
 typedef struct CLogContext {
   /** Single linked list of types. */
   CLG_LogType *types;
@@ -97,6 +106,17 @@ typedef struct CLogContext {
   int output;
   FILE *output_file;
 
+#ifdef WITH_CLOG_PTHREADS
+  /** Optional background writer, see #CLG_output_use_writer_thread_set. */
+  struct {
+    /** Formatted messages, last pushed first (made FIFO again when draining). */
+    struct CLogPendingMsg *pending;
+    pthread_t thread;
+    bool use_thread;
+    bool thread_exit;
+  } writer;
+#endif
+
   /** For timer (use_timestamp). */
   uint64_t timestamp_tick_start;
 
@@ -410,10 +430,124 @@ static uint64_t clg_timestamp_ticks_get(void)
 
 /** \} */
 
+#ifdef WITH_CLOG_PTHREADS
+
+/* -------------------------------------------------------------------- */
+/** \name Background Writer
+ *
+ * Optionally defer the write system calls to a thread, so threads that log
+ * heavily only pay for the formatting and a push onto an atomic stack.
+ * Formatting itself cannot be deferred: arguments may point at stack memory
+ * which is gone by the time a writer thread would read them.
+ * \{ */
+
+#  if defined(_MSC_VER)
+#    define CLOG_WRITER_SLEEP() Sleep(50)
+#  else
+#    define CLOG_WRITER_SLEEP() usleep(50000)
+#  endif
+
+static void clg_ctx_write_pending_push(CLogContext *ctx, const char *data, uint len)
+{
+  CLogPendingMsg *msg = MEM_mallocN(sizeof(*msg) + len, __func__);
+  CLogPendingMsg *head;
+  msg->len = len;
+  memcpy(msg->data, data, len);
+
+  do {
+    head = ctx->writer.pending;
+    msg->next = head;
+  } while (atomic_cas_ptr((void **)&ctx->writer.pending, head, msg) != head);
+}
+
+static void clg_ctx_write_pending_drain(CLogContext *ctx)
+{
+  CLogPendingMsg *head, *msg = NULL;
+
+  do {
+    head = ctx->writer.pending;
+  } while (atomic_cas_ptr((void **)&ctx->writer.pending, head, NULL) != head);
+
+  /* Reverse, so messages are written in the order they were pushed. */
+  while (head != NULL) {
+    CLogPendingMsg *next = head->next;
+    head->next = msg;
+    msg = head;
+    head = next;
+  }
+
+  while (msg != NULL) {
+    CLogPendingMsg *next = msg->next;
+    int bytes_written = write(ctx->output, msg->data, msg->len);
+    (void)bytes_written;
+    MEM_freeN(msg);
+    msg = next;
+  }
+}
+
+static void *clg_ctx_write_thread_run(void *arg)
+{
+  CLogContext *ctx = arg;
+  while (!ctx->writer.thread_exit) {
+    clg_ctx_write_pending_drain(ctx);
+    CLOG_WRITER_SLEEP();
+  }
+  return NULL;
+}
+
+static void clg_ctx_write_thread_start(CLogContext *ctx)
+{
+  if (ctx->writer.use_thread) {
+    return;
+  }
+  ctx->writer.thread_exit = false;
+  if (pthread_create(&ctx->writer.thread, NULL, clg_ctx_write_thread_run, ctx) == 0) {
+    ctx->writer.use_thread = true;
+  }
+}
+
+static void clg_ctx_write_thread_stop(CLogContext *ctx)
+{
+  if (!ctx->writer.use_thread) {
+    return;
+  }
+  ctx->writer.use_thread = false;
+  ctx->writer.thread_exit = true;
+  pthread_join(ctx->writer.thread, NULL);
+  clg_ctx_write_pending_drain(ctx);
+}
+
+#  undef CLOG_WRITER_SLEEP
+
+/** \} */
+
+#endif /* WITH_CLOG_PTHREADS */
+
 /* -------------------------------------------------------------------- */
 /** \name Logging API
  * \{ */
 
+static void clg_ctx_write_message(CLogContext *ctx,
+                                  enum CLG_Severity severity,
+                                  const char *data,
+                                  uint len)
+{
+#ifdef WITH_CLOG_PTHREADS
+  if (ctx->writer.use_thread) {
+    /* Back-traces print straight to the output file, so they would
+     * overtake their own message if it was queued. */
+    if ((severity <= CLG_SEVERITY_INFO) && (ctx->callbacks.backtrace_fn == NULL)) {
+      clg_ctx_write_pending_push(ctx, data, len);
+      return;
+    }
+    /* Warnings and up stay synchronous, after any queued messages. */
+    clg_ctx_write_pending_drain(ctx);
+  }
+#endif
+  int bytes_written = write(ctx->output, data, len);
+  (void)bytes_written;
+}
+
 static void write_timestamp(CLogStringBuf *cstr, const uint64_t timestamp_tick_start)
 {
   char timestamp_str[64];
@@ -494,9 +628,7 @@ void CLG_log_str(CLG_LogType *lg,
   }
   clg_str_append(&cstr, "\n");
 
-  /* could be optional */
-  int bytes_written = write(lg->ctx->output, cstr.data, cstr.len);
-  (void)bytes_written;
+  clg_ctx_write_message(lg->ctx, severity, cstr.data, cstr.len);
 
   clg_str_free(&cstr);
 
@@ -537,9 +669,7 @@ void CLG_logf(CLG_LogType *lg,
   }
   clg_str_append(&cstr, "\n");
 
-  /* could be optional */
-  int bytes_written = write(lg->ctx->output, cstr.data, cstr.len);
-  (void)bytes_written;
+  clg_ctx_write_message(lg->ctx, severity, cstr.data, cstr.len);
 
   clg_str_free(&cstr);
 
@@ -601,6 +731,21 @@ static void CLG_ctx_output_use_timestamp_set(CLogContext *ctx, int value)
   }
 }
 
+static void CLG_ctx_output_use_writer_thread_set(CLogContext *ctx, int value)
+{
+#ifdef WITH_CLOG_PTHREADS
+  if (value) {
+    clg_ctx_write_thread_start(ctx);
+  }
+  else {
+    clg_ctx_write_thread_stop(ctx);
+  }
+#else
+  (void)ctx;
+  (void)value;
+#endif
+}
+
 /** Action on error severity. */
 static void CLT_ctx_error_fn_set(CLogContext *ctx, void (*error_fn)(void *file_handle))
 {
@@ -668,6 +813,9 @@ static CLogContext *CLG_ctx_init(void)
 
 static void CLG_ctx_free(CLogContext *ctx)
 {
+#ifdef WITH_CLOG_PTHREADS
+  clg_ctx_write_thread_stop(ctx);
+#endif
 #if defined(WIN32)
   SetConsoleMode(GetStdHandle(STD_OUTPUT_HANDLE), clg_previous_console_mode);
 #endif
@@ -734,6 +882,11 @@ void CLG_output_use_timestamp_set(int value)
   CLG_ctx_output_use_timestamp_set(g_ctx, value);
 }
 
+void CLG_output_use_writer_thread_set(int value)
+{
+  CLG_ctx_output_use_writer_thread_set(g_ctx, value);
+}
+
 void CLG_error_fn_set(void (*error_fn)(void *file_handle))
 {
   CLT_ctx_error_fn_set(g_ctx, error_fn);
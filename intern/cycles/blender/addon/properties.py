@@ -400,6 +400,12 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         default=0.01,
     )
 
+    use_light_tree: BoolProperty(
+        name="Light Tree",
+        description="Sample one light at a time using a light tree, for lower noise in scenes with many lights at a small cost per sample",
+        default=False,
+    )
+
     use_adaptive_sampling: BoolProperty(
         name="Use Adaptive Sampling",
         description="Automatically reduce the number of samples per pixel based on estimated noise level",
@@ -834,6 +840,7 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         scene = context.scene.as_pointer()
         return _cycles.debug_flags_update(scene)
 
+    debug_use_cpu_avx512: BoolProperty(name="AVX512", default=True)
     debug_use_cpu_avx2: BoolProperty(name="AVX2", default=True)
     debug_use_cpu_avx: BoolProperty(name="AVX", default=True)
     debug_use_cpu_sse41: BoolProperty(name="SSE41", default=True)
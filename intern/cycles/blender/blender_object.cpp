@@ -226,7 +226,10 @@ Object *BlenderSync::sync_object(BL::Depsgraph &b_depsgraph,
   }
 
   /* Use task pool only for non-instances, since sync_dupli_particle accesses
-   * geometry. This restriction should be removed for better performance. */
+   * geometry, and the depsgraph iterator hands out a temporary object for
+   * instances that is reused as the iteration advances, so it can not be
+   * captured by a deferred sync task. This restriction should be removed for
+   * better performance. */
   TaskPool *object_geom_task_pool = (is_instance) ? NULL : geom_task_pool;
 
   /* key to lookup object */
@@ -100,11 +100,16 @@ void BVH2::build(Progress &progress, Stats *)
 
 void BVH2::refit(Progress &progress)
 {
-  progress.set_substatus("Packing BVH primitives");
-  pack_primitives();
-
-  if (progress.get_cancel())
-    return;
+  /* For the top level BVH only object transforms may have changed: the
+   * primitive and triangle arrays merged from the per-object BVHs are reused
+   * as-is, and only the node bounds need to be brought up to date. */
+  if (!params.top_level) {
+    progress.set_substatus("Packing BVH primitives");
+    pack_primitives();
+
+    if (progress.get_cancel())
+      return;
+  }
 
   progress.set_substatus("Refitting BVH nodes");
   refit_nodes();
@@ -315,8 +320,6 @@ void BVH2::pack_nodes(const BVHNode *root)
 
 void BVH2::refit_nodes()
 {
-  assert(!params.top_level);
-
   BoundBox bbox = BoundBox::empty;
   uint visibility = 0;
   refit_node(0, (pack.root_index == -1) ? true : false, bbox, visibility);
@@ -56,6 +56,7 @@ class BVHEmbree : public BVH {
  private:
   void set_tri_vertex_buffer(RTCGeometry geom_id, const Mesh *mesh, const bool update);
   void set_curve_vertex_buffer(RTCGeometry geom_id, const Hair *hair, const bool update);
+  void set_instance_transform(const Object *ob, RTCGeometry geom_id);
 
   RTCDevice rtc_device;
   enum RTCBuildQuality build_quality;
@@ -25,9 +25,15 @@
 #include "render/object.h"
 
 #include "util/util_algorithm.h"
+#include "util/util_task.h"
 
 CCL_NAMESPACE_BEGIN
 
+/* Only bother parallelizing the spatial binning when there is a considerable
+ * amount of references, to avoid threading overhead near the leafs where the
+ * build tasks themselves already run in parallel. */
+static const int BVH_SPATIAL_BIN_THRESHOLD = 4096;
+
 /* Object Split */
 
 BVHObjectSplit::BVHObjectSplit(BVHBuild *builder,
@@ -170,34 +176,74 @@ BVHSpatialSplit::BVHSpatialSplit(const BVHBuild &builder,
   }
 
   /* chop references into bins. */
-  for (unsigned int refIdx = range.start(); refIdx < range.end(); refIdx++) {
-    const BVHReference &ref = references_->at(refIdx);
-    BoundBox prim_bounds = get_prim_bounds(ref);
-    float3 firstBinf = (prim_bounds.min - origin) * invBinSize;
-    float3 lastBinf = (prim_bounds.max - origin) * invBinSize;
-    int3 firstBin = make_int3((int)firstBinf.x, (int)firstBinf.y, (int)firstBinf.z);
-    int3 lastBin = make_int3((int)lastBinf.x, (int)lastBinf.y, (int)lastBinf.z);
-
-    firstBin = clamp(firstBin, 0, BVHParams::NUM_SPATIAL_BINS - 1);
-    lastBin = clamp(lastBin, firstBin, BVHParams::NUM_SPATIAL_BINS - 1);
-
-    for (int dim = 0; dim < 3; dim++) {
-      BVHReference currRef(
-          get_prim_bounds(ref), ref.prim_index(), ref.prim_object(), ref.prim_type());
-
-      for (int i = firstBin[dim]; i < lastBin[dim]; i++) {
-        BVHReference leftRef, rightRef;
-
-        split_reference(
-            builder, leftRef, rightRef, currRef, dim, origin[dim] + binSize[dim] * (float)(i + 1));
-        storage_->bins[dim][i].bounds.grow(leftRef.bounds());
-        currRef = rightRef;
+  typedef BVHSpatialBin SpatialBins[3][BVHParams::NUM_SPATIAL_BINS];
+  auto chop_references = [&](const int first, const int last, SpatialBins &bins) {
+    for (int refIdx = first; refIdx < last; refIdx++) {
+      const BVHReference &ref = references_->at(refIdx);
+      BoundBox prim_bounds = get_prim_bounds(ref);
+      float3 firstBinf = (prim_bounds.min - origin) * invBinSize;
+      float3 lastBinf = (prim_bounds.max - origin) * invBinSize;
+      int3 firstBin = make_int3((int)firstBinf.x, (int)firstBinf.y, (int)firstBinf.z);
+      int3 lastBin = make_int3((int)lastBinf.x, (int)lastBinf.y, (int)lastBinf.z);
+
+      firstBin = clamp(firstBin, 0, BVHParams::NUM_SPATIAL_BINS - 1);
+      lastBin = clamp(lastBin, firstBin, BVHParams::NUM_SPATIAL_BINS - 1);
+
+      for (int dim = 0; dim < 3; dim++) {
+        BVHReference currRef(
+            get_prim_bounds(ref), ref.prim_index(), ref.prim_object(), ref.prim_type());
+
+        for (int i = firstBin[dim]; i < lastBin[dim]; i++) {
+          BVHReference leftRef, rightRef;
+
+          split_reference(builder,
+                          leftRef,
+                          rightRef,
+                          currRef,
+                          dim,
+                          origin[dim] + binSize[dim] * (float)(i + 1));
+          bins[dim][i].bounds.grow(leftRef.bounds());
+          currRef = rightRef;
+        }
+
+        bins[dim][lastBin[dim]].bounds.grow(currRef.bounds());
+        bins[dim][firstBin[dim]].enter++;
+        bins[dim][lastBin[dim]].exit++;
       }
-
-      storage_->bins[dim][lastBin[dim]].bounds.grow(currRef.bounds());
-      storage_->bins[dim][firstBin[dim]].enter++;
-      storage_->bins[dim][lastBin[dim]].exit++;
     }
+  };
+
+  if (range.size() < BVH_SPATIAL_BIN_THRESHOLD) {
+    chop_references(range.start(), range.end(), storage_->bins);
+  }
+  else {
+    /* Bins accumulated over a sub-range are independent from the other
+     * sub-ranges, so large ranges near the root are binned in parallel and the
+     * per-chunk histograms are merged afterwards. */
+    thread_spin_lock merge_lock;
+    parallel_for(
+        blocked_range<int>(range.start(), range.end(), BVH_SPATIAL_BIN_THRESHOLD),
+        [&](const blocked_range<int> &r) {
+          SpatialBins local_bins;
+          for (int dim = 0; dim < 3; dim++) {
+            for (int i = 0; i < BVHParams::NUM_SPATIAL_BINS; i++) {
+              local_bins[dim][i].bounds = BoundBox::empty;
+              local_bins[dim][i].enter = 0;
+              local_bins[dim][i].exit = 0;
+            }
+          }
+
+          chop_references(r.begin(), r.end(), local_bins);
+
+          thread_scoped_spin_lock lock(merge_lock);
+          for (int dim = 0; dim < 3; dim++) {
+            for (int i = 0; i < BVHParams::NUM_SPATIAL_BINS; i++) {
+              storage_->bins[dim][i].bounds.grow(local_bins[dim][i].bounds);
+              storage_->bins[dim][i].enter += local_bins[dim][i].enter;
+              storage_->bins[dim][i].exit += local_bins[dim][i].exit;
+            }
+          }
+        });
   }
 
   /* select best split plane. */
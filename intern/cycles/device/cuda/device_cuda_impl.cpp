@@ -1024,6 +1024,26 @@ void CUDADevice::mem_copy_to(device_memory &mem)
   }
 }
 
+void CUDADevice::mem_copy_to(device_memory &mem, size_t offset, size_t size)
+{
+  /* Partial copies are only done into an existing allocation, and not for
+   * textures which rebuild texture objects on every copy. */
+  if (!mem.device_pointer || mem.type == MEM_PIXELS || mem.type == MEM_TEXTURE) {
+    Device::mem_copy_to(mem, offset, size);
+    return;
+  }
+
+  if (mem.host_pointer) {
+    thread_scoped_lock lock(cuda_mem_map_mutex);
+
+    if (!cuda_mem_map[&mem].use_mapped_host || mem.host_pointer != mem.shared_pointer) {
+      const CUDAContextScope scope(this);
+      cuda_assert(cuMemcpyHtoD(
+          (CUdeviceptr)mem.device_pointer + offset, (char *)mem.host_pointer + offset, size));
+    }
+  }
+}
+
 void CUDADevice::mem_copy_from(device_memory &mem, int y, int w, int h, int elem)
 {
   if (mem.type == MEM_PIXELS && !background) {
@@ -376,6 +376,12 @@ class Device {
     return NULL;
   }
 
+  /* OpenImageIO texture system for the texture cache, only for CPU device */
+  virtual void *oiio_texture_system()
+  {
+    return NULL;
+  }
+
   /* load/compile kernels, must be called before adding tasks */
   virtual bool load_kernels(const DeviceRequestedFeatures & /*requested_features*/)
   {
@@ -489,6 +495,13 @@ class Device {
 
   virtual void mem_alloc(device_memory &mem) = 0;
   virtual void mem_copy_to(device_memory &mem) = 0;
+  /* Copy a byte range into an existing device allocation, for incremental
+   * updates of large buffers. Devices without partial copy support fall
+   * back to copying the entire buffer. */
+  virtual void mem_copy_to(device_memory &mem, size_t /*offset*/, size_t /*size*/)
+  {
+    mem_copy_to(mem);
+  }
   virtual void mem_copy_from(device_memory &mem, int y, int w, int h, int elem) = 0;
   virtual void mem_zero(device_memory &mem) = 0;
   virtual void mem_free(device_memory &mem) = 0;
@@ -45,6 +45,8 @@
 
 #include "kernel/osl/osl_shader.h"
 #include "kernel/osl/osl_globals.h"
+
+#include "kernel/kernels/cpu/kernel_oiio_globals.h"
 // clang-format on
 
 #include "bvh/bvh_embree.h"
@@ -79,8 +81,13 @@ template<typename F> class KernelFunctions {
     kernel = (F)NULL;
   }
 
-  KernelFunctions(
-      F kernel_default, F kernel_sse2, F kernel_sse3, F kernel_sse41, F kernel_avx, F kernel_avx2)
+  KernelFunctions(F kernel_default,
+                  F kernel_sse2,
+                  F kernel_sse3,
+                  F kernel_sse41,
+                  F kernel_avx,
+                  F kernel_avx2,
+                  F kernel_avx512)
   {
     const char *architecture_name = "default";
     kernel = kernel_default;
@@ -92,8 +99,16 @@ template<typename F> class KernelFunctions {
     (void)kernel_sse41;
     (void)kernel_avx;
     (void)kernel_avx2;
+    (void)kernel_avx512;
+#ifdef WITH_CYCLES_OPTIMIZED_KERNEL_AVX512
+    if (DebugFlags().cpu.has_avx512() && system_cpu_support_avx512()) {
+      architecture_name = "AVX-512";
+      kernel = kernel_avx512;
+    }
+    else
+#endif
 #ifdef WITH_CYCLES_OPTIMIZED_KERNEL_AVX2
-    if (DebugFlags().cpu.has_avx2() && system_cpu_support_avx2()) {
+        if (DebugFlags().cpu.has_avx2() && system_cpu_support_avx2()) {
       architecture_name = "AVX2";
       kernel = kernel_avx2;
     }
@@ -184,9 +199,12 @@ class CPUDevice : public Device {
 #ifdef WITH_OSL
   OSLGlobals osl_globals;
 #endif
+  OIIOGlobals oiio_globals;
 #ifdef WITH_OPENIMAGEDENOISE
   oidn::DeviceRef oidn_device;
   oidn::FilterRef oidn_filter;
+  oidn::FilterRef oidn_albedo_filter;
+  oidn::FilterRef oidn_normal_filter;
 #endif
   thread_spin_lock oidn_task_lock;
 #ifdef WITH_EMBREE
@@ -278,7 +296,8 @@ class CPUDevice : public Device {
 #define KERNEL_FUNCTIONS(name) \
   KERNEL_NAME_EVAL(cpu, name), KERNEL_NAME_EVAL(cpu_sse2, name), \
       KERNEL_NAME_EVAL(cpu_sse3, name), KERNEL_NAME_EVAL(cpu_sse41, name), \
-      KERNEL_NAME_EVAL(cpu_avx, name), KERNEL_NAME_EVAL(cpu_avx2, name)
+      KERNEL_NAME_EVAL(cpu_avx, name), KERNEL_NAME_EVAL(cpu_avx2, name), \
+      KERNEL_NAME_EVAL(cpu_avx512, name)
 
   CPUDevice(DeviceInfo &info_, Stats &stats_, Profiler &profiler_, bool background_)
       : Device(info_, stats_, profiler_, background_),
@@ -312,6 +331,16 @@ class CPUDevice : public Device {
 #ifdef WITH_OSL
     kernel_globals.osl = &osl_globals;
 #endif
+
+    /* Texture system for sampling tiled and mipmapped image files through a
+     * fixed size in-memory tile cache, so large texture sets do not have to be
+     * loaded at full resolution. */
+    oiio_globals.tex_sys = OIIO::TextureSystem::create(false);
+    oiio_globals.tex_sys->attribute("automip", 1);
+    oiio_globals.tex_sys->attribute("autotile", 64);
+    oiio_globals.tex_sys->attribute("max_memory_MB", 1024);
+    kernel_globals.oiio = &oiio_globals;
+    kernel_globals.oiio_tdata = NULL;
 #ifdef WITH_EMBREE
     embree_device = rtcNewDevice("verbose=0");
 #endif
@@ -357,6 +386,12 @@ class CPUDevice : public Device {
 #endif
     task_pool.cancel();
     texture_info.free();
+
+    if (oiio_globals.tex_sys) {
+      VLOG(2) << oiio_globals.tex_sys->getstats();
+      OIIO::TextureSystem::destroy(oiio_globals.tex_sys);
+      oiio_globals.tex_sys = NULL;
+    }
   }
 
   virtual bool show_samples() const override
@@ -525,7 +560,11 @@ class CPUDevice : public Device {
     }
 
     texture_info[slot] = mem.info;
-    texture_info[slot].data = (uint64_t)mem.host_pointer;
+    /* For textures sampled through the OpenImageIO texture cache, the data
+     * field holds the texture handle instead of a pointer to pixel memory. */
+    if (mem.info.data_type != IMAGE_DATA_TYPE_OIIO) {
+      texture_info[slot].data = (uint64_t)mem.host_pointer;
+    }
     need_texture_info = true;
   }
 
@@ -548,6 +587,11 @@ class CPUDevice : public Device {
 #endif
   }
 
+  virtual void *oiio_texture_system() override
+  {
+    return oiio_globals.tex_sys;
+  }
+
   void build_bvh(BVH *bvh, Progress &progress, bool refit) override
   {
 #ifdef WITH_EMBREE
@@ -910,9 +954,10 @@ class CPUDevice : public Device {
     return (!any);
   }
 
-  void adaptive_sampling_post(const RenderTile &tile, KernelGlobals *kg)
+  void adaptive_sampling_post(RenderTile &tile, KernelGlobals *kg)
   {
     float *render_buffer = (float *)tile.buffer;
+    int num_unconverged = 0;
     for (int y = tile.y; y < tile.y + tile.h; y++) {
       for (int x = tile.x; x < tile.x + tile.w; x++) {
         int index = tile.offset + x + y * tile.stride;
@@ -925,10 +970,15 @@ class CPUDevice : public Device {
           }
         }
         else {
+          num_unconverged++;
           kernel_adaptive_post_adjust(kg, buffer, tile.sample / (tile.sample - 1.0f));
         }
       }
     }
+
+    /* Report the fraction of unconverged pixels, which the tile manager uses
+     * to schedule the noisiest tiles first on the next progressive pass. */
+    tile.error = (float)num_unconverged / (float)(tile.w * tile.h);
   }
 
   void render(DeviceTask &task, RenderTile &tile, KernelGlobals *kg)
@@ -1033,23 +1083,36 @@ class CPUDevice : public Device {
       oidn_filter.set("srgb", false);
     }
 
+    /* With OpenImageDenoise 1.3+, prefilter the noisy albedo and normal passes so
+     * that the main filter can use them at low sample counts without smearing
+     * detail. Prefiltering would modify the passes, so it always runs on a copy
+     * and the render buffer keeps accumulating samples undisturbed. */
+#  if OIDN_VERSION_MAJOR > 1 || (OIDN_VERSION_MAJOR == 1 && OIDN_VERSION_MINOR >= 3)
+    const bool use_prefilter = task.denoising.input_passes >= DENOISER_INPUT_RGB_ALBEDO;
+#  else
+    const bool use_prefilter = false;
+#  endif
+
     /* Set images with appropriate stride for our interleaved pass storage. */
     struct {
       const char *name;
       const int offset;
       const bool scale;
       const bool use;
+      oidn::FilterRef *const prefilter;
       array<float> scaled_buffer;
-    } passes[] = {{"color", task.pass_denoising_data + DENOISING_PASS_COLOR, false, true},
+    } passes[] = {{"color", task.pass_denoising_data + DENOISING_PASS_COLOR, false, true, NULL},
                   {"albedo",
                    task.pass_denoising_data + DENOISING_PASS_ALBEDO,
                    true,
-                   task.denoising.input_passes >= DENOISER_INPUT_RGB_ALBEDO},
+                   task.denoising.input_passes >= DENOISER_INPUT_RGB_ALBEDO,
+                   use_prefilter ? &oidn_albedo_filter : NULL},
                   {"normal",
                    task.pass_denoising_data + DENOISING_PASS_NORMAL,
                    true,
-                   task.denoising.input_passes >= DENOISER_INPUT_RGB_ALBEDO_NORMAL},
-                  {"output", 0, false, true},
+                   task.denoising.input_passes >= DENOISER_INPUT_RGB_ALBEDO_NORMAL,
+                   use_prefilter ? &oidn_normal_filter : NULL},
+                  {"output", 0, false, true, NULL},
                   { NULL,
                     0 }};
 
@@ -1063,7 +1126,7 @@ class CPUDevice : public Device {
       const int64_t pixel_stride = task.pass_stride;
       const int64_t row_stride = stride * pixel_stride;
 
-      if (passes[i].scale && scale != 1.0f) {
+      if ((passes[i].scale && scale != 1.0f) || passes[i].prefilter) {
         /* Normalize albedo and normal passes as they are scaled by the number of samples.
          * For the color passes OIDN will perform auto-exposure making it unnecessary. */
         array<float> &scaled_buffer = passes[i].scaled_buffer;
@@ -1080,6 +1143,19 @@ class CPUDevice : public Device {
           }
         }
 
+        if (passes[i].prefilter) {
+          oidn::FilterRef &prefilter = *passes[i].prefilter;
+          if (!prefilter) {
+            prefilter = oidn_device.newFilter("RT");
+          }
+          prefilter.setImage(
+              passes[i].name, scaled_buffer.data(), oidn::Format::Float3, w, h, 0, 0, 0);
+          prefilter.setImage(
+              "output", scaled_buffer.data(), oidn::Format::Float3, w, h, 0, 0, 0);
+          prefilter.commit();
+          prefilter.execute();
+        }
+
         oidn_filter.setImage(
             passes[i].name, scaled_buffer.data(), oidn::Format::Float3, w, h, 0, 0, 0);
       }
@@ -1096,6 +1172,9 @@ class CPUDevice : public Device {
     }
 
     /* Execute filter. */
+#  if OIDN_VERSION_MAJOR > 1 || (OIDN_VERSION_MAJOR == 1 && OIDN_VERSION_MINOR >= 3)
+    oidn_filter.set("cleanAux", use_prefilter);
+#  endif
     oidn_filter.commit();
     oidn_filter.execute();
 #else
@@ -1486,6 +1565,7 @@ class CPUDevice : public Device {
 #ifdef WITH_OSL
     OSLShader::thread_init(&kg, &kernel_globals, &osl_globals);
 #endif
+    kg.oiio_tdata = oiio_globals.tex_sys ? oiio_globals.tex_sys->get_perthread_info() : NULL;
     return kg;
   }
 
@@ -1625,7 +1705,13 @@ int2 CPUSplitKernel::split_kernel_global_size(device_memory & /*kg*/,
                                               device_memory & /*data*/,
                                               DeviceTask & /*task*/)
 {
-  return make_int2(1, 1);
+  /* Process a batch of paths per thread instead of a single one, so that each
+   * split kernel stage loops over many paths doing the same work. The state
+   * the stages touch stays dense in cache, the queues compact away terminated
+   * paths between bounces, and the inner loops become candidates for
+   * vectorization, which helps divergent scenes where the megakernel leaves
+   * SIMD lanes underused. */
+  return make_int2(64, 1);
 }
 
 uint64_t CPUSplitKernel::state_buffer_size(device_memory &kernel_globals,
@@ -1671,7 +1757,8 @@ string device_cpu_capabilities()
   capabilities += system_cpu_support_sse3() ? "SSE3 " : "";
   capabilities += system_cpu_support_sse41() ? "SSE41 " : "";
   capabilities += system_cpu_support_avx() ? "AVX " : "";
-  capabilities += system_cpu_support_avx2() ? "AVX2" : "";
+  capabilities += system_cpu_support_avx2() ? "AVX2 " : "";
+  capabilities += system_cpu_support_avx512() ? "AVX512" : "";
   if (capabilities[capabilities.size() - 1] == ' ')
     capabilities.resize(capabilities.size() - 1);
   return capabilities;
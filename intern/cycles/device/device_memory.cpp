@@ -136,6 +136,13 @@ void device_memory::device_copy_to()
   }
 }
 
+void device_memory::device_copy_to(size_t offset, size_t size)
+{
+  if (host_pointer) {
+    device->mem_copy_to(*this, offset, size);
+  }
+}
+
 void device_memory::device_copy_from(int y, int w, int h, int elem)
 {
   assert(type != MEM_TEXTURE && type != MEM_READ_ONLY && type != MEM_GLOBAL);
@@ -212,6 +219,7 @@ device_texture::device_texture(Device *device,
     case IMAGE_DATA_TYPE_BYTE:
     case IMAGE_DATA_TYPE_NANOVDB_FLOAT:
     case IMAGE_DATA_TYPE_NANOVDB_FLOAT3:
+    case IMAGE_DATA_TYPE_OIIO:
       data_type = TYPE_UCHAR;
       data_elements = 1;
       break;
@@ -274,7 +282,14 @@ void *device_texture::alloc(const size_t width, const size_t height, const size_
 
 void device_texture::copy_to_device()
 {
-  device_copy_to();
+  /* Textures sampled through the OpenImageIO texture cache have no pixel
+   * memory of their own, but still have to fill their texture info slot. */
+  if (info.data_type == IMAGE_DATA_TYPE_OIIO) {
+    device->mem_copy_to(*this);
+  }
+  else {
+    device_copy_to();
+  }
 }
 
 CCL_NAMESPACE_END
@@ -254,6 +254,7 @@ class device_memory {
   void device_alloc();
   void device_free();
   void device_copy_to();
+  void device_copy_to(size_t offset, size_t size);
   void device_copy_from(int y, int w, int h, int elem);
   void device_zero();
 
@@ -338,6 +339,8 @@ template<typename T> class device_vector : public device_memory {
     data_elements = device_type_traits<T>::num_elements;
     modified = true;
     need_realloc_ = true;
+    modified_begin_ = 0;
+    modified_end_ = (size_t)-1;
 
     assert(data_elements > 0);
   }
@@ -459,6 +462,27 @@ template<typename T> class device_vector : public device_memory {
   void tag_modified()
   {
     modified = true;
+    modified_begin_ = 0;
+    modified_end_ = (size_t)-1;
+  }
+
+  /* Tag a sub-range of elements as modified, so that only the union of the
+   * tagged ranges needs to be copied by copy_to_device_if_modified(). */
+  void tag_modified_range(size_t begin, size_t size)
+  {
+    if (!modified) {
+      modified_begin_ = begin;
+      modified_end_ = begin + size;
+      modified = true;
+    }
+    else {
+      if (begin < modified_begin_) {
+        modified_begin_ = begin;
+      }
+      if (begin + size > modified_end_) {
+        modified_end_ = begin + size;
+      }
+    }
   }
 
   void tag_realloc()
@@ -496,13 +520,25 @@ template<typename T> class device_vector : public device_memory {
       return;
     }
 
-    copy_to_device();
+    const size_t begin = (modified_begin_ < data_size) ? modified_begin_ : data_size;
+    const size_t end = (modified_end_ < data_size) ? modified_end_ : data_size;
+
+    if (need_realloc_ || !device_pointer || (begin == 0 && end == data_size)) {
+      copy_to_device();
+    }
+    else if (begin < end) {
+      /* Only part of the buffer was modified, copy just that range into the
+       * existing device allocation. */
+      device_copy_to(begin * sizeof(T), (end - begin) * sizeof(T));
+    }
   }
 
   void clear_modified()
   {
     modified = false;
     need_realloc_ = false;
+    modified_begin_ = 0;
+    modified_end_ = 0;
   }
 
   void copy_from_device()
@@ -533,6 +569,11 @@ template<typename T> class device_vector : public device_memory {
   {
     return width * ((height == 0) ? 1 : height) * ((depth == 0) ? 1 : depth);
   }
+
+  /* Element range tagged as modified since the last device copy, used by
+   * copy_to_device_if_modified() to upload only part of the buffer. */
+  size_t modified_begin_;
+  size_t modified_end_;
 };
 
 /* Pixel Memory
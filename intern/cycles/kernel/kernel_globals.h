@@ -45,6 +45,8 @@ struct OSLThreadData;
 struct OSLShadingSystem;
 #  endif
 
+struct OIIOGlobals;
+
 typedef unordered_map<float, float> CoverageMap;
 
 struct Intersection;
@@ -64,6 +66,11 @@ typedef struct KernelGlobals {
   OSLThreadData *osl_tdata;
 #  endif
 
+  /* OpenImageIO texture system for textures sampled through the texture
+   * cache, with a per-thread context (OIIO::TextureSystem::Perthread). */
+  OIIOGlobals *oiio;
+  void *oiio_tdata;
+
   /* **** Run-time data **** */
 
   /* Heap-allocated storage for transparent shadows intersections. */
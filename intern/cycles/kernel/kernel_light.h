@@ -35,6 +35,225 @@ typedef struct LightSample {
   LightType type; /* type of light */
 } LightSample;
 
+/* Light Tree
+ *
+ * Hierarchical importance sampling of many lights, following "Importance
+ * Sampling of Many Lights with Adaptive Tree Splitting" by Estevez and Kulla.
+ * The tree is traversed stochastically, picking children proportional to an
+ * importance estimated from the cluster bounds as seen from the shading
+ * point. Distant and background lights have no meaningful bounds and are kept
+ * in a separate group that is picked by energy. */
+
+ccl_device float light_tree_cluster_importance(const float3 P,
+                                               const ccl_global KernelLightTreeNode *knode)
+{
+  const float3 bbox_min = make_float3(
+      knode->bbox_min[0], knode->bbox_min[1], knode->bbox_min[2]);
+  const float3 bbox_max = make_float3(
+      knode->bbox_max[0], knode->bbox_max[1], knode->bbox_max[2]);
+  const float3 centroid = 0.5f * (bbox_min + bbox_max);
+
+  const float r2 = len_squared(bbox_max - centroid);
+  float3 dir = centroid - P;
+  const float d2 = len_squared(dir);
+
+  /* Inside the cluster bounds, any emitter may dominate, so use the energy
+   * without distance or orientation attenuation. */
+  if (d2 <= r2) {
+    return knode->energy;
+  }
+
+  const float d = sqrtf(d2);
+  dir /= d;
+
+  /* Minimum angle between the emitter axes and the direction towards the
+   * shading point, conservatively lowered by the angle subtended by the
+   * cluster bounds. Note this does not use the shading normal, so that the
+   * same importance can be computed for the forward pdf on MIS hits. */
+  const float3 axis = make_float3(knode->axis[0], knode->axis[1], knode->axis[2]);
+  const float theta = fast_acosf(dot(axis, -dir));
+  const float theta_u = fast_asinf(min(sqrtf(r2) / d, 1.0f));
+  const float theta_prime = max(theta - knode->theta_o - theta_u, 0.0f);
+
+  if (theta_prime >= knode->theta_e) {
+    return 0.0f;
+  }
+
+  return knode->energy * fast_cosf(theta_prime) / d2;
+}
+
+/* Pick an emitter, returning the index into the light distribution and the
+ * discrete probability of having picked it. The random number is rescaled for
+ * reuse. Returns -1 if no emitter could be picked. */
+ccl_device int light_tree_sample(KernelGlobals *kg, float *randu, const float3 P, float *pdf)
+{
+  float r = *randu;
+  *pdf = 1.0f;
+
+  /* distant group */
+  const float distant_prob = kernel_data.integrator.light_tree_distant_prob;
+  if (distant_prob > 0.0f) {
+    const int num_distant = kernel_data.integrator.num_distant_lights;
+
+    if (r < distant_prob) {
+      r /= distant_prob;
+      const int i = min((int)(r * num_distant), num_distant - 1);
+      *randu = r * num_distant - i;
+      *pdf = distant_prob / num_distant;
+
+      const int emitter = kernel_data.integrator.num_light_tree_emitters + i;
+      return kernel_tex_fetch(__light_tree_emitters, emitter).distribution_id;
+    }
+    else if (distant_prob == 1.0f) {
+      return -1;
+    }
+
+    r = (r - distant_prob) / (1.0f - distant_prob);
+    *pdf = 1.0f - distant_prob;
+  }
+
+  /* descend into the tree, picking children by importance */
+  int node_index = 0;
+  const ccl_global KernelLightTreeNode *knode = &kernel_tex_fetch(__light_tree_nodes, 0);
+
+  while (knode->right_child != -1) {
+    const int left = node_index + 1;
+    const int right = knode->right_child;
+    const float importance_left = light_tree_cluster_importance(
+        P, &kernel_tex_fetch(__light_tree_nodes, left));
+    const float importance_right = light_tree_cluster_importance(
+        P, &kernel_tex_fetch(__light_tree_nodes, right));
+    const float importance_total = importance_left + importance_right;
+
+    if (!(importance_total > 0.0f)) {
+      return -1;
+    }
+
+    const float P_left = importance_left / importance_total;
+
+    if (r < P_left) {
+      node_index = left;
+      r /= P_left;
+      *pdf *= P_left;
+    }
+    else {
+      node_index = right;
+      r = (r - P_left) / (1.0f - P_left);
+      *pdf *= 1.0f - P_left;
+    }
+
+    knode = &kernel_tex_fetch(__light_tree_nodes, node_index);
+  }
+
+  /* pick an emitter within the leaf proportional to energy */
+  float total_energy = 0.0f;
+  for (int i = 0; i < knode->num_emitters; i++) {
+    total_energy += kernel_tex_fetch(__light_tree_emitters, knode->first_emitter + i).energy;
+  }
+
+  if (!(total_energy > 0.0f)) {
+    return -1;
+  }
+
+  const float r_pick = r * total_energy;
+  float partial = 0.0f;
+
+  for (int i = 0; i < knode->num_emitters; i++) {
+    const ccl_global KernelLightTreeEmitter *kemitter = &kernel_tex_fetch(
+        __light_tree_emitters, knode->first_emitter + i);
+
+    if (r_pick <= partial + kemitter->energy || i == knode->num_emitters - 1) {
+      *randu = clamp((r_pick - partial) / kemitter->energy, 0.0f, 1.0f);
+      *pdf *= kemitter->energy / total_energy;
+      return kemitter->distribution_id;
+    }
+
+    partial += kemitter->energy;
+  }
+
+  return -1;
+}
+
+/* Discrete probability of light_tree_sample() picking the given emitter from
+ * shading point P, computed by walking the tree upwards from the emitter. */
+ccl_device float light_tree_pdf(KernelGlobals *kg, const float3 P, int emitter)
+{
+  const ccl_global KernelLightTreeEmitter *kemitter = &kernel_tex_fetch(__light_tree_emitters,
+                                                                        emitter);
+
+  /* distant group */
+  if (kemitter->parent == -1) {
+    return kernel_data.integrator.light_tree_distant_prob /
+           kernel_data.integrator.num_distant_lights;
+  }
+
+  const ccl_global KernelLightTreeNode *kleaf = &kernel_tex_fetch(__light_tree_nodes,
+                                                                  kemitter->parent);
+
+  /* probability of picking the emitter within its leaf */
+  float total_energy = 0.0f;
+  for (int i = 0; i < kleaf->num_emitters; i++) {
+    total_energy += kernel_tex_fetch(__light_tree_emitters, kleaf->first_emitter + i).energy;
+  }
+
+  if (!(total_energy > 0.0f)) {
+    return 0.0f;
+  }
+
+  float pdf = kemitter->energy / total_energy;
+
+  /* probability of reaching the leaf from the root */
+  int node_index = kemitter->parent;
+
+  while (node_index > 0) {
+    const int parent = kernel_tex_fetch(__light_tree_nodes, node_index).parent;
+    const ccl_global KernelLightTreeNode *kparent = &kernel_tex_fetch(__light_tree_nodes, parent);
+
+    const int left = parent + 1;
+    const int right = kparent->right_child;
+    const float importance_left = light_tree_cluster_importance(
+        P, &kernel_tex_fetch(__light_tree_nodes, left));
+    const float importance_right = light_tree_cluster_importance(
+        P, &kernel_tex_fetch(__light_tree_nodes, right));
+    const float importance_total = importance_left + importance_right;
+
+    if (!(importance_total > 0.0f)) {
+      return 0.0f;
+    }
+
+    pdf *= ((node_index == left) ? importance_left : importance_right) / importance_total;
+    node_index = parent;
+  }
+
+  return pdf * (1.0f - kernel_data.integrator.light_tree_distant_prob);
+}
+
+ccl_device_inline float light_tree_pdf_lamp(KernelGlobals *kg, const float3 P, int lamp)
+{
+  const uint emitter = kernel_tex_fetch(__light_tree_lamp_map, lamp);
+
+  if (emitter == LIGHT_TREE_INVALID_EMITTER) {
+    return 0.0f;
+  }
+
+  return light_tree_pdf(kg, P, emitter);
+}
+
+ccl_device_inline float light_tree_pdf_triangle(KernelGlobals *kg,
+                                                const float3 P,
+                                                int object,
+                                                int prim)
+{
+  const uint slot = kernel_tex_fetch(__light_tree_object_offset, object) + (uint)prim;
+  const uint emitter = kernel_tex_fetch(__light_tree_triangle_map, slot);
+
+  if (emitter == LIGHT_TREE_INVALID_EMITTER) {
+    return 0.0f;
+  }
+
+  return light_tree_pdf(kg, P, emitter);
+}
+
 /* Regular Light */
 
 ccl_device_inline bool lamp_light_sample(
@@ -171,7 +390,12 @@ ccl_device_inline bool lamp_light_sample(
     }
   }
 
-  ls->pdf *= kernel_data.integrator.pdf_lights;
+  if (kernel_data.integrator.use_light_tree) {
+    ls->pdf *= light_tree_pdf_lamp(kg, P, lamp);
+  }
+  else {
+    ls->pdf *= kernel_data.integrator.pdf_lights;
+  }
 
   return (ls->pdf > 0.0f);
 }
@@ -328,7 +552,12 @@ ccl_device bool lamp_light_eval(
     return false;
   }
 
-  ls->pdf *= kernel_data.integrator.pdf_lights;
+  if (kernel_data.integrator.use_light_tree) {
+    ls->pdf *= light_tree_pdf_lamp(kg, P, lamp);
+  }
+  else {
+    ls->pdf *= kernel_data.integrator.pdf_lights;
+  }
 
   return true;
 }
@@ -417,20 +646,40 @@ ccl_device_forceinline float triangle_light_pdf(KernelGlobals *kg, ShaderData *s
       return 0.0f;
     }
     else {
-      float area = 1.0f;
-      if (has_motion) {
-        /* get the center frame vertices, this is what the PDF was calculated from */
-        triangle_world_space_vertices(kg, sd->object, sd->prim, -1.0f, V);
-        area = triangle_area(V[0], V[1], V[2]);
+      float pdf;
+      if (kernel_data.integrator.use_light_tree) {
+        /* discrete probability of the light tree picking this triangle from
+         * the point being shaded, which was sampled over solid angle */
+        pdf = light_tree_pdf_triangle(kg, Px, sd->object, sd->prim);
       }
       else {
-        area = 0.5f * len(N);
+        float area = 1.0f;
+        if (has_motion) {
+          /* get the center frame vertices, this is what the PDF was calculated from */
+          triangle_world_space_vertices(kg, sd->object, sd->prim, -1.0f, V);
+          area = triangle_area(V[0], V[1], V[2]);
+        }
+        else {
+          area = 0.5f * len(N);
+        }
+        pdf = area * kernel_data.integrator.pdf_triangles;
       }
-      const float pdf = area * kernel_data.integrator.pdf_triangles;
       return pdf / solid_angle;
     }
   }
   else {
+    if (kernel_data.integrator.use_light_tree) {
+      const float3 Px = sd->P + sd->I * t;
+      const float area = 0.5f * len(N);
+      const float cos_pi = fabsf(dot(sd->Ng, sd->I));
+
+      if (UNLIKELY(area == 0.0f || cos_pi == 0.0f)) {
+        return 0.0f;
+      }
+
+      return t * t * light_tree_pdf_triangle(kg, Px, sd->object, sd->prim) / (cos_pi * area);
+    }
+
     float pdf = triangle_light_pdf_area(kg, sd->Ng, sd->I, t);
     if (has_motion) {
       const float area = 0.5f * len(N);
@@ -455,7 +704,8 @@ ccl_device_forceinline void triangle_light_sample(KernelGlobals *kg,
                                                   float randv,
                                                   float time,
                                                   LightSample *ls,
-                                                  const float3 P)
+                                                  const float3 P,
+                                                  const float pdf_selection)
 {
   /* A naive heuristic to decide between costly solid angle sampling
    * and simple area sampling, comparing the distance to the triangle plane
@@ -574,12 +824,20 @@ ccl_device_forceinline void triangle_light_sample(KernelGlobals *kg,
       return;
     }
     else {
-      if (has_motion) {
-        /* get the center frame vertices, this is what the PDF was calculated from */
-        triangle_world_space_vertices(kg, object, prim, -1.0f, V);
-        area = triangle_area(V[0], V[1], V[2]);
+      float pdf;
+      if (kernel_data.integrator.use_light_tree) {
+        /* the discrete probability of having picked this triangle, which was
+         * sampled over solid angle */
+        pdf = pdf_selection;
+      }
+      else {
+        if (has_motion) {
+          /* get the center frame vertices, this is what the PDF was calculated from */
+          triangle_world_space_vertices(kg, object, prim, -1.0f, V);
+          area = triangle_area(V[0], V[1], V[2]);
+        }
+        pdf = area * kernel_data.integrator.pdf_triangles;
       }
-      const float pdf = area * kernel_data.integrator.pdf_triangles;
       ls->pdf = pdf / solid_angle;
     }
   }
@@ -601,14 +859,26 @@ ccl_device_forceinline void triangle_light_sample(KernelGlobals *kg,
     ls->P = u * V[0] + v * V[1] + t * V[2];
     /* compute incoming direction, distance and pdf */
     ls->D = normalize_len(ls->P - P, &ls->t);
-    ls->pdf = triangle_light_pdf_area(kg, ls->Ng, -ls->D, ls->t);
-    if (has_motion && area != 0.0f) {
-      /* scale the PDF.
-       * area = the area the sample was taken from
-       * area_pre = the are from which pdf_triangles was calculated from */
-      triangle_world_space_vertices(kg, object, prim, -1.0f, V);
-      const float area_pre = triangle_area(V[0], V[1], V[2]);
-      ls->pdf = ls->pdf * area_pre / area;
+    if (kernel_data.integrator.use_light_tree) {
+      /* convert the discrete picking probability to a pdf over the triangle
+       * area, and that to solid angle */
+      const float cos_pi = fabsf(dot(ls->Ng, -ls->D));
+      if (UNLIKELY(area == 0.0f || cos_pi == 0.0f)) {
+        ls->pdf = 0.0f;
+        return;
+      }
+      ls->pdf = pdf_selection * ls->t * ls->t / (cos_pi * area);
+    }
+    else {
+      ls->pdf = triangle_light_pdf_area(kg, ls->Ng, -ls->D, ls->t);
+      if (has_motion && area != 0.0f) {
+        /* scale the PDF.
+         * area = the area the sample was taken from
+         * area_pre = the are from which pdf_triangles was calculated from */
+        triangle_world_space_vertices(kg, object, prim, -1.0f, V);
+        const float area_pre = triangle_area(V[0], V[1], V[2]);
+        ls->pdf = ls->pdf * area_pre / area;
+      }
     }
     ls->u = u;
     ls->v = v;
@@ -671,7 +941,18 @@ ccl_device_noinline bool light_sample(KernelGlobals *kg,
 {
   if (lamp < 0) {
     /* sample index */
-    int index = light_distribution_sample(kg, &randu);
+    float pdf_selection = 0.0f;
+    int index;
+
+    if (kernel_data.integrator.use_light_tree) {
+      index = light_tree_sample(kg, &randu, P, &pdf_selection);
+      if (index < 0) {
+        return false;
+      }
+    }
+    else {
+      index = light_distribution_sample(kg, &randu);
+    }
 
     /* fetch light data */
     const ccl_global KernelLightDistribution *kdistribution = &kernel_tex_fetch(
@@ -682,7 +963,7 @@ ccl_device_noinline bool light_sample(KernelGlobals *kg,
       int object = kdistribution->mesh_light.object_id;
       int shader_flag = kdistribution->mesh_light.shader_flag;
 
-      triangle_light_sample(kg, prim, object, randu, randv, time, ls, P);
+      triangle_light_sample(kg, prim, object, randu, randv, time, ls, P, pdf_selection);
       ls->shader |= shader_flag;
       return (ls->pdf > 0.0f);
     }
@@ -402,6 +402,14 @@ background_light_sample(KernelGlobals *kg, float3 P, float randu, float randv, f
 
 ccl_device float background_light_pdf(KernelGlobals *kg, float3 P, float3 direction)
 {
+  /* Probability of having picked the background light. With the light tree
+   * this is the uniform pick within the distant group, matching the selection
+   * probability applied by lamp_light_sample. */
+  const float pdf_lights = (kernel_data.integrator.use_light_tree) ?
+                               kernel_data.integrator.light_tree_distant_prob /
+                                   kernel_data.integrator.num_distant_lights :
+                               kernel_data.integrator.pdf_lights;
+
   float portal_method_pdf = kernel_data.background.portal_weight;
   float sun_method_pdf = kernel_data.background.sun_weight;
   float map_method_pdf = kernel_data.background.map_weight;
@@ -424,7 +432,7 @@ ccl_device float background_light_pdf(KernelGlobals *kg, float3 P, float3 direct
   float pdf_fac = (portal_method_pdf + sun_method_pdf + map_method_pdf);
   if (pdf_fac == 0.0f) {
     /* Use uniform as a fallback if we can't use any strategy. */
-    return kernel_data.integrator.pdf_lights / M_4PI_F;
+    return pdf_lights / M_4PI_F;
   }
 
   pdf_fac = 1.0f / pdf_fac;
@@ -440,7 +448,7 @@ ccl_device float background_light_pdf(KernelGlobals *kg, float3 P, float3 direct
     pdf += background_map_pdf(kg, direction) * map_method_pdf;
   }
 
-  return pdf * kernel_data.integrator.pdf_lights;
+  return pdf * pdf_lights;
 }
 
 #endif
@@ -67,6 +67,13 @@ KERNEL_TEX(KernelLight, __lights)
 KERNEL_TEX(float2, __light_background_marginal_cdf)
 KERNEL_TEX(float2, __light_background_conditional_cdf)
 
+/* light tree */
+KERNEL_TEX(KernelLightTreeNode, __light_tree_nodes)
+KERNEL_TEX(KernelLightTreeEmitter, __light_tree_emitters)
+KERNEL_TEX(uint, __light_tree_lamp_map)
+KERNEL_TEX(uint, __light_tree_object_offset)
+KERNEL_TEX(uint, __light_tree_triangle_map)
+
 /* particles */
 KERNEL_TEX(KernelParticle, __particles)
 
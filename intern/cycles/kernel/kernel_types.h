@@ -1290,6 +1290,12 @@ typedef struct KernelIntegrator {
   float pdf_lights;
   float light_inv_rr_threshold;
 
+  /* light tree */
+  int use_light_tree;
+  int num_light_tree_emitters;
+  int num_distant_lights;
+  float light_tree_distant_prob;
+
   /* bounces */
   int min_bounce;
   int max_bounce;
@@ -1516,6 +1522,43 @@ typedef struct KernelLightDistribution {
 } KernelLightDistribution;
 static_assert_align(KernelLightDistribution, 16);
 
+/* Cluster of emitters in the light tree, bounded in space by an axis aligned
+ * box and in orientation by a cone. The left child of an interior node is
+ * stored at the next index in the array, only the right child is explicit. */
+typedef struct KernelLightTreeNode {
+  float bbox_min[3];
+  float bbox_max[3];
+  /* Bounding cone around the emitter orientations. theta_o bounds the spread
+   * of the emitter axes around the cone axis, theta_e the emission angle. */
+  float axis[3];
+  float theta_o;
+  float theta_e;
+  float energy;
+  /* Index of the right child, or -1 for a leaf node. */
+  int right_child;
+  /* Range of emitters for leaf nodes. */
+  int first_emitter;
+  int num_emitters;
+  /* Index of the parent node, or -1 for the root. */
+  int parent;
+} KernelLightTreeNode;
+static_assert_align(KernelLightTreeNode, 16);
+
+/* Marker for lamps and triangles that have no emitter in the light tree. */
+#define LIGHT_TREE_INVALID_EMITTER (~0u)
+
+typedef struct KernelLightTreeEmitter {
+  /* Index into the light distribution array. */
+  int distribution_id;
+  /* Energy estimate used to pick this emitter within its leaf. */
+  float energy;
+  /* Leaf node containing this emitter, or -1 for lights in the distant group
+   * which are sampled separately from the tree. */
+  int parent;
+  int pad1;
+} KernelLightTreeEmitter;
+static_assert_align(KernelLightTreeEmitter, 16);
+
 typedef struct KernelParticle {
   int index;
   float age;
@@ -23,6 +23,8 @@
 #  include <nanovdb/util/SampleFromVoxels.h>
 #endif
 
+#include "kernel/kernels/cpu/kernel_oiio_globals.h"
+
 CCL_NAMESPACE_BEGIN
 
 /* Make template functions private so symbols don't conflict between kernels with different
@@ -584,6 +586,64 @@ template<typename T> struct NanoVDBInterpolator {
 
 #undef SET_CUBIC_SPLINE_WEIGHTS
 
+/* Lookup through the OpenImageIO texture cache, which streams individual tiles
+ * of tiled and mipmapped image files from disk on demand, so the full
+ * resolution pixels never have to reside in memory. */
+ccl_device float4 kernel_tex_image_interp_oiio(KernelGlobals *kg,
+                                               const TextureInfo &info,
+                                               float x,
+                                               float y)
+{
+  if (UNLIKELY(!info.data || !kg->oiio || !kg->oiio->tex_sys)) {
+    return make_float4(
+        TEX_IMAGE_MISSING_R, TEX_IMAGE_MISSING_G, TEX_IMAGE_MISSING_B, TEX_IMAGE_MISSING_A);
+  }
+
+  OIIO::TextureSystem *tex_sys = kg->oiio->tex_sys;
+  OIIO::TextureSystem::TextureHandle *handle = (OIIO::TextureSystem::TextureHandle *)info.data;
+  OIIO::TextureSystem::Perthread *thread_info = (OIIO::TextureSystem::Perthread *)kg->oiio_tdata;
+
+  OIIO::TextureOpt opt;
+  /* Fill missing channels of grayscale and RGB files with a solid alpha. */
+  opt.fill = 1.0f;
+
+  switch (info.interpolation) {
+    case INTERPOLATION_CLOSEST:
+      opt.interpmode = OIIO::TextureOpt::InterpClosest;
+      break;
+    case INTERPOLATION_LINEAR:
+      opt.interpmode = OIIO::TextureOpt::InterpBilinear;
+      break;
+    default:
+      opt.interpmode = OIIO::TextureOpt::InterpSmartBicubic;
+      break;
+  }
+
+  switch (info.extension) {
+    case EXTENSION_REPEAT:
+      opt.swrap = opt.twrap = OIIO::TextureOpt::WrapPeriodic;
+      break;
+    case EXTENSION_EXTEND:
+      opt.swrap = opt.twrap = OIIO::TextureOpt::WrapClamp;
+      break;
+    default:
+      opt.swrap = opt.twrap = OIIO::TextureOpt::WrapBlack;
+      break;
+  }
+
+  /* No ray differentials are available here, so the lookup happens on the
+   * finest mipmap level. Images are stored bottom to top in Cycles, while the
+   * texture cache samples top to bottom. */
+  float result[4];
+  if (!tex_sys->texture(
+          handle, thread_info, opt, x, 1.0f - y, 0.0f, 0.0f, 0.0f, 0.0f, 4, result)) {
+    return make_float4(
+        TEX_IMAGE_MISSING_R, TEX_IMAGE_MISSING_G, TEX_IMAGE_MISSING_B, TEX_IMAGE_MISSING_A);
+  }
+
+  return make_float4(result[0], result[1], result[2], result[3]);
+}
+
 ccl_device float4 kernel_tex_image_interp(KernelGlobals *kg, int id, float x, float y)
 {
   const TextureInfo &info = kernel_tex_fetch(__texture_info, id);
@@ -605,6 +665,8 @@ ccl_device float4 kernel_tex_image_interp(KernelGlobals *kg, int id, float x, fl
       return TextureInterpolator<ushort4>::interp(info, x, y);
     case IMAGE_DATA_TYPE_FLOAT4:
       return TextureInterpolator<float4>::interp(info, x, y);
+    case IMAGE_DATA_TYPE_OIIO:
+      return kernel_tex_image_interp_oiio(kg, info, x, y);
     default:
       assert(0);
       return make_float4(
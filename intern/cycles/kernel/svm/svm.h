@@ -216,27 +216,17 @@ CCL_NAMESPACE_END
 
 CCL_NAMESPACE_BEGIN
 
-/* Main Interpreter Loop */
-#if defined(__KERNEL_OPTIX__) && defined(__SHADER_RAYTRACE__)
-ccl_device_inline void svm_eval_nodes(KernelGlobals *kg,
-                                      ShaderData *sd,
-                                      ccl_addr_space PathState *state,
-                                      ccl_global float *buffer,
-                                      ShaderType type,
-                                      int path_flag)
-{
-  optixDirectCall<void>(0, kg, sd, state, buffer, type, path_flag);
-}
-extern "C" __device__ void __direct_callable__svm_eval_nodes(
-#else
-ccl_device_noinline void svm_eval_nodes(
-#endif
-    KernelGlobals *kg,
-    ShaderData *sd,
-    ccl_addr_space PathState *state,
-    ccl_global float *buffer,
-    ShaderType type,
-    int path_flag)
+/* Main Interpreter Loop
+ *
+ * The shader type is a template parameter, so that every caller gets its own
+ * specialized variant of the interpreter, with branches on the type and node
+ * cases that can not occur for that type eliminated at compile time. */
+template<ShaderType type>
+ccl_device_noinline void svm_eval_nodes_impl(KernelGlobals *kg,
+                                             ShaderData *sd,
+                                             ccl_addr_space PathState *state,
+                                             ccl_global float *buffer,
+                                             int path_flag)
 {
   float stack[SVM_STACK_SIZE];
   int offset = sd->shader & SHADER_MASK;
@@ -562,6 +552,46 @@ ccl_device_noinline void svm_eval_nodes(
   }
 }
 
+#if defined(__KERNEL_OPTIX__) && defined(__SHADER_RAYTRACE__)
+template<ShaderType type>
+ccl_device_inline void svm_eval_nodes(KernelGlobals *kg,
+                                      ShaderData *sd,
+                                      ccl_addr_space PathState *state,
+                                      ccl_global float *buffer,
+                                      int path_flag)
+{
+  optixDirectCall<void>(0, kg, sd, state, buffer, type, path_flag);
+}
+
+extern "C" __device__ void __direct_callable__svm_eval_nodes(KernelGlobals *kg,
+                                                             ShaderData *sd,
+                                                             ccl_addr_space PathState *state,
+                                                             ccl_global float *buffer,
+                                                             ShaderType type,
+                                                             int path_flag)
+{
+  if (type == SHADER_TYPE_SURFACE) {
+    svm_eval_nodes_impl<SHADER_TYPE_SURFACE>(kg, sd, state, buffer, path_flag);
+  }
+  else if (type == SHADER_TYPE_VOLUME) {
+    svm_eval_nodes_impl<SHADER_TYPE_VOLUME>(kg, sd, state, buffer, path_flag);
+  }
+  else {
+    svm_eval_nodes_impl<SHADER_TYPE_DISPLACEMENT>(kg, sd, state, buffer, path_flag);
+  }
+}
+#else
+template<ShaderType type>
+ccl_device_noinline void svm_eval_nodes(KernelGlobals *kg,
+                                        ShaderData *sd,
+                                        ccl_addr_space PathState *state,
+                                        ccl_global float *buffer,
+                                        int path_flag)
+{
+  svm_eval_nodes_impl<type>(kg, sd, state, buffer, path_flag);
+}
+#endif
+
 CCL_NAMESPACE_END
 
 #endif /* __SVM_H__ */
@@ -459,8 +459,6 @@ void AlembicObject::load_data_in_cache(CachedData &cached_data,
     return;
   }
 
-  cached_data.clear();
-
   PolyMeshSchemaData data;
   data.topology_variance = schema.getTopologyVariance();
   data.time_sampling = schema.getTimeSampling();
@@ -500,8 +498,6 @@ void AlembicObject::load_data_in_cache(CachedData &cached_data,
     return;
   }
 
-  cached_data.clear();
-
   if (this->get_ignore_subdivision()) {
     PolyMeshSchemaData data;
     data.topology_variance = schema.getTopologyVariance();
@@ -574,8 +570,6 @@ void AlembicObject::load_data_in_cache(CachedData &cached_data,
     return;
   }
 
-  cached_data.clear();
-
   CurvesSchemaData data;
   data.positions = schema.getPositionsProperty();
   data.position_weights = schema.getPositionWeightsProperty();
@@ -750,6 +744,8 @@ AlembicProcedural::AlembicProcedural() : Procedural(get_node_type())
 
 AlembicProcedural::~AlembicProcedural()
 {
+  join_prefetch_thread();
+
   ccl::set<Geometry *> geometries_set;
   ccl::set<Object *> objects_set;
   ccl::set<AlembicObject *> abc_objects_set;
@@ -784,6 +780,10 @@ void AlembicProcedural::generate(Scene *scene, Progress &progress)
   assert(scene_ == nullptr || scene_ == scene);
   scene_ = scene;
 
+  /* Stop any background loading of upcoming frames, only one thread may touch the caches
+   * at a time. */
+  join_prefetch_thread();
+
   if (frame < start_frame || frame > end_frame) {
     clear_modified();
     return;
@@ -909,6 +909,11 @@ void AlembicProcedural::generate(Scene *scene, Progress &progress)
     object->clear_modified();
   }
 
+  /* Load the data for the upcoming frames in the background while this one renders. */
+  if (use_prefetch && !progress.get_cancel()) {
+    start_prefetch();
+  }
+
   clear_modified();
 }
 
@@ -1357,6 +1362,7 @@ void AlembicProcedural::walk_hierarchy(
 
 void AlembicProcedural::build_caches(Progress &progress)
 {
+  const double frame_d = static_cast<double>(frame);
   size_t memory_used = 0;
 
   for (Node *node : objects) {
@@ -1366,46 +1372,22 @@ void AlembicProcedural::build_caches(Progress &progress)
       return;
     }
 
-    if (object->schema_type == AlembicObject::POLY_MESH) {
-      if (!object->has_data_loaded()) {
-        IPolyMesh polymesh(object->iobject, Alembic::Abc::kWrapExisting);
-        IPolyMeshSchema schema = polymesh.getSchema();
-        object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
-      }
-      else if (object->need_shader_update) {
-        IPolyMesh polymesh(object->iobject, Alembic::Abc::kWrapExisting);
-        IPolyMeshSchema schema = polymesh.getSchema();
-        read_attributes(this,
-                        object->get_cached_data(),
-                        schema,
-                        schema.getUVsParam(),
-                        object->get_requested_attributes(),
-                        progress);
-      }
-    }
-    else if (object->schema_type == AlembicObject::CURVES) {
-      if (!object->has_data_loaded() || default_radius_is_modified() ||
-          object->radius_scale_is_modified()) {
-        ICurves curves(object->iobject, Alembic::Abc::kWrapExisting);
-        ICurvesSchema schema = curves.getSchema();
-        object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
-      }
+    const bool need_radius_update = object->schema_type == AlembicObject::CURVES &&
+                                    (default_radius_is_modified() ||
+                                     object->radius_scale_is_modified());
+
+    if (!object->has_data_loaded() || need_radius_update) {
+      /* Load the current frame only, the prefetch thread takes care of the upcoming ones. */
+      load_object_data(object, frame_d, frame_d, false, progress);
     }
-    else if (object->schema_type == AlembicObject::SUBD) {
-      if (!object->has_data_loaded()) {
-        ISubD subd_mesh(object->iobject, Alembic::Abc::kWrapExisting);
-        ISubDSchema schema = subd_mesh.getSchema();
-        object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+    else {
+      if (frame_d > object->loaded_end_frame) {
+        /* The prefetch thread has not reached this frame yet, catch up. */
+        load_object_data(object, object->loaded_end_frame + 1.0, frame_d, true, progress);
       }
-      else if (object->need_shader_update) {
-        ISubD subd_mesh(object->iobject, Alembic::Abc::kWrapExisting);
-        ISubDSchema schema = subd_mesh.getSchema();
-        read_attributes(this,
-                        object->get_cached_data(),
-                        schema,
-                        schema.getUVsParam(),
-                        object->get_requested_attributes(),
-                        progress);
+
+      if (object->need_shader_update) {
+        update_attributes(object, progress);
       }
     }
 
@@ -1426,6 +1408,135 @@ void AlembicProcedural::build_caches(Progress &progress)
   VLOG(1) << "AlembicProcedural memory usage : " << string_human_readable_size(memory_used);
 }
 
+void AlembicProcedural::load_object_data(
+    AlembicObject *object, double frame_start, double frame_end, bool extend, Progress &progress)
+{
+  /* Only load data for the original Geometry. */
+  if (object->instance_of) {
+    return;
+  }
+
+  load_start_frame = frame_start;
+  load_end_frame = frame_end;
+  load_extends_cache = extend;
+
+  if (!extend) {
+    object->clear_cache();
+  }
+
+  if (object->schema_type == AlembicObject::POLY_MESH) {
+    IPolyMesh polymesh(object->iobject, Alembic::Abc::kWrapExisting);
+    IPolyMeshSchema schema = polymesh.getSchema();
+    object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+  }
+  else if (object->schema_type == AlembicObject::CURVES) {
+    ICurves curves(object->iobject, Alembic::Abc::kWrapExisting);
+    ICurvesSchema schema = curves.getSchema();
+    object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+  }
+  else if (object->schema_type == AlembicObject::SUBD) {
+    ISubD subd_mesh(object->iobject, Alembic::Abc::kWrapExisting);
+    ISubDSchema schema = subd_mesh.getSchema();
+    object->load_data_in_cache(object->get_cached_data(), this, schema, progress);
+  }
+
+  if (progress.get_cancel()) {
+    return;
+  }
+
+  if (!extend) {
+    object->loaded_start_frame = frame_start;
+  }
+  object->loaded_end_frame = frame_end;
+}
+
+void AlembicProcedural::update_attributes(AlembicObject *object, Progress &progress)
+{
+  /* Re-read the requested attributes over the frame range already present in the cache,
+   * attributes which were read before are deduplicated through the DataStore keys. */
+  load_start_frame = object->loaded_start_frame;
+  load_end_frame = object->loaded_end_frame;
+  load_extends_cache = false;
+
+  if (object->schema_type == AlembicObject::POLY_MESH) {
+    IPolyMesh polymesh(object->iobject, Alembic::Abc::kWrapExisting);
+    IPolyMeshSchema schema = polymesh.getSchema();
+    read_attributes(this,
+                    object->get_cached_data(),
+                    schema,
+                    schema.getUVsParam(),
+                    object->get_requested_attributes(),
+                    progress);
+  }
+  else if (object->schema_type == AlembicObject::SUBD) {
+    ISubD subd_mesh(object->iobject, Alembic::Abc::kWrapExisting);
+    ISubDSchema schema = subd_mesh.getSchema();
+    read_attributes(this,
+                    object->get_cached_data(),
+                    schema,
+                    schema.getUVsParam(),
+                    object->get_requested_attributes(),
+                    progress);
+  }
+}
+
+void AlembicProcedural::prefetch_frame_data()
+{
+  const size_t memory_limit = get_prefetch_cache_size_in_bytes();
+
+  /* This progress is not hooked up to the render, cancellation is instead polled between
+   * the per-frame loads so the caches never hold partially loaded frames. */
+  Progress progress;
+
+  for (double prefetch_frame = static_cast<double>(frame) + 1.0;
+       prefetch_frame <= static_cast<double>(end_frame);
+       prefetch_frame += 1.0) {
+    size_t memory_used = 0;
+
+    foreach (Node *node, objects) {
+      AlembicObject *object = static_cast<AlembicObject *>(node);
+
+      if (prefetch_cancel) {
+        return;
+      }
+
+      if (object->has_data_loaded() && prefetch_frame > object->loaded_end_frame) {
+        load_object_data(object, object->loaded_end_frame + 1.0, prefetch_frame, true, progress);
+      }
+
+      memory_used += object->get_cached_data().memory_used();
+    }
+
+    /* Stay within the memory window, the remaining frames are loaded once the render
+     * catches up with them. */
+    if (memory_used > memory_limit) {
+      return;
+    }
+  }
+}
+
+void AlembicProcedural::start_prefetch()
+{
+  assert(prefetch_thread == nullptr);
+
+  if (frame >= end_frame) {
+    return;
+  }
+
+  prefetch_cancel = false;
+  prefetch_thread = new thread(function_bind(&AlembicProcedural::prefetch_frame_data, this));
+}
+
+void AlembicProcedural::join_prefetch_thread()
+{
+  if (prefetch_thread) {
+    prefetch_cancel = true;
+    prefetch_thread->join();
+    delete prefetch_thread;
+    prefetch_thread = nullptr;
+  }
+}
+
 CCL_NAMESPACE_END
 
 #endif
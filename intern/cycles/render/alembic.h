@@ -20,6 +20,7 @@
 #include "render/attribute.h"
 #include "render/procedural.h"
 #include "util/util_set.h"
+#include "util/util_thread.h"
 #include "util/util_transform.h"
 #include "util/util_vector.h"
 
@@ -440,12 +441,20 @@ class AlembicObject : public Node {
   void clear_cache()
   {
     cached_data_.clear();
+    data_loaded = false;
+    loaded_start_frame = 0.0;
+    loaded_end_frame = -1.0;
   }
 
   Object *object = nullptr;
 
   bool data_loaded = false;
 
+  /* Frame range for which data is present in the cache, used to incrementally
+   * load the animation as the render progresses. */
+  double loaded_start_frame = 0.0;
+  double loaded_end_frame = -1.0;
+
   CachedData cached_data_;
 
   void setup_transform_cache(CachedData &cached_data, float scale);
@@ -458,9 +467,10 @@ class AlembicObject : public Node {
  * Every object desired to be rendered should be passed as an AlembicObject through the objects
  * socket.
  *
- * This procedural will load the data set for the entire animation in memory on the first frame,
- * and directly set the data for the new frames on the created Nodes if needed. This allows for
- * faster updates between frames as it avoids reseeking the data on disk.
+ * This procedural loads the data for the current frame in memory, and directly sets the data for
+ * the new frames on the created Nodes if needed. When prefetching is enabled, the data for the
+ * upcoming frames is loaded in the background while the current frame renders, within the
+ * configured memory limit, so that frame changes do not have to wait on disk reads.
  */
 class AlembicProcedural : public Procedural {
   Alembic::AbcGeom::IArchive archive;
@@ -526,6 +536,25 @@ class AlembicProcedural : public Procedural {
    * Returns a pointer to an existing or a newly created AlembicObject for the given path. */
   AlembicObject *get_or_create_object(const ustring &path);
 
+  /* Frame range to load data for during the current cache update, used by
+   * get_relevant_sample_times() in alembic_read.cpp. */
+  double get_load_start_frame() const
+  {
+    return load_start_frame;
+  }
+
+  double get_load_end_frame() const
+  {
+    return load_end_frame;
+  }
+
+  /* Whether the current cache update appends to already loaded caches, in which case
+   * constant properties should not be loaded again. */
+  bool is_extending_cache() const
+  {
+    return load_extends_cache;
+  }
+
  private:
   /* Add an object to our list of objects, and tag the socket as modified. */
   void add_object(AlembicObject *object);
@@ -556,11 +585,39 @@ class AlembicProcedural : public Procedural {
 
   void build_caches(Progress &progress);
 
+  /* Load the cache data of the object for the given frame range, appending to the already
+   * loaded data when extend is true. */
+  void load_object_data(
+      AlembicObject *object, double frame_start, double frame_end, bool extend, Progress &progress);
+
+  /* Re-read the requested attributes of the object over its loaded frame range, used when
+   * shaders request new attributes after the caches were built. */
+  void update_attributes(AlembicObject *object, Progress &progress);
+
+  /* Background loading of the frames following the current one, so the data is already
+   * decoded in the cache when the render moves on to the next frame. */
+  void prefetch_frame_data();
+
+  void start_prefetch();
+  void join_prefetch_thread();
+
   size_t get_prefetch_cache_size_in_bytes() const
   {
     /* prefetch_cache_size is in megabytes, so convert to bytes. */
     return static_cast<size_t>(prefetch_cache_size) * 1024 * 1024;
   }
+
+  /* Frame range passed to the data reading functions, see get_load_start_frame(). */
+  double load_start_frame = 0.0;
+  double load_end_frame = 0.0;
+  bool load_extends_cache = false;
+
+  /* Thread loading the data for upcoming frames while the current frame renders. Only
+   * this thread and generate() touch the caches, and generate() always joins the thread
+   * before doing so. The cancel flag is only polled between per-frame loads so that the
+   * caches are never left with partially loaded frames. */
+  thread *prefetch_thread = nullptr;
+  bool prefetch_cancel = false;
 };
 
 CCL_NAMESPACE_END
@@ -32,7 +32,7 @@ static float3 make_float3_from_yup(const V3f &v)
   return make_float3(v.x, -v.z, v.y);
 }
 
-/* get the sample times to load data for the given the start and end frame of the procedural */
+/* get the sample times to load data for the frame range requested by the procedural */
 static set<chrono_t> get_relevant_sample_times(AlembicProcedural *proc,
                                                const TimeSampling &time_sampling,
                                                size_t num_samples)
@@ -40,23 +40,15 @@ static set<chrono_t> get_relevant_sample_times(AlembicProcedural *proc,
   set<chrono_t> result;
 
   if (num_samples < 2) {
-    result.insert(0.0);
+    /* Constant data, only load it when the cache is built from scratch. */
+    if (!proc->is_extending_cache()) {
+      result.insert(0.0);
+    }
     return result;
   }
 
-  double start_frame;
-  double end_frame;
-
-  if (proc->get_use_prefetch()) {
-    // load the data for the entire animation
-    start_frame = static_cast<double>(proc->get_start_frame());
-    end_frame = static_cast<double>(proc->get_end_frame());
-  }
-  else {
-    // load the data for the current frame
-    start_frame = static_cast<double>(proc->get_frame());
-    end_frame = start_frame;
-  }
+  const double start_frame = proc->get_load_start_frame();
+  const double end_frame = proc->get_load_end_frame();
 
   const double frame_rate = static_cast<double>(proc->get_frame_rate());
   const double start_time = start_frame / frame_rate;
@@ -126,6 +126,7 @@ RenderTile::RenderTile()
 
   buffers = NULL;
   stealing_state = NO_STEALING;
+  error = -1.0f;
 }
 
 /* Render Buffers */
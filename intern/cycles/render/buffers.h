@@ -149,6 +149,10 @@ class RenderTile {
   typedef enum { NO_STEALING = 0, CAN_BE_STOLEN = 1, WAS_STOLEN = 2 } StealingState;
   StealingState stealing_state;
 
+  /* Fraction of pixels in the tile that adaptive sampling considers not yet
+   * converged, filled in by the device. Negative when there is no estimate. */
+  float error;
+
   RenderBuffers *buffers;
 
   RenderTile();
@@ -1137,10 +1137,12 @@ void GeometryManager::device_update_mesh(
         if (mesh->shader_is_modified() || mesh->smooth_is_modified() ||
             mesh->triangles_is_modified() || copy_all_data) {
           mesh->pack_shaders(scene, &tri_shader[mesh->prim_offset]);
+          dscene->tri_shader.tag_modified_range(mesh->prim_offset, mesh->num_triangles());
         }
 
         if (mesh->verts_is_modified() || copy_all_data) {
           mesh->pack_normals(&vnormal[mesh->vert_offset]);
+          dscene->tri_vnormal.tag_modified_range(mesh->vert_offset, mesh->verts.size());
         }
 
         if (mesh->triangles_is_modified() || mesh->vert_patch_uv_is_modified() || copy_all_data) {
@@ -1150,6 +1152,9 @@ void GeometryManager::device_update_mesh(
                            &tri_patch_uv[mesh->vert_offset],
                            mesh->vert_offset,
                            mesh->prim_offset);
+          dscene->tri_vindex.tag_modified_range(mesh->prim_offset, mesh->num_triangles());
+          dscene->tri_patch.tag_modified_range(mesh->prim_offset, mesh->num_triangles());
+          dscene->tri_patch_uv.tag_modified_range(mesh->vert_offset, mesh->verts.size());
         }
 
         if (progress.get_cancel())
@@ -1192,6 +1197,9 @@ void GeometryManager::device_update_mesh(
                           &curve_keys[hair->curvekey_offset],
                           &curves[hair->prim_offset],
                           hair->curvekey_offset);
+        dscene->curve_keys.tag_modified_range(hair->curvekey_offset,
+                                              hair->get_curve_keys().size());
+        dscene->curves.tag_modified_range(hair->prim_offset, hair->num_curves());
         if (progress.get_cancel())
           return;
       }
@@ -1248,6 +1256,7 @@ void GeometryManager::device_update_mesh(
 void GeometryManager::device_update_bvh(Device *device,
                                         DeviceScene *dscene,
                                         Scene *scene,
+                                        bool can_refit,
                                         Progress &progress)
 {
   /* bvh build */
@@ -1267,8 +1276,33 @@ void GeometryManager::device_update_bvh(Device *device,
 
   VLOG(1) << "Using " << bvh_layout_name(bparams.bvh_layout) << " layout.";
 
-  const bool can_refit = scene->bvh != nullptr &&
-                         (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX);
+  /* Refit the top level BVH instead of rebuilding it when only object transforms
+   * or vertex positions changed. The BVH2 layout additionally requires that no
+   * geometry was modified at all, since the primitive arrays merged from the
+   * per-object BVHs are reused as-is for the refit. */
+  const bool matching_bvh = scene->bvh != nullptr &&
+                            scene->bvh->geometry == scene->geometry &&
+                            scene->bvh->objects == scene->objects;
+  if (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX) {
+    can_refit = can_refit && scene->bvh != nullptr;
+  }
+  else if (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_EMBREE) {
+    can_refit = can_refit && matching_bvh;
+  }
+  else if (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_BVH2) {
+    bool any_geometry_modified = false;
+    foreach (Geometry *geom, scene->geometry) {
+      if (geom->is_modified()) {
+        any_geometry_modified = true;
+        break;
+      }
+    }
+    can_refit = can_refit && matching_bvh && !any_geometry_modified &&
+                !dscene->prim_visibility.is_modified();
+  }
+  else {
+    can_refit = false;
+  }
 
   PackFlags pack_flags = PackFlags::PACK_NONE;
 
@@ -1285,14 +1319,26 @@ void GeometryManager::device_update_bvh(Device *device,
     bvh = scene->bvh = BVH::create(bparams, scene->geometry, scene->objects, device);
   }
 
+  const bool has_bvh2_layout = (bparams.bvh_layout == BVH_LAYOUT_BVH2);
+
+  if (has_bvh2_layout && can_refit) {
+    /* Return the arrays the refit works on to the BVH, their memory was stolen
+     * for the device copy on the previous update. The other arrays are left
+     * alone so they do not have to be copied to the device again. */
+    BVH2 *const bvh2 = static_cast<BVH2 *>(bvh);
+    dscene->bvh_nodes.give_data(bvh2->pack.nodes);
+    dscene->bvh_leaf_nodes.give_data(bvh2->pack.leaf_nodes);
+    dscene->prim_index.give_data(bvh2->pack.prim_index);
+    dscene->prim_object.give_data(bvh2->pack.prim_object);
+    dscene->prim_type.give_data(bvh2->pack.prim_type);
+  }
+
   device->build_bvh(bvh, progress, can_refit);
 
   if (progress.get_cancel()) {
     return;
   }
 
-  const bool has_bvh2_layout = (bparams.bvh_layout == BVH_LAYOUT_BVH2);
-
   PackedBVH pack;
   if (has_bvh2_layout) {
     pack = std::move(static_cast<BVH2 *>(bvh)->pack);
@@ -1702,17 +1748,10 @@ void GeometryManager::device_update_preprocess(Device *device, Scene *scene, Pro
     dscene->attributes_uchar4.tag_modified();
   }
 
-  if (device_update_flags & DEVICE_MESH_DATA_MODIFIED) {
-    /* if anything else than vertices or shaders are modified, we would need to reallocate, so
-     * these are the only arrays that can be updated */
-    dscene->tri_vnormal.tag_modified();
-    dscene->tri_shader.tag_modified();
-  }
-
-  if (device_update_flags & DEVICE_CURVE_DATA_MODIFIED) {
-    dscene->curve_keys.tag_modified();
-    dscene->curves.tag_modified();
-  }
+  /* if anything else than vertices or shaders are modified, we would need to reallocate, so
+   * tri_vnormal, tri_shader, curve_keys and curves are the only arrays that can be updated
+   * in place; the modified ranges for them are tagged per geometry while packing in
+   * device_update_mesh, so that only the slices for modified geometries are copied. */
 
   need_flags_update = false;
 }
@@ -1998,6 +2037,17 @@ void GeometryManager::device_update(Device *device,
    * change. */
   bool need_update_scene_bvh = (scene->bvh == nullptr ||
                                 (update_flags & (TRANSFORM_MODIFIED | VISIBILITY_MODIFIED)) != 0);
+
+  /* Refitting the scene BVH is only possible when the BVH structure of all the
+   * per-object BVHs referenced by it stays in place. This needs to be checked
+   * before building the object BVHs below, which resets the rebuild tags. */
+  bool can_refit_scene_bvh = true;
+  foreach (Geometry *geom, scene->geometry) {
+    if (geom->need_update_rebuild || geom->need_update_bvh_for_offset) {
+      can_refit_scene_bvh = false;
+      break;
+    }
+  }
   {
     scoped_callback_timer timer([scene](double time) {
       if (scene->update_stats) {
@@ -2054,7 +2104,7 @@ void GeometryManager::device_update(Device *device,
         scene->update_stats->geometry.times.add_entry({"device_update (build scene BVH)", time});
       }
     });
-    device_update_bvh(device, dscene, scene, progress);
+    device_update_bvh(device, dscene, scene, can_refit_scene_bvh, progress);
     if (progress.get_cancel()) {
       return;
     }
@@ -32,6 +32,8 @@
 #include "util/util_texture.h"
 #include "util/util_unique_ptr.h"
 
+#include <OpenImageIO/texture.h>
+
 #ifdef WITH_OSL
 #  include <OSL/oslexec.h>
 #endif
@@ -77,6 +79,8 @@ const char *name_from_type(ImageDataType type)
       return "nanovdb_float";
     case IMAGE_DATA_TYPE_NANOVDB_FLOAT3:
       return "nanovdb_float3";
+    case IMAGE_DATA_TYPE_OIIO:
+      return "oiio";
     case IMAGE_DATA_NUM_TYPES:
       assert(!"System enumerator type, should never be used");
       return "";
@@ -300,6 +304,7 @@ ImageManager::ImageManager(const DeviceInfo &info)
 {
   need_update_ = true;
   osl_texture_system = NULL;
+  oiio_texture_system = NULL;
   animation_frame = 0;
 
   /* Set image limits */
@@ -318,6 +323,11 @@ void ImageManager::set_osl_texture_system(void *texture_system)
   osl_texture_system = texture_system;
 }
 
+void ImageManager::set_oiio_texture_system(void *texture_system)
+{
+  oiio_texture_system = texture_system;
+}
+
 bool ImageManager::set_animation_frame_update(int frame)
 {
   if (frame != animation_frame) {
@@ -667,6 +677,41 @@ void ImageManager::device_load_image(Device *device, Scene *scene, int slot, Pro
     img->mem = NULL;
   }
 
+  /* Sample tiled and mipmapped image files directly through the OpenImageIO
+   * texture cache when the device supports it, so the full resolution pixels
+   * never have to be loaded into memory. Files are expected to have been
+   * converted to scene linear .tx files by maketx, like for the OSL texture
+   * cache. */
+  if (oiio_texture_system && !img->builtin && img->metadata.depth <= 1) {
+    const ustring filename = img->loader->osl_filepath();
+    if (!filename.empty() && string_endswith(filename.string(), ".tx")) {
+      OIIO::TextureSystem *const tex_sys = (OIIO::TextureSystem *)oiio_texture_system;
+      OIIO::TextureSystem::TextureHandle *const handle = tex_sys->get_texture_handle(filename);
+      if (handle != NULL && tex_sys->good(handle)) {
+        img->mem_name = string_printf("__tex_image_oiio_%03d", slot);
+        img->mem = new device_texture(device,
+                                      img->mem_name.c_str(),
+                                      slot,
+                                      IMAGE_DATA_TYPE_OIIO,
+                                      img->params.interpolation,
+                                      img->params.extension);
+        img->mem->info.data = (uint64_t)handle;
+        img->mem->info.width = img->metadata.width;
+        img->mem->info.height = img->metadata.height;
+        img->mem->info.depth = 1;
+
+        {
+          thread_scoped_lock device_lock(device_mutex);
+          img->mem->copy_to_device();
+        }
+
+        img->loader->cleanup();
+        img->need_load = false;
+        return;
+      }
+    }
+  }
+
   img->mem = new device_texture(
       device, img->mem_name.c_str(), slot, type, img->params.interpolation, img->params.extension);
   img->mem->info.use_transform_3d = img->metadata.use_transform_3d;
@@ -794,6 +839,13 @@ void ImageManager::device_free_image(Device *, int slot)
 #endif
   }
 
+  if (oiio_texture_system) {
+    ustring filepath = img->loader->osl_filepath();
+    if (!filepath.empty()) {
+      ((OIIO::TextureSystem *)oiio_texture_system)->invalidate(filepath);
+    }
+  }
+
   if (img->mem) {
     thread_scoped_lock device_lock(device_mutex);
     delete img->mem;
@@ -192,6 +192,7 @@ class ImageManager {
   void device_free_builtin(Device *device);
 
   void set_osl_texture_system(void *texture_system);
+  void set_oiio_texture_system(void *texture_system);
   bool set_animation_frame_update(int frame);
 
   void collect_statistics(RenderStats *stats);
@@ -228,6 +229,7 @@ class ImageManager {
 
   vector<Image *> images;
   void *osl_texture_system;
+  void *oiio_texture_system;
 
   int add_image_slot(ImageLoader *loader, const ImageParams &params, const bool builtin);
   void add_image_user(int slot);
@@ -20,6 +20,7 @@
 #include "render/film.h"
 #include "render/graph.h"
 #include "render/integrator.h"
+#include "render/light_tree.h"
 #include "render/mesh.h"
 #include "render/nodes.h"
 #include "render/object.h"
@@ -518,6 +519,15 @@ void LightManager::device_update_distribution(Device *,
 
     /* Map */
     kbackground->map_weight = background_mis ? 1.0f : 0.0f;
+
+    /* Light tree. The branched path integrator restricts the distribution to
+     * triangles or individual lamps when looping over all lights, which does
+     * not map to the tree traversal, so it keeps using the flat CDF. */
+    kintegrator->use_light_tree = 0;
+    if (scene->integrator->get_use_light_tree() &&
+        scene->integrator->get_method() == Integrator::PATH) {
+      device_update_tree(dscene, scene, progress);
+    }
   }
   else {
     dscene->light_distribution.free();
@@ -527,6 +537,7 @@ void LightManager::device_update_distribution(Device *,
     kintegrator->pdf_triangles = 0.0f;
     kintegrator->pdf_lights = 0.0f;
     kintegrator->use_lamp_mis = false;
+    kintegrator->use_light_tree = 0;
 
     kbackground->num_portals = 0;
     kbackground->portal_offset = 0;
@@ -538,6 +549,266 @@ void LightManager::device_update_distribution(Device *,
   }
 }
 
+void LightManager::device_update_tree(DeviceScene *dscene, Scene *scene, Progress &progress)
+{
+  progress.set_status("Updating Lights", "Computing light tree");
+
+  KernelIntegrator *kintegrator = &dscene->data.integrator;
+
+  /* Collect emitters in the same order as the light distribution was built,
+   * so that the distribution ids of both agree. Distant and background lights
+   * have no meaningful bounds and are kept in a separate group that is
+   * sampled by energy, while all other emitters go into the tree. */
+  vector<LightTreePrimitive> prims;
+  vector<LightTreePrimitive> distant_prims;
+
+  uint *object_offset = dscene->light_tree_object_offset.alloc(scene->objects.size());
+
+  int offset = 0;
+  size_t num_triangle_slots = 0;
+  int j = 0;
+
+  foreach (Object *object, scene->objects) {
+    if (progress.get_cancel())
+      return;
+
+    object_offset[j] = 0;
+
+    if (!object_usable_as_light(object)) {
+      j++;
+      continue;
+    }
+
+    Mesh *mesh = static_cast<Mesh *>(object->get_geometry());
+    bool transform_applied = mesh->transform_applied;
+    Transform tfm = object->get_tfm();
+
+    /* The kernel indexes triangles by their global primitive id, offset so
+     * that the additions below wrap to the right slot. */
+    object_offset[j] = (uint)num_triangle_slots - (uint)mesh->prim_offset;
+
+    size_t mesh_num_triangles = mesh->num_triangles();
+    for (size_t i = 0; i < mesh_num_triangles; i++) {
+      int shader_index = mesh->get_shader()[i];
+      Shader *shader = (shader_index < mesh->get_used_shaders().size()) ?
+                           static_cast<Shader *>(mesh->get_used_shaders()[shader_index]) :
+                           scene->default_surface;
+
+      if (shader->get_use_mis() && shader->has_surface_emission) {
+        const int distribution_id = offset;
+        offset++;
+
+        Mesh::Triangle t = mesh->get_triangle(i);
+        if (!t.valid(&mesh->get_verts()[0])) {
+          continue;
+        }
+        float3 p1 = mesh->get_verts()[t.v[0]];
+        float3 p2 = mesh->get_verts()[t.v[1]];
+        float3 p3 = mesh->get_verts()[t.v[2]];
+
+        if (!transform_applied) {
+          p1 = transform_point(&tfm, p1);
+          p2 = transform_point(&tfm, p2);
+          p3 = transform_point(&tfm, p3);
+        }
+
+        const float area = triangle_area(p1, p2, p3);
+        if (!(area > 0.0f)) {
+          continue;
+        }
+
+        LightTreePrimitive prim;
+        prim.bbox.grow(p1);
+        prim.bbox.grow(p2);
+        prim.bbox.grow(p3);
+        prim.centroid = (p1 + p2 + p3) * (1.0f / 3.0f);
+        /* Mesh lights emit from both sides, so the cone covers all normals. */
+        prim.axis = safe_normalize(cross(p2 - p1, p3 - p1));
+        if (is_zero(prim.axis)) {
+          prim.axis = make_float3(0.0f, 0.0f, 1.0f);
+        }
+        prim.theta_o = M_PI_F;
+        prim.theta_e = M_PI_2_F;
+        /* Without evaluating the shader, the emitting area is the best
+         * available estimate of the triangle energy. */
+        prim.energy = area;
+        prim.distribution_id = distribution_id;
+        prims.push_back(prim);
+      }
+    }
+
+    num_triangle_slots += mesh_num_triangles;
+    j++;
+  }
+
+  foreach (Light *light, scene->lights) {
+    if (!light->is_enabled)
+      continue;
+
+    const int distribution_id = offset;
+    offset++;
+
+    const float3 strength = light->strength;
+    float energy = (fabsf(strength.x) + fabsf(strength.y) + fabsf(strength.z)) / 3.0f;
+
+    if (light->light_type == LIGHT_DISTANT || light->light_type == LIGHT_BACKGROUND) {
+      LightTreePrimitive prim;
+      prim.energy = (light->light_type == LIGHT_BACKGROUND) ? 1.0f : max(energy, 1e-8f);
+      prim.distribution_id = distribution_id;
+      distant_prims.push_back(prim);
+      continue;
+    }
+
+    LightTreePrimitive prim;
+    prim.centroid = light->co;
+    prim.energy = max(energy, 1e-8f);
+    prim.distribution_id = distribution_id;
+
+    if (light->light_type == LIGHT_AREA) {
+      const float3 axisu = light->axisu * (light->sizeu * light->size);
+      const float3 axisv = light->axisv * (light->sizev * light->size);
+      prim.bbox.grow(light->co + (axisu + axisv) * 0.5f);
+      prim.bbox.grow(light->co + (axisu - axisv) * 0.5f);
+      prim.bbox.grow(light->co - (axisu - axisv) * 0.5f);
+      prim.bbox.grow(light->co - (axisu + axisv) * 0.5f);
+      prim.axis = safe_normalize(light->dir);
+      prim.theta_o = 0.0f;
+      prim.theta_e = M_PI_2_F;
+    }
+    else {
+      /* point and spot lights */
+      const float radius = light->size;
+      prim.bbox.grow(light->co - make_float3(radius, radius, radius));
+      prim.bbox.grow(light->co + make_float3(radius, radius, radius));
+
+      if (light->light_type == LIGHT_SPOT) {
+        prim.axis = safe_normalize(light->dir);
+        prim.theta_o = 0.0f;
+        prim.theta_e = light->spot_angle * 0.5f;
+      }
+      else {
+        prim.theta_o = M_PI_F;
+        prim.theta_e = M_PI_2_F;
+      }
+    }
+
+    prims.push_back(prim);
+  }
+
+  /* Probability of picking the distant group rather than the tree, set to the
+   * fraction of the total energy the distant lights contribute. */
+  float tree_energy = 0.0f;
+  foreach (const LightTreePrimitive &prim, prims) {
+    tree_energy += prim.energy;
+  }
+  float distant_energy = 0.0f;
+  foreach (const LightTreePrimitive &prim, distant_prims) {
+    distant_energy += prim.energy;
+  }
+
+  float distant_prob = 0.0f;
+  if (prims.empty()) {
+    distant_prob = 1.0f;
+  }
+  else if (distant_energy > 0.0f) {
+    distant_prob = distant_energy / (distant_energy + tree_energy);
+  }
+
+  const size_t num_tree_emitters = prims.size();
+
+  LightTree tree(prims, LIGHT_TREE_MAX_LEAF_SIZE);
+
+  const vector<KernelLightTreeNode> &nodes = tree.get_nodes();
+  const vector<LightTreePrimitive> &ordered_prims = tree.get_prims();
+
+  if (!nodes.empty()) {
+    KernelLightTreeNode *knodes = dscene->light_tree_nodes.alloc(nodes.size());
+    memcpy(knodes, nodes.data(), nodes.size() * sizeof(KernelLightTreeNode));
+  }
+
+  KernelLightTreeEmitter *kemitters = dscene->light_tree_emitters.alloc(num_tree_emitters +
+                                                                        distant_prims.size());
+
+  for (size_t i = 0; i < num_tree_emitters; i++) {
+    kemitters[i].distribution_id = ordered_prims[i].distribution_id;
+    kemitters[i].energy = ordered_prims[i].energy;
+    kemitters[i].parent = -1;
+    kemitters[i].pad1 = 0;
+  }
+  for (size_t i = 0; i < distant_prims.size(); i++) {
+    KernelLightTreeEmitter &kemitter = kemitters[num_tree_emitters + i];
+    kemitter.distribution_id = distant_prims[i].distribution_id;
+    kemitter.energy = distant_prims[i].energy;
+    kemitter.parent = -1;
+    kemitter.pad1 = 0;
+  }
+
+  /* Point the tree emitters back at the leaf containing them, for the pdf
+   * computation on MIS hits. */
+  for (size_t i = 0; i < nodes.size(); i++) {
+    const KernelLightTreeNode &knode = nodes[i];
+    if (knode.right_child == -1) {
+      for (int k = 0; k < knode.num_emitters; k++) {
+        kemitters[knode.first_emitter + k].parent = (int)i;
+      }
+    }
+  }
+
+  /* Lookup tables from device lamp and triangle indices to emitter slots,
+   * again for the pdf computation on MIS hits. Entries that have no emitter
+   * remain at the invalid marker. */
+  uint *lamp_map = dscene->light_tree_lamp_map.alloc(dscene->lights.size());
+  for (size_t i = 0; i < dscene->lights.size(); i++) {
+    lamp_map[i] = LIGHT_TREE_INVALID_EMITTER;
+  }
+
+  uint *triangle_map = NULL;
+  if (num_triangle_slots > 0) {
+    triangle_map = dscene->light_tree_triangle_map.alloc(num_triangle_slots);
+    for (size_t i = 0; i < num_triangle_slots; i++) {
+      triangle_map[i] = LIGHT_TREE_INVALID_EMITTER;
+    }
+  }
+
+  const KernelLightDistribution *distribution = dscene->light_distribution.data();
+  const size_t num_emitters = num_tree_emitters + distant_prims.size();
+
+  for (size_t i = 0; i < num_emitters; i++) {
+    const KernelLightDistribution &kdist = distribution[kemitters[i].distribution_id];
+    if (kdist.prim >= 0) {
+      triangle_map[object_offset[kdist.mesh_light.object_id] + (uint)kdist.prim] = i;
+    }
+    else {
+      lamp_map[~kdist.prim] = i;
+    }
+  }
+
+  if (progress.get_cancel())
+    return;
+
+  if (!nodes.empty()) {
+    dscene->light_tree_nodes.copy_to_device();
+  }
+  if (num_emitters > 0) {
+    dscene->light_tree_emitters.copy_to_device();
+  }
+  if (dscene->lights.size() > 0) {
+    dscene->light_tree_lamp_map.copy_to_device();
+  }
+  if (num_triangle_slots > 0) {
+    dscene->light_tree_object_offset.copy_to_device();
+    dscene->light_tree_triangle_map.copy_to_device();
+  }
+
+  VLOG(1) << "Use light tree with " << num_tree_emitters << " emitters, " << nodes.size()
+          << " nodes and " << distant_prims.size() << " distant lights.";
+
+  kintegrator->use_light_tree = 1;
+  kintegrator->num_light_tree_emitters = num_tree_emitters;
+  kintegrator->num_distant_lights = distant_prims.size();
+  kintegrator->light_tree_distant_prob = distant_prob;
+}
+
 static void background_cdf(
     int start, int end, int res_x, int res_y, const vector<float3> *pixels, float2 *cond_cdf)
 {
@@ -1028,6 +1299,11 @@ void LightManager::device_free(Device *, DeviceScene *dscene, const bool free_ba
 {
   dscene->light_distribution.free();
   dscene->lights.free();
+  dscene->light_tree_nodes.free();
+  dscene->light_tree_emitters.free();
+  dscene->light_tree_lamp_map.free();
+  dscene->light_tree_object_offset.free();
+  dscene->light_tree_triangle_map.free();
   if (free_background) {
     dscene->light_background_marginal_cdf.free();
     dscene->light_background_conditional_cdf.free();
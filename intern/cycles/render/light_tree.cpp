@@ -0,0 +1,266 @@
+/*
+ * Copyright 2011-2021 Blender Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "render/light_tree.h"
+
+#include "util/util_algorithm.h"
+
+CCL_NAMESPACE_BEGIN
+
+/* Merge orientation cone b into cone a, so that a bounds the emitter
+ * orientations of both. Algorithm 1 from "Importance Sampling of Many Lights
+ * with Adaptive Tree Splitting". */
+static void light_tree_cone_merge(
+    float3 &axis_a, float &theta_oa, float &theta_ea, float3 axis_b, float theta_ob, float theta_eb)
+{
+  /* guarantee that a is the cone with the larger orientation spread */
+  if (theta_ob > theta_oa) {
+    swap(axis_a, axis_b);
+    swap(theta_oa, theta_ob);
+  }
+
+  const float theta_d = safe_acosf(dot(axis_a, axis_b));
+  theta_ea = max(theta_ea, theta_eb);
+
+  /* cone a already bounds cone b */
+  if (min(theta_d + theta_ob, M_PI_F) <= theta_oa) {
+    return;
+  }
+
+  const float theta_o = (theta_oa + theta_d + theta_ob) * 0.5f;
+  if (theta_o >= M_PI_F) {
+    theta_oa = M_PI_F;
+    return;
+  }
+
+  /* rotate a's axis towards b's axis, to the center of the merged cone */
+  const float theta_r = theta_o - theta_oa;
+  float len;
+  const float3 ortho = safe_normalize_len(axis_b - dot(axis_a, axis_b) * axis_a, &len);
+  if (len > 0.0f) {
+    axis_a = cosf(theta_r) * axis_a + sinf(theta_r) * ortho;
+  }
+  theta_oa = theta_o;
+}
+
+/* Measure of the solid angles subtended by the cluster orientation cone,
+ * equation 1 from the paper. */
+static float light_tree_cone_measure(float theta_o, float theta_e)
+{
+  const float theta_w = min(theta_o + theta_e, M_PI_F);
+  const float sin_o = sinf(theta_o);
+  const float cos_o = cosf(theta_o);
+
+  return M_2PI_F * (1.0f - cos_o) +
+         M_PI_2_F * (2.0f * theta_w * sin_o - cosf(theta_o - 2.0f * theta_w) -
+                     2.0f * theta_o * sin_o + cos_o);
+}
+
+struct LightTreeBucket {
+  BoundBox bbox;
+  float3 axis;
+  float theta_o, theta_e;
+  float energy;
+  int count;
+
+  LightTreeBucket()
+      : bbox(BoundBox::empty),
+        axis(make_float3(0.0f, 0.0f, 1.0f)),
+        theta_o(0.0f),
+        theta_e(0.0f),
+        energy(0.0f),
+        count(0)
+  {
+  }
+};
+
+static void light_tree_bucket_merge(LightTreeBucket &a, const LightTreeBucket &b)
+{
+  if (b.count == 0) {
+    return;
+  }
+  else if (a.count == 0) {
+    a = b;
+    return;
+  }
+
+  a.bbox.grow(b.bbox);
+  light_tree_cone_merge(a.axis, a.theta_o, a.theta_e, b.axis, b.theta_o, b.theta_e);
+  a.energy += b.energy;
+  a.count += b.count;
+}
+
+LightTree::LightTree(vector<LightTreePrimitive> &prims, int max_lights_in_leaf)
+    : max_lights_in_leaf_(max_lights_in_leaf)
+{
+  prims_.swap(prims);
+
+  if (prims_.empty()) {
+    return;
+  }
+
+  nodes_.reserve(2 * prims_.size());
+  recursive_build(0, prims_.size(), -1);
+}
+
+bool LightTree::split_saoh(
+    int first, int last, const BoundBox &bbox, int *split_dim, float *split_pos)
+{
+  /* Find the lowest cost split plane according to the surface area orientation
+   * heuristic, testing bucketed centroid positions along all three axes. */
+  const int num_buckets = 12;
+  const float3 extent = bbox.size();
+
+  bool found = false;
+  float min_cost = FLT_MAX;
+
+  for (int dim = 0; dim < 3; dim++) {
+    if (!(extent[dim] > 0.0f)) {
+      continue;
+    }
+
+    const float inv_extent = num_buckets / extent[dim];
+    LightTreeBucket buckets[num_buckets];
+
+    for (int i = first; i < last; i++) {
+      const LightTreePrimitive &prim = prims_[i];
+      const int b = min((int)((prim.centroid[dim] - bbox.min[dim]) * inv_extent), num_buckets - 1);
+      LightTreeBucket &bucket = buckets[b];
+
+      bucket.bbox.grow(prim.bbox);
+      if (bucket.count == 0) {
+        bucket.axis = prim.axis;
+        bucket.theta_o = prim.theta_o;
+        bucket.theta_e = prim.theta_e;
+      }
+      else {
+        light_tree_cone_merge(
+            bucket.axis, bucket.theta_o, bucket.theta_e, prim.axis, prim.theta_o, prim.theta_e);
+      }
+      bucket.energy += prim.energy;
+      bucket.count++;
+    }
+
+    for (int i = 0; i < num_buckets - 1; i++) {
+      LightTreeBucket left, right;
+
+      for (int j = 0; j <= i; j++) {
+        light_tree_bucket_merge(left, buckets[j]);
+      }
+      for (int j = i + 1; j < num_buckets; j++) {
+        light_tree_bucket_merge(right, buckets[j]);
+      }
+
+      if (left.count == 0 || right.count == 0) {
+        continue;
+      }
+
+      const float cost = left.energy * left.bbox.area() *
+                             light_tree_cone_measure(left.theta_o, left.theta_e) +
+                         right.energy * right.bbox.area() *
+                             light_tree_cone_measure(right.theta_o, right.theta_e);
+
+      if (cost < min_cost) {
+        min_cost = cost;
+        *split_dim = dim;
+        *split_pos = bbox.min[dim] + (i + 1) * extent[dim] / num_buckets;
+        found = true;
+      }
+    }
+  }
+
+  return found;
+}
+
+int LightTree::recursive_build(int first, int last, int parent)
+{
+  /* compute the cluster bounds */
+  BoundBox bbox = BoundBox::empty;
+  float3 axis = prims_[first].axis;
+  float theta_o = prims_[first].theta_o;
+  float theta_e = prims_[first].theta_e;
+  float energy = 0.0f;
+
+  for (int i = first; i < last; i++) {
+    const LightTreePrimitive &prim = prims_[i];
+    bbox.grow(prim.bbox);
+    energy += prim.energy;
+    if (i > first) {
+      light_tree_cone_merge(axis, theta_o, theta_e, prim.axis, prim.theta_o, prim.theta_e);
+    }
+  }
+
+  const int node_index = (int)nodes_.size();
+  nodes_.push_back(KernelLightTreeNode());
+
+  const int num_prims = last - first;
+  int right_child = -1;
+  int first_emitter = -1;
+  int num_emitters = 0;
+
+  if (num_prims <= max_lights_in_leaf_) {
+    /* leaf node, primitives are stored contiguously after partitioning */
+    first_emitter = first;
+    num_emitters = num_prims;
+  }
+  else {
+    int split_dim = 0;
+    float split_pos = 0.0f;
+    int mid = first;
+
+    if (split_saoh(first, last, bbox, &split_dim, &split_pos)) {
+      for (int i = first; i < last; i++) {
+        if (prims_[i].centroid[split_dim] < split_pos) {
+          swap(prims_[i], prims_[mid]);
+          mid++;
+        }
+      }
+    }
+
+    /* fall back to an even split when the heuristic failed to separate the
+     * primitives, which happens when all centroids coincide */
+    if (mid == first || mid == last) {
+      mid = first + num_prims / 2;
+    }
+
+    /* the left child immediately follows the node itself */
+    recursive_build(first, mid, node_index);
+    right_child = recursive_build(mid, last, node_index);
+  }
+
+  /* fill in after recursion, as building the children may reallocate nodes_ */
+  KernelLightTreeNode &node = nodes_[node_index];
+  node.bbox_min[0] = bbox.min.x;
+  node.bbox_min[1] = bbox.min.y;
+  node.bbox_min[2] = bbox.min.z;
+  node.bbox_max[0] = bbox.max.x;
+  node.bbox_max[1] = bbox.max.y;
+  node.bbox_max[2] = bbox.max.z;
+  node.axis[0] = axis.x;
+  node.axis[1] = axis.y;
+  node.axis[2] = axis.z;
+  node.theta_o = theta_o;
+  node.theta_e = theta_e;
+  node.energy = energy;
+  node.right_child = right_child;
+  node.first_emitter = first_emitter;
+  node.num_emitters = num_emitters;
+  node.parent = parent;
+
+  return node_index;
+}
+
+CCL_NAMESPACE_END
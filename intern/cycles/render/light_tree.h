@@ -0,0 +1,90 @@
+/*
+ * Copyright 2011-2021 Blender Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LIGHT_TREE_H__
+#define __LIGHT_TREE_H__
+
+#include "kernel/kernel_types.h"
+
+#include "util/util_boundbox.h"
+#include "util/util_types.h"
+#include "util/util_vector.h"
+
+CCL_NAMESPACE_BEGIN
+
+/* Maximum number of emitters stored in a single leaf node. */
+#define LIGHT_TREE_MAX_LEAF_SIZE 8
+
+/* Single emitter to be clustered in the light tree, either an emissive
+ * triangle or a lamp. Bounded in space by a bounding box and in orientation
+ * by a cone, following "Importance Sampling of Many Lights with Adaptive Tree
+ * Splitting" by Estevez and Kulla. */
+class LightTreePrimitive {
+ public:
+  BoundBox bbox;
+  float3 centroid;
+  /* Orientation cone axis and angles. theta_o bounds the emitter normals
+   * around the axis, theta_e the emission angle around a normal. */
+  float3 axis;
+  float theta_o;
+  float theta_e;
+  /* Energy estimate used as the clustering and sampling weight. */
+  float energy;
+  /* Index of the corresponding entry in the light distribution. */
+  int distribution_id;
+
+  LightTreePrimitive()
+      : bbox(BoundBox::empty),
+        centroid(zero_float3()),
+        axis(make_float3(0.0f, 0.0f, 1.0f)),
+        theta_o(0.0f),
+        theta_e(M_PI_2_F),
+        energy(0.0f),
+        distribution_id(-1)
+  {
+  }
+};
+
+/* Binary light tree built over the primitives with a surface area orientation
+ * heuristic. Nodes are built directly in the kernel layout, with the emitters
+ * of each leaf stored contiguously in the reordered primitive array. */
+class LightTree {
+ public:
+  LightTree(vector<LightTreePrimitive> &prims, int max_lights_in_leaf);
+
+  const vector<KernelLightTreeNode> &get_nodes() const
+  {
+    return nodes_;
+  }
+
+  /* Primitives reordered so that leaf emitters are contiguous. */
+  const vector<LightTreePrimitive> &get_prims() const
+  {
+    return prims_;
+  }
+
+ protected:
+  int recursive_build(int first, int last, int parent);
+  bool split_saoh(int first, int last, const BoundBox &bbox, int *split_dim, float *split_pos);
+
+  vector<LightTreePrimitive> prims_;
+  vector<KernelLightTreeNode> nodes_;
+  int max_lights_in_leaf_;
+};
+
+CCL_NAMESPACE_END
+
+#endif /* __LIGHT_TREE_H__ */
@@ -19,6 +19,7 @@
 
 #include "device/device.h"
 
+#include "render/camera.h"
 #include "render/graph.h"
 #include "render/hair.h"
 #include "render/mesh.h"
@@ -176,10 +177,76 @@ SubdParams *Mesh::get_subd_params()
   return subd_params;
 }
 
+/* Conservative estimate of the relative change in screen-space dicing rates
+ * between two object transforms, as seen from the dicing camera. */
+static float subd_dicing_rate_change(const Transform &old_tfm,
+                                     const Transform &new_tfm,
+                                     const Camera *camera,
+                                     const BoundBox &bounds)
+{
+  /* A change of the world-space scale of the transform changes the length of
+   * diced edges proportionally. */
+  float change = 0.0f;
+
+  for (int i = 0; i < 3; i++) {
+    const float len_old = len(transform_get_column(&old_tfm, i));
+    const float len_new = len(transform_get_column(&new_tfm, i));
+
+    if (len_old == 0.0f || len_new == 0.0f) {
+      return FLT_MAX;
+    }
+
+    change = max(change, fabsf(len_new / len_old - 1.0f));
+  }
+
+  /* For perspective cameras the rates additionally scale with the distance
+   * from the camera, estimated at the center of the bounds. */
+  if (camera->get_camera_type() == CAMERA_PERSPECTIVE) {
+    const float3 cam_P = transform_get_column(&camera->get_matrix(), 3);
+    const float3 center = bounds.center();
+    const float dist_old = len(transform_point(&old_tfm, center) - cam_P);
+    const float dist_new = len(transform_point(&new_tfm, center) - cam_P);
+
+    if (dist_old < 1e-4f || dist_new < 1e-4f) {
+      return FLT_MAX;
+    }
+
+    change += fabsf(dist_old / dist_new - 1.0f);
+  }
+
+  return change;
+}
+
 bool Mesh::need_tesselation()
 {
-  return get_subd_params() && (verts_is_modified() || subd_dicing_rate_is_modified() ||
-                               subd_objecttoworld_is_modified() || subd_max_level_is_modified());
+  if (!get_subd_params()) {
+    return false;
+  }
+
+  if (verts_is_modified() || subd_dicing_rate_is_modified() || subd_max_level_is_modified()) {
+    return true;
+  }
+
+  if (subd_objecttoworld_is_modified()) {
+    /* A transform change affects the tessellation only through the screen
+     * space dicing rates, and those are conservative estimates to begin with.
+     * Keep the existing tessellation as long as the rates stay within a few
+     * percent of the ones the mesh was last diced with, so that small
+     * per-frame transform changes do not force a full re-dice of heavy
+     * displaced geometry. The difference is accumulated against the transform
+     * actually used for dicing, so a slow drift still re-dices eventually. */
+    if (subd_tessellated && subd_params->camera && bounds.valid()) {
+      const float change = subd_dicing_rate_change(
+          subd_tessellated_objecttoworld, get_subd_objecttoworld(), subd_params->camera, bounds);
+      if (change < 0.05f) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  return false;
 }
 
 Mesh::Mesh(const NodeType *node_type, Type geom_type_)
@@ -284,6 +351,8 @@ void Mesh::clear_non_sockets()
   num_subd_verts = 0;
   num_subd_faces = 0;
 
+  subd_tessellated = false;
+
   vert_to_stitching_key_map.clear();
   vert_stitching_map.clear();
 
@@ -194,6 +194,11 @@ class Mesh : public Geometry {
 
   SubdParams *subd_params = nullptr;
 
+  /* Dicing state at the time of the last tessellation, used to avoid re-dicing
+   * when a transform change barely affects the screen-space dicing rates. */
+  bool subd_tessellated = false;
+  Transform subd_tessellated_objecttoworld;
+
  public:
   /* Functions */
   Mesh();
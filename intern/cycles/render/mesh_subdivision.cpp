@@ -375,6 +375,13 @@ void Mesh::tessellate(DiagSplit *split)
    * between calls or data updates */
   num_subd_verts = 0;
 
+  /* remember the dicing state, so need_tesselation() can detect when a later
+   * transform change has little effect on the dicing rates */
+  if (subd_params) {
+    subd_tessellated = true;
+    subd_tessellated_objecttoworld = subd_params->objecttoworld;
+  }
+
 #ifdef WITH_OPENSUBDIV
   OsdData osd_data;
   bool need_packed_patch_table = false;
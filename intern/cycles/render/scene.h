@@ -117,6 +117,13 @@ class DeviceScene {
   device_vector<float2> light_background_marginal_cdf;
   device_vector<float2> light_background_conditional_cdf;
 
+  /* light tree */
+  device_vector<KernelLightTreeNode> light_tree_nodes;
+  device_vector<KernelLightTreeEmitter> light_tree_emitters;
+  device_vector<uint> light_tree_lamp_map;
+  device_vector<uint> light_tree_object_offset;
+  device_vector<uint> light_tree_triangle_map;
+
   /* particles */
   device_vector<KernelParticle> particles;
 
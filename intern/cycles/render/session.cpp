@@ -578,6 +578,25 @@ void Session::release_tile(RenderTile &rtile, const bool need_denoise)
 
   progress.add_finished_tile(rtile.task == RenderTile::DENOISE);
 
+  /* Let the tile manager know how noisy the tile still is, so that it can
+   * prioritize tiles on the next progressive pass. */
+  if (rtile.task == RenderTile::PATH_TRACE && rtile.error >= 0.0f) {
+    tile_manager.set_tile_error(rtile.tile_index, rtile.error);
+  }
+
+  /* Accumulate per-device throughput statistics, to split work among
+   * heterogeneous devices proportionally on the next reset. */
+  if (rtile.task == RenderTile::PATH_TRACE && rtile.buffers && rtile.buffers->render_time > 0.0) {
+    const int tile_device = tile_manager.state.tiles[rtile.tile_index].device;
+    if ((size_t)tile_device >= device_render_time_.size()) {
+      device_render_time_.resize(tile_device + 1, 0.0);
+      device_pixel_samples_.resize(tile_device + 1, 0.0);
+    }
+    device_render_time_[tile_device] += rtile.buffers->render_time;
+    device_pixel_samples_[tile_device] += (double)rtile.w * (double)rtile.h *
+                                          (double)(rtile.sample - rtile.start_sample);
+  }
+
   bool delete_tile;
 
   if (tile_manager.finish_tile(rtile.tile_index, need_denoise, delete_tile)) {
@@ -887,6 +906,26 @@ void Session::reset_(BufferParams &buffer_params, int samples)
     }
   }
 
+  /* Once every device has finished some tiles, split the work proportionally to
+   * the measured throughput, so that slower devices of a heterogeneous set get
+   * smaller shares and all devices finish at roughly the same time. */
+  if (device_render_time_.size() > 1) {
+    vector<double> weights(device_render_time_.size());
+    bool valid = true;
+    for (size_t i = 0; i < weights.size(); i++) {
+      if (device_render_time_[i] > 0.0 && device_pixel_samples_[i] > 0.0) {
+        weights[i] = device_pixel_samples_[i] / device_render_time_[i];
+      }
+      else {
+        valid = false;
+        break;
+      }
+    }
+    if (valid) {
+      tile_manager.set_device_weights(weights);
+    }
+  }
+
   tile_manager.reset(buffer_params, samples);
   stealable_tiles_ = 0;
   tile_stealing_state_ = NOT_STEALING;
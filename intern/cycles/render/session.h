@@ -233,6 +233,11 @@ class Session {
   double last_update_time_;
   double last_display_time_;
 
+  /* Per-device throughput statistics, accumulated from finished tiles and used
+   * to split the work among heterogeneous devices proportionally on reset. */
+  vector<double> device_render_time_;
+  vector<double> device_pixel_samples_;
+
   RenderTile stolen_tile_;
   typedef enum {
     NOT_STEALING,     /* There currently is no tile stealing in progress. */
@@ -59,6 +59,26 @@ class TileComparator {
   Tile *tiles;
 };
 
+/* Orders tiles by decreasing remaining adaptive sampling error, so that the
+ * noisiest tiles are dispatched first. Tiles without an error estimate yet are
+ * treated as maximally noisy. */
+class TileErrorComparator {
+ public:
+  explicit TileErrorComparator(Tile *tiles_) : tiles(tiles_)
+  {
+  }
+
+  bool operator()(int a, int b)
+  {
+    float error_a = (tiles[a].error < 0.0f) ? 1.0f : tiles[a].error;
+    float error_b = (tiles[b].error < 0.0f) ? 1.0f : tiles[b].error;
+    return error_a > error_b;
+  }
+
+ protected:
+  Tile *tiles;
+};
+
 inline int2 hilbert_index_to_pos(int n, int d)
 {
   int2 r, xy = make_int2(0, 0);
@@ -224,7 +244,7 @@ int TileManager::gen_tiles(bool sliced)
     /* Size of blocks in tiles, must be a power of 2 */
     const int hilbert_size = (max(tile_size.x, tile_size.y) <= 12) ? 8 : 4;
 
-    int tiles_per_device = divide_up(tile_w * tile_h, num);
+    const vector<int> tiles_for_device = divide_among_devices(tile_w * tile_h, num);
     int cur_device = 0, cur_tiles = 0;
 
     int2 block_size = tile_size * make_int2(hilbert_size, hilbert_size);
@@ -264,15 +284,16 @@ int TileManager::gen_tiles(bool sliced)
           int h = min(tile_size.y, image_h - pos.y);
           int2 ipos = pos / tile_size;
           int idx = ipos.y * tile_w + ipos.x;
-          state.tiles[idx] = Tile(idx, pos.x, pos.y, w, h, cur_device, Tile::RENDER);
-          tile_list->push_front(idx);
-          cur_tiles++;
 
-          if (cur_tiles == tiles_per_device) {
+          while (cur_device < num - 1 && cur_tiles == tiles_for_device[cur_device]) {
             tile_list++;
             cur_tiles = 0;
             cur_device++;
           }
+
+          state.tiles[idx] = Tile(idx, pos.x, pos.y, w, h, cur_device, Tile::RENDER);
+          tile_list->push_front(idx);
+          cur_tiles++;
         }
       }
 
@@ -313,11 +334,16 @@ int TileManager::gen_tiles(bool sliced)
     return tile_w * tile_h;
   }
 
+  /* Slice heights are weighted by the measured device throughput, so a faster device
+   * gets a larger part of the image in sliced viewport rendering. */
+  const vector<int> slice_heights = divide_among_devices(image_h, slice_num);
+
   int idx = 0;
+  int next_slice_y = 0;
   for (int slice = 0; slice < slice_num; slice++) {
-    int slice_y = (image_h / slice_num) * slice;
-    int slice_h = (slice == slice_num - 1) ? image_h - slice * (image_h / slice_num) :
-                                             image_h / slice_num;
+    int slice_y = next_slice_y;
+    int slice_h = slice_heights[slice];
+    next_slice_y += slice_h;
 
     if (slice_overlap != 0) {
       int slice_y_offset = max(slice_y - slice_overlap, 0);
@@ -327,7 +353,7 @@ int TileManager::gen_tiles(bool sliced)
 
     int tile_h = (tile_size.y >= slice_h) ? 1 : divide_up(slice_h, tile_size.y);
 
-    int tiles_per_device = divide_up(tile_w * tile_h, num);
+    const vector<int> tiles_for_device = divide_among_devices(tile_w * tile_h, num);
     int cur_device = 0, cur_tiles = 0;
 
     for (int tile_y = 0; tile_y < tile_h; tile_y++) {
@@ -337,14 +363,8 @@ int TileManager::gen_tiles(bool sliced)
         int w = (tile_x == tile_w - 1) ? image_w - x : tile_size.x;
         int h = (tile_y == tile_h - 1) ? slice_h - y : tile_size.y;
 
-        state.tiles.push_back(
-            Tile(idx, x, y + slice_y, w, h, sliced ? slice : cur_device, Tile::RENDER));
-        tile_list->push_back(idx);
-
         if (!sliced) {
-          cur_tiles++;
-
-          if (cur_tiles == tiles_per_device) {
+          while (cur_device < num - 1 && cur_tiles == tiles_for_device[cur_device]) {
             /* Tiles are already generated in Bottom-to-Top order, so no sort is necessary in that
              * case. */
             if (tile_order != TILE_BOTTOM_TO_TOP) {
@@ -355,8 +375,18 @@ int TileManager::gen_tiles(bool sliced)
             cur_device++;
           }
         }
+
+        state.tiles.push_back(
+            Tile(idx, x, y + slice_y, w, h, sliced ? slice : cur_device, Tile::RENDER));
+        tile_list->push_back(idx);
+        cur_tiles++;
       }
     }
+
+    if (!sliced && cur_tiles > 0 && tile_order != TILE_BOTTOM_TO_TOP) {
+      tile_list->sort(TileComparator(tile_order, center, &state.tiles[0]));
+    }
+
     if (sliced) {
       tile_list++;
     }
@@ -368,9 +398,20 @@ int TileManager::gen_tiles(bool sliced)
 void TileManager::gen_render_tiles()
 {
   /* Regenerate just the render tiles for progressive render. */
+  bool any_error = false;
   foreach (Tile &tile, state.tiles) {
     tile.state = Tile::RENDER;
     state.render_tiles[tile.device].push_back(tile.index);
+    any_error |= (tile.error >= 0.0f);
+  }
+
+  /* When adaptive sampling has reported error estimates, dispatch the noisiest
+   * tiles first so devices spend their time on them while mostly converged
+   * tiles only get their cheap per-pixel early-out pass at the end. */
+  if (any_error) {
+    foreach (list<int> & tile_list, state.render_tiles) {
+      tile_list.sort(TileErrorComparator(&state.tiles[0]));
+    }
   }
 }
 
@@ -495,6 +536,70 @@ bool TileManager::finish_tile(const int index, const bool need_denoise, bool &de
   }
 }
 
+void TileManager::set_tile_error(const int index, const float error)
+{
+  state.tiles[index].error = error;
+}
+
+void TileManager::set_device_weights(const vector<double> &weights)
+{
+  device_weights = weights;
+}
+
+vector<int> TileManager::divide_among_devices(int count, int num) const
+{
+  vector<int> result(num, 0);
+
+  double weight_sum = 0.0;
+  if (device_weights.size() == (size_t)num) {
+    foreach (double weight, device_weights) {
+      weight_sum += weight;
+    }
+  }
+
+  if (!(weight_sum > 0.0)) {
+    /* No usable weights, divide evenly. */
+    for (int i = 0; i < num; i++) {
+      result[i] = (count * (i + 1)) / num - (count * i) / num;
+    }
+    return result;
+  }
+
+  /* Use cumulative boundaries so that rounding errors do not accumulate and the
+   * shares always add up to the full count. */
+  double weight_acc = 0.0;
+  int assigned = 0;
+  for (int i = 0; i < num; i++) {
+    weight_acc += device_weights[i];
+    const int boundary = min((int)((double)count * weight_acc / weight_sum + 0.5), count);
+    result[i] = boundary - assigned;
+    assigned = boundary;
+  }
+  result[num - 1] += count - assigned;
+
+  /* Even very slow devices should get work, so borrow units from the largest
+   * share when there are enough of them. */
+  if (count >= num) {
+    for (int i = 0; i < num; i++) {
+      while (result[i] == 0) {
+        int largest = 0;
+        for (int j = 1; j < num; j++) {
+          if (result[j] > result[largest]) {
+            largest = j;
+          }
+        }
+        if (result[largest] < 2) {
+          break;
+        }
+        result[largest]--;
+        result[i]++;
+      }
+    }
+  }
+
+  return result;
+}
+
 bool TileManager::next_tile(Tile *&tile, int device, uint tile_types)
 {
   /* Preserve device if requested, unless this is a separate denoising device that just wants to
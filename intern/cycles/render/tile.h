@@ -40,12 +40,25 @@ class Tile {
   State state;
   RenderBuffers *buffers;
 
-  Tile()
+  /* Remaining error as reported by adaptive sampling, as the fraction of
+   * pixels in the tile that have not converged yet. Negative when no
+   * estimate has been reported. */
+  float error;
+
+  Tile() : error(-1.0f)
   {
   }
 
   Tile(int index_, int x_, int y_, int w_, int h_, int device_, State state_ = RENDER)
-      : index(index_), x(x_), y(y_), w(w_), h(h_), device(device_), state(state_), buffers(NULL)
+      : index(index_),
+        x(x_),
+        y(y_),
+        w(w_),
+        h(h_),
+        device(device_),
+        state(state_),
+        buffers(NULL),
+        error(-1.0f)
   {
   }
 };
@@ -108,6 +121,12 @@ class TileManager {
   bool next();
   bool next_tile(Tile *&tile, int device, uint tile_types);
   bool finish_tile(const int index, const bool need_denoise, bool &delete_tile);
+  void set_tile_error(const int index, const float error);
+
+  /* Set the relative measured throughput of every logical device, so that tiles and
+   * viewport slices are split proportionally among heterogeneous devices instead of
+   * evenly. Takes effect on the next reset. */
+  void set_device_weights(const vector<double> &weights);
   bool done();
   bool has_tiles();
 
@@ -162,6 +181,13 @@ class TileManager {
    */
   bool background;
 
+  /* Relative throughput of every logical device, empty for an even split. */
+  vector<double> device_weights;
+
+  /* Divide count work units among num devices proportionally to the device weights,
+   * every device is guaranteed at least one unit as long as there are enough. */
+  vector<int> divide_among_devices(int count, int num) const;
+
   /* Generate tile list, return number of tiles. */
   int gen_tiles(bool sliced);
   void gen_render_tiles();
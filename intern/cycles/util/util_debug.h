@@ -43,6 +43,7 @@ class DebugFlags {
     void reset();
 
     /* Flags describing which instructions sets are allowed for use. */
+    bool avx512;
     bool avx2;
     bool avx;
     bool sse41;
@@ -52,6 +53,10 @@ class DebugFlags {
     /* Check functions to see whether instructions up to the given one
      * are allowed for use.
      */
+    bool has_avx512()
+    {
+      return has_avx2() && avx512;
+    }
     bool has_avx2()
     {
       return has_avx() && avx2;
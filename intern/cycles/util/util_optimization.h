@@ -36,7 +36,7 @@
 
 /* x86-64
  *
- * Compile a regular (includes SSE2), SSE3, SSE 4.1, AVX and AVX2 kernel. */
+ * Compile a regular (includes SSE2), SSE3, SSE 4.1, AVX, AVX2 and AVX-512 kernel. */
 
 #  elif defined(__x86_64__) || defined(_M_X64)
 
@@ -55,6 +55,9 @@
 #    ifdef WITH_KERNEL_AVX2
 #      define WITH_CYCLES_OPTIMIZED_KERNEL_AVX2
 #    endif
+#    ifdef WITH_KERNEL_AVX512
+#      define WITH_CYCLES_OPTIMIZED_KERNEL_AVX512
+#    endif
 
 /* Arm Neon
  *
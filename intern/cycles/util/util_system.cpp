@@ -238,6 +238,11 @@ struct CPUCapabilities {
   bool avx;
   bool f16c;
   bool avx2;
+  bool avx512f;
+  bool avx512dq;
+  bool avx512bw;
+  bool avx512vl;
+  bool os_saves_zmm;
   bool xop;
   bool fma3;
   bool fma4;
@@ -288,6 +293,8 @@ static CPUCapabilities &system_cpu_capabilities()
         xcr_feature_mask = 0;
 #  endif
         caps.avx = (xcr_feature_mask & 0x6) == 0x6;
+        /* AVX-512 additionally needs the OS to save the opmask and ZMM state. */
+        caps.os_saves_zmm = (xcr_feature_mask & 0xe6) == 0xe6;
       }
 
       caps.f16c = (result[2] & ((int)1 << 29)) != 0;
@@ -296,6 +303,10 @@ static CPUCapabilities &system_cpu_capabilities()
       caps.bmi1 = (result[1] & ((int)1 << 3)) != 0;
       caps.bmi2 = (result[1] & ((int)1 << 8)) != 0;
       caps.avx2 = (result[1] & ((int)1 << 5)) != 0;
+      caps.avx512f = (result[1] & ((int)1 << 16)) != 0;
+      caps.avx512dq = (result[1] & ((int)1 << 17)) != 0;
+      caps.avx512bw = (result[1] & ((int)1 << 30)) != 0;
+      caps.avx512vl = (result[1] & ((int)1 << 31)) != 0;
     }
 
     caps_init = true;
@@ -334,6 +345,15 @@ bool system_cpu_support_avx2()
   return caps.sse && caps.sse2 && caps.sse3 && caps.ssse3 && caps.sse41 && caps.avx && caps.f16c &&
          caps.avx2 && caps.fma3 && caps.bmi1 && caps.bmi2;
 }
+
+bool system_cpu_support_avx512()
+{
+  CPUCapabilities &caps = system_cpu_capabilities();
+  /* Require the Skylake-X feature set, which all AVX-512 capable CPUs that
+   * are relevant for rendering support. */
+  return system_cpu_support_avx2() && caps.os_saves_zmm && caps.avx512f && caps.avx512dq &&
+         caps.avx512bw && caps.avx512vl;
+}
 #else
 
 bool system_cpu_support_sse2()
@@ -359,6 +379,10 @@ bool system_cpu_support_avx2()
 {
   return false;
 }
+bool system_cpu_support_avx512()
+{
+  return false;
+}
 
 #endif
 
@@ -21,6 +21,7 @@
 #include "octree.h"
 #include <Eigen/Dense>
 #include <limits>
+#include <thread>
 #include <time.h>
 
 /**
@@ -2143,7 +2144,16 @@ void Octree::writeOut()
   actualVerts = 0;
   actualQuads = 0;
 
-  generateMinimizer(root, st, dimen, maxDepth, offset);
+  std::vector<MinimizerLeaf> leafs;
+  leafs.reserve(numVertices);
+  collectMinimizerLeafs(root, st, dimen, maxDepth, offset, leafs);
+  computeMinimizerPositions(leafs);
+  for (int i = 0; i < (int)leafs.size(); i++) {
+    for (int j = 0; j < leafs[i].mult; j++) {
+      add_vert(output_mesh, leafs[i].rvalue);
+    }
+  }
+
   cellProcContour(root, 0, maxDepth);
   dc_printf("Vertices written: %d Quads written: %d \n", offset, actualQuads);
 }
@@ -2326,27 +2336,13 @@ void Octree::computeMinimizer(const LeafNode *leaf, int st[3], int len, float rv
   }
 }
 
-void Octree::generateMinimizer(Node *node, int st[3], int len, int height, int &offset)
+void Octree::collectMinimizerLeafs(
+    Node *node, int st[3], int len, int height, int &offset, std::vector<MinimizerLeaf> &leafs)
 {
-  int i, j;
+  int i;
 
   if (height == 0) {
-    // Leaf cell, generate
-
-    // First, find minimizer
-    float rvalue[3];
-    rvalue[0] = (float)st[0] + len / 2;
-    rvalue[1] = (float)st[1] + len / 2;
-    rvalue[2] = (float)st[2] + len / 2;
-    computeMinimizer(&node->leaf, st, len, rvalue);
-
-    // Update
-    // float fnst[3];
-    for (j = 0; j < 3; j++) {
-      rvalue[j] = rvalue[j] * range / dimen + origin[j];
-      // fnst[j] = st[j] * range / dimen + origin[j];
-    }
-
+    // Leaf cell, record it for minimizer computation
     int mult = 0, smask = getSignMask(&node->leaf);
 
     if (use_manifold) {
@@ -2358,9 +2354,14 @@ void Octree::generateMinimizer(Node *node, int st[3], int len, int height, int &
       }
     }
 
-    for (j = 0; j < mult; j++) {
-      add_vert(output_mesh, rvalue);
-    }
+    MinimizerLeaf ml;
+    ml.leaf = &node->leaf;
+    ml.st[0] = st[0];
+    ml.st[1] = st[1];
+    ml.st[2] = st[2];
+    ml.len = len;
+    ml.mult = mult;
+    leafs.push_back(ml);
 
     // Store the index
     setMinimizerIndex(&node->leaf, offset);
@@ -2378,13 +2379,59 @@ void Octree::generateMinimizer(Node *node, int st[3], int len, int height, int &
         nst[1] = st[1] + vertmap[i][1] * len;
         nst[2] = st[2] + vertmap[i][2] * len;
 
-        generateMinimizer(node->internal.get_child(count), nst, len, height - 1, offset);
+        collectMinimizerLeafs(node->internal.get_child(count), nst, len, height - 1, offset, leafs);
         count++;
       }
     }
   }
 }
 
+/* Computing a minimizer runs an SVD based QEF solve for every leaf, which on
+   dense remeshes is the bulk of the output step. The octree is not modified
+   here and every leaf is independent, so split them over hardware threads. */
+void Octree::computeMinimizerPositions(std::vector<MinimizerLeaf> &leafs) const
+{
+  const int num_leafs = (int)leafs.size();
+
+  auto compute_range = [&](int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      MinimizerLeaf &ml = leafs[i];
+
+      // First, find minimizer
+      float rvalue[3];
+      rvalue[0] = (float)ml.st[0] + ml.len / 2;
+      rvalue[1] = (float)ml.st[1] + ml.len / 2;
+      rvalue[2] = (float)ml.st[2] + ml.len / 2;
+      computeMinimizer(ml.leaf, ml.st, ml.len, rvalue);
+
+      // Update
+      for (int j = 0; j < 3; j++) {
+        ml.rvalue[j] = rvalue[j] * range / dimen + origin[j];
+      }
+    }
+  };
+
+  int num_threads = (int)std::thread::hardware_concurrency();
+  if (num_threads <= 1 || num_leafs < 4096) {
+    compute_range(0, num_leafs);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  const int chunk = (num_leafs + num_threads - 1) / num_threads;
+  for (int t = 0; t < num_threads; t++) {
+    const int begin = t * chunk;
+    const int end = (begin + chunk < num_leafs) ? begin + chunk : num_leafs;
+    if (begin >= end) {
+      break;
+    }
+    threads.emplace_back(compute_range, begin, end);
+  }
+  for (size_t t = 0; t < threads.size(); t++) {
+    threads[t].join();
+  }
+}
+
 void Octree::processEdgeWrite(Node *node[4], int /*depth*/[4], int /*maxdep*/, int dir)
 {
   // int color = 0;
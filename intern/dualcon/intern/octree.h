@@ -29,6 +29,7 @@
 #include <cstring>
 #include <math.h>
 #include <stdio.h>
+#include <vector>
 
 /**
  * Main class and structures for scan-convertion, sign-generation,
@@ -449,7 +450,23 @@ class Octree {
   void writeOut();
 
   void countIntersection(Node *node, int height, int &nedge, int &ncell, int &nface);
-  void generateMinimizer(Node *node, int st[3], int len, int height, int &offset);
+
+  /* Leaf data gathered during the output walk, so that the minimizers of
+     all leafs can be computed in parallel before vertices are written. */
+  struct MinimizerLeaf {
+    LeafNode *leaf;
+    int st[3];
+    int len;
+    int mult;
+    float rvalue[3];
+  };
+  void collectMinimizerLeafs(Node *node,
+                             int st[3],
+                             int len,
+                             int height,
+                             int &offset,
+                             std::vector<MinimizerLeaf> &leafs);
+  void computeMinimizerPositions(std::vector<MinimizerLeaf> &leafs) const;
   void computeMinimizer(const LeafNode *leaf, int st[3], int len, float rvalue[3]) const;
   /**
    * Traversal functions to generate polygon model
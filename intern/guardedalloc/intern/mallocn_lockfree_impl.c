@@ -159,13 +159,32 @@ void *MEM_lockfree_reallocN_id(void *vmemh, size_t len, const char *str)
     size_t old_len = MEM_lockfree_allocN_len(vmemh);
 
     if (LIKELY(!MEMHEAD_IS_ALIGNED(memh))) {
-      newp = MEM_lockfree_mallocN(len, "realloc");
-    }
-    else {
-      MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
-      newp = MEM_lockfree_mallocN_aligned(len, (size_t)memh_aligned->alignment, "realloc");
+      /* The system allocator can often resize the block in place, which
+       * avoids both the copy and an extra pair of statistics updates. */
+      len = SIZET_ALIGN_4(len);
+      MemHead *memh_new = (MemHead *)realloc(memh, len + sizeof(MemHead));
+      if (LIKELY(memh_new)) {
+        if (UNLIKELY(malloc_debug_memset && len > old_len)) {
+          memset((char *)PTR_FROM_MEMHEAD(memh_new) + old_len, 255, len - old_len);
+        }
+        memh_new->len = len;
+        atomic_sub_and_fetch_z(&mem_in_use, old_len);
+        update_maximum(&peak_mem, atomic_add_and_fetch_z(&mem_in_use, len));
+        return PTR_FROM_MEMHEAD(memh_new);
+      }
+      /* The original block is untouched when realloc fails, free it to match
+       * the behavior of the copying path. */
+      print_error("Realloc returns null: len=" SIZET_FORMAT " in %s, total %u\n",
+                  SIZET_ARG(len),
+                  str,
+                  (unsigned int)mem_in_use);
+      MEM_lockfree_freeN(vmemh);
+      return NULL;
     }
 
+    MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
+    newp = MEM_lockfree_mallocN_aligned(len, (size_t)memh_aligned->alignment, "realloc");
+
     if (newp) {
       if (len < old_len) {
         /* shrink */
@@ -195,13 +214,30 @@ void *MEM_lockfree_recallocN_id(void *vmemh, size_t len, const char *str)
     size_t old_len = MEM_lockfree_allocN_len(vmemh);
 
     if (LIKELY(!MEMHEAD_IS_ALIGNED(memh))) {
-      newp = MEM_lockfree_mallocN(len, "recalloc");
-    }
-    else {
-      MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
-      newp = MEM_lockfree_mallocN_aligned(len, (size_t)memh_aligned->alignment, "recalloc");
+      /* See MEM_lockfree_reallocN_id for why realloc is used directly. */
+      len = SIZET_ALIGN_4(len);
+      MemHead *memh_new = (MemHead *)realloc(memh, len + sizeof(MemHead));
+      if (LIKELY(memh_new)) {
+        if (len > old_len) {
+          /* grow, zero new bytes */
+          memset((char *)PTR_FROM_MEMHEAD(memh_new) + old_len, 0, len - old_len);
+        }
+        memh_new->len = len;
+        atomic_sub_and_fetch_z(&mem_in_use, old_len);
+        update_maximum(&peak_mem, atomic_add_and_fetch_z(&mem_in_use, len));
+        return PTR_FROM_MEMHEAD(memh_new);
+      }
+      print_error("Recalloc returns null: len=" SIZET_FORMAT " in %s, total %u\n",
+                  SIZET_ARG(len),
+                  str,
+                  (unsigned int)mem_in_use);
+      MEM_lockfree_freeN(vmemh);
+      return NULL;
     }
 
+    MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
+    newp = MEM_lockfree_mallocN_aligned(len, (size_t)memh_aligned->alignment, "recalloc");
+
     if (newp) {
       if (len < old_len) {
         /* shrink */
@@ -238,8 +274,8 @@ void *MEM_lockfree_callocN(size_t len, const char *str)
   if (LIKELY(memh)) {
     memh->len = len;
     atomic_add_and_fetch_u(&totblock, 1);
-    atomic_add_and_fetch_z(&mem_in_use, len);
-    update_maximum(&peak_mem, mem_in_use);
+    /* Use the add result so the peak check reads the counter only once. */
+    update_maximum(&peak_mem, atomic_add_and_fetch_z(&mem_in_use, len));
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -283,8 +319,8 @@ void *MEM_lockfree_mallocN(size_t len, const char *str)
 
     memh->len = len;
     atomic_add_and_fetch_u(&totblock, 1);
-    atomic_add_and_fetch_z(&mem_in_use, len);
-    update_maximum(&peak_mem, mem_in_use);
+    /* Use the add result so the peak check reads the counter only once. */
+    update_maximum(&peak_mem, atomic_add_and_fetch_z(&mem_in_use, len));
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -354,8 +390,8 @@ void *MEM_lockfree_mallocN_aligned(size_t len, size_t alignment, const char *str
     memh->len = len | (size_t)MEMHEAD_ALIGN_FLAG;
     memh->alignment = (short)alignment;
     atomic_add_and_fetch_u(&totblock, 1);
-    atomic_add_and_fetch_z(&mem_in_use, len);
-    update_maximum(&peak_mem, mem_in_use);
+    /* Use the add result so the peak check reads the counter only once. */
+    update_maximum(&peak_mem, atomic_add_and_fetch_z(&mem_in_use, len));
 
     return PTR_FROM_MEMHEAD(memh);
   }
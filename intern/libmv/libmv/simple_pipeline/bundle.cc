@@ -20,6 +20,7 @@
 
 #include "libmv/simple_pipeline/bundle.h"
 
+#include <cstdio>
 #include <map>
 #include <thread>
 
@@ -31,6 +32,7 @@
 #include "libmv/multiview/fundamental.h"
 #include "libmv/multiview/projection.h"
 #include "libmv/numeric/numeric.h"
+#include "libmv/simple_pipeline/callbacks.h"
 #include "libmv/simple_pipeline/camera_intrinsics.h"
 #include "libmv/simple_pipeline/distortion_models.h"
 #include "libmv/simple_pipeline/packed_intrinsics.h"
@@ -47,6 +49,32 @@ bool NeedUseInvertIntrinsicsPipeline(const CameraIntrinsics* intrinsics) {
   return (distortion_model == DISTORTION_MODEL_NUKE);
 }
 
+// Forwards Ceres iterations to the pipeline progress callback, so the
+// interface can show the minimizer advancing on long shots instead of
+// appearing frozen for the whole refinement.
+class BundleProgressCallback : public ceres::IterationCallback {
+ public:
+  BundleProgressCallback(ProgressUpdateCallback* update_callback,
+                         int max_num_iterations)
+      : update_callback_(update_callback),
+        max_num_iterations_(max_num_iterations) {}
+
+  ceres::CallbackReturnType operator()(const ceres::IterationSummary& summary) {
+    char message[256];
+    snprintf(message,
+             sizeof(message),
+             "Bundle adjusting (iteration %d)",
+             summary.iteration);
+    update_callback_->invoke(double(summary.iteration) / max_num_iterations_,
+                             message);
+    return ceres::SOLVER_CONTINUE;
+  }
+
+ private:
+  ProgressUpdateCallback* update_callback_;
+  int max_num_iterations_;
+};
+
 // Apply distortion model (distort the input) on the input point in the
 // normalized space to get distorted coordinate in the image space.
 //
@@ -663,7 +691,8 @@ void EuclideanBundleCommonIntrinsics(const Tracks& tracks,
                                      const int bundle_constraints,
                                      EuclideanReconstruction* reconstruction,
                                      CameraIntrinsics* intrinsics,
-                                     BundleEvaluation* evaluation) {
+                                     BundleEvaluation* evaluation,
+                                     ProgressUpdateCallback* update_callback) {
   LG << "Original intrinsics: " << *intrinsics;
   vector<Marker> markers = tracks.AllMarkers();
 
@@ -805,6 +834,12 @@ void EuclideanBundleCommonIntrinsics(const Tracks& tracks,
   options.max_num_iterations = 100;
   options.num_threads = std::thread::hardware_concurrency();
 
+  BundleProgressCallback progress_callback(update_callback,
+                                           options.max_num_iterations);
+  if (update_callback) {
+    options.callbacks.push_back(&progress_callback);
+  }
+
   // Solve!
   ceres::Solver::Summary summary;
   ceres::Solve(options, &problem, &summary);
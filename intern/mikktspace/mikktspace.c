@@ -210,7 +210,8 @@ static tbool GenerateTSpaces(STSpace psTspace[],
                              const int iNrActiveGroups,
                              const int piTriListIn[],
                              const float fThresCos,
-                             const SMikkTSpaceContext *pContext);
+                             const SMikkTSpaceContext *pContext,
+                             const int iNrTrianglesIn);
 
 MIKK_INLINE int MakeIndex(const int iFace, const int iVert)
 {
@@ -396,8 +397,14 @@ tbool genTangSpace(const SMikkTSpaceContext *pContext, const float fAngularThres
   // based on fAngularThreshold. Finally a tangent space is made for
   // every resulting subgroup
   // printf("gen tspaces begin\n");
-  bRes = GenerateTSpaces(
-      psTspace, pTriInfos, pGroups, iNrActiveGroups, piTriListIn, fThresCos, pContext);
+  bRes = GenerateTSpaces(psTspace,
+                         pTriInfos,
+                         pGroups,
+                         iNrActiveGroups,
+                         piTriListIn,
+                         fThresCos,
+                         pContext,
+                         iNrTrianglesIn);
   // printf("gen tspaces end\n");
 
   // clean up
@@ -1125,171 +1132,199 @@ static tbool GenerateTSpaces(STSpace psTspace[],
                              const int iNrActiveGroups,
                              const int piTriListIn[],
                              const float fThresCos,
-                             const SMikkTSpaceContext *pContext)
+                             const SMikkTSpaceContext *pContext,
+                             const int iNrTrianglesIn)
 {
-  STSpace *pSubGroupTspace = NULL;
-  SSubGroup *pUniSubGroups = NULL;
-  int *pTmpMembers = NULL;
-  int iMaxNrFaces = 0, iUniqueTspaces = 0, g = 0, i = 0;
-  for (g = 0; g < iNrActiveGroups; g++)
-    if (iMaxNrFaces < pGroups[g].iNrFaces)
-      iMaxNrFaces = pGroups[g].iNrFaces;
-
-  if (iMaxNrFaces == 0)
+  STSpace *pCornerTspace = NULL;
+  tbool bRes = TTRUE;
+  int g = 0;
+
+  if (iNrTrianglesIn == 0)
     return TTRUE;
 
-  // make initial allocations
-  pSubGroupTspace = (STSpace *)malloc(sizeof(STSpace) * iMaxNrFaces);
-  pUniSubGroups = (SSubGroup *)malloc(sizeof(SSubGroup) * iMaxNrFaces);
-  pTmpMembers = (int *)malloc(sizeof(int) * iMaxNrFaces);
-  if (pSubGroupTspace == NULL || pUniSubGroups == NULL || pTmpMembers == NULL) {
-    if (pSubGroupTspace != NULL)
-      free(pSubGroupTspace);
-    if (pUniSubGroups != NULL)
-      free(pUniSubGroups);
-    if (pTmpMembers != NULL)
-      free(pTmpMembers);
+  // Holds the tangent space of every (triangle, group vertex) corner, so the
+  // groups can be evaluated independently. The welding into psTspace[] is
+  // done in a serial pass afterwards, keeping the original merge order so
+  // the output stays bit-exact regardless of how groups are scheduled.
+  pCornerTspace = (STSpace *)malloc(sizeof(STSpace) * iNrTrianglesIn * 3);
+  if (pCornerTspace == NULL)
     return TFALSE;
-  }
 
-  iUniqueTspaces = 0;
+#ifdef _OPENMP
+#  pragma omp parallel for schedule(dynamic) if (iNrActiveGroups > 64)
+#endif
   for (g = 0; g < iNrActiveGroups; g++) {
     const SGroup *pGroup = &pGroups[g];
-    int iUniqueSubGroups = 0, s = 0;
+    STSpace *pSubGroupTspace = NULL;
+    SSubGroup *pUniSubGroups = NULL;
+    int *pTmpMembers = NULL;
+    int iUniqueSubGroups = 0, i = 0, s = 0;
 
-    for (i = 0; i < pGroup->iNrFaces; i++)  // triangles
-    {
-      const int f = pGroup->pFaceIndices[i];  // triangle number
-      int index = -1, iVertIndex = -1, iOF_1 = -1, iMembers = 0, j = 0, l = 0;
-      SSubGroup tmp_group;
-      tbool bFound;
-      SVec3 n, vOs, vOt;
-      if (pTriInfos[f].AssignedGroup[0] == pGroup)
-        index = 0;
-      else if (pTriInfos[f].AssignedGroup[1] == pGroup)
-        index = 1;
-      else if (pTriInfos[f].AssignedGroup[2] == pGroup)
-        index = 2;
-      assert(index >= 0 && index < 3);
-
-      iVertIndex = piTriListIn[f * 3 + index];
-      assert(iVertIndex == pGroup->iVertexRepresentitive);
-
-      // is normalized already
-      n = GetNormal(pContext, iVertIndex);
+    if (!bRes || pGroup->iNrFaces == 0)
+      continue;
 
-      // project
-      vOs = NormalizeSafe(vsub(pTriInfos[f].vOs, vscale(vdot(n, pTriInfos[f].vOs), n)));
-      vOt = NormalizeSafe(vsub(pTriInfos[f].vOt, vscale(vdot(n, pTriInfos[f].vOt), n)));
+    // make the scratch allocations for this group
+    pSubGroupTspace = (STSpace *)malloc(sizeof(STSpace) * pGroup->iNrFaces);
+    pUniSubGroups = (SSubGroup *)malloc(sizeof(SSubGroup) * pGroup->iNrFaces);
+    pTmpMembers = (int *)malloc(sizeof(int) * pGroup->iNrFaces);
+    if (pSubGroupTspace == NULL || pUniSubGroups == NULL || pTmpMembers == NULL) {
+      bRes = TFALSE;
+    }
+    else {
+      for (i = 0; i < pGroup->iNrFaces; i++)  // triangles
+      {
+        const int f = pGroup->pFaceIndices[i];  // triangle number
+        int index = -1, iVertIndex = -1, iOF_1 = -1, iMembers = 0, j = 0, l = 0;
+        SSubGroup tmp_group;
+        tbool bFound;
+        SVec3 n, vOs, vOt;
+        if (pTriInfos[f].AssignedGroup[0] == pGroup)
+          index = 0;
+        else if (pTriInfos[f].AssignedGroup[1] == pGroup)
+          index = 1;
+        else if (pTriInfos[f].AssignedGroup[2] == pGroup)
+          index = 2;
+        assert(index >= 0 && index < 3);
+
+        iVertIndex = piTriListIn[f * 3 + index];
+        assert(iVertIndex == pGroup->iVertexRepresentitive);
+
+        // is normalized already
+        n = GetNormal(pContext, iVertIndex);
 
-      // original face number
-      iOF_1 = pTriInfos[f].iOrgFaceNumber;
+        // project
+        vOs = NormalizeSafe(vsub(pTriInfos[f].vOs, vscale(vdot(n, pTriInfos[f].vOs), n)));
+        vOt = NormalizeSafe(vsub(pTriInfos[f].vOt, vscale(vdot(n, pTriInfos[f].vOt), n)));
 
-      iMembers = 0;
-      for (j = 0; j < pGroup->iNrFaces; j++) {
-        const int t = pGroup->pFaceIndices[j];  // triangle number
-        const int iOF_2 = pTriInfos[t].iOrgFaceNumber;
+        // original face number
+        iOF_1 = pTriInfos[f].iOrgFaceNumber;
 
-        // project
-        SVec3 vOs2 = NormalizeSafe(vsub(pTriInfos[t].vOs, vscale(vdot(n, pTriInfos[t].vOs), n)));
-        SVec3 vOt2 = NormalizeSafe(vsub(pTriInfos[t].vOt, vscale(vdot(n, pTriInfos[t].vOt), n)));
+        iMembers = 0;
+        for (j = 0; j < pGroup->iNrFaces; j++) {
+          const int t = pGroup->pFaceIndices[j];  // triangle number
+          const int iOF_2 = pTriInfos[t].iOrgFaceNumber;
 
-        {
-          const tbool bAny = ((pTriInfos[f].iFlag | pTriInfos[t].iFlag) & GROUP_WITH_ANY) != 0 ?
-                                 TTRUE :
-                                 TFALSE;
-          // make sure triangles which belong to the same quad are joined.
-          const tbool bSameOrgFace = iOF_1 == iOF_2 ? TTRUE : TFALSE;
-
-          const float fCosS = vdot(vOs, vOs2);
-          const float fCosT = vdot(vOt, vOt2);
-
-          assert(f != t || bSameOrgFace);  // sanity check
-          if (bAny || bSameOrgFace || (fCosS > fThresCos && fCosT > fThresCos))
-            pTmpMembers[iMembers++] = t;
+          // project
+          SVec3 vOs2 = NormalizeSafe(
+              vsub(pTriInfos[t].vOs, vscale(vdot(n, pTriInfos[t].vOs), n)));
+          SVec3 vOt2 = NormalizeSafe(
+              vsub(pTriInfos[t].vOt, vscale(vdot(n, pTriInfos[t].vOt), n)));
+
+          {
+            const tbool bAny = ((pTriInfos[f].iFlag | pTriInfos[t].iFlag) & GROUP_WITH_ANY) != 0 ?
+                                   TTRUE :
+                                   TFALSE;
+            // make sure triangles which belong to the same quad are joined.
+            const tbool bSameOrgFace = iOF_1 == iOF_2 ? TTRUE : TFALSE;
+
+            const float fCosS = vdot(vOs, vOs2);
+            const float fCosT = vdot(vOt, vOt2);
+
+            assert(f != t || bSameOrgFace);  // sanity check
+            if (bAny || bSameOrgFace || (fCosS > fThresCos && fCosT > fThresCos))
+              pTmpMembers[iMembers++] = t;
+          }
         }
-      }
 
-      // sort pTmpMembers
-      tmp_group.iNrFaces = iMembers;
-      tmp_group.pTriMembers = pTmpMembers;
-      if (iMembers > 1) {
-        unsigned int uSeed = INTERNAL_RND_SORT_SEED;  // could replace with a random seed?
-        QuickSort(pTmpMembers, 0, iMembers - 1, uSeed);
-      }
+        // sort pTmpMembers
+        tmp_group.iNrFaces = iMembers;
+        tmp_group.pTriMembers = pTmpMembers;
+        if (iMembers > 1) {
+          unsigned int uSeed = INTERNAL_RND_SORT_SEED;  // could replace with a random seed?
+          QuickSort(pTmpMembers, 0, iMembers - 1, uSeed);
+        }
 
-      // look for an existing match
-      bFound = TFALSE;
-      l = 0;
-      while (l < iUniqueSubGroups && !bFound) {
-        bFound = CompareSubGroups(&tmp_group, &pUniSubGroups[l]);
-        if (!bFound)
-          ++l;
-      }
+        // look for an existing match
+        bFound = TFALSE;
+        l = 0;
+        while (l < iUniqueSubGroups && !bFound) {
+          bFound = CompareSubGroups(&tmp_group, &pUniSubGroups[l]);
+          if (!bFound)
+            ++l;
+        }
+
+        // assign tangent space index
+        assert(bFound || l == iUniqueSubGroups);
 
-      // assign tangent space index
-      assert(bFound || l == iUniqueSubGroups);
-      // piTempTangIndices[f*3+index] = iUniqueTspaces+l;
-
-      // if no match was found we allocate a new subgroup
-      if (!bFound) {
-        // insert new subgroup
-        int *pIndices = (int *)malloc(sizeof(int) * iMembers);
-        if (pIndices == NULL) {
-          // clean up and return false
-          int s = 0;
-          for (s = 0; s < iUniqueSubGroups; s++)
-            free(pUniSubGroups[s].pTriMembers);
-          free(pUniSubGroups);
-          free(pTmpMembers);
-          free(pSubGroupTspace);
-          return TFALSE;
+        // if no match was found we allocate a new subgroup
+        if (!bFound) {
+          // insert new subgroup
+          int *pIndices = (int *)malloc(sizeof(int) * iMembers);
+          if (pIndices == NULL) {
+            bRes = TFALSE;
+            break;
+          }
+          pUniSubGroups[iUniqueSubGroups].iNrFaces = iMembers;
+          pUniSubGroups[iUniqueSubGroups].pTriMembers = pIndices;
+          memcpy(pIndices, tmp_group.pTriMembers, sizeof(int) * iMembers);
+          pSubGroupTspace[iUniqueSubGroups] = EvalTspace(tmp_group.pTriMembers,
+                                                         iMembers,
+                                                         piTriListIn,
+                                                         pTriInfos,
+                                                         pContext,
+                                                         pGroup->iVertexRepresentitive);
+          ++iUniqueSubGroups;
         }
-        pUniSubGroups[iUniqueSubGroups].iNrFaces = iMembers;
-        pUniSubGroups[iUniqueSubGroups].pTriMembers = pIndices;
-        memcpy(pIndices, tmp_group.pTriMembers, sizeof(int) * iMembers);
-        pSubGroupTspace[iUniqueSubGroups] = EvalTspace(tmp_group.pTriMembers,
-                                                       iMembers,
-                                                       piTriListIn,
-                                                       pTriInfos,
-                                                       pContext,
-                                                       pGroup->iVertexRepresentitive);
-        ++iUniqueSubGroups;
+
+        // keep the result for the serial weld pass below
+        pCornerTspace[f * 3 + index] = pSubGroupTspace[l];
       }
+    }
 
-      // output tspace
-      {
-        const int iOffs = pTriInfos[f].iTSpacesOffs;
-        const int iVert = pTriInfos[f].vert_num[index];
-        STSpace *pTS_out = &psTspace[iOffs + iVert];
+    // clean up
+    for (s = 0; s < iUniqueSubGroups; s++)
+      free(pUniSubGroups[s].pTriMembers);
+    if (pSubGroupTspace != NULL)
+      free(pSubGroupTspace);
+    if (pUniSubGroups != NULL)
+      free(pUniSubGroups);
+    if (pTmpMembers != NULL)
+      free(pTmpMembers);
+  }
+
+  if (bRes) {
+    // output tspaces, in the original group order so that quads which
+    // average the spaces of their two triangles match the serial result
+    for (g = 0; g < iNrActiveGroups; g++) {
+      const SGroup *pGroup = &pGroups[g];
+      int i = 0;
+
+      for (i = 0; i < pGroup->iNrFaces; i++) {
+        const int f = pGroup->pFaceIndices[i];  // triangle number
+        int index = -1, iOffs = 0, iVert = 0;
+        STSpace *pTS_out = NULL;
+        if (pTriInfos[f].AssignedGroup[0] == pGroup)
+          index = 0;
+        else if (pTriInfos[f].AssignedGroup[1] == pGroup)
+          index = 1;
+        else if (pTriInfos[f].AssignedGroup[2] == pGroup)
+          index = 2;
+        assert(index >= 0 && index < 3);
+
+        iOffs = pTriInfos[f].iTSpacesOffs;
+        iVert = pTriInfos[f].vert_num[index];
+        pTS_out = &psTspace[iOffs + iVert];
         assert(pTS_out->iCounter < 2);
         assert(((pTriInfos[f].iFlag & ORIENT_PRESERVING) != 0) == pGroup->bOrientPreservering);
         if (pTS_out->iCounter == 1) {
-          *pTS_out = AvgTSpace(pTS_out, &pSubGroupTspace[l]);
+          *pTS_out = AvgTSpace(pTS_out, &pCornerTspace[f * 3 + index]);
           pTS_out->iCounter = 2;  // update counter
           pTS_out->bOrient = pGroup->bOrientPreservering;
         }
         else {
           assert(pTS_out->iCounter == 0);
-          *pTS_out = pSubGroupTspace[l];
+          *pTS_out = pCornerTspace[f * 3 + index];
           pTS_out->iCounter = 1;  // update counter
           pTS_out->bOrient = pGroup->bOrientPreservering;
         }
       }
     }
-
-    // clean up and offset iUniqueTspaces
-    for (s = 0; s < iUniqueSubGroups; s++)
-      free(pUniSubGroups[s].pTriMembers);
-    iUniqueTspaces += iUniqueSubGroups;
   }
 
   // clean up
-  free(pUniSubGroups);
-  free(pTmpMembers);
-  free(pSubGroupTspace);
+  free(pCornerTspace);
 
-  return TTRUE;
+  return bRes;
 }
 
 static STSpace EvalTspace(int face_indices[],
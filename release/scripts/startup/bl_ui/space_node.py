@@ -256,6 +256,9 @@ class NODE_MT_view(Menu):
         # Auto-offset nodes (called "insert_offset" in code)
         layout.prop(snode, "use_insert_offset")
 
+        if snode.tree_type == 'GeometryNodeTree':
+            layout.prop(snode, "show_timings")
+
         layout.separator()
 
         sub = layout.column()
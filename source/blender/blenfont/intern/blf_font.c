@@ -39,6 +39,7 @@
 
 #include "DNA_vec_types.h"
 
+#include "BLI_ghash.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
 #include "BLI_math_color_blend.h"
@@ -782,11 +783,65 @@ static void blf_font_boundbox_ex(FontBLF *font,
     r_info->width = pen_x;
   }
 }
+/* The UI measures the same strings (labels, row values) over and over per redraw, so keep the
+ * bounds of recently measured strings in the glyph cache. Only short strings are cached, longer
+ * ones are unlikely to repeat and would make the keys expensive. */
+#define BOUNDBOX_CACHE_STR_LEN_MAX 64
+#define BOUNDBOX_CACHE_LEN_MAX 2048
+
+typedef struct StringBoundsBLF {
+  rctf box;
+  int width;
+} StringBoundsBLF;
+
 void blf_font_boundbox(
     FontBLF *font, const char *str, const size_t str_len, rctf *r_box, struct ResultBLF *r_info)
 {
   GlyphCacheBLF *gc = blf_glyph_cache_acquire(font);
-  blf_font_boundbox_ex(font, gc, str, str_len, r_box, r_info, 0);
+
+  /* Bounds are fully determined by the glyphs and kerning of this cache (so by the font at this
+   * size/DPI), making them safe to memoize. The cache is protected by the mutex held here. */
+  const size_t n = BLI_strnlen(str, str_len);
+  char key_buf[BOUNDBOX_CACHE_STR_LEN_MAX + 1];
+  const bool use_cache = (n <= BOUNDBOX_CACHE_STR_LEN_MAX);
+  if (use_cache) {
+    memcpy(key_buf, str, n);
+    key_buf[n] = '\0';
+
+    if (gc->boundbox_cache) {
+      const StringBoundsBLF *cached = BLI_ghash_lookup(gc->boundbox_cache, key_buf);
+      if (cached) {
+        *r_box = cached->box;
+        if (r_info) {
+          r_info->lines = 1;
+          r_info->width = cached->width;
+        }
+        blf_glyph_cache_release(font);
+        return;
+      }
+    }
+  }
+
+  struct ResultBLF info_local;
+  blf_font_boundbox_ex(font, gc, str, str_len, r_box, &info_local, 0);
+
+  if (use_cache) {
+    if (gc->boundbox_cache == NULL) {
+      gc->boundbox_cache = BLI_ghash_str_new(__func__);
+    }
+    else if (BLI_ghash_len(gc->boundbox_cache) >= BOUNDBOX_CACHE_LEN_MAX) {
+      /* Simply flush, an LRU is not worth the complexity here. */
+      BLI_ghash_clear(gc->boundbox_cache, MEM_freeN, MEM_freeN);
+    }
+    StringBoundsBLF *cached = MEM_mallocN(sizeof(*cached), __func__);
+    cached->box = *r_box;
+    cached->width = info_local.width;
+    BLI_ghash_insert(gc->boundbox_cache, BLI_strdupn(key_buf, n), cached);
+  }
+
+  if (r_info) {
+    *r_info = info_local;
+  }
   blf_glyph_cache_release(font);
 }
 
@@ -40,6 +40,7 @@
 #include "DNA_userdef_types.h"
 #include "DNA_vec_types.h"
 
+#include "BLI_ghash.h"
 #include "BLI_listbase.h"
 #include "BLI_rect.h"
 #include "BLI_threads.h"
@@ -156,6 +157,9 @@ void blf_glyph_cache_free(GlyphCacheBLF *gc)
   if (gc->bitmap_result) {
     MEM_freeN(gc->bitmap_result);
   }
+  if (gc->boundbox_cache) {
+    BLI_ghash_free(gc->boundbox_cache, MEM_freeN, MEM_freeN);
+  }
   MEM_freeN(gc);
 }
 
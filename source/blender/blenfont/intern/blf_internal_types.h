@@ -93,6 +93,10 @@ typedef struct GlyphCacheBLF {
   /* ascender and descender value. */
   float ascender;
   float descender;
+
+  /* Bound-boxes of recently measured strings, see #blf_font_boundbox. Lazily created,
+   * protected by #FontBLF.glyph_cache_mutex like the rest of this cache. */
+  struct GHash *boundbox_cache;
 } GlyphCacheBLF;
 
 typedef struct GlyphBLF {
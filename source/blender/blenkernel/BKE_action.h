@@ -39,6 +39,7 @@ struct bArmature;
 /* The following structures are defined in DNA_action_types.h, and DNA_anim_types.h */
 struct AnimationEvalContext;
 struct FCurve;
+struct FCurveBakedCache;
 struct Main;
 struct Object;
 struct bAction;
@@ -94,6 +95,11 @@ void calc_action_range(const struct bAction *act, float *start, float *end, shor
 /* Does action have any motion data at all? */
 bool action_has_motion(const struct bAction *act);
 
+/* Baked playback cache (see ACT_BAKED_CACHE), lazily built on first evaluation.
+ * Thread-safe, may return NULL when the action has nothing worth baking. */
+struct FCurveBakedCache *BKE_action_baked_cache_ensure(struct bAction *act);
+void BKE_action_baked_cache_free(struct bAction *act);
+
 /* Action Groups API ----------------- */
 
 /* Get the active action-group for an Action */
@@ -122,6 +128,10 @@ void BKE_action_groups_reconstruct(struct bAction *act);
 /* Find a group with the given name */
 struct bActionGroup *BKE_action_group_find_name(struct bAction *act, const char name[]);
 
+/* Group name hash for quick lookups, only for use on evaluated actions. */
+void BKE_action_groups_hash_ensure(struct bAction *act);
+void BKE_action_groups_hash_free(struct bAction *act);
+
 /* Clear all 'temp' flags on all groups */
 void action_groups_clear_tempflags(struct bAction *act);
 
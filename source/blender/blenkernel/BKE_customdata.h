@@ -74,6 +74,13 @@ typedef enum eCDAllocType {
   CD_REFERENCE = 3,
   /** Do a full copy of all layers, only allowed if source has same number of elements. */
   CD_DUPLICATE = 4,
+  /**
+   * Share the source layer's data with reference counting: the data is only duplicated
+   * once some user writes to it (see #CustomData_duplicate_referenced_layer) and freed
+   * when the last user is gone. Unlike #CD_REFERENCE, source and copies may be freed in
+   * any order. Intended for passing layers down the modifier stack without copying them.
+   */
+  CD_SHARED = 5,
 } eCDAllocType;
 
 #define CD_TYPE_AS_MASK(_type) (CustomDataMask)((CustomDataMask)1 << (CustomDataMask)(_type))
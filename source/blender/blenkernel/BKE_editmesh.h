@@ -89,6 +89,17 @@ typedef struct BMEditMesh {
    */
   char needs_flush_to_id;
 
+  /**
+   * Hint set by operators which only move vertices (transform for example), so the next
+   * geometry evaluation can keep topology dependent draw buffers,
+   * see #BKE_MESH_BATCH_DIRTY_DEFORM. The element counts are a sanity check which invalidates
+   * the hint when topology changes sneak in before the evaluation consumes it.
+   */
+  struct {
+    char is_set;
+    int verts_len, edges_len, faces_len, loops_len;
+  } deform_only_update;
+
 } BMEditMesh;
 
 /* editmesh.c */
@@ -104,6 +115,9 @@ void BKE_editmesh_looptri_and_normals_calc_with_partial(BMEditMesh *em,
 
 void BKE_editmesh_looptri_and_normals_calc(BMEditMesh *em);
 
+void BKE_editmesh_deform_only_update_tag(BMEditMesh *em);
+bool BKE_editmesh_deform_only_update_consume(BMEditMesh *em);
+
 BMEditMesh *BKE_editmesh_create(BMesh *bm);
 BMEditMesh *BKE_editmesh_copy(BMEditMesh *em);
 BMEditMesh *BKE_editmesh_from_object(struct Object *ob);
@@ -245,6 +245,19 @@ int BKE_fcurve_pathcache_find_array(struct FCurvePathCache *fcache,
                                     struct FCurve **fcurve_result,
                                     int fcurve_result_len);
 
+/* Baked playback cache: per-frame sample tables for fast lookup + lerp evaluation.
+ * The cache is a snapshot, editing curves while it exists will not be reflected
+ * until it is freed and rebuilt (see ACT_BAKED_CACHE). */
+struct FCurveBakedCache;
+struct FCurveBakedCache *BKE_fcurve_baked_cache_create(ListBase *fcurves,
+                                                       int frame_start,
+                                                       int frame_end);
+bool BKE_fcurve_baked_cache_evaluate(const struct FCurveBakedCache *cache,
+                                     const struct FCurve *fcu,
+                                     float evaltime,
+                                     float *r_value);
+void BKE_fcurve_baked_cache_free(struct FCurveBakedCache *cache);
+
 /* get the time extents for F-Curve */
 bool BKE_fcurve_calc_range(
     struct FCurve *fcu, float *min, float *max, const bool do_sel_only, const bool do_min_length);
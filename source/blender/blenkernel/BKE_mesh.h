@@ -23,6 +23,7 @@
  */
 
 #include "BKE_mesh_types.h"
+#include "BLI_bitmap.h"
 #include "BLI_utildefines.h"
 
 struct BLI_Stack;
@@ -51,6 +52,7 @@ struct MVert;
 struct Main;
 struct MemArena;
 struct Mesh;
+struct MeshElemMap;
 struct ModifierData;
 struct Object;
 struct PointCloud;
@@ -292,6 +294,14 @@ void BKE_mesh_calc_normals_poly_and_vertex(struct MVert *mvert,
                                            float (*r_poly_normals)[3],
                                            float (*r_vert_normals)[3]);
 void BKE_mesh_calc_normals(struct Mesh *me);
+void BKE_mesh_calc_normals_partial(struct MVert *mvert,
+                                   int mvert_len,
+                                   const struct MLoop *mloop,
+                                   const struct MPoly *mpoly,
+                                   int mpoly_len,
+                                   const BLI_bitmap *dirty_verts,
+                                   const struct MeshElemMap *vert_to_poly,
+                                   float (*r_poly_normals)[3]);
 void BKE_mesh_ensure_normals(struct Mesh *me);
 void BKE_mesh_ensure_normals_for_display(struct Mesh *mesh);
 void BKE_mesh_calc_normals_looptri(struct MVert *mverts,
@@ -33,7 +33,9 @@ struct Mesh *BKE_mesh_remesh_voxel_fix_poles(const struct Mesh *mesh);
 struct Mesh *BKE_mesh_remesh_voxel(const struct Mesh *mesh,
                                    float voxel_size,
                                    float adaptivity,
-                                   float isovalue);
+                                   float isovalue,
+                                   void (*update_cb)(void *, float progress, int *cancel),
+                                   void *update_cb_data);
 struct Mesh *BKE_mesh_remesh_quadriflow(const struct Mesh *mesh,
                                         int target_faces,
                                         int seed,
@@ -24,6 +24,9 @@
 
 typedef enum eMeshBatchDirtyMode {
   BKE_MESH_BATCH_DIRTY_ALL = 0,
+  /** Only vertex positions changed (topology & attributes are unchanged),
+   * keeps index buffers and attribute data, see #BKE_editmesh_deform_only_update_tag. */
+  BKE_MESH_BATCH_DIRTY_DEFORM,
   BKE_MESH_BATCH_DIRTY_SELECT,
   BKE_MESH_BATCH_DIRTY_SELECT_PAINT,
   BKE_MESH_BATCH_DIRTY_SHADING,
@@ -107,6 +107,9 @@ void BKE_ocean_simulate(struct Ocean *o, float t, float scale, float chop_amount
 /* sampling the ocean surface */
 float BKE_ocean_jminus_to_foam(float jminus, float coverage);
 void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float v);
+void BKE_ocean_eval_uv_no_lock(struct Ocean *oc, struct OceanResult *ocr, float u, float v);
+void BKE_ocean_eval_lock(struct Ocean *oc);
+void BKE_ocean_eval_unlock(struct Ocean *oc);
 void BKE_ocean_eval_uv_catrom(struct Ocean *oc, struct OceanResult *ocr, float u, float v);
 void BKE_ocean_eval_xz(struct Ocean *oc, struct OceanResult *ocr, float x, float z);
 void BKE_ocean_eval_xz_catrom(struct Ocean *oc, struct OceanResult *ocr, float x, float z);
@@ -433,6 +433,32 @@ typedef struct SculptBoundary {
   } twist;
 } SculptBoundary;
 
+/**
+ * Cached vertex-to-vertex connectivity in a compressed row layout.
+ * Only valid while a tool that cannot change topology, visibility or face
+ * sets is active, see #SCULPT_vertex_neighbors_cache_ensure.
+ */
+typedef struct SculptNeighborsCache {
+  /* Offset of every vertex into `neighbors`, of length totvert + 1. */
+  int *offsets;
+  /* Flat array with the neighbor indices of all vertices. */
+  int *neighbors;
+} SculptNeighborsCache;
+
+/**
+ * Cached result of the last geodesic distance computation, reused to speed up
+ * repeated Expand invocations (see sculpt_geodesic.c). Invalidated whenever
+ * coordinates or visibility change.
+ */
+typedef struct SculptGeodesicCache {
+  /* Seed vertices the field was computed from. */
+  int *initial_vertices;
+  int initial_vertices_num;
+  /* Geodesic distance per base mesh vertex. */
+  float *dists;
+  int totvert;
+} SculptGeodesicCache;
+
 typedef struct SculptFakeNeighbors {
   bool use_fake_neighbors;
 
@@ -565,6 +591,8 @@ typedef struct SculptSession {
   SculptPersistentBase *persistent_base;
 
   SculptVertexInfo vertex_info;
+  SculptNeighborsCache neighbors_cache;
+  SculptGeodesicCache geodesic_cache;
   SculptFakeNeighbors fake_neighbors;
 
   /* Transform operator */
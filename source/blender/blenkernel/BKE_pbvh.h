@@ -78,6 +78,10 @@ typedef enum {
 
   PBVH_UpdateTopology = 1 << 13,
   PBVH_UpdateColor = 1 << 14,
+
+  /* Draw buffers were already filled by a background task and only
+   * need the final GPU upload, see BKE_pbvh_draw_buffers_update_async. */
+  PBVH_DrawBufferStaged = 1 << 15,
 } PBVHNodeFlags;
 
 typedef struct PBVHFrustumPlanes {
@@ -193,6 +197,14 @@ bool BKE_pbvh_node_find_nearest_to_ray(PBVH *pbvh,
 
 /* Drawing */
 
+/* Start filling the draw buffers of all nodes tagged for update on task pool workers, so
+ * the next draw only has to upload them (see BKE_pbvh_draw_buffers_join). Any OpenGL work
+ * (freeing rebuilt buffers) still happens on the calling thread. */
+void BKE_pbvh_draw_buffers_update_async(PBVH *pbvh);
+/* Wait for async draw buffer extraction to finish. Must be called before modifying mesh
+ * data the extraction reads from (the draw code joins implicitly). */
+void BKE_pbvh_draw_buffers_join(PBVH *pbvh);
+
 void BKE_pbvh_draw_cb(PBVH *pbvh,
                       bool update_only_visible,
                       PBVHFrustumPlanes *update_frustum,
@@ -304,6 +316,9 @@ void BKE_pbvh_update_bounds(PBVH *pbvh, int flags);
 void BKE_pbvh_update_vertex_data(PBVH *pbvh, int flags);
 void BKE_pbvh_update_visibility(PBVH *pbvh);
 void BKE_pbvh_update_normals(PBVH *pbvh, struct SubdivCCG *subdiv_ccg);
+/* Set bits in r_dirty_verts (sized to the mesh vertex count) for all vertices tagged for a
+ * normal update, to feed #BKE_mesh_calc_normals_partial. Does not clear the tags. */
+void BKE_pbvh_get_vert_normals_dirty(PBVH *pbvh, BLI_bitmap *r_dirty_verts);
 void BKE_pbvh_redraw_BB(PBVH *pbvh, float bb_min[3], float bb_max[3]);
 void BKE_pbvh_get_grid_updates(PBVH *pbvh, bool clear, void ***r_gridfaces, int *r_totface);
 void BKE_pbvh_grids_update(PBVH *pbvh,
@@ -28,6 +28,9 @@ extern "C" {
 
 #define SOUND_WAVE_SAMPLES_PER_SECOND 250
 
+/** Number of downsampled min/max/rms levels, each with half the samples of the previous one. */
+#define SOUND_WAVEFORM_PYRAMID_LEVELS 8
+
 #if defined(WITH_AUDASPACE)
 #  include <AUD_Device.h>
 #endif
@@ -40,6 +43,10 @@ struct bSound;
 typedef struct SoundWaveform {
   int length;
   float *data;
+  /** Downsampled copies of #data for drawing zoomed out timelines. Level 0 has half the
+   * samples, each further level halves again. Unused levels are NULL with zero length. */
+  int pyramid_length[SOUND_WAVEFORM_PYRAMID_LEVELS];
+  float *pyramid[SOUND_WAVEFORM_PYRAMID_LEVELS];
 } SoundWaveform;
 
 void BKE_sound_init_once(void);
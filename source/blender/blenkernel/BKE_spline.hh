@@ -550,6 +550,7 @@ struct CurveEval {
 
   void translate(const blender::float3 &translation);
   void transform(const blender::float4x4 &matrix);
+  void ensure_evaluation_cache() const;
   void bounds_min_max(blender::float3 &min, blender::float3 &max, const bool use_evaluated) const;
 
   blender::Array<int> control_point_offsets() const;
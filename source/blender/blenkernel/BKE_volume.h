@@ -116,6 +116,10 @@ bool BKE_volume_grid_is_loaded(const struct VolumeGrid *grid);
 
 /* Metadata */
 const char *BKE_volume_grid_name(const struct VolumeGrid *grid);
+/* Key uniquely identifying the contents of a file-backed grid, for caching data derived from it
+ * across frame changes. Returns a newly allocated string to be freed by the caller, or NULL for
+ * in-memory grids which have no stable identity. */
+char *BKE_volume_grid_file_cache_key(const struct VolumeGrid *grid);
 VolumeGridType BKE_volume_grid_type(const struct VolumeGrid *grid);
 int BKE_volume_grid_channels(const struct VolumeGrid *grid);
 void BKE_volume_grid_transform_matrix(const struct VolumeGrid *grid, float mat[4][4]);
@@ -39,6 +39,7 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
+#include "BLI_threads.h"
 #include "BLI_math.h"
 #include "BLI_session_uuid.h"
 #include "BLI_string_utils.h"
@@ -46,6 +47,8 @@
 
 #include "BLT_translation.h"
 
+#include "atomic_ops.h"
+
 #include "BKE_action.h"
 #include "BKE_anim_data.h"
 #include "BKE_anim_visualization.h"
@@ -144,6 +147,10 @@ static void action_copy_data(Main *UNUSED(bmain), ID *id_dst, const ID *id_src,
     }
   }
 
+  /* The baked cache and group hash are runtime data, never shared between copies. */
+  action_dst->baked_cache = NULL;
+  action_dst->grouphash = NULL;
+
   if (flag & LIB_ID_COPY_NO_PREVIEW) {
     action_dst->preview = NULL;
   }
@@ -162,11 +169,14 @@ static void action_free_data(struct ID *id)
   BKE_fcurves_free(&action->curves);
 
   /* Free groups. */
+  BKE_action_groups_hash_free(action);
   BLI_freelistN(&action->groups);
 
   /* Free pose-references (aka local markers). */
   BLI_freelistN(&action->markers);
 
+  BKE_action_baked_cache_free(action);
+
   BKE_previewimg_free(&action->preview);
 }
 
@@ -227,6 +237,9 @@ static void action_blend_read_data(BlendDataReader *reader, ID *id)
     BLO_read_data_address(reader, &agrp->channels.last);
   }
 
+  act->baked_cache = NULL;
+  act->grouphash = NULL;
+
   BLO_read_data_address(reader, &act->preview);
   BKE_previewimg_blend_read(reader, act->preview);
 }
@@ -419,6 +432,10 @@ bActionGroup *action_groups_add_new(bAction *act, const char name[])
   BLI_uniquename(
       &act->groups, agrp, DATA_("Group"), '.', offsetof(bActionGroup, name), sizeof(agrp->name));
 
+  if (act->grouphash) {
+    BLI_ghash_insert(act->grouphash, agrp->name, agrp);
+  }
+
   /* return the new group */
   return agrp;
 }
@@ -587,10 +604,45 @@ bActionGroup *BKE_action_group_find_name(bAction *act, const char name[])
     return NULL;
   }
 
+  if (act->grouphash) {
+    return BLI_ghash_lookup(act->grouphash, (const void *)name);
+  }
+
   /* do string comparisons */
   return BLI_findstring(&act->groups, name, offsetof(bActionGroup, name));
 }
 
+/**
+ * Build the name lookup hash for this action's groups, to speed up many lookups on a stable
+ * action.
+ *
+ * \note Only use on evaluated (copy-on-write) actions. The hash is not maintained when groups are
+ * removed or renamed, editing code relies on it being NULL for original data-blocks. Evaluated
+ * copies are replaced wholesale on any change, which clears the hash (see #action_copy_data).
+ */
+void BKE_action_groups_hash_ensure(bAction *act)
+{
+  if (act->grouphash == NULL) {
+    GHash *grouphash = BLI_ghash_str_new("action grouphash");
+    LISTBASE_FOREACH (bActionGroup *, agrp, &act->groups) {
+      BLI_ghash_insert(grouphash, agrp->name, agrp);
+    }
+    /* Evaluation may ensure the hash of a shared action from multiple threads at once, only one
+     * of the hashes can be kept then. */
+    if (atomic_cas_ptr((void **)&act->grouphash, NULL, grouphash) != NULL) {
+      BLI_ghash_free(grouphash, NULL, NULL);
+    }
+  }
+}
+
+void BKE_action_groups_hash_free(bAction *act)
+{
+  if (act->grouphash) {
+    BLI_ghash_free(act->grouphash, NULL, NULL);
+    act->grouphash = NULL;
+  }
+}
+
 /* Clear all 'temp' flags on all groups */
 void action_groups_clear_tempflags(bAction *act)
 {
@@ -1418,6 +1470,34 @@ bool action_has_motion(const bAction *act)
   return false;
 }
 
+/* Lock for lazily creating the baked cache: the same action may be evaluated from multiple
+ * depsgraph evaluation threads at once. */
+static ThreadMutex baked_cache_mutex = BLI_MUTEX_INITIALIZER;
+
+struct FCurveBakedCache *BKE_action_baked_cache_ensure(bAction *act)
+{
+  if (act->baked_cache != NULL) {
+    return act->baked_cache;
+  }
+  BLI_mutex_lock(&baked_cache_mutex);
+  if (act->baked_cache == NULL) {
+    float start, end;
+    calc_action_range(act, &start, &end, true);
+    act->baked_cache = BKE_fcurve_baked_cache_create(
+        &act->curves, (int)floorf(start), (int)ceilf(end));
+  }
+  BLI_mutex_unlock(&baked_cache_mutex);
+  return act->baked_cache;
+}
+
+void BKE_action_baked_cache_free(bAction *act)
+{
+  if (act->baked_cache != NULL) {
+    BKE_fcurve_baked_cache_free(act->baked_cache);
+    act->baked_cache = NULL;
+  }
+}
+
 /* Calculate the extents of given action */
 void calc_action_range(const bAction *act, float *start, float *end, short incl_modifiers)
 {
@@ -1751,6 +1831,12 @@ void what_does_obaction(Object *ob,
                         char groupname[],
                         const AnimationEvalContext *anim_eval_context)
 {
+  /* This runs for every action constraint on every frame, hash the group names on evaluated
+   * copies where they can't change under us. */
+  if (act->id.tag & LIB_TAG_COPIED_ON_WRITE) {
+    BKE_action_groups_hash_ensure(act);
+  }
+
   bActionGroup *agrp = BKE_action_group_find_name(act, groupname);
 
   /* clear workob */
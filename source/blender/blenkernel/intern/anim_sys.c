@@ -36,6 +36,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -596,6 +597,46 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
   }
 }
 
+/* Resolved target and result of a single F-Curve in a batched evaluation. */
+typedef struct FCurveEvalItem {
+  FCurve *fcu;
+  PathResolvedRNA anim_rna;
+  float value;
+} FCurveEvalItem;
+
+typedef struct FCurveEvalBatch {
+  FCurveEvalItem *items;
+  const struct FCurveBakedCache *baked_cache;
+  float eval_time;
+} FCurveEvalBatch;
+
+/* Below this number of channels the batched path only adds overhead. */
+#define ANIMSYS_FCURVE_BATCH_SIZE_MIN 64
+
+static void animsys_evaluate_fcurve_batch_cb(void *__restrict userdata_v,
+                                             const int i,
+                                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const FCurveEvalBatch *batch = userdata_v;
+  FCurveEvalItem *item = &batch->items[i];
+  FCurve *fcu = item->fcu;
+
+  /* Same logic as calculate_fcurve() for driver-less curves: evaluation is read-only on the
+   * curve apart from the (documented as non-thread-safe) debug `curval`, which is unique per
+   * curve here. */
+  if (BKE_fcurve_is_empty(fcu)) {
+    item->value = 0.0f;
+  }
+  else if (batch->baked_cache &&
+           BKE_fcurve_baked_cache_evaluate(batch->baked_cache, fcu, batch->eval_time, &item->value)) {
+    fcu->curval = item->value;
+  }
+  else {
+    item->value = evaluate_fcurve(fcu, batch->eval_time);
+    fcu->curval = item->value;
+  }
+}
+
 /**
  * Evaluate all the F-Curves in the given list
  * This performs a set of standard checks. If extra checks are required,
@@ -604,24 +645,89 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
 static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      ListBase *list,
                                      const AnimationEvalContext *anim_eval_context,
-                                     bool flush_to_original)
+                                     bool flush_to_original,
+                                     const struct FCurveBakedCache *baked_cache)
 {
-  /* Calculate then execute each curve. */
+  const int tot_channels = BLI_listbase_count(list);
+
+  if (tot_channels < ANIMSYS_FCURVE_BATCH_SIZE_MIN) {
+    /* Calculate then execute each curve. */
+    LISTBASE_FOREACH (FCurve *, fcu, list) {
+
+      if (!is_fcurve_evaluatable(fcu)) {
+        continue;
+      }
+
+      PathResolvedRNA anim_rna;
+      if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+        float curval;
+        if (baked_cache && (fcu->driver == NULL) &&
+            BKE_fcurve_baked_cache_evaluate(
+                baked_cache, fcu, anim_eval_context->eval_time, &curval)) {
+          fcu->curval = curval;
+        }
+        else {
+          curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
+        }
+        BKE_animsys_write_to_rna_path(&anim_rna, curval);
+        if (flush_to_original) {
+          animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, curval);
+        }
+      }
+    }
+    return;
+  }
+
+  /* Heavy rigs (many hundreds of channels): resolve all targets first, evaluate the curves in
+   * parallel, then write the results back in one serial pass (RNA writes are not thread-safe).
+   */
+  FCurveEvalItem *items = MEM_malloc_arrayN(tot_channels, sizeof(*items), __func__);
+  int tot_items = 0;
+
   LISTBASE_FOREACH (FCurve *, fcu, list) {
 
     if (!is_fcurve_evaluatable(fcu)) {
       continue;
     }
 
-    PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
-      const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
-      BKE_animsys_write_to_rna_path(&anim_rna, curval);
-      if (flush_to_original) {
-        animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, curval);
+    if (fcu->driver != NULL) {
+      /* Driver evaluation reads RNA, keep it on this thread. */
+      PathResolvedRNA anim_rna;
+      if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+        const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
+        BKE_animsys_write_to_rna_path(&anim_rna, curval);
+        if (flush_to_original) {
+          animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, curval);
+        }
       }
+      continue;
+    }
+
+    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &items[tot_items].anim_rna)) {
+      items[tot_items].fcu = fcu;
+      tot_items++;
     }
   }
+
+  FCurveEvalBatch batch;
+  batch.items = items;
+  batch.baked_cache = baked_cache;
+  batch.eval_time = anim_eval_context->eval_time;
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 8;
+  BLI_task_parallel_range(0, tot_items, &batch, animsys_evaluate_fcurve_batch_cb, &settings);
+
+  for (int i = 0; i < tot_items; i++) {
+    FCurveEvalItem *item = &items[i];
+    BKE_animsys_write_to_rna_path(&item->anim_rna, item->value);
+    if (flush_to_original) {
+      animsys_write_orig_anim_rna(ptr, item->fcu->rna_path, item->fcu->array_index, item->value);
+    }
+  }
+
+  MEM_freeN(items);
 }
 
 /* This function assumes that the quaternion is fully keyed, and is stored in array index order. */
@@ -877,8 +983,14 @@ void animsys_evaluate_action(PointerRNA *ptr,
 
   action_idcode_patch_check(ptr->owner_id, act);
 
+  /* Baked playback mode: sample the curves once, evaluate by table lookup afterwards. */
+  const struct FCurveBakedCache *baked_cache = NULL;
+  if (act->flag & ACT_BAKED_CACHE) {
+    baked_cache = BKE_action_baked_cache_ensure(act);
+  }
+
   /* calculate then execute each curve */
-  animsys_evaluate_fcurves(ptr, &act->curves, anim_eval_context, flush_to_original);
+  animsys_evaluate_fcurves(ptr, &act->curves, anim_eval_context, flush_to_original, baked_cache);
 }
 
 /* Evaluate Action and blend it into the current values of the animated properties. */
@@ -928,7 +1040,7 @@ static void nlastrip_evaluate_controls(NlaStrip *strip,
     RNA_pointer_create(NULL, &RNA_NlaStrip, strip, &strip_ptr);
 
     /* execute these settings as per normal */
-    animsys_evaluate_fcurves(&strip_ptr, &strip->fcurves, anim_eval_context, flush_to_original);
+    animsys_evaluate_fcurves(&strip_ptr, &strip->fcurves, anim_eval_context, flush_to_original, NULL);
   }
 
   /* analytically generate values for influence and time (if applicable)
@@ -35,6 +35,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 #include "BLT_translation.h"
 
@@ -2822,12 +2823,25 @@ void BKE_pose_where_is_bone(struct Depsgraph *depsgraph,
 
 /* This only reads anim data from channels, and writes to channels */
 /* This is the only function adding poses */
+static void pose_channel_deform_mat_cb(void *__restrict UNUSED(userdata),
+                                       void *item,
+                                       int UNUSED(index),
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  bPoseChannel *pchan = item;
+
+  if (pchan->bone) {
+    float imat[4][4];
+    invert_m4_m4(imat, pchan->bone->arm_mat);
+    mul_m4_m4m4(pchan->chan_mat, pchan->pose_mat, imat);
+  }
+}
+
 void BKE_pose_where_is(struct Depsgraph *depsgraph, Scene *scene, Object *ob)
 {
   bArmature *arm;
   Bone *bone;
   bPoseChannel *pchan;
-  float imat[4][4];
   float ctime;
 
   if (ob->type != OB_ARMATURE) {
@@ -2891,12 +2905,12 @@ void BKE_pose_where_is(struct Depsgraph *depsgraph, Scene *scene, Object *ob)
     BIK_release_tree(scene, ob, ctime);
   }
 
-  /* calculating deform matrices */
-  for (pchan = ob->pose->chanbase.first; pchan; pchan = pchan->next) {
-    if (pchan->bone) {
-      invert_m4_m4(imat, pchan->bone->arm_mat);
-      mul_m4_m4m4(pchan->chan_mat, pchan->pose_mat, imat);
-    }
+  /* Calculating deform matrices, independent per channel. */
+  {
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 64;
+    BLI_task_parallel_listbase(&ob->pose->chanbase, NULL, pose_channel_deform_mat_cb, &settings);
   }
 }
 
@@ -1108,11 +1108,11 @@ static void save_output_attribute(blender::bke::OutputAttribute &output_attribut
     return;
   }
   WriteAttributeLookup write_attribute = component.attribute_try_get_for_write(name);
-  BUFFER_FOR_CPP_TYPE_VALUE(varray.type(), buffer);
-  for (const int i : IndexRange(varray.size())) {
-    varray.get(i, buffer);
-    write_attribute.varray->set_by_relocate(i, buffer);
-  }
+  varray.materialize_chunked([&](const IndexRange range, const GSpan values) {
+    for (const int i : range) {
+      write_attribute.varray->set_by_copy(i, values[i - range.start()]);
+    }
+  });
 }
 
 static blender::bke::OutputAttribute create_output_attribute(
@@ -135,6 +135,39 @@ BVHTree *bvhtree_build_from_mvert(const MVert *mvert,
   return tree;
 }
 
+typedef struct BVHUpdateFromMvertData {
+  BVHTree *bvhtree;
+  const MVert *mvert;
+  const MVert *mvert_moving;
+  const MVertTri *tri;
+} BVHUpdateFromMvertData;
+
+static void bvhtree_update_from_mvert_task_cb(void *__restrict userdata,
+                                              const int i,
+                                              const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BVHUpdateFromMvertData *data = (BVHUpdateFromMvertData *)userdata;
+  const MVertTri *vt = &data->tri[i];
+  float co[3][3];
+
+  copy_v3_v3(co[0], data->mvert[vt->tri[0]].co);
+  copy_v3_v3(co[1], data->mvert[vt->tri[1]].co);
+  copy_v3_v3(co[2], data->mvert[vt->tri[2]].co);
+
+  if (data->mvert_moving) {
+    float co_moving[3][3];
+    /* update moving positions */
+    copy_v3_v3(co_moving[0], data->mvert_moving[vt->tri[0]].co);
+    copy_v3_v3(co_moving[1], data->mvert_moving[vt->tri[1]].co);
+    copy_v3_v3(co_moving[2], data->mvert_moving[vt->tri[2]].co);
+
+    BLI_bvhtree_update_node(data->bvhtree, i, &co[0][0], &co_moving[0][0], 3);
+  }
+  else {
+    BLI_bvhtree_update_node(data->bvhtree, i, &co[0][0], NULL, 3);
+  }
+}
+
 void bvhtree_update_from_mvert(BVHTree *bvhtree,
                                const MVert *mvert,
                                const MVert *mvert_moving,
@@ -151,37 +184,22 @@ void bvhtree_update_from_mvert(BVHTree *bvhtree,
     moving = false;
   }
 
-  const MVertTri *vt;
-  int i;
-  for (i = 0, vt = tri; i < tri_num; i++, vt++) {
-    float co[3][3];
-    bool ret;
-
-    copy_v3_v3(co[0], mvert[vt->tri[0]].co);
-    copy_v3_v3(co[1], mvert[vt->tri[1]].co);
-    copy_v3_v3(co[2], mvert[vt->tri[2]].co);
-
-    /* copy new locations into array */
-    if (moving) {
-      float co_moving[3][3];
-      /* update moving positions */
-      copy_v3_v3(co_moving[0], mvert_moving[vt->tri[0]].co);
-      copy_v3_v3(co_moving[1], mvert_moving[vt->tri[1]].co);
-      copy_v3_v3(co_moving[2], mvert_moving[vt->tri[2]].co);
-
-      ret = BLI_bvhtree_update_node(bvhtree, i, &co[0][0], &co_moving[0][0], 3);
-    }
-    else {
-      ret = BLI_bvhtree_update_node(bvhtree, i, &co[0][0], NULL, 3);
-    }
+  /* Leaf bounding volumes only depend on their own triangle, so they can be
+   * updated in parallel. Updating a node cannot fail for the indices the tree
+   * was built with, hence no tree-full check like the insertion loop has. */
+  BVHUpdateFromMvertData data = {
+      .bvhtree = bvhtree,
+      .mvert = mvert,
+      .mvert_moving = moving ? mvert_moving : NULL,
+      .tri = tri,
+  };
 
-    /* check if tree is already full */
-    if (ret == false) {
-      break;
-    }
-  }
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, tri_num, &data, bvhtree_update_from_mvert_task_cb, &settings);
 
-  BLI_bvhtree_update_tree(bvhtree);
+  BLI_bvhtree_refit(bvhtree);
 }
 
 /* ***************************
@@ -31,6 +31,7 @@
 
 #include "BLI_linklist.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_DerivedMesh.h"
@@ -189,6 +190,45 @@ void BKE_crazyspace_set_quats_editmesh(BMEditMesh *em,
   }
 }
 
+typedef struct SetQuatsMeshData {
+  const MVert *mvert;
+  /** Per derived vertex the (prev, curr, next) corner triple, quat goes to curr. */
+  int (*corners)[3];
+  float (*origcos)[3];
+  float (*mappedcos)[3];
+  float (*quats)[4];
+} SetQuatsMeshData;
+
+static void crazyspace_set_quats_mesh_task(void *__restrict userdata,
+                                           const int i,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SetQuatsMeshData *data = userdata;
+  const int v_prev = data->corners[i][0];
+  const int v_curr = data->corners[i][1];
+  const int v_next = data->corners[i][2];
+  const float *co_prev, *co_curr, *co_next; /* orig */
+
+  if (data->origcos) {
+    co_prev = data->origcos[v_prev];
+    co_curr = data->origcos[v_curr];
+    co_next = data->origcos[v_next];
+  }
+  else {
+    co_prev = data->mvert[v_prev].co;
+    co_curr = data->mvert[v_curr].co;
+    co_next = data->mvert[v_next].co;
+  }
+
+  set_crazy_vertex_quat(data->quats[v_curr],
+                        co_curr,
+                        co_next,
+                        co_prev,
+                        data->mappedcos[v_curr],
+                        data->mappedcos[v_next],
+                        data->mappedcos[v_prev]);
+}
+
 void BKE_crazyspace_set_quats_mesh(Mesh *me,
                                    float (*origcos)[3],
                                    float (*mappedcos)[3],
@@ -199,7 +239,12 @@ void BKE_crazyspace_set_quats_mesh(Mesh *me,
     mvert->flag &= ~ME_VERT_TMP_TAG;
   }
 
-  /* first store two sets of tangent vectors in vertices, we derive it just from the face-edges */
+  /* Gather the first face-corner of each vertex serially (the quat of a vertex
+   * depends on which of its corners is used, keep the original first-touch
+   * order), the actual derivation below is independent per vertex. */
+  int(*corners)[3] = MEM_mallocN(sizeof(*corners) * me->totvert, __func__);
+  int corners_len = 0;
+
   mvert = me->mvert;
   MPoly *mp = me->mpoly;
   MLoop *mloop = me->mloop;
@@ -211,27 +256,10 @@ void BKE_crazyspace_set_quats_mesh(Mesh *me,
 
     for (int j = 0; j < mp->totloop; j++) {
       if ((mvert[ml_curr->v].flag & ME_VERT_TMP_TAG) == 0) {
-        const float *co_prev, *co_curr, *co_next; /* orig */
-        const float *vd_prev, *vd_curr, *vd_next; /* deform */
-
-        /* retrieve mapped coordinates */
-        vd_prev = mappedcos[ml_prev->v];
-        vd_curr = mappedcos[ml_curr->v];
-        vd_next = mappedcos[ml_next->v];
-
-        if (origcos) {
-          co_prev = origcos[ml_prev->v];
-          co_curr = origcos[ml_curr->v];
-          co_next = origcos[ml_next->v];
-        }
-        else {
-          co_prev = mvert[ml_prev->v].co;
-          co_curr = mvert[ml_curr->v].co;
-          co_next = mvert[ml_next->v].co;
-        }
-
-        set_crazy_vertex_quat(
-            quats[ml_curr->v], co_curr, co_next, co_prev, vd_curr, vd_next, vd_prev);
+        corners[corners_len][0] = (int)ml_prev->v;
+        corners[corners_len][1] = (int)ml_curr->v;
+        corners[corners_len][2] = (int)ml_next->v;
+        corners_len++;
 
         mvert[ml_curr->v].flag |= ME_VERT_TMP_TAG;
       }
@@ -241,6 +269,22 @@ void BKE_crazyspace_set_quats_mesh(Mesh *me,
       ml_next++;
     }
   }
+
+  {
+    SetQuatsMeshData data = {
+        .mvert = me->mvert,
+        .corners = corners,
+        .origcos = origcos,
+        .mappedcos = mappedcos,
+        .quats = quats,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 512;
+    BLI_task_parallel_range(0, corners_len, &data, crazyspace_set_quats_mesh_task, &settings);
+  }
+
+  MEM_freeN(corners);
 }
 
 /**
@@ -87,22 +87,48 @@ void CurveEval::remove_splines(blender::IndexMask mask)
 
 void CurveEval::translate(const float3 &translation)
 {
-  for (SplinePtr &spline : this->splines()) {
+  blender::MutableSpan<SplinePtr> splines = this->splines();
+  blender::threading::parallel_for_each(splines, [&](SplinePtr &spline) {
     spline->translate(translation);
     spline->mark_cache_invalid();
-  }
+  });
 }
 
 void CurveEval::transform(const float4x4 &matrix)
 {
-  for (SplinePtr &spline : this->splines()) {
-    spline->transform(matrix);
-  }
+  blender::MutableSpan<SplinePtr> splines = this->splines();
+  blender::threading::parallel_for_each(splines,
+                                        [&](SplinePtr &spline) { spline->transform(matrix); });
+}
+
+/**
+ * Evaluate all splines from multiple threads. The results are stored in the lazy per-spline
+ * caches, which are only recomputed for splines whose cache has been invalidated, so calling this
+ * is only a performance optimization for code that would otherwise trigger the evaluation of many
+ * splines one after the other.
+ */
+void CurveEval::ensure_evaluation_cache() const
+{
+  blender::Span<SplinePtr> splines = this->splines();
+  blender::threading::parallel_for_each(splines, [](const SplinePtr &spline) {
+    /* These functions fill the corresponding caches on each spline. */
+    spline->evaluated_positions();
+    spline->evaluated_tangents();
+    spline->evaluated_normals();
+    spline->evaluated_lengths();
+  });
 }
 
 void CurveEval::bounds_min_max(float3 &min, float3 &max, const bool use_evaluated) const
 {
-  for (const SplinePtr &spline : this->splines()) {
+  blender::Span<SplinePtr> splines = this->splines();
+  if (use_evaluated) {
+    /* Fill the evaluated position caches in parallel first, so the serial loop below doesn't
+     * evaluate every spline one after the other. */
+    blender::threading::parallel_for_each(
+        splines, [](const SplinePtr &spline) { spline->evaluated_positions(); });
+  }
+  for (const SplinePtr &spline : splines) {
     spline->bounds_min_max(min, max, use_evaluated);
   }
 }
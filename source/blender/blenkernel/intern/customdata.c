@@ -36,12 +36,14 @@
 
 #include "BLI_bitmap.h"
 #include "BLI_endian_switch.h"
+#include "BLI_ghash.h"
 #include "BLI_math.h"
 #include "BLI_math_color_blend.h"
 #include "BLI_mempool.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -2142,6 +2144,7 @@ bool CustomData_merge(const struct CustomData *source,
       case CD_ASSIGN:
       case CD_REFERENCE:
       case CD_DUPLICATE:
+      case CD_SHARED:
         data = layer->data;
         break;
       default:
@@ -2158,6 +2161,12 @@ bool CustomData_merge(const struct CustomData *source,
     }
 
     if (newlayer) {
+      if (alloctype == CD_SHARED) {
+        /* The source becomes a shared user of its own data as well,
+         * so it stops writing to (or freeing) it while others use it. */
+        layer->flag |= CD_FLAG_SHARED;
+      }
+
       newlayer->uid = layer->uid;
 
       newlayer->active = lastactive;
@@ -2179,7 +2188,9 @@ void CustomData_realloc(CustomData *data, int totelem)
   for (int i = 0; i < data->totlayer; i++) {
     CustomDataLayer *layer = &data->layers[i];
     const LayerTypeInfo *typeInfo;
-    if (layer->flag & CD_FLAG_NOFREE) {
+    /* Shared data may not be reallocated either, other users would be left
+     * with a dangling pointer (callers have to un-share such layers first). */
+    if (layer->flag & (CD_FLAG_NOFREE | CD_FLAG_SHARED)) {
       continue;
     }
     typeInfo = layerType_getInfo(layer->type);
@@ -2202,10 +2213,78 @@ void CustomData_copy(const struct CustomData *source,
   CustomData_merge(source, dest, mask, alloctype, totelem);
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Shared Layer Data Reference Counting (#CD_SHARED)
+ *
+ * User counts of layer data shared between CustomData instances. Only layers that are
+ * actually shared ever touch this table: a data pointer is added when first shared (with
+ * the source and the new layer as its two users) and removed again once a single user
+ * remains, so the common unshared case stays free of overhead.
+ * \{ */
+
+static struct {
+  GHash *user_counts; /* data pointer -> user count */
+  ThreadMutex mutex;
+} shared_layer_data = {NULL, BLI_MUTEX_INITIALIZER};
+
+/** Register one additional user of \a data (called for each newly shared layer). */
+static void customdata_shared_data_user_add(void *data)
+{
+  BLI_mutex_lock(&shared_layer_data.mutex);
+  if (UNLIKELY(shared_layer_data.user_counts == NULL)) {
+    shared_layer_data.user_counts = BLI_ghash_ptr_new(__func__);
+  }
+  void **count_p;
+  if (BLI_ghash_ensure_p(shared_layer_data.user_counts, data, &count_p)) {
+    /* Second user: the pre-existing owner becomes the first. */
+    *count_p = POINTER_FROM_INT(2);
+  }
+  else {
+    *count_p = POINTER_FROM_INT(POINTER_AS_INT(*count_p) + 1);
+  }
+  BLI_mutex_unlock(&shared_layer_data.mutex);
+}
+
+/**
+ * Remove one user of \a data.
+ * \return true when the caller was the last user (and therefore has to free the data).
+ */
+static bool customdata_shared_data_user_remove(void *data)
+{
+  bool do_free = true;
+  BLI_mutex_lock(&shared_layer_data.mutex);
+  if (shared_layer_data.user_counts != NULL) {
+    void **count_p = BLI_ghash_lookup_p(shared_layer_data.user_counts, data);
+    if (count_p != NULL) {
+      const int count = POINTER_AS_INT(*count_p) - 1;
+      if (count > 1) {
+        *count_p = POINTER_FROM_INT(count);
+      }
+      else {
+        /* A single user remains, which can treat the data as exclusively owned again. */
+        BLI_ghash_remove(shared_layer_data.user_counts, data, NULL, NULL);
+      }
+      do_free = false;
+    }
+  }
+  BLI_mutex_unlock(&shared_layer_data.mutex);
+  return do_free;
+}
+
+/** \} */
+
 static void customData_free_layer__internal(CustomDataLayer *layer, int totelem)
 {
   const LayerTypeInfo *typeInfo;
 
+  if (layer->flag & CD_FLAG_SHARED) {
+    if (!customdata_shared_data_user_remove(layer->data)) {
+      /* Other users remain, they keep ownership of the data. */
+      return;
+    }
+    /* Last user, fall through and free the data normally. */
+  }
+
   if (!(layer->flag & CD_FLAG_NOFREE) && layer->data) {
     typeInfo = layerType_getInfo(layer->type);
 
@@ -2520,13 +2599,13 @@ static CustomDataLayer *customData_add_layer__internal(CustomData *data,
 
   /* Passing a layer-data to copy from with an alloctype that won't copy is
    * most likely a bug */
-  BLI_assert(!layerdata || ELEM(alloctype, CD_ASSIGN, CD_DUPLICATE, CD_REFERENCE));
+  BLI_assert(!layerdata || ELEM(alloctype, CD_ASSIGN, CD_DUPLICATE, CD_REFERENCE, CD_SHARED));
 
   if (!typeInfo->defaultname && CustomData_has_layer(data, type)) {
     return &data->layers[CustomData_get_layer_index(data, type)];
   }
 
-  if (ELEM(alloctype, CD_ASSIGN, CD_REFERENCE)) {
+  if (ELEM(alloctype, CD_ASSIGN, CD_REFERENCE, CD_SHARED)) {
     newlayerdata = layerdata;
   }
   else if (totelem > 0 && typeInfo->size > 0) {
@@ -2560,6 +2639,10 @@ static CustomDataLayer *customData_add_layer__internal(CustomData *data,
   else if (alloctype == CD_REFERENCE) {
     flag |= CD_FLAG_NOFREE;
   }
+  else if (alloctype == CD_SHARED) {
+    flag |= CD_FLAG_SHARED;
+    customdata_shared_data_user_add(layerdata);
+  }
 
   if (index >= data->maxlayer) {
     if (!customData_resize(data, CUSTOMDATA_GROW)) {
@@ -2759,6 +2842,27 @@ static void *customData_duplicate_referenced_layer_index(CustomData *data,
 
   CustomDataLayer *layer = &data->layers[layer_index];
 
+  if (layer->flag & CD_FLAG_SHARED) {
+    /* Copy-on-write: only this user's layer gets a private copy, other users keep
+     * sharing the original data. When this was the last shared user, ownership is
+     * simply taken back without copying. */
+    if (customdata_shared_data_user_remove(layer->data)) {
+      layer->flag &= ~CD_FLAG_SHARED;
+      return layer->data;
+    }
+    const LayerTypeInfo *typeInfo = layerType_getInfo(layer->type);
+    void *dst_data = MEM_malloc_arrayN((size_t)totelem, typeInfo->size, "CD duplicate ref layer");
+    if (typeInfo->copy) {
+      typeInfo->copy(layer->data, dst_data, totelem);
+    }
+    else {
+      memcpy(dst_data, layer->data, (size_t)totelem * typeInfo->size);
+    }
+    layer->data = dst_data;
+    layer->flag &= ~CD_FLAG_SHARED;
+    return layer->data;
+  }
+
   if (layer->flag & CD_FLAG_NOFREE) {
     /* MEM_dupallocN won't work in case of complex layers, like e.g.
      * CD_MDEFORMVERT, which has pointers to allocated data...
@@ -41,7 +41,9 @@
 #include "BLI_memarena.h"
 #include "BLI_scanfill.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_anim_path.h"
 #include "BKE_curve.h"
@@ -62,6 +64,7 @@
 #include "DEG_depsgraph_query.h"
 
 using blender::IndexRange;
+using blender::Vector;
 
 static void boundbox_displist_object(Object *ob);
 
@@ -1394,6 +1397,119 @@ static void calc_bevfac_mapping(const Curve *cu,
   }
 }
 
+/**
+ * One bevel cross-section swept along one spline. The target #DispList is allocated and linked
+ * into the result up-front, so the vertex emission for all sweeps can run in parallel afterwards.
+ */
+struct BevelSweep {
+  const BevList *bl;
+  const Nurb *nu;
+  const DispList *dlb;
+  DispList *dl;
+  int start;
+  int steps;
+  float first_blend;
+  float last_blend;
+  /** Shared by all sweeps of the same spline, owned by the caller. */
+  const float *radius_factors;
+};
+
+/**
+ * Calculate the per-step radius factors of a spline up-front. The taper can lazily trigger
+ * evaluation of another curve object, which may not happen from a worker thread.
+ */
+static float *bevel_spline_radius_factors_calc(Depsgraph *depsgraph,
+                                               const Scene *scene,
+                                               const Curve *cu,
+                                               const BevList *bl,
+                                               const int start,
+                                               const int steps,
+                                               const float first_blend,
+                                               const float last_blend)
+{
+  float *radius_factors = (float *)MEM_mallocN(sizeof(float) * steps, __func__);
+
+  const BevPoint *bevp = &bl->bevpoints[start];
+  for (int i = start, a = 0; a < steps; i++, bevp++, a++) {
+    float radius_factor = 1.0;
+
+    if (cu->taperobj == nullptr) {
+      radius_factor = bevp->radius;
+    }
+    else {
+      float taper_factor;
+      if (cu->flag & CU_MAP_TAPER) {
+        float len = (steps - 3) + first_blend + last_blend;
+
+        if (a == 0) {
+          taper_factor = 0.0f;
+        }
+        else if (a == steps - 1) {
+          taper_factor = 1.0f;
+        }
+        else {
+          taper_factor = ((float)a - (1.0f - first_blend)) / len;
+        }
+      }
+      else {
+        float len = bl->nr - 1;
+        taper_factor = (float)i / len;
+
+        if (a == 0) {
+          taper_factor += (1.0f - first_blend) / len;
+        }
+        else if (a == steps - 1) {
+          taper_factor -= (1.0f - last_blend) / len;
+        }
+      }
+
+      radius_factor = displist_calc_taper(depsgraph, scene, cu->taperobj, taper_factor);
+
+      if (cu->taper_radius_mode == CU_TAPER_RADIUS_MULTIPLY) {
+        radius_factor *= bevp->radius;
+      }
+      else if (cu->taper_radius_mode == CU_TAPER_RADIUS_ADD) {
+        radius_factor += bevp->radius;
+      }
+    }
+
+    radius_factors[a] = radius_factor;
+  }
+
+  return radius_factors;
+}
+
+static void bevel_sweep_fill_verts(const Curve *cu, const float widfac, const BevelSweep *sweep)
+{
+  const BevList *bl = sweep->bl;
+  const DispList *dlb = sweep->dlb;
+
+  /* For each point of poly make a bevel piece. */
+  const BevPoint *bevp_first = bl->bevpoints;
+  const BevPoint *bevp_last = &bl->bevpoints[bl->nr - 1];
+  const BevPoint *bevp = &bl->bevpoints[sweep->start];
+  float *data = sweep->dl->verts;
+  for (int a = 0; a < sweep->steps; a++, bevp++) {
+    const float radius_factor = sweep->radius_factors[a];
+
+    /* Rotate bevel piece and write in data. */
+    if ((a == 0) && (bevp != bevp_last)) {
+      rotateBevelPiece(
+          cu, bevp, bevp + 1, dlb, 1.0f - sweep->first_blend, widfac, radius_factor, &data);
+    }
+    else if ((a == sweep->steps - 1) && (bevp != bevp_first)) {
+      rotateBevelPiece(
+          cu, bevp, bevp - 1, dlb, 1.0f - sweep->last_blend, widfac, radius_factor, &data);
+    }
+    else {
+      rotateBevelPiece(cu, bevp, nullptr, dlb, 0.0f, widfac, radius_factor, &data);
+    }
+  }
+
+  /* gl array drawing: using indices */
+  displist_surf_indices(sweep->dl);
+}
+
 static void evaluate_curve_type_object(Depsgraph *depsgraph,
                                        const Scene *scene,
                                        Object *ob,
@@ -1433,6 +1549,11 @@ static void evaluate_curve_type_object(Depsgraph *depsgraph,
   else {
     const float widfac = cu->width - 1.0f;
 
+    /* Sweeps are only collected here; their vertex emission runs in parallel below, with the
+     * target display lists already allocated and linked into the result. */
+    Vector<BevelSweep> sweeps;
+    Vector<float *> radius_factor_arrays;
+
     const BevList *bl = (BevList *)ob->runtime.curve_cache->bev.first;
     const Nurb *nu = (Nurb *)deformed_nurbs->first;
     for (; bl && nu; bl = bl->next, nu = nu->next) {
@@ -1474,10 +1595,6 @@ static void evaluate_curve_type_object(Depsgraph *depsgraph,
         }
       }
       else {
-        ListBase bottom_capbase = {nullptr, nullptr};
-        ListBase top_capbase = {nullptr, nullptr};
-        float bottom_no[3] = {0.0f};
-        float top_no[3] = {0.0f};
         float first_blend = 0.0f, last_blend = 0.0f;
         int start, steps = 0;
 
@@ -1492,10 +1609,14 @@ static void evaluate_curve_type_object(Depsgraph *depsgraph,
           calc_bevfac_mapping(cu, bl, nu, &start, &first_blend, &steps, &last_blend);
         }
 
+        float *radius_factors = bevel_spline_radius_factors_calc(
+            depsgraph, scene, cu, bl, start, steps, first_blend, last_blend);
+        radius_factor_arrays.append(radius_factors);
+
         LISTBASE_FOREACH (DispList *, dlb, &dlbev) {
           /* for each part of the bevel use a separate displblock */
           DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), __func__);
-          dl->verts = data = (float *)MEM_mallocN(sizeof(float[3]) * dlb->nr * steps, __func__);
+          dl->verts = (float *)MEM_mallocN(sizeof(float[3]) * dlb->nr * steps, __func__);
           BLI_addtail(r_dispbase, dl);
 
           dl->type = DL_SURF;
@@ -1514,90 +1635,63 @@ static void evaluate_curve_type_object(Depsgraph *depsgraph,
           dl->charidx = nu->charidx;
           dl->rt = nu->flag;
 
-          /* for each point of poly make a bevel piece */
-          BevPoint *bevp_first = bl->bevpoints;
-          BevPoint *bevp_last = &bl->bevpoints[bl->nr - 1];
-          BevPoint *bevp = &bl->bevpoints[start];
-          for (int i = start, a = 0; a < steps; i++, bevp++, a++) {
-            float radius_factor = 1.0;
-            float *cur_data = data;
-
-            if (cu->taperobj == nullptr) {
-              radius_factor = bevp->radius;
-            }
-            else {
-              float taper_factor;
-              if (cu->flag & CU_MAP_TAPER) {
-                float len = (steps - 3) + first_blend + last_blend;
-
-                if (a == 0) {
-                  taper_factor = 0.0f;
-                }
-                else if (a == steps - 1) {
-                  taper_factor = 1.0f;
-                }
-                else {
-                  taper_factor = ((float)a - (1.0f - first_blend)) / len;
-                }
-              }
-              else {
-                float len = bl->nr - 1;
-                taper_factor = (float)i / len;
-
-                if (a == 0) {
-                  taper_factor += (1.0f - first_blend) / len;
-                }
-                else if (a == steps - 1) {
-                  taper_factor -= (1.0f - last_blend) / len;
-                }
-              }
-
-              radius_factor = displist_calc_taper(depsgraph, scene, cu->taperobj, taper_factor);
+          sweeps.append({bl, nu, dlb, dl, start, steps, first_blend, last_blend, radius_factors});
+        }
+      }
+    }
 
-              if (cu->taper_radius_mode == CU_TAPER_RADIUS_MULTIPLY) {
-                radius_factor *= bevp->radius;
-              }
-              else if (cu->taper_radius_mode == CU_TAPER_RADIUS_ADD) {
-                radius_factor += bevp->radius;
-              }
-            }
+    /* Rotating the bevel profile along a spline only writes to that sweep's own vertex block,
+     * so all sweeps can be emitted in parallel. */
+    blender::threading::parallel_for(sweeps.index_range(), 1, [&](IndexRange range) {
+      for (const int i : range) {
+        bevel_sweep_fill_verts(cu, widfac, &sweeps[i]);
+      }
+    });
+
+    /* Cap filling reads the emitted vertices and appends to the result, do it single threaded.
+     * Sweeps of the same spline are contiguous and share their caps. */
+    for (int i = 0; i < sweeps.size();) {
+      const Nurb *sweep_nu = sweeps[i].nu;
+      int spline_end = i;
+      while (spline_end < sweeps.size() && sweeps[spline_end].nu == sweep_nu) {
+        spline_end++;
+      }
 
-            /* rotate bevel piece and write in data */
-            if ((a == 0) && (bevp != bevp_last)) {
-              rotateBevelPiece(
-                  cu, bevp, bevp + 1, dlb, 1.0f - first_blend, widfac, radius_factor, &data);
-            }
-            else if ((a == steps - 1) && (bevp != bevp_first)) {
-              rotateBevelPiece(
-                  cu, bevp, bevp - 1, dlb, 1.0f - last_blend, widfac, radius_factor, &data);
-            }
-            else {
-              rotateBevelPiece(cu, bevp, nullptr, dlb, 0.0f, widfac, radius_factor, &data);
-            }
+      if ((cu->flag & CU_FILL_CAPS) && !(sweep_nu->flagu & CU_NURB_CYCLIC)) {
+        ListBase bottom_capbase = {nullptr, nullptr};
+        ListBase top_capbase = {nullptr, nullptr};
+        float bottom_no[3] = {0.0f};
+        float top_no[3] = {0.0f};
 
-            if ((cu->flag & CU_FILL_CAPS) && !(nu->flagu & CU_NURB_CYCLIC)) {
-              if (a == 1) {
-                fillBevelCap(nu, dlb, cur_data - 3 * dlb->nr, &bottom_capbase);
-                copy_v3_v3(bottom_no, bevp->dir);
-              }
-              if (a == steps - 1) {
-                fillBevelCap(nu, dlb, cur_data, &top_capbase);
-                negate_v3_v3(top_no, bevp->dir);
-              }
-            }
+        for (int j = i; j < spline_end; j++) {
+          const BevelSweep &sweep = sweeps[j];
+          const BevPoint *bevpoints = sweep.bl->bevpoints;
+          if (sweep.steps > 1) {
+            fillBevelCap(sweep_nu, sweep.dlb, sweep.dl->verts, &bottom_capbase);
+            copy_v3_v3(bottom_no, bevpoints[sweep.start + 1].dir);
+          }
+          if (sweep.steps > 0) {
+            fillBevelCap(sweep_nu,
+                         sweep.dlb,
+                         sweep.dl->verts + 3 * sweep.dlb->nr * (sweep.steps - 1),
+                         &top_capbase);
+            negate_v3_v3(top_no, bevpoints[sweep.start + sweep.steps - 1].dir);
           }
-
-          /* gl array drawing: using indices */
-          displist_surf_indices(dl);
         }
 
         if (bottom_capbase.first) {
           BKE_displist_fill(&bottom_capbase, r_dispbase, bottom_no, false);
           BKE_displist_fill(&top_capbase, r_dispbase, top_no, false);
-          BKE_displist_free(&bottom_capbase);
-          BKE_displist_free(&top_capbase);
         }
+        BKE_displist_free(&bottom_capbase);
+        BKE_displist_free(&top_capbase);
       }
+
+      i = spline_end;
+    }
+
+    for (float *radius_factors : radius_factor_arrays) {
+      MEM_freeN(radius_factors);
     }
   }
 
@@ -3918,6 +3918,7 @@ typedef struct DynamicPaintPaintData {
   const Scene *scene;
   const float timescale;
   const int c_index;
+  const int *cells;
 
   Mesh *mesh;
   const MVert *mvert;
@@ -3938,11 +3939,10 @@ typedef struct DynamicPaintPaintData {
 /*
  * Paint a brush object mesh to the surface
  */
-static void dynamic_paint_paint_mesh_cell_point_cb_ex(
-    void *__restrict userdata, const int id, const TaskParallelTLS *__restrict UNUSED(tls))
+static void dynamic_paint_paint_mesh_cell_point(const DynamicPaintPaintData *data,
+                                                const int c_index,
+                                                const int id)
 {
-  const DynamicPaintPaintData *data = userdata;
-
   const DynamicPaintSurface *surface = data->surface;
   const PaintSurfaceData *sData = surface->data;
   const PaintBakeData *bData = sData->bData;
@@ -3951,7 +3951,6 @@ static void dynamic_paint_paint_mesh_cell_point_cb_ex(
   const DynamicPaintBrushSettings *brush = data->brush;
 
   const float timescale = data->timescale;
-  const int c_index = data->c_index;
 
   const MVert *mvert = data->mvert;
   const MLoop *mloop = data->mloop;
@@ -4268,6 +4267,26 @@ static void dynamic_paint_paint_mesh_cell_point_cb_ex(
   }
 }
 
+static void dynamic_paint_paint_mesh_cell_point_cb_ex(
+    void *__restrict userdata, const int id, const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DynamicPaintPaintData *data = userdata;
+  dynamic_paint_paint_mesh_cell_point(data, data->c_index, id);
+}
+
+static void dynamic_paint_paint_mesh_cells_cb_ex(void *__restrict userdata,
+                                                 const int i,
+                                                 const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DynamicPaintPaintData *data = userdata;
+  const VolumeGrid *grid = data->surface->data->bData->grid;
+  const int c_index = data->cells[i];
+
+  for (int id = 0; id < grid->s_num[c_index]; id++) {
+    dynamic_paint_paint_mesh_cell_point(data, c_index, id);
+  }
+}
+
 static bool dynamicPaint_paintMesh(Depsgraph *depsgraph,
                                    DynamicPaintSurface *surface,
                                    DynamicPaintBrushSettings *brush,
@@ -4341,40 +4360,55 @@ static bool dynamicPaint_paintMesh(Depsgraph *depsgraph,
         int c_index;
         int total_cells = grid->dim[0] * grid->dim[1] * grid->dim[2];
 
-        /* loop through space partitioning grid */
+        /* Gather grid cells touched by the brush bounds first, so only those
+         * recompute and they can be processed in parallel: with high
+         * resolution surfaces the grid consists of many small cells and
+         * stepping through them one at a time leaves most threads idle. */
+        int *cells = MEM_mallocN(sizeof(int) * total_cells, __func__);
+        int num_cells = 0;
         for (c_index = 0; c_index < total_cells; c_index++) {
           /* check grid cell bounding box */
           if (!grid->s_num[c_index] ||
               !meshBrush_boundsIntersect(&grid->bounds[c_index], &mesh_bb, brush, brush_radius)) {
             continue;
           }
+          cells[num_cells++] = c_index;
+        }
 
-          /* loop through cell points and process brush */
-          DynamicPaintPaintData data = {
-              .surface = surface,
-              .brush = brush,
-              .brushOb = brushOb,
-              .scene = scene,
-              .timescale = timescale,
-              .c_index = c_index,
-              .mesh = mesh,
-              .mvert = mvert,
-              .mloop = mloop,
-              .mlooptri = mlooptri,
-              .brush_radius = brush_radius,
-              .avg_brushNor = avg_brushNor,
-              .brushVelocity = brushVelocity,
-              .treeData = &treeData,
-          };
-          TaskParallelSettings settings;
-          BLI_parallel_range_settings_defaults(&settings);
-          settings.use_threading = (grid->s_num[c_index] > 250);
+        /* process brush on the touched cells */
+        DynamicPaintPaintData data = {
+            .surface = surface,
+            .brush = brush,
+            .brushOb = brushOb,
+            .scene = scene,
+            .timescale = timescale,
+            .c_index = (num_cells == 1) ? cells[0] : 0,
+            .cells = cells,
+            .mesh = mesh,
+            .mvert = mvert,
+            .mloop = mloop,
+            .mlooptri = mlooptri,
+            .brush_radius = brush_radius,
+            .avg_brushNor = avg_brushNor,
+            .brushVelocity = brushVelocity,
+            .treeData = &treeData,
+        };
+        TaskParallelSettings settings;
+        BLI_parallel_range_settings_defaults(&settings);
+        if (num_cells == 1) {
+          /* A single touched cell: parallelize over its points instead. */
+          settings.use_threading = (grid->s_num[cells[0]] > 250);
           BLI_task_parallel_range(0,
-                                  grid->s_num[c_index],
+                                  grid->s_num[cells[0]],
                                   &data,
                                   dynamic_paint_paint_mesh_cell_point_cb_ex,
                                   &settings);
         }
+        else {
+          BLI_task_parallel_range(
+              0, num_cells, &data, dynamic_paint_paint_mesh_cells_cb_ex, &settings);
+        }
+        MEM_freeN(cells);
       }
     }
     /* free bvh tree */
@@ -4393,11 +4427,10 @@ static bool dynamicPaint_paintMesh(Depsgraph *depsgraph,
 /*
  * Paint a particle system to the surface
  */
-static void dynamic_paint_paint_particle_cell_point_cb_ex(
-    void *__restrict userdata, const int id, const TaskParallelTLS *__restrict UNUSED(tls))
+static void dynamic_paint_paint_particle_cell_point(const DynamicPaintPaintData *data,
+                                                    const int c_index,
+                                                    const int id)
 {
-  const DynamicPaintPaintData *data = userdata;
-
   const DynamicPaintSurface *surface = data->surface;
   const PaintSurfaceData *sData = surface->data;
   const PaintBakeData *bData = sData->bData;
@@ -4408,7 +4441,6 @@ static void dynamic_paint_paint_particle_cell_point_cb_ex(
   const ParticleSystem *psys = data->psys;
 
   const float timescale = data->timescale;
-  const int c_index = data->c_index;
 
   KDTree_3d *tree = data->treeData;
 
@@ -4568,6 +4600,26 @@ static void dynamic_paint_paint_particle_cell_point_cb_ex(
   }
 }
 
+static void dynamic_paint_paint_particle_cell_point_cb_ex(
+    void *__restrict userdata, const int id, const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DynamicPaintPaintData *data = userdata;
+  dynamic_paint_paint_particle_cell_point(data, data->c_index, id);
+}
+
+static void dynamic_paint_paint_particle_cells_cb_ex(void *__restrict userdata,
+                                                     const int i,
+                                                     const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DynamicPaintPaintData *data = userdata;
+  const VolumeGrid *grid = data->surface->data->bData->grid;
+  const int c_index = data->cells[i];
+
+  for (int id = 0; id < grid->s_num[c_index]; id++) {
+    dynamic_paint_paint_particle_cell_point(data, c_index, id);
+  }
+}
+
 static bool dynamicPaint_paintParticles(DynamicPaintSurface *surface,
                                         ParticleSystem *psys,
                                         DynamicPaintBrushSettings *brush,
@@ -4647,32 +4699,44 @@ static bool dynamicPaint_paintParticles(DynamicPaintSurface *surface,
     /* balance tree */
     BLI_kdtree_3d_balance(tree);
 
-    /* loop through space partitioning grid */
+    /* Gather grid cells within reach of the particle system bounds, then
+     * process them in parallel (see dynamicPaint_paintMesh). */
+    int *cells = MEM_mallocN(sizeof(int) * total_cells, __func__);
+    int num_cells = 0;
     for (c_index = 0; c_index < total_cells; c_index++) {
       /* check cell bounding box */
       if (!grid->s_num[c_index] || !boundsIntersectDist(&grid->bounds[c_index], &part_bb, range)) {
         continue;
       }
+      cells[num_cells++] = c_index;
+    }
 
-      /* loop through cell points */
-      DynamicPaintPaintData data = {
-          .surface = surface,
-          .brush = brush,
-          .psys = psys,
-          .solidradius = solidradius,
-          .timescale = timescale,
-          .c_index = c_index,
-          .treeData = tree,
-      };
-      TaskParallelSettings settings;
-      BLI_parallel_range_settings_defaults(&settings);
-      settings.use_threading = (grid->s_num[c_index] > 250);
+    DynamicPaintPaintData data = {
+        .surface = surface,
+        .brush = brush,
+        .psys = psys,
+        .solidradius = solidradius,
+        .timescale = timescale,
+        .c_index = (num_cells == 1) ? cells[0] : 0,
+        .cells = cells,
+        .treeData = tree,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    if (num_cells == 1) {
+      /* A single touched cell: parallelize over its points instead. */
+      settings.use_threading = (grid->s_num[cells[0]] > 250);
       BLI_task_parallel_range(0,
-                              grid->s_num[c_index],
+                              grid->s_num[cells[0]],
                               &data,
                               dynamic_paint_paint_particle_cell_point_cb_ex,
                               &settings);
     }
+    else {
+      BLI_task_parallel_range(
+          0, num_cells, &data, dynamic_paint_paint_particle_cells_cb_ex, &settings);
+    }
+    MEM_freeN(cells);
   }
   BLI_kdtree_3d_free(tree);
 
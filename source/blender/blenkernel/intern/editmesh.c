@@ -50,6 +50,34 @@ BMEditMesh *BKE_editmesh_create(BMesh *bm)
   return em;
 }
 
+void BKE_editmesh_deform_only_update_tag(BMEditMesh *em)
+{
+  BMesh *bm = em->bm;
+  em->deform_only_update.is_set = true;
+  em->deform_only_update.verts_len = bm->totvert;
+  em->deform_only_update.edges_len = bm->totedge;
+  em->deform_only_update.faces_len = bm->totface;
+  em->deform_only_update.loops_len = bm->totloop;
+}
+
+/**
+ * Check & clear the deform-only hint (it only ever applies to a single evaluation).
+ * Returns false when topology changed since #BKE_editmesh_deform_only_update_tag ran.
+ */
+bool BKE_editmesh_deform_only_update_consume(BMEditMesh *em)
+{
+  if (!em->deform_only_update.is_set) {
+    return false;
+  }
+  em->deform_only_update.is_set = false;
+
+  const BMesh *bm = em->bm;
+  return (em->deform_only_update.verts_len == bm->totvert) &&
+         (em->deform_only_update.edges_len == bm->totedge) &&
+         (em->deform_only_update.faces_len == bm->totface) &&
+         (em->deform_only_update.loops_len == bm->totloop);
+}
+
 BMEditMesh *BKE_editmesh_copy(BMEditMesh *em)
 {
   BMEditMesh *em_copy = MEM_callocN(sizeof(BMEditMesh), __func__);
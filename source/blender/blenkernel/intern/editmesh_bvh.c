@@ -36,6 +36,11 @@ struct BMBVHTree {
   BMLoop *(*looptris)[3];
   int looptris_tot;
 
+  /* Maps leaf nodes (in insertion order) to looptri indices,
+   * NULL when no faces were filtered out and the mapping is the identity. */
+  int *leaf_looptri_map;
+  int leaf_tot;
+
   BMesh *bm;
 
   const float (*cos_cage)[3];
@@ -112,9 +117,15 @@ BMBVHTree *BKE_bmbvh_new_ex(BMesh *bm,
 
   bmtree->tree = BLI_bvhtree_new(tottri, epsilon, 8, 8);
 
+  bmtree->leaf_tot = tottri;
+  if (test_fn && tottri != looptris_tot) {
+    bmtree->leaf_looptri_map = MEM_mallocN(sizeof(int) * tottri, __func__);
+  }
+
   f_test_prev = NULL;
   test_fn_ret = false;
 
+  int leaf_index = 0;
   for (int i = 0; i < looptris_tot; i++) {
     if (test_fn) {
       /* NOTE: the arrays won't align now! Take care. */
@@ -140,6 +151,11 @@ BMBVHTree *BKE_bmbvh_new_ex(BMesh *bm,
       copy_v3_v3(cos[2], looptris[i][2]->v->co);
     }
 
+    if (bmtree->leaf_looptri_map) {
+      bmtree->leaf_looptri_map[leaf_index] = i;
+    }
+    leaf_index++;
+
     BLI_bvhtree_insert(bmtree->tree, i, (float *)cos, 3);
   }
 
@@ -148,6 +164,44 @@ BMBVHTree *BKE_bmbvh_new_ex(BMesh *bm,
   return bmtree;
 }
 
+/**
+ * Refit the tree to the current vertex coordinates (or \a cos_cage when the tree was
+ * built from cage coordinates), without changing its topology.
+ *
+ * Much cheaper than rebuilding, intended for modal tools which move vertices between
+ * queries (transform snapping and the like). Bounding volumes stay valid but the tree
+ * quality degrades with large displacements, so callers should still rebuild once the
+ * interactive edit is confirmed.
+ */
+void BKE_bmbvh_refit(BMBVHTree *bmtree)
+{
+  float cos[3][3];
+
+  if (bmtree->cos_cage) {
+    BM_mesh_elem_index_ensure(bmtree->bm, BM_VERT);
+  }
+
+  for (int leaf_index = 0; leaf_index < bmtree->leaf_tot; leaf_index++) {
+    const int i = bmtree->leaf_looptri_map ? bmtree->leaf_looptri_map[leaf_index] : leaf_index;
+    BMLoop **ltri = bmtree->looptris[i];
+
+    if (bmtree->cos_cage) {
+      copy_v3_v3(cos[0], bmtree->cos_cage[BM_elem_index_get(ltri[0]->v)]);
+      copy_v3_v3(cos[1], bmtree->cos_cage[BM_elem_index_get(ltri[1]->v)]);
+      copy_v3_v3(cos[2], bmtree->cos_cage[BM_elem_index_get(ltri[2]->v)]);
+    }
+    else {
+      copy_v3_v3(cos[0], ltri[0]->v->co);
+      copy_v3_v3(cos[1], ltri[1]->v->co);
+      copy_v3_v3(cos[2], ltri[2]->v->co);
+    }
+
+    BLI_bvhtree_update_node(bmtree->tree, leaf_index, (float *)cos, NULL, 3);
+  }
+
+  BLI_bvhtree_refit(bmtree->tree);
+}
+
 static bool bm_face_is_select(BMFace *f, void *UNUSED(user_data))
 {
   return (BM_elem_flag_test(f, BM_ELEM_SELECT) != 0);
@@ -187,6 +241,10 @@ void BKE_bmbvh_free(BMBVHTree *bmtree)
 {
   BLI_bvhtree_free(bmtree->tree);
 
+  if (bmtree->leaf_looptri_map) {
+    MEM_freeN(bmtree->leaf_looptri_map);
+  }
+
   if (bmtree->cos_cage && bmtree->cos_cage_free) {
     MEM_freeN((void *)bmtree->cos_cage);
   }
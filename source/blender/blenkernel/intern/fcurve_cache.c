@@ -29,6 +29,9 @@
 
 #include "BLI_ghash.h"
 #include "BLI_listbase.h"
+#include "BLI_math_base.h"
+#include "BLI_task.h"
+#include "BLI_utildefines.h"
 
 #include "BKE_fcurve.h"
 
@@ -187,3 +190,141 @@ int BKE_fcurve_pathcache_find_array(struct FCurvePathCache *fcache,
 }
 
 /** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name F-Curve Baked Evaluation Cache
+ *
+ * Frame-indexed sample table for fast playback of dense actions,
+ * evaluation becomes a lookup + linear interpolation (see #ACT_BAKED_CACHE).
+ * \{ */
+
+struct FCurveBakedCache_Span {
+  /** Samples of a single F-Curve, one per frame starting at #FCurveBakedCache.frame_start. */
+  float *samples;
+};
+
+struct FCurveBakedCache {
+  /** Map #FCurve to elements in #FCurveBakedCache.span_table. */
+  GHash *span_from_fcurve;
+  /** One span per baked F-Curve. */
+  struct FCurveBakedCache_Span *span_table;
+  /** Shared storage for all spans, `fcurve_len * sample_len` values. */
+  float *sample_buffer;
+  uint fcurve_len;
+  int frame_start;
+  int sample_len;
+};
+
+struct FCurveBakedCacheSampleData {
+  struct FCurveBakedCache *cache;
+  FCurve **fcurve_array;
+};
+
+static void fcurve_baked_cache_sample_cb(void *__restrict userdata_v,
+                                         const int fcurve_index,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct FCurveBakedCacheSampleData *data = userdata_v;
+  const struct FCurveBakedCache *cache = data->cache;
+  FCurve *fcu = data->fcurve_array[fcurve_index];
+  float *samples = cache->span_table[fcurve_index].samples;
+
+  for (int i = 0; i < cache->sample_len; i++) {
+    samples[i] = evaluate_fcurve(fcu, (float)(cache->frame_start + i));
+  }
+}
+
+struct FCurveBakedCache *BKE_fcurve_baked_cache_create(ListBase *fcurves,
+                                                       const int frame_start,
+                                                       const int frame_end)
+{
+  BLI_assert(frame_end >= frame_start);
+
+  /* Count the curves which are worth baking: drivers read RNA and curves without any
+   * keyframe data are cheap to evaluate anyway. */
+  uint fcurve_len = 0;
+  LISTBASE_FOREACH (FCurve *, fcu, fcurves) {
+    if ((fcu->driver == NULL) && !BKE_fcurve_is_empty(fcu)) {
+      fcurve_len++;
+    }
+  }
+  if (fcurve_len == 0) {
+    return NULL;
+  }
+
+  const int sample_len = frame_end - frame_start + 1;
+
+  struct FCurveBakedCache *cache = MEM_callocN(sizeof(*cache), __func__);
+  cache->span_from_fcurve = BLI_ghash_ptr_new_ex(__func__, fcurve_len);
+  cache->span_table = MEM_mallocN(sizeof(*cache->span_table) * fcurve_len, __func__);
+  cache->sample_buffer = MEM_malloc_arrayN(
+      fcurve_len, sizeof(float) * (size_t)sample_len, __func__);
+  cache->fcurve_len = fcurve_len;
+  cache->frame_start = frame_start;
+  cache->sample_len = sample_len;
+
+  FCurve **fcurve_array = MEM_mallocN(sizeof(*fcurve_array) * fcurve_len, __func__);
+  uint i = 0;
+  LISTBASE_FOREACH (FCurve *, fcu, fcurves) {
+    if ((fcu->driver == NULL) && !BKE_fcurve_is_empty(fcu)) {
+      fcurve_array[i] = fcu;
+      cache->span_table[i].samples = cache->sample_buffer + (size_t)i * sample_len;
+      BLI_ghash_insert(cache->span_from_fcurve, fcu, &cache->span_table[i]);
+      i++;
+    }
+  }
+
+  struct FCurveBakedCacheSampleData data;
+  data.cache = cache;
+  data.fcurve_array = fcurve_array;
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, fcurve_len, &data, fcurve_baked_cache_sample_cb, &settings);
+
+  MEM_freeN(fcurve_array);
+
+  return cache;
+}
+
+/**
+ * Evaluate \a fcu from the baked samples.
+ *
+ * \return false when the curve is not part of the cache (driver or empty curve),
+ * the caller has to fall back to full evaluation.
+ */
+bool BKE_fcurve_baked_cache_evaluate(const struct FCurveBakedCache *cache,
+                                     const FCurve *fcu,
+                                     const float evaltime,
+                                     float *r_value)
+{
+  const struct FCurveBakedCache_Span *span = BLI_ghash_lookup(cache->span_from_fcurve, fcu);
+  if (span == NULL) {
+    return false;
+  }
+
+  const float t = evaltime - (float)cache->frame_start;
+  if (t <= 0.0f) {
+    *r_value = span->samples[0];
+  }
+  else if (t >= (float)(cache->sample_len - 1)) {
+    *r_value = span->samples[cache->sample_len - 1];
+  }
+  else {
+    const int i = (int)t;
+    const float frac = t - (float)i;
+    *r_value = interpf(span->samples[i + 1], span->samples[i], frac);
+  }
+  return true;
+}
+
+void BKE_fcurve_baked_cache_free(struct FCurveBakedCache *cache)
+{
+  BLI_ghash_free(cache->span_from_fcurve, NULL, NULL);
+  MEM_freeN(cache->span_table);
+  MEM_freeN(cache->sample_buffer);
+  MEM_freeN(cache);
+}
+
+/** \} */
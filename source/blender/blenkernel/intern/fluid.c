@@ -4249,17 +4249,13 @@ struct Mesh *BKE_fluid_modifier_do(
 }
 
 static float calc_voxel_transp(
-    float *result, const float *input, int res[3], int *pixel, float *t_ray, float correct)
+    float *UNUSED(result), const float *input, int res[3], int *pixel, float *t_ray, float correct)
 {
   const size_t index = manta_get_index(pixel[0], res[0], pixel[1], res[1], pixel[2]);
 
   /* `T_ray *= T_vox`. */
   *t_ray *= expf(input[index] * correct);
 
-  if (result[index] < 0.0f) {
-    result[index] = *t_ray;
-  }
-
   return *t_ray;
 }
 
@@ -4360,14 +4356,75 @@ static void bresenham_linie_3D(int x1,
   cb(result, input, res, pixel, t_ray, correct);
 }
 
+typedef struct MantaShadowData {
+  FluidDomainSettings *fds;
+  float *density;
+  float *shadow;
+  float light[3];
+  float bv[6];
+  float correct;
+} MantaShadowData;
+
+static void manta_smoke_calc_transparency_cb(void *__restrict userdata,
+                                             const int z,
+                                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  MantaShadowData *data = userdata;
+  FluidDomainSettings *fds = data->fds;
+  float *shadow = data->shadow;
+  size_t index = (size_t)z * (size_t)(fds->res[0] * fds->res[1]);
+
+  for (int y = 0; y < fds->res[1]; y++) {
+    for (int x = 0; x < fds->res[0]; x++, index++) {
+      float voxel_center[3];
+      float pos[3];
+      int cell[3];
+      float t_ray = 1.0;
+
+      voxel_center[0] = (float)x;
+      voxel_center[1] = (float)y;
+      voxel_center[2] = (float)z;
+
+      /* Get starting cell (light pos). */
+      if (BLI_bvhtree_bb_raycast(data->bv, data->light, voxel_center, pos) > FLT_EPSILON) {
+        /* We're outside -> use point on side of domain. */
+        cell[0] = (int)floor(pos[0]);
+        cell[1] = (int)floor(pos[1]);
+        cell[2] = (int)floor(pos[2]);
+      }
+      else {
+        /* We're inside -> use light itself. */
+        cell[0] = (int)floor(data->light[0]);
+        cell[1] = (int)floor(data->light[1]);
+        cell[2] = (int)floor(data->light[2]);
+      }
+      /* Clamp within grid bounds */
+      CLAMP(cell[0], 0, fds->res[0] - 1);
+      CLAMP(cell[1], 0, fds->res[1] - 1);
+      CLAMP(cell[2], 0, fds->res[2] - 1);
+
+      bresenham_linie_3D(cell[0],
+                         cell[1],
+                         cell[2],
+                         x,
+                         y,
+                         z,
+                         &t_ray,
+                         calc_voxel_transp,
+                         shadow,
+                         data->density,
+                         fds->res,
+                         data->correct);
+
+      /* Convention -> from a RGBA float array, use G value for t_ray. */
+      shadow[index] = t_ray;
+    }
+  }
+}
+
 static void manta_smoke_calc_transparency(FluidDomainSettings *fds, ViewLayer *view_layer)
 {
-  float bv[6] = {0};
   float light[3];
-  int slabsize = fds->res[0] * fds->res[1];
-  float *density = manta_smoke_get_density(fds->fluid);
-  float *shadow = manta_smoke_get_shadow(fds->fluid);
-  float correct = -7.0f * fds->dx;
 
   if (!get_light(view_layer, light)) {
     return;
@@ -4379,65 +4436,21 @@ static void manta_smoke_calc_transparency(FluidDomainSettings *fds, ViewLayer *v
   light[1] = (light[1] - fds->p0[1]) / fds->cell_size[1] - 0.5f - (float)fds->res_min[1];
   light[2] = (light[2] - fds->p0[2]) / fds->cell_size[2] - 0.5f - (float)fds->res_min[2];
 
-  /* Calculate domain bounds in sim cell space. */
-  /* 0,2,4 = 0.0f */
-  bv[1] = (float)fds->res[0]; /* X */
-  bv[3] = (float)fds->res[1]; /* Y */
-  bv[5] = (float)fds->res[2]; /* Z */
-
-  for (int z = 0; z < fds->res[2]; z++) {
-    size_t index = z * slabsize;
-
-    for (int y = 0; y < fds->res[1]; y++) {
-      for (int x = 0; x < fds->res[0]; x++, index++) {
-        float voxel_center[3];
-        float pos[3];
-        int cell[3];
-        float t_ray = 1.0;
-
-        /* Reset shadow value. */
-        shadow[index] = -1.0f;
-
-        voxel_center[0] = (float)x;
-        voxel_center[1] = (float)y;
-        voxel_center[2] = (float)z;
-
-        /* Get starting cell (light pos). */
-        if (BLI_bvhtree_bb_raycast(bv, light, voxel_center, pos) > FLT_EPSILON) {
-          /* We're outside -> use point on side of domain. */
-          cell[0] = (int)floor(pos[0]);
-          cell[1] = (int)floor(pos[1]);
-          cell[2] = (int)floor(pos[2]);
-        }
-        else {
-          /* We're inside -> use light itself. */
-          cell[0] = (int)floor(light[0]);
-          cell[1] = (int)floor(light[1]);
-          cell[2] = (int)floor(light[2]);
-        }
-        /* Clamp within grid bounds */
-        CLAMP(cell[0], 0, fds->res[0] - 1);
-        CLAMP(cell[1], 0, fds->res[1] - 1);
-        CLAMP(cell[2], 0, fds->res[2] - 1);
-
-        bresenham_linie_3D(cell[0],
-                           cell[1],
-                           cell[2],
-                           x,
-                           y,
-                           z,
-                           &t_ray,
-                           calc_voxel_transp,
-                           shadow,
-                           density,
-                           fds->res,
-                           correct);
-
-        /* Convention -> from a RGBA float array, use G value for t_ray. */
-        shadow[index] = t_ray;
-      }
-    }
-  }
+  MantaShadowData data = {
+      .fds = fds,
+      .density = manta_smoke_get_density(fds->fluid),
+      .shadow = manta_smoke_get_shadow(fds->fluid),
+      .light = {light[0], light[1], light[2]},
+      /* Domain bounds in sim cell space (0,2,4 = 0.0f). */
+      .bv = {0.0f, (float)fds->res[0], 0.0f, (float)fds->res[1], 0.0f, (float)fds->res[2]},
+      .correct = -7.0f * fds->dx,
+  };
+
+  /* Each voxel marches its own ray from the light and only writes its own shadow value,
+   * so z-slices can be processed independently. */
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0, fds->res[2], &data, manta_smoke_calc_transparency_cb, &settings);
 }
 
 /* Get fluid velocity and density at given coordinates
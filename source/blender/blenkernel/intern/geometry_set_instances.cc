@@ -14,6 +14,10 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+#include <algorithm>
+
+#include "BLI_task.hh"
+
 #include "BKE_geometry_set_instances.hh"
 #include "BKE_material.h"
 #include "BKE_mesh.h"
@@ -431,6 +435,7 @@ static Mesh *join_mesh_topology_and_builtin_attributes(Span<GeometryInstanceGrou
     const GeometrySet &set = set_group.geometry_set;
     if (set.has_mesh()) {
       const Mesh &mesh = *set.get_mesh_for_read();
+      const int tot_transforms = set_group.transforms.size();
 
       Array<int> material_index_map(mesh.totcol);
       for (const int i : IndexRange(mesh.totcol)) {
@@ -439,49 +444,63 @@ static Mesh *join_mesh_topology_and_builtin_attributes(Span<GeometryInstanceGrou
         material_index_map[i] = new_material_index;
       }
 
-      for (const float4x4 &transform : set_group.transforms) {
-        for (const int i : IndexRange(mesh.totvert)) {
-          const MVert &old_vert = mesh.mvert[i];
-          MVert &new_vert = new_mesh->mvert[vert_offset + i];
-
-          new_vert = old_vert;
-
-          const float3 new_position = transform * float3(old_vert.co);
-          copy_v3_v3(new_vert.co, new_position);
-        }
-        for (const int i : IndexRange(mesh.totedge)) {
-          const MEdge &old_edge = mesh.medge[i];
-          MEdge &new_edge = new_mesh->medge[edge_offset + i];
-          new_edge = old_edge;
-          new_edge.v1 += vert_offset;
-          new_edge.v2 += vert_offset;
-        }
-        for (const int i : IndexRange(mesh.totloop)) {
-          const MLoop &old_loop = mesh.mloop[i];
-          MLoop &new_loop = new_mesh->mloop[loop_offset + i];
-          new_loop = old_loop;
-          new_loop.v += vert_offset;
-          new_loop.e += edge_offset;
-        }
-        for (const int i : IndexRange(mesh.totpoly)) {
-          const MPoly &old_poly = mesh.mpoly[i];
-          MPoly &new_poly = new_mesh->mpoly[poly_offset + i];
-          new_poly = old_poly;
-          new_poly.loopstart += loop_offset;
-          if (old_poly.mat_nr >= 0 && old_poly.mat_nr < mesh.totcol) {
-            new_poly.mat_nr = material_index_map[new_poly.mat_nr];
-          }
-          else {
-            /* The material index was invalid before. */
-            new_poly.mat_nr = 0;
-          }
-        }
+      /* Every instance writes to its own range of the result arrays, so the copies can run in
+       * parallel. Pick a grain size that keeps a reasonable amount of work per task even when
+       * many instances of a small mesh are realized. */
+      const int64_t grain_size = std::max<int64_t>(
+          1, 8192 / std::max(1, mesh.totvert + mesh.totloop));
+      threading::parallel_for(
+          set_group.transforms.index_range(), grain_size, [&](const IndexRange range) {
+            for (const int transform_index : range) {
+              const float4x4 &transform = set_group.transforms[transform_index];
+              const int instance_vert_offset = vert_offset + transform_index * mesh.totvert;
+              const int instance_edge_offset = edge_offset + transform_index * mesh.totedge;
+              const int instance_loop_offset = loop_offset + transform_index * mesh.totloop;
+              const int instance_poly_offset = poly_offset + transform_index * mesh.totpoly;
+
+              for (const int i : IndexRange(mesh.totvert)) {
+                const MVert &old_vert = mesh.mvert[i];
+                MVert &new_vert = new_mesh->mvert[instance_vert_offset + i];
+
+                new_vert = old_vert;
+
+                const float3 new_position = transform * float3(old_vert.co);
+                copy_v3_v3(new_vert.co, new_position);
+              }
+              for (const int i : IndexRange(mesh.totedge)) {
+                const MEdge &old_edge = mesh.medge[i];
+                MEdge &new_edge = new_mesh->medge[instance_edge_offset + i];
+                new_edge = old_edge;
+                new_edge.v1 += instance_vert_offset;
+                new_edge.v2 += instance_vert_offset;
+              }
+              for (const int i : IndexRange(mesh.totloop)) {
+                const MLoop &old_loop = mesh.mloop[i];
+                MLoop &new_loop = new_mesh->mloop[instance_loop_offset + i];
+                new_loop = old_loop;
+                new_loop.v += instance_vert_offset;
+                new_loop.e += instance_edge_offset;
+              }
+              for (const int i : IndexRange(mesh.totpoly)) {
+                const MPoly &old_poly = mesh.mpoly[i];
+                MPoly &new_poly = new_mesh->mpoly[instance_poly_offset + i];
+                new_poly = old_poly;
+                new_poly.loopstart += instance_loop_offset;
+                if (old_poly.mat_nr >= 0 && old_poly.mat_nr < mesh.totcol) {
+                  new_poly.mat_nr = material_index_map[new_poly.mat_nr];
+                }
+                else {
+                  /* The material index was invalid before. */
+                  new_poly.mat_nr = 0;
+                }
+              }
+            }
+          });
 
-        vert_offset += mesh.totvert;
-        loop_offset += mesh.totloop;
-        edge_offset += mesh.totedge;
-        poly_offset += mesh.totpoly;
-      }
+      vert_offset += mesh.totvert * tot_transforms;
+      loop_offset += mesh.totloop * tot_transforms;
+      edge_offset += mesh.totedge * tot_transforms;
+      poly_offset += mesh.totpoly * tot_transforms;
     }
 
     const float3 point_normal{0.0f, 0.0f, 1.0f};
@@ -160,8 +160,9 @@ void BKE_lattice_deform_data_eval_co(LatticeDeformData *lattice_deform_data,
   const Lattice *lt = lattice_deform_data->lt;
   float u, v, w, tu[4], tv[4], tw[4];
   float vec[3];
-  int idx_w, idx_v, idx_u;
-  int ui, vi, wi, uu, vv, ww;
+  int idx_w, idx_v;
+  int idx_u_arr[4], idx_v_arr[4], idx_w_arr[4];
+  int ui, vi, wi;
 
   /* vgroup influence */
   float co_prev[4] = {0}, weight_blend = 0.0f;
@@ -217,31 +218,27 @@ void BKE_lattice_deform_data_eval_co(LatticeDeformData *lattice_deform_data,
   const int idx_v_max = (lt->pntsv - 1) * lt->pntsu;
   const int idx_u_max = (lt->pntsu - 1);
 
-  for (ww = wi - 1; ww <= wi + 2; ww++) {
-    w = weight * tw[ww - wi + 1];
-    idx_w = CLAMPIS(ww * w_stride, 0, idx_w_max);
-    for (vv = vi - 1; vv <= vi + 2; vv++) {
-      v = w * tv[vv - vi + 1];
-      idx_v = CLAMPIS(vv * v_stride, 0, idx_v_max);
-      for (uu = ui - 1; uu <= ui + 2; uu++) {
-        u = v * tu[uu - ui + 1];
-        idx_u = CLAMPIS(uu, 0, idx_u_max);
-        const int idx = idx_w + idx_v + idx_u;
+  /* Clamp the indices per axis once instead of for each of the 64 cells. */
+  for (int i = 0; i < 4; i++) {
+    idx_u_arr[i] = CLAMPIS(ui - 1 + i, 0, idx_u_max);
+    idx_v_arr[i] = CLAMPIS((vi - 1 + i) * v_stride, 0, idx_v_max);
+    idx_w_arr[i] = CLAMPIS((wi - 1 + i) * w_stride, 0, idx_w_max);
+  }
+
+  for (int i = 0; i < 4; i++) {
+    w = weight * tw[i];
+    idx_w = idx_w_arr[i];
+    for (int j = 0; j < 4; j++) {
+      v = w * tv[j];
+      idx_v = idx_v_arr[j];
+      for (int k = 0; k < 4; k++) {
+        u = v * tu[k];
+        const int idx = idx_w + idx_v + idx_u_arr[k];
 #ifdef BLI_HAVE_SSE2
-        {
-          __m128 weight_vec = _mm_set1_ps(u);
-          /* We need to address special case for last item to avoid accessing invalid memory. */
-          __m128 lattice_vec;
-          if (idx * 3 == idx_w_max) {
-            copy_v3_v3((float *)&lattice_vec, &latticedata[idx * 3]);
-          }
-          else {
-            /* When not on last item, we can safely access one extra float, it will be ignored
-             * anyway. */
-            lattice_vec = _mm_loadu_ps(&latticedata[idx * 3]);
-          }
-          co_vec = _mm_add_ps(co_vec, _mm_mul_ps(lattice_vec, weight_vec));
-        }
+        /* Loading a float past the last point is safe, the buffer over-allocates
+         * for exactly this purpose (see #BKE_lattice_deform_data_create). */
+        co_vec = _mm_add_ps(co_vec,
+                            _mm_mul_ps(_mm_loadu_ps(&latticedata[idx * 3]), _mm_set1_ps(u)));
 #else
         madd_v3_v3fl(co, &latticedata[idx * 3], u);
 #endif
@@ -47,6 +47,7 @@
 #include "BKE_editmesh_cache.h"
 #include "BKE_global.h"
 #include "BKE_mesh.h"
+#include "BKE_mesh_mapping.h"
 
 #include "atomic_ops.h"
 
@@ -304,6 +305,172 @@ void BKE_mesh_calc_normals_poly_and_vertex(MVert *mvert,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Mesh Normal Calculation (Partial Updates)
+ *
+ * Recompute normals only in the neighborhood of a set of modified vertices, instead of
+ * walking the entire mesh. Used with small localized changes (sculpt strokes, proportional
+ * editing with a small radius) where a full recompute would be dominated by unchanged
+ * geometry.
+ * \{ */
+
+struct MeshCalcNormalsData_Partial {
+  MVert *mvert;
+  const MLoop *mloop;
+  const MPoly *mpoly;
+  const MeshElemMap *vert_to_poly;
+
+  /** Polygons using at least one dirty vertex. */
+  const int *poly_indices;
+  /** All vertices of those polygons (the one-ring of the dirty vertices). */
+  const int *vert_indices;
+
+  /** Polygon normal output (may be null, vertex normals then compute fans on the fly). */
+  float (*pnors)[3];
+};
+
+static void mesh_calc_normals_partial_poly_fn(void *__restrict userdata,
+                                              const int i,
+                                              const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const MeshCalcNormalsData_Partial *data = (MeshCalcNormalsData_Partial *)userdata;
+  const int pidx = data->poly_indices[i];
+  const MPoly *mp = &data->mpoly[pidx];
+  BKE_mesh_calc_poly_normal(mp, data->mloop + mp->loopstart, data->mvert, data->pnors[pidx]);
+}
+
+static void mesh_calc_normals_partial_vert_fn(void *__restrict userdata,
+                                              const int i,
+                                              const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const MeshCalcNormalsData_Partial *data = (MeshCalcNormalsData_Partial *)userdata;
+  const int vidx = data->vert_indices[i];
+  const MeshElemMap *fan = &data->vert_to_poly[vidx];
+  MVert *mv = &data->mvert[vidx];
+
+  /* Accumulate angle weighted normals of the whole fan, so the result is identical to a
+   * full recompute and no seam forms against untouched vertices. */
+  float vnor[3] = {0.0f, 0.0f, 0.0f};
+
+  for (int j = 0; j < fan->count; j++) {
+    const int pidx = fan->indices[j];
+    const MPoly *mp = &data->mpoly[pidx];
+    const MLoop *loops = &data->mloop[mp->loopstart];
+
+    float pnor_temp[3];
+    const float *pnor;
+    if (data->pnors != nullptr) {
+      pnor = data->pnors[pidx];
+    }
+    else {
+      BKE_mesh_calc_poly_normal(mp, loops, data->mvert, pnor_temp);
+      pnor = pnor_temp;
+    }
+
+    for (int k = 0; k < mp->totloop; k++) {
+      if (loops[k].v != (uint)vidx) {
+        continue;
+      }
+      const float *co_prev = data->mvert[loops[(k + mp->totloop - 1) % mp->totloop].v].co;
+      const float *co_next = data->mvert[loops[(k + 1) % mp->totloop].v].co;
+      const float fac = angle_v3v3v3(co_prev, mv->co, co_next);
+      madd_v3_v3fl(vnor, pnor, fac);
+    }
+  }
+
+  if (UNLIKELY(normalize_v3(vnor) == 0.0f)) {
+    /* Following Mesh convention; we use vertex coordinate itself for normal in this case. */
+    normalize_v3_v3(vnor, mv->co);
+  }
+  normal_float_to_short_v3(mv->no, vnor);
+}
+
+/**
+ * Update vertex (and optionally polygon) normals around modified vertices only.
+ *
+ * \param dirty_verts: Bitmap of vertices whose coordinates changed, e.g. filled in from
+ * the PBVH partial update tags with #BKE_pbvh_get_vert_normals_dirty.
+ * \param vert_to_poly: Vertex to polygon map of the mesh (see #BKE_mesh_vert_poly_map_create).
+ * \param r_poly_normals: Polygon normals maintained by the caller (commonly the #CD_NORMAL
+ * polygon layer), updated in place for affected polygons. May be null, in which case only
+ * vertex normals in #MVert.no are updated.
+ *
+ * \note The caller is responsible for the dirty state of the mesh normals: when all
+ * modified vertices are tagged, this is equivalent to a full recompute for them, so
+ * #Mesh.runtime `cd_dirty_vert` can be cleared.
+ */
+void BKE_mesh_calc_normals_partial(MVert *mvert,
+                                   const int mvert_len,
+                                   const MLoop *mloop,
+                                   const MPoly *mpoly,
+                                   const int mpoly_len,
+                                   const BLI_bitmap *dirty_verts,
+                                   const MeshElemMap *vert_to_poly,
+                                   float (*r_poly_normals)[3])
+{
+  /* Expand the dirty vertices into the polygons using them, then into all vertices of
+   * those polygons: a polygon normal changes when any of its vertices moves, and a vertex
+   * normal when any polygon of its fan does. Both passes are bounded by the size of the
+   * edited region, only the initial bitmap scan touches the whole mesh (cheaply). */
+  BLI_bitmap *poly_tag = BLI_BITMAP_NEW(mpoly_len, __func__);
+  BLI_bitmap *vert_tag = BLI_BITMAP_NEW(mvert_len, __func__);
+  int *poly_indices = (int *)MEM_mallocN(sizeof(int) * (size_t)mpoly_len, __func__);
+  int *vert_indices = (int *)MEM_mallocN(sizeof(int) * (size_t)mvert_len, __func__);
+  int poly_indices_num = 0, vert_indices_num = 0;
+
+  for (int v = 0; v < mvert_len; v++) {
+    if (!BLI_BITMAP_TEST(dirty_verts, v)) {
+      continue;
+    }
+    const MeshElemMap *fan = &vert_to_poly[v];
+    for (int j = 0; j < fan->count; j++) {
+      const int pidx = fan->indices[j];
+      if (!BLI_BITMAP_TEST(poly_tag, pidx)) {
+        BLI_BITMAP_ENABLE(poly_tag, pidx);
+        poly_indices[poly_indices_num++] = pidx;
+      }
+    }
+  }
+
+  for (int i = 0; i < poly_indices_num; i++) {
+    const MPoly *mp = &mpoly[poly_indices[i]];
+    const MLoop *loops = &mloop[mp->loopstart];
+    for (int k = 0; k < mp->totloop; k++) {
+      const int vidx = (int)loops[k].v;
+      if (!BLI_BITMAP_TEST(vert_tag, vidx)) {
+        BLI_BITMAP_ENABLE(vert_tag, vidx);
+        vert_indices[vert_indices_num++] = vidx;
+      }
+    }
+  }
+
+  MeshCalcNormalsData_Partial data = {};
+  data.mvert = mvert;
+  data.mloop = mloop;
+  data.mpoly = mpoly;
+  data.vert_to_poly = vert_to_poly;
+  data.poly_indices = poly_indices;
+  data.vert_indices = vert_indices;
+  data.pnors = r_poly_normals;
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 256;
+
+  if (r_poly_normals != nullptr) {
+    BLI_task_parallel_range(
+        0, poly_indices_num, &data, mesh_calc_normals_partial_poly_fn, &settings);
+  }
+  BLI_task_parallel_range(0, vert_indices_num, &data, mesh_calc_normals_partial_vert_fn, &settings);
+
+  MEM_freeN(poly_indices);
+  MEM_freeN(vert_indices);
+  MEM_freeN(poly_tag);
+  MEM_freeN(vert_tag);
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Mesh Normal Calculation
  * \{ */
@@ -36,6 +36,8 @@
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_rand.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_bvhutils.h"
@@ -373,6 +375,10 @@ void BKE_mesh_remap_free(MeshPairRemap *map)
   map->mem = NULL;
 }
 
+/* Protects the memory arena of the map being computed, since items are defined from
+ * parallel loops over the destination elements. */
+static ThreadMutex mesh_remap_mem_lock = BLI_MUTEX_INITIALIZER;
+
 static void mesh_remap_item_define(MeshPairRemap *map,
                                    const int index,
                                    const float UNUSED(hit_dist),
@@ -386,11 +392,13 @@ static void mesh_remap_item_define(MeshPairRemap *map,
 
   if (sources_num) {
     mapit->sources_num = sources_num;
+    BLI_mutex_lock(&mesh_remap_mem_lock);
     mapit->indices_src = BLI_memarena_alloc(mem,
                                             sizeof(*mapit->indices_src) * (size_t)sources_num);
-    memcpy(mapit->indices_src, indices_src, sizeof(*mapit->indices_src) * (size_t)sources_num);
     mapit->weights_src = BLI_memarena_alloc(mem,
                                             sizeof(*mapit->weights_src) * (size_t)sources_num);
+    BLI_mutex_unlock(&mesh_remap_mem_lock);
+    memcpy(mapit->indices_src, indices_src, sizeof(*mapit->indices_src) * (size_t)sources_num);
     memcpy(mapit->weights_src, weights_src, sizeof(*mapit->weights_src) * (size_t)sources_num);
   }
   else {
@@ -497,6 +505,238 @@ typedef struct IslandResult {
 /* Will be enough in 99% of cases. */
 #define MREMAP_DEFAULT_BUFSIZE 32
 
+/* Shared and per-thread state for the parallel loops over destination elements below. The BVH
+ * trees and source arrays are only read from the worker threads, while each thread keeps its
+ * own query results and interpolation buffers. */
+typedef struct MeshRemapParallelData {
+  const SpaceTransform *space_transform;
+  float max_dist;
+  float max_dist_sq;
+  float ray_radius;
+  int mode;
+
+  MeshPairRemap *r_map;
+  BVHTreeFromMesh *treedata;
+
+  const MVert *verts_dst;
+  const MLoop *loops_dst;
+  const MPoly *polys_dst;
+  const float (*poly_nors_dst)[3];
+
+  const MEdge *edges_src;
+  const MPoly *polys_src;
+  MLoop *loops_src;
+  const float (*vcos_src)[3];
+} MeshRemapParallelData;
+
+typedef struct MeshRemapParallelTLS {
+  BVHTreeNearest nearest;
+  BVHTreeRayHit rayhit;
+  /* Lazily allocated per-thread buffers for poly interpolation. */
+  size_t buff_size;
+  float (*vcos)[3];
+  int *indices;
+  float *weights;
+} MeshRemapParallelTLS;
+
+static void mesh_remap_parallel_tls_free(const void *UNUSED(userdata), void *tls_v)
+{
+  MeshRemapParallelTLS *tls = tls_v;
+  MEM_SAFE_FREE(tls->vcos);
+  MEM_SAFE_FREE(tls->indices);
+  MEM_SAFE_FREE(tls->weights);
+}
+
+static void mesh_remap_task_settings(TaskParallelSettings *settings,
+                                     MeshRemapParallelTLS *tls,
+                                     const int items_num)
+{
+  BLI_parallel_range_settings_defaults(settings);
+  settings->use_threading = (items_num > BKE_MESH_OMP_LIMIT);
+  settings->userdata_chunk = tls;
+  settings->userdata_chunk_size = sizeof(*tls);
+  settings->func_free = mesh_remap_parallel_tls_free;
+}
+
+static void mesh_remap_calc_verts_nearest_cb(void *__restrict userdata,
+                                             const int i,
+                                             const TaskParallelTLS *__restrict tls_v)
+{
+  MeshRemapParallelData *data = userdata;
+  MeshRemapParallelTLS *tls = tls_v->userdata_chunk;
+  const float full_weight = 1.0f;
+  float tmp_co[3];
+  float hit_dist;
+
+  copy_v3_v3(tmp_co, data->verts_dst[i].co);
+
+  /* Convert the vertex to tree coordinates, if needed. */
+  if (data->space_transform) {
+    BLI_space_transform_apply(data->space_transform, tmp_co);
+  }
+
+  if (mesh_remap_bvhtree_query_nearest(
+          data->treedata, &tls->nearest, tmp_co, data->max_dist_sq, &hit_dist)) {
+    mesh_remap_item_define(data->r_map, i, hit_dist, 0, 1, &tls->nearest.index, &full_weight);
+  }
+  else {
+    /* No source for this dest vertex! */
+    BKE_mesh_remap_item_define_invalid(data->r_map, i);
+  }
+}
+
+static void mesh_remap_calc_verts_from_edges_cb(void *__restrict userdata,
+                                                const int i,
+                                                const TaskParallelTLS *__restrict tls_v)
+{
+  MeshRemapParallelData *data = userdata;
+  MeshRemapParallelTLS *tls = tls_v->userdata_chunk;
+  const float full_weight = 1.0f;
+  float tmp_co[3];
+  float hit_dist;
+
+  copy_v3_v3(tmp_co, data->verts_dst[i].co);
+
+  /* Convert the vertex to tree coordinates, if needed. */
+  if (data->space_transform) {
+    BLI_space_transform_apply(data->space_transform, tmp_co);
+  }
+
+  if (mesh_remap_bvhtree_query_nearest(
+          data->treedata, &tls->nearest, tmp_co, data->max_dist_sq, &hit_dist)) {
+    const MEdge *me = &data->edges_src[tls->nearest.index];
+    const float *v1cos = data->vcos_src[me->v1];
+    const float *v2cos = data->vcos_src[me->v2];
+
+    if (data->mode == MREMAP_MODE_VERT_EDGE_NEAREST) {
+      const float dist_v1 = len_squared_v3v3(tmp_co, v1cos);
+      const float dist_v2 = len_squared_v3v3(tmp_co, v2cos);
+      const int index = (int)((dist_v1 > dist_v2) ? me->v2 : me->v1);
+      mesh_remap_item_define(data->r_map, i, hit_dist, 0, 1, &index, &full_weight);
+    }
+    else if (data->mode == MREMAP_MODE_VERT_EDGEINTERP_NEAREST) {
+      int indices[2];
+      float weights[2];
+
+      indices[0] = (int)me->v1;
+      indices[1] = (int)me->v2;
+
+      /* Weight is inverse of point factor here... */
+      weights[0] = line_point_factor_v3(tmp_co, v2cos, v1cos);
+      CLAMP(weights[0], 0.0f, 1.0f);
+      weights[1] = 1.0f - weights[0];
+
+      mesh_remap_item_define(data->r_map, i, hit_dist, 0, 2, indices, weights);
+    }
+  }
+  else {
+    /* No source for this dest vertex! */
+    BKE_mesh_remap_item_define_invalid(data->r_map, i);
+  }
+}
+
+static void mesh_remap_calc_verts_polyinterp_vnorproj_cb(void *__restrict userdata,
+                                                         const int i,
+                                                         const TaskParallelTLS *__restrict tls_v)
+{
+  MeshRemapParallelData *data = userdata;
+  MeshRemapParallelTLS *tls = tls_v->userdata_chunk;
+  float tmp_co[3], tmp_no[3];
+  float hit_dist;
+
+  copy_v3_v3(tmp_co, data->verts_dst[i].co);
+  normal_short_to_float_v3(tmp_no, data->verts_dst[i].no);
+
+  /* Convert the vertex to tree coordinates, if needed. */
+  if (data->space_transform) {
+    BLI_space_transform_apply(data->space_transform, tmp_co);
+    BLI_space_transform_apply_normal(data->space_transform, tmp_no);
+  }
+
+  if (mesh_remap_bvhtree_query_raycast(
+          data->treedata, &tls->rayhit, tmp_co, tmp_no, data->ray_radius, data->max_dist, &hit_dist)) {
+    const MLoopTri *lt = &data->treedata->looptri[tls->rayhit.index];
+    const MPoly *mp_src = &data->polys_src[lt->poly];
+    const int sources_num = mesh_remap_interp_poly_data_get(mp_src,
+                                                            data->loops_src,
+                                                            data->vcos_src,
+                                                            tls->rayhit.co,
+                                                            &tls->buff_size,
+                                                            &tls->vcos,
+                                                            false,
+                                                            &tls->indices,
+                                                            &tls->weights,
+                                                            true,
+                                                            NULL);
+
+    mesh_remap_item_define(data->r_map, i, hit_dist, 0, sources_num, tls->indices, tls->weights);
+  }
+  else {
+    /* No source for this dest vertex! */
+    BKE_mesh_remap_item_define_invalid(data->r_map, i);
+  }
+}
+
+static void mesh_remap_calc_verts_from_polys_cb(void *__restrict userdata,
+                                                const int i,
+                                                const TaskParallelTLS *__restrict tls_v)
+{
+  MeshRemapParallelData *data = userdata;
+  MeshRemapParallelTLS *tls = tls_v->userdata_chunk;
+  const float full_weight = 1.0f;
+  float tmp_co[3];
+  float hit_dist;
+
+  copy_v3_v3(tmp_co, data->verts_dst[i].co);
+
+  /* Convert the vertex to tree coordinates, if needed. */
+  if (data->space_transform) {
+    BLI_space_transform_apply(data->space_transform, tmp_co);
+  }
+
+  if (mesh_remap_bvhtree_query_nearest(
+          data->treedata, &tls->nearest, tmp_co, data->max_dist_sq, &hit_dist)) {
+    const MLoopTri *lt = &data->treedata->looptri[tls->nearest.index];
+    const MPoly *mp = &data->polys_src[lt->poly];
+
+    if (data->mode == MREMAP_MODE_VERT_POLY_NEAREST) {
+      int index;
+      mesh_remap_interp_poly_data_get(mp,
+                                      data->loops_src,
+                                      data->vcos_src,
+                                      tls->nearest.co,
+                                      &tls->buff_size,
+                                      &tls->vcos,
+                                      false,
+                                      &tls->indices,
+                                      &tls->weights,
+                                      false,
+                                      &index);
+
+      mesh_remap_item_define(data->r_map, i, hit_dist, 0, 1, &index, &full_weight);
+    }
+    else if (data->mode == MREMAP_MODE_VERT_POLYINTERP_NEAREST) {
+      const int sources_num = mesh_remap_interp_poly_data_get(mp,
+                                                              data->loops_src,
+                                                              data->vcos_src,
+                                                              tls->nearest.co,
+                                                              &tls->buff_size,
+                                                              &tls->vcos,
+                                                              false,
+                                                              &tls->indices,
+                                                              &tls->weights,
+                                                              true,
+                                                              NULL);
+
+      mesh_remap_item_define(data->r_map, i, hit_dist, 0, sources_num, tls->indices, tls->weights);
+    }
+  }
+  else {
+    /* No source for this dest vertex! */
+    BKE_mesh_remap_item_define_invalid(data->r_map, i);
+  }
+}
+
 void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
                                          const SpaceTransform *space_transform,
                                          const float max_dist,
@@ -523,80 +763,32 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
   }
   else {
     BVHTreeFromMesh treedata = {NULL};
-    BVHTreeNearest nearest = {0};
-    BVHTreeRayHit rayhit = {0};
-    float hit_dist;
-    float tmp_co[3], tmp_no[3];
+    MeshRemapParallelData data = {
+        .space_transform = space_transform,
+        .max_dist = max_dist,
+        .max_dist_sq = max_dist_sq,
+        .ray_radius = ray_radius,
+        .mode = mode,
+        .r_map = r_map,
+        .treedata = &treedata,
+        .verts_dst = verts_dst,
+    };
+    MeshRemapParallelTLS tls = {.nearest = {.index = -1}};
+    TaskParallelSettings settings;
+    mesh_remap_task_settings(&settings, &tls, numverts_dst);
 
     if (mode == MREMAP_MODE_VERT_NEAREST) {
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_VERTS, 2);
-      nearest.index = -1;
-
-      for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, verts_dst[i].co);
-
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
-
-        if (mesh_remap_bvhtree_query_nearest(
-                &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist)) {
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest.index, &full_weight);
-        }
-        else {
-          /* No source for this dest vertex! */
-          BKE_mesh_remap_item_define_invalid(r_map, i);
-        }
-      }
+      BLI_task_parallel_range(0, numverts_dst, &data, mesh_remap_calc_verts_nearest_cb, &settings);
     }
     else if (ELEM(mode, MREMAP_MODE_VERT_EDGE_NEAREST, MREMAP_MODE_VERT_EDGEINTERP_NEAREST)) {
-      MEdge *edges_src = me_src->medge;
       float(*vcos_src)[3] = BKE_mesh_vert_coords_alloc(me_src, NULL);
+      data.edges_src = me_src->medge;
+      data.vcos_src = (const float(*)[3])vcos_src;
 
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_EDGES, 2);
-      nearest.index = -1;
-
-      for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, verts_dst[i].co);
-
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
-
-        if (mesh_remap_bvhtree_query_nearest(
-                &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist)) {
-          MEdge *me = &edges_src[nearest.index];
-          const float *v1cos = vcos_src[me->v1];
-          const float *v2cos = vcos_src[me->v2];
-
-          if (mode == MREMAP_MODE_VERT_EDGE_NEAREST) {
-            const float dist_v1 = len_squared_v3v3(tmp_co, v1cos);
-            const float dist_v2 = len_squared_v3v3(tmp_co, v2cos);
-            const int index = (int)((dist_v1 > dist_v2) ? me->v2 : me->v1);
-            mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &index, &full_weight);
-          }
-          else if (mode == MREMAP_MODE_VERT_EDGEINTERP_NEAREST) {
-            int indices[2];
-            float weights[2];
-
-            indices[0] = (int)me->v1;
-            indices[1] = (int)me->v2;
-
-            /* Weight is inverse of point factor here... */
-            weights[0] = line_point_factor_v3(tmp_co, v2cos, v1cos);
-            CLAMP(weights[0], 0.0f, 1.0f);
-            weights[1] = 1.0f - weights[0];
-
-            mesh_remap_item_define(r_map, i, hit_dist, 0, 2, indices, weights);
-          }
-        }
-        else {
-          /* No source for this dest vertex! */
-          BKE_mesh_remap_item_define_invalid(r_map, i);
-        }
-      }
+      BLI_task_parallel_range(
+          0, numverts_dst, &data, mesh_remap_calc_verts_from_edges_cb, &settings);
 
       MEM_freeN(vcos_src);
     }
@@ -604,111 +796,23 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
                   MREMAP_MODE_VERT_POLY_NEAREST,
                   MREMAP_MODE_VERT_POLYINTERP_NEAREST,
                   MREMAP_MODE_VERT_POLYINTERP_VNORPROJ)) {
-      MPoly *polys_src = me_src->mpoly;
-      MLoop *loops_src = me_src->mloop;
       float(*vcos_src)[3] = BKE_mesh_vert_coords_alloc(me_src, NULL);
-
-      size_t tmp_buff_size = MREMAP_DEFAULT_BUFSIZE;
-      float(*vcos)[3] = MEM_mallocN(sizeof(*vcos) * tmp_buff_size, __func__);
-      int *indices = MEM_mallocN(sizeof(*indices) * tmp_buff_size, __func__);
-      float *weights = MEM_mallocN(sizeof(*weights) * tmp_buff_size, __func__);
+      data.polys_src = me_src->mpoly;
+      data.loops_src = me_src->mloop;
+      data.vcos_src = (const float(*)[3])vcos_src;
 
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_LOOPTRI, 2);
 
       if (mode == MREMAP_MODE_VERT_POLYINTERP_VNORPROJ) {
-        for (i = 0; i < numverts_dst; i++) {
-          copy_v3_v3(tmp_co, verts_dst[i].co);
-          normal_short_to_float_v3(tmp_no, verts_dst[i].no);
-
-          /* Convert the vertex to tree coordinates, if needed. */
-          if (space_transform) {
-            BLI_space_transform_apply(space_transform, tmp_co);
-            BLI_space_transform_apply_normal(space_transform, tmp_no);
-          }
-
-          if (mesh_remap_bvhtree_query_raycast(
-                  &treedata, &rayhit, tmp_co, tmp_no, ray_radius, max_dist, &hit_dist)) {
-            const MLoopTri *lt = &treedata.looptri[rayhit.index];
-            MPoly *mp_src = &polys_src[lt->poly];
-            const int sources_num = mesh_remap_interp_poly_data_get(mp_src,
-                                                                    loops_src,
-                                                                    (const float(*)[3])vcos_src,
-                                                                    rayhit.co,
-                                                                    &tmp_buff_size,
-                                                                    &vcos,
-                                                                    false,
-                                                                    &indices,
-                                                                    &weights,
-                                                                    true,
-                                                                    NULL);
-
-            mesh_remap_item_define(r_map, i, hit_dist, 0, sources_num, indices, weights);
-          }
-          else {
-            /* No source for this dest vertex! */
-            BKE_mesh_remap_item_define_invalid(r_map, i);
-          }
-        }
+        BLI_task_parallel_range(
+            0, numverts_dst, &data, mesh_remap_calc_verts_polyinterp_vnorproj_cb, &settings);
       }
       else {
-        nearest.index = -1;
-
-        for (i = 0; i < numverts_dst; i++) {
-          copy_v3_v3(tmp_co, verts_dst[i].co);
-
-          /* Convert the vertex to tree coordinates, if needed. */
-          if (space_transform) {
-            BLI_space_transform_apply(space_transform, tmp_co);
-          }
-
-          if (mesh_remap_bvhtree_query_nearest(
-                  &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist)) {
-            const MLoopTri *lt = &treedata.looptri[nearest.index];
-            MPoly *mp = &polys_src[lt->poly];
-
-            if (mode == MREMAP_MODE_VERT_POLY_NEAREST) {
-              int index;
-              mesh_remap_interp_poly_data_get(mp,
-                                              loops_src,
-                                              (const float(*)[3])vcos_src,
-                                              nearest.co,
-                                              &tmp_buff_size,
-                                              &vcos,
-                                              false,
-                                              &indices,
-                                              &weights,
-                                              false,
-                                              &index);
-
-              mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &index, &full_weight);
-            }
-            else if (mode == MREMAP_MODE_VERT_POLYINTERP_NEAREST) {
-              const int sources_num = mesh_remap_interp_poly_data_get(mp,
-                                                                      loops_src,
-                                                                      (const float(*)[3])vcos_src,
-                                                                      nearest.co,
-                                                                      &tmp_buff_size,
-                                                                      &vcos,
-                                                                      false,
-                                                                      &indices,
-                                                                      &weights,
-                                                                      true,
-                                                                      NULL);
-
-              mesh_remap_item_define(r_map, i, hit_dist, 0, sources_num, indices, weights);
-            }
-          }
-          else {
-            /* No source for this dest vertex! */
-            BKE_mesh_remap_item_define_invalid(r_map, i);
-          }
-        }
+        BLI_task_parallel_range(
+            0, numverts_dst, &data, mesh_remap_calc_verts_from_polys_cb, &settings);
       }
 
       MEM_freeN(vcos_src);
-      MEM_freeN(vcos);
-      MEM_freeN(indices);
-      MEM_freeN(weights);
     }
     else {
       CLOG_WARN(&LOG, "Unsupported mesh-to-mesh vertex mapping mode (%d)!", mode);
@@ -1317,10 +1421,8 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
 
     float(*poly_cents_src)[3] = NULL;
 
-    MeshElemMap *vert_to_loop_map_src = NULL;
-    int *vert_to_loop_map_src_buff = NULL;
-    MeshElemMap *vert_to_poly_map_src = NULL;
-    int *vert_to_poly_map_src_buff = NULL;
+    const MeshElemMap *vert_to_loop_map_src = NULL;
+    const MeshElemMap *vert_to_poly_map_src = NULL;
     MeshElemMap *edge_to_poly_map_src = NULL;
     int *edge_to_poly_map_src_buff = NULL;
     MeshElemMap *poly_to_looptri_map_src = NULL;
@@ -1429,21 +1531,11 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
     }
 
     if (use_from_vert) {
-      BKE_mesh_vert_loop_map_create(&vert_to_loop_map_src,
-                                    &vert_to_loop_map_src_buff,
-                                    polys_src,
-                                    loops_src,
-                                    num_verts_src,
-                                    num_polys_src,
-                                    num_loops_src);
+      /* Cached on the source mesh, rebuilding them here for every transfer would be
+       * wasteful (they only depend on the topology). */
+      vert_to_loop_map_src = BKE_mesh_runtime_vert_loop_map_ensure(me_src);
       if (mode & MREMAP_USE_POLY) {
-        BKE_mesh_vert_poly_map_create(&vert_to_poly_map_src,
-                                      &vert_to_poly_map_src_buff,
-                                      polys_src,
-                                      loops_src,
-                                      num_verts_src,
-                                      num_polys_src,
-                                      num_loops_src);
+        vert_to_poly_map_src = BKE_mesh_runtime_vert_poly_map_ensure(me_src);
       }
     }
 
@@ -1648,7 +1740,7 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
         ml_dst = &loops_dst[mp_dst->loopstart];
         for (plidx_dst = 0; plidx_dst < mp_dst->totloop; plidx_dst++, ml_dst++) {
           if (use_from_vert) {
-            MeshElemMap *vert_to_refelem_map_src = NULL;
+            const MeshElemMap *vert_to_refelem_map_src = NULL;
 
             copy_v3_v3(tmp_co, verts_dst[ml_dst->v].co);
             nearest.index = -1;
@@ -2155,18 +2247,7 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
     if (vcos_src) {
       MEM_freeN(vcos_src);
     }
-    if (vert_to_loop_map_src) {
-      MEM_freeN(vert_to_loop_map_src);
-    }
-    if (vert_to_loop_map_src_buff) {
-      MEM_freeN(vert_to_loop_map_src_buff);
-    }
-    if (vert_to_poly_map_src) {
-      MEM_freeN(vert_to_poly_map_src);
-    }
-    if (vert_to_poly_map_src_buff) {
-      MEM_freeN(vert_to_poly_map_src_buff);
-    }
+    /* NOTE: `vert_to_loop_map_src` and `vert_to_poly_map_src` are owned by `me_src`. */
     if (edge_to_poly_map_src) {
       MEM_freeN(edge_to_poly_map_src);
     }
@@ -2197,6 +2278,69 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
   }
 }
 
+static void mesh_remap_calc_polys_nearest_cb(void *__restrict userdata,
+                                             const int i,
+                                             const TaskParallelTLS *__restrict tls_v)
+{
+  MeshRemapParallelData *data = userdata;
+  MeshRemapParallelTLS *tls = tls_v->userdata_chunk;
+  const float full_weight = 1.0f;
+  const MPoly *mp = &data->polys_dst[i];
+  float tmp_co[3];
+  float hit_dist;
+
+  BKE_mesh_calc_poly_center(mp, &data->loops_dst[mp->loopstart], data->verts_dst, tmp_co);
+
+  /* Convert the vertex to tree coordinates, if needed. */
+  if (data->space_transform) {
+    BLI_space_transform_apply(data->space_transform, tmp_co);
+  }
+
+  if (mesh_remap_bvhtree_query_nearest(
+          data->treedata, &tls->nearest, tmp_co, data->max_dist_sq, &hit_dist)) {
+    const MLoopTri *lt = &data->treedata->looptri[tls->nearest.index];
+    const int poly_index = (int)lt->poly;
+    mesh_remap_item_define(data->r_map, i, hit_dist, 0, 1, &poly_index, &full_weight);
+  }
+  else {
+    /* No source for this dest poly! */
+    BKE_mesh_remap_item_define_invalid(data->r_map, i);
+  }
+}
+
+static void mesh_remap_calc_polys_nor_cb(void *__restrict userdata,
+                                         const int i,
+                                         const TaskParallelTLS *__restrict tls_v)
+{
+  MeshRemapParallelData *data = userdata;
+  MeshRemapParallelTLS *tls = tls_v->userdata_chunk;
+  const float full_weight = 1.0f;
+  const MPoly *mp = &data->polys_dst[i];
+  float tmp_co[3], tmp_no[3];
+  float hit_dist;
+
+  BKE_mesh_calc_poly_center(mp, &data->loops_dst[mp->loopstart], data->verts_dst, tmp_co);
+  copy_v3_v3(tmp_no, data->poly_nors_dst[i]);
+
+  /* Convert the vertex to tree coordinates, if needed. */
+  if (data->space_transform) {
+    BLI_space_transform_apply(data->space_transform, tmp_co);
+    BLI_space_transform_apply_normal(data->space_transform, tmp_no);
+  }
+
+  if (mesh_remap_bvhtree_query_raycast(
+          data->treedata, &tls->rayhit, tmp_co, tmp_no, data->ray_radius, data->max_dist, &hit_dist)) {
+    const MLoopTri *lt = &data->treedata->looptri[tls->rayhit.index];
+    const int poly_index = (int)lt->poly;
+
+    mesh_remap_item_define(data->r_map, i, hit_dist, 0, 1, &poly_index, &full_weight);
+  }
+  else {
+    /* No source for this dest poly! */
+    BKE_mesh_remap_item_define_invalid(data->r_map, i);
+  }
+}
+
 void BKE_mesh_remap_calc_polys_from_mesh(const int mode,
                                          const SpaceTransform *space_transform,
                                          const float max_dist,
@@ -2248,64 +2392,35 @@ void BKE_mesh_remap_calc_polys_from_mesh(const int mode,
   }
   else {
     BVHTreeFromMesh treedata = {NULL};
-    BVHTreeNearest nearest = {0};
     BVHTreeRayHit rayhit = {0};
     float hit_dist;
 
     BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_LOOPTRI, 2);
 
-    if (mode == MREMAP_MODE_POLY_NEAREST) {
-      nearest.index = -1;
+    MeshRemapParallelData data = {
+        .space_transform = space_transform,
+        .max_dist = max_dist,
+        .max_dist_sq = max_dist_sq,
+        .ray_radius = ray_radius,
+        .mode = mode,
+        .r_map = r_map,
+        .treedata = &treedata,
+        .verts_dst = verts_dst,
+        .loops_dst = loops_dst,
+        .polys_dst = polys_dst,
+        .poly_nors_dst = (const float(*)[3])poly_nors_dst,
+    };
+    MeshRemapParallelTLS tls = {.nearest = {.index = -1}};
+    TaskParallelSettings settings;
+    mesh_remap_task_settings(&settings, &tls, numpolys_dst);
 
-      for (i = 0; i < numpolys_dst; i++) {
-        MPoly *mp = &polys_dst[i];
-
-        BKE_mesh_calc_poly_center(mp, &loops_dst[mp->loopstart], verts_dst, tmp_co);
-
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
-
-        if (mesh_remap_bvhtree_query_nearest(
-                &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist)) {
-          const MLoopTri *lt = &treedata.looptri[nearest.index];
-          const int poly_index = (int)lt->poly;
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &poly_index, &full_weight);
-        }
-        else {
-          /* No source for this dest poly! */
-          BKE_mesh_remap_item_define_invalid(r_map, i);
-        }
-      }
+    if (mode == MREMAP_MODE_POLY_NEAREST) {
+      BLI_task_parallel_range(0, numpolys_dst, &data, mesh_remap_calc_polys_nearest_cb, &settings);
     }
     else if (mode == MREMAP_MODE_POLY_NOR) {
       BLI_assert(poly_nors_dst);
 
-      for (i = 0; i < numpolys_dst; i++) {
-        MPoly *mp = &polys_dst[i];
-
-        BKE_mesh_calc_poly_center(mp, &loops_dst[mp->loopstart], verts_dst, tmp_co);
-        copy_v3_v3(tmp_no, poly_nors_dst[i]);
-
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-          BLI_space_transform_apply_normal(space_transform, tmp_no);
-        }
-
-        if (mesh_remap_bvhtree_query_raycast(
-                &treedata, &rayhit, tmp_co, tmp_no, ray_radius, max_dist, &hit_dist)) {
-          const MLoopTri *lt = &treedata.looptri[rayhit.index];
-          const int poly_index = (int)lt->poly;
-
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &poly_index, &full_weight);
-        }
-        else {
-          /* No source for this dest poly! */
-          BKE_mesh_remap_item_define_invalid(r_map, i);
-        }
-      }
+      BLI_task_parallel_range(0, numpolys_dst, &data, mesh_remap_calc_polys_nor_cb, &settings);
     }
     else if (mode == MREMAP_MODE_POLY_POLYINTERP_PNORPROJ) {
       /* We cast our rays randomly, with a pseudo-even distribution
@@ -197,8 +197,60 @@ Mesh *BKE_mesh_remesh_quadriflow(const Mesh *mesh,
 }
 
 #ifdef WITH_OPENVDB
-static openvdb::FloatGrid::Ptr remesh_voxel_level_set_create(const Mesh *mesh,
-                                                             const float voxel_size)
+/**
+ * Adapter exposing the quadriflow-style update callback as an OpenVDB interrupter, so the level
+ * set conversion can report progress and be cancelled from a background job.
+ */
+class VoxelRemeshInterrupter {
+ private:
+  void (*update_cb_)(void *, float progress, int *cancel);
+  void *update_cb_data_;
+  /* Part of the total progress range covered by the interrupted operation. */
+  float progress_start_;
+  float progress_factor_;
+  bool was_interrupted_ = false;
+
+ public:
+  VoxelRemeshInterrupter(void (*update_cb)(void *, float progress, int *cancel),
+                         void *update_cb_data,
+                         const float progress_start,
+                         const float progress_factor)
+      : update_cb_(update_cb),
+        update_cb_data_(update_cb_data),
+        progress_start_(progress_start),
+        progress_factor_(progress_factor)
+  {
+  }
+
+  void start(const char *UNUSED(name) = nullptr) {}
+
+  void end() {}
+
+  bool wasInterrupted(const int percent = -1)
+  {
+    if (update_cb_ == nullptr) {
+      return false;
+    }
+    const float local_progress = (percent < 0) ? 0.0f : percent / 100.0f;
+    int cancel = 0;
+    update_cb_(update_cb_data_, progress_start_ + local_progress * progress_factor_, &cancel);
+    if (cancel) {
+      was_interrupted_ = true;
+    }
+    return was_interrupted_;
+  }
+
+  bool interrupted() const
+  {
+    return was_interrupted_;
+  }
+};
+
+static openvdb::FloatGrid::Ptr remesh_voxel_level_set_create(
+    const Mesh *mesh,
+    const float voxel_size,
+    void (*update_cb)(void *, float progress, int *cancel),
+    void *update_cb_data)
 {
   Span<MLoop> mloop{mesh->mloop, mesh->totloop};
   Span<MLoopTri> looptris{BKE_mesh_runtime_looptri_ensure(mesh),
@@ -220,13 +272,19 @@ static openvdb::FloatGrid::Ptr remesh_voxel_level_set_create(const Mesh *mesh,
 
   openvdb::math::Transform::Ptr transform = openvdb::math::Transform::createLinearTransform(
       voxel_size);
+  /* The conversion dominates the total runtime, let it cover most of the progress range. */
+  VoxelRemeshInterrupter interrupter(update_cb, update_cb_data, 0.0f, 0.75f);
   openvdb::FloatGrid::Ptr grid = openvdb::tools::meshToLevelSet<openvdb::FloatGrid>(
-      *transform, points, triangles, 1.0f);
+      interrupter, *transform, points, triangles, 1.0f);
+
+  if (interrupter.interrupted()) {
+    return nullptr;
+  }
 
   return grid;
 }
 
-static Mesh *remesh_voxel_volume_to_mesh(const openvdb::FloatGrid::Ptr level_set_grid,
+static Mesh *remesh_voxel_volume_to_mesh(openvdb::FloatGrid::Ptr level_set_grid,
                                          const float isovalue,
                                          const float adaptivity,
                                          const bool relax_disoriented_triangles)
@@ -237,6 +295,11 @@ static Mesh *remesh_voxel_volume_to_mesh(const openvdb::FloatGrid::Ptr level_set
   openvdb::tools::volumeToMesh<openvdb::FloatGrid>(
       *level_set_grid, vertices, tris, quads, isovalue, adaptivity, relax_disoriented_triangles);
 
+  /* The level set is not needed anymore, release it before the output mesh is allocated to
+   * lower the peak memory usage (the grid is the biggest allocation by far on dense meshes). */
+  level_set_grid->clear();
+  level_set_grid.reset();
+
   Mesh *mesh = BKE_mesh_new_nomain(
       vertices.size(), 0, 0, quads.size() * 4 + tris.size() * 3, quads.size() + tris.size());
   MutableSpan<MVert> mverts{mesh->mvert, mesh->totvert};
@@ -279,13 +342,28 @@ static Mesh *remesh_voxel_volume_to_mesh(const openvdb::FloatGrid::Ptr level_set
 Mesh *BKE_mesh_remesh_voxel(const Mesh *mesh,
                             const float voxel_size,
                             const float adaptivity,
-                            const float isovalue)
+                            const float isovalue,
+                            void (*update_cb)(void *, float progress, int *cancel),
+                            void *update_cb_data)
 {
 #ifdef WITH_OPENVDB
-  openvdb::FloatGrid::Ptr level_set = remesh_voxel_level_set_create(mesh, voxel_size);
-  return remesh_voxel_volume_to_mesh(level_set, isovalue, adaptivity, false);
+  openvdb::FloatGrid::Ptr level_set = remesh_voxel_level_set_create(
+      mesh, voxel_size, update_cb, update_cb_data);
+  if (!level_set) {
+    /* Conversion was cancelled. */
+    return nullptr;
+  }
+  /* Meshing itself is threaded internally by OpenVDB but has no interruption support, poll for
+   * cancellation once more before committing to it. */
+  VoxelRemeshInterrupter interrupter(update_cb, update_cb_data, 0.75f, 0.25f);
+  if (interrupter.wasInterrupted()) {
+    return nullptr;
+  }
+  Mesh *result = remesh_voxel_volume_to_mesh(std::move(level_set), isovalue, adaptivity, false);
+  interrupter.wasInterrupted(100);
+  return result;
 #else
-  UNUSED_VARS(mesh, voxel_size, adaptivity, isovalue);
+  UNUSED_VARS(mesh, voxel_size, adaptivity, isovalue, update_cb, update_cb_data);
   return nullptr;
 #endif
 }
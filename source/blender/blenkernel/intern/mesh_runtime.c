@@ -29,6 +29,7 @@
 #include "DNA_meshdata_types.h"
 #include "DNA_object_types.h"
 
+#include "BLI_hash_mm2a.h"
 #include "BLI_math_geom.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
@@ -36,6 +37,7 @@
 #include "BKE_bvhutils.h"
 #include "BKE_lib_id.h"
 #include "BKE_mesh.h"
+#include "BKE_mesh_mapping.h"
 #include "BKE_mesh_runtime.h"
 #include "BKE_shrinkwrap.h"
 #include "BKE_subdiv_ccg.h"
@@ -68,6 +70,7 @@ void BKE_mesh_runtime_reset_on_copy(Mesh *mesh, const int UNUSED(flag))
   memset(&runtime->looptris, 0, sizeof(runtime->looptris));
   runtime->bvh_cache = NULL;
   runtime->shrinkwrap_data = NULL;
+  runtime->topology_maps = NULL;
 
   mesh->runtime.eval_mutex = MEM_mallocN(sizeof(ThreadMutex), "mesh runtime eval_mutex");
   BLI_mutex_init(mesh->runtime.eval_mutex);
@@ -86,6 +89,11 @@ void BKE_mesh_runtime_clear_cache(Mesh *mesh)
     mesh->runtime.mesh_eval = NULL;
   }
   BKE_mesh_runtime_clear_geometry(mesh);
+  /* Unlike BKE_mesh_runtime_clear_geometry, this is a full teardown: also release the
+   * tessellation cache which is otherwise kept for topology-preserving updates. */
+  MEM_SAFE_FREE(mesh->runtime.looptris.array);
+  mesh->runtime.looptris.len = 0;
+  mesh->runtime.looptris.len_alloc = 0;
   BKE_mesh_batch_cache_free(mesh);
   BKE_mesh_runtime_clear_edit_data(mesh);
 }
@@ -124,6 +132,28 @@ static void mesh_ensure_looptri_data(Mesh *mesh)
   }
 }
 
+/**
+ * Hash of everything the tessellation result depends on: polygon loop ranges and loop vertex
+ * indices. Vertex coordinates are intentionally not included, they only affect the quality of
+ * the N-gon triangulation and any cached triangulation stays valid under deformation.
+ */
+static uint mesh_runtime_looptri_topology_hash(const Mesh *mesh)
+{
+  BLI_HashMurmur2A mm2;
+  BLI_hash_mm2a_init(&mm2, 0);
+  BLI_hash_mm2a_add_int(&mm2, mesh->totpoly);
+  BLI_hash_mm2a_add_int(&mm2, mesh->totloop);
+  if (mesh->totpoly != 0) {
+    BLI_hash_mm2a_add(
+        &mm2, (const uchar *)mesh->mpoly, sizeof(MPoly) * (size_t)mesh->totpoly);
+  }
+  if (mesh->totloop != 0) {
+    BLI_hash_mm2a_add(
+        &mm2, (const uchar *)mesh->mloop, sizeof(MLoop) * (size_t)mesh->totloop);
+  }
+  return BLI_hash_mm2a_end(&mm2);
+}
+
 /* This is a ported copy of CDDM_recalc_looptri(dm). */
 void BKE_mesh_runtime_looptri_recalc(Mesh *mesh)
 {
@@ -142,6 +172,9 @@ void BKE_mesh_runtime_looptri_recalc(Mesh *mesh)
                  mesh->runtime.looptris.array,
                  mesh->runtime.looptris.array_wip);
   mesh->runtime.looptris.array_wip = NULL;
+
+  mesh->runtime.looptris.topology_hash = mesh_runtime_looptri_topology_hash(mesh);
+  mesh->runtime.looptris.dirty_topology = false;
 }
 
 /* This is a ported copy of dm_getNumLoopTri(dm). */
@@ -170,6 +203,18 @@ const MLoopTri *BKE_mesh_runtime_looptri_ensure(const Mesh *mesh)
 
   MLoopTri *looptri = mesh->runtime.looptris.array;
 
+  if (looptri != NULL && mesh->runtime.looptris.dirty_topology) {
+    if (mesh_runtime_looptri_topology_hash(mesh) == mesh->runtime.looptris.topology_hash) {
+      /* Geometry changed but the topology didn't (armature or shape-key deformation for
+       * example), the cached tessellation is still valid. */
+      ((Mesh *)mesh)->runtime.looptris.dirty_topology = false;
+    }
+    else {
+      /* Fall through to re-tessellation, which re-uses the allocation when possible. */
+      looptri = NULL;
+    }
+  }
+
   if (looptri != NULL) {
     BLI_assert(BKE_mesh_runtime_looptri_len(mesh) == mesh->runtime.looptris.len);
   }
@@ -184,6 +229,109 @@ const MLoopTri *BKE_mesh_runtime_looptri_ensure(const Mesh *mesh)
   return looptri;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Mesh Runtime Topology Maps
+ *
+ * Adjacency maps (see BKE_mesh_mapping.h) only depend on the mesh topology, so they stay
+ * valid across deform-only updates and can be shared by all users of an evaluated mesh
+ * (modifiers, tools) instead of each rebuilding them. The cache is freed together with
+ * the other topology derived data in #BKE_mesh_runtime_clear_geometry, which also bumps
+ * #Mesh_Runtime.topology_generation.
+ * \{ */
+
+typedef struct MeshTopologyMapCache {
+  MeshElemMap *vert_poly_map;
+  int *vert_poly_mem;
+  MeshElemMap *vert_loop_map;
+  int *vert_loop_mem;
+  MeshElemMap *vert_edge_map;
+  int *vert_edge_mem;
+} MeshTopologyMapCache;
+
+static MeshTopologyMapCache *mesh_runtime_topology_maps_ensure(Mesh *mesh)
+{
+  if (mesh->runtime.topology_maps == NULL) {
+    mesh->runtime.topology_maps = MEM_callocN(sizeof(MeshTopologyMapCache), __func__);
+  }
+  return mesh->runtime.topology_maps;
+}
+
+static void mesh_runtime_topology_maps_free(Mesh_Runtime *runtime)
+{
+  MeshTopologyMapCache *maps = runtime->topology_maps;
+  if (maps == NULL) {
+    return;
+  }
+  MEM_SAFE_FREE(maps->vert_poly_map);
+  MEM_SAFE_FREE(maps->vert_poly_mem);
+  MEM_SAFE_FREE(maps->vert_loop_map);
+  MEM_SAFE_FREE(maps->vert_loop_mem);
+  MEM_SAFE_FREE(maps->vert_edge_map);
+  MEM_SAFE_FREE(maps->vert_edge_mem);
+  MEM_freeN(maps);
+  runtime->topology_maps = NULL;
+}
+
+const MeshElemMap *BKE_mesh_runtime_vert_poly_map_ensure(Mesh *mesh)
+{
+  ThreadMutex *mesh_eval_mutex = (ThreadMutex *)mesh->runtime.eval_mutex;
+  BLI_mutex_lock(mesh_eval_mutex);
+
+  MeshTopologyMapCache *maps = mesh_runtime_topology_maps_ensure(mesh);
+  if (maps->vert_poly_map == NULL) {
+    BKE_mesh_vert_poly_map_create(&maps->vert_poly_map,
+                                  &maps->vert_poly_mem,
+                                  mesh->mpoly,
+                                  mesh->mloop,
+                                  mesh->totvert,
+                                  mesh->totpoly,
+                                  mesh->totloop);
+  }
+
+  BLI_mutex_unlock(mesh_eval_mutex);
+
+  return maps->vert_poly_map;
+}
+
+const MeshElemMap *BKE_mesh_runtime_vert_loop_map_ensure(Mesh *mesh)
+{
+  ThreadMutex *mesh_eval_mutex = (ThreadMutex *)mesh->runtime.eval_mutex;
+  BLI_mutex_lock(mesh_eval_mutex);
+
+  MeshTopologyMapCache *maps = mesh_runtime_topology_maps_ensure(mesh);
+  if (maps->vert_loop_map == NULL) {
+    BKE_mesh_vert_loop_map_create(&maps->vert_loop_map,
+                                  &maps->vert_loop_mem,
+                                  mesh->mpoly,
+                                  mesh->mloop,
+                                  mesh->totvert,
+                                  mesh->totpoly,
+                                  mesh->totloop);
+  }
+
+  BLI_mutex_unlock(mesh_eval_mutex);
+
+  return maps->vert_loop_map;
+}
+
+const MeshElemMap *BKE_mesh_runtime_vert_edge_map_ensure(Mesh *mesh)
+{
+  ThreadMutex *mesh_eval_mutex = (ThreadMutex *)mesh->runtime.eval_mutex;
+  BLI_mutex_lock(mesh_eval_mutex);
+
+  MeshTopologyMapCache *maps = mesh_runtime_topology_maps_ensure(mesh);
+  if (maps->vert_edge_map == NULL) {
+    BKE_mesh_vert_edge_map_create(
+        &maps->vert_edge_map, &maps->vert_edge_mem, mesh->medge, mesh->totvert, mesh->totedge);
+  }
+
+  BLI_mutex_unlock(mesh_eval_mutex);
+
+  return maps->vert_edge_map;
+}
+
+/** \} */
+
 /* This is a copy of DM_verttri_from_looptri(). */
 void BKE_mesh_runtime_verttri_from_looptri(MVertTri *r_verttri,
                                            const MLoop *mloop,
@@ -241,7 +389,12 @@ void BKE_mesh_runtime_clear_geometry(Mesh *mesh)
     bvhcache_free(mesh->runtime.bvh_cache);
     mesh->runtime.bvh_cache = NULL;
   }
-  MEM_SAFE_FREE(mesh->runtime.looptris.array);
+  mesh_runtime_topology_maps_free(&mesh->runtime);
+  mesh->runtime.topology_generation++;
+  /* Don't free the tessellation cache here: it only depends on topology and is revalidated
+   * against a topology hash on next access, so deform-only updates (armature, shape keys)
+   * keep re-using it. See #BKE_mesh_runtime_looptri_ensure. */
+  mesh->runtime.looptris.dirty_topology = true;
   /* TODO(sergey): Does this really belong here? */
   if (mesh->runtime.subdiv_ccg != NULL) {
     BKE_subdiv_ccg_destroy(mesh->runtime.subdiv_ccg);
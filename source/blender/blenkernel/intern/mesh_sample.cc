@@ -14,6 +14,8 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+#include "BLI_task.hh"
+
 #include "BKE_attribute_access.hh"
 #include "BKE_attribute_math.hh"
 #include "BKE_mesh_runtime.h"
@@ -34,22 +36,24 @@ BLI_NOINLINE static void sample_point_attribute(const Mesh &mesh,
   const Span<MLoopTri> looptris{BKE_mesh_runtime_looptri_ensure(&mesh),
                                 BKE_mesh_runtime_looptri_len(&mesh)};
 
-  for (const int i : bary_coords.index_range()) {
-    const int looptri_index = looptri_indices[i];
-    const MLoopTri &looptri = looptris[looptri_index];
-    const float3 &bary_coord = bary_coords[i];
+  threading::parallel_for(bary_coords.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int looptri_index = looptri_indices[i];
+      const MLoopTri &looptri = looptris[looptri_index];
+      const float3 &bary_coord = bary_coords[i];
 
-    const int v0_index = mesh.mloop[looptri.tri[0]].v;
-    const int v1_index = mesh.mloop[looptri.tri[1]].v;
-    const int v2_index = mesh.mloop[looptri.tri[2]].v;
+      const int v0_index = mesh.mloop[looptri.tri[0]].v;
+      const int v1_index = mesh.mloop[looptri.tri[1]].v;
+      const int v2_index = mesh.mloop[looptri.tri[2]].v;
 
-    const T v0 = data_in[v0_index];
-    const T v1 = data_in[v1_index];
-    const T v2 = data_in[v2_index];
+      const T v0 = data_in[v0_index];
+      const T v1 = data_in[v1_index];
+      const T v2 = data_in[v2_index];
 
-    const T interpolated_value = attribute_math::mix3(bary_coord, v0, v1, v2);
-    data_out[i] = interpolated_value;
-  }
+      const T interpolated_value = attribute_math::mix3(bary_coord, v0, v1, v2);
+      data_out[i] = interpolated_value;
+    }
+  });
 }
 
 void sample_point_attribute(const Mesh &mesh,
@@ -81,22 +85,24 @@ BLI_NOINLINE static void sample_corner_attribute(const Mesh &mesh,
   const Span<MLoopTri> looptris{BKE_mesh_runtime_looptri_ensure(&mesh),
                                 BKE_mesh_runtime_looptri_len(&mesh)};
 
-  for (const int i : bary_coords.index_range()) {
-    const int looptri_index = looptri_indices[i];
-    const MLoopTri &looptri = looptris[looptri_index];
-    const float3 &bary_coord = bary_coords[i];
+  threading::parallel_for(bary_coords.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int looptri_index = looptri_indices[i];
+      const MLoopTri &looptri = looptris[looptri_index];
+      const float3 &bary_coord = bary_coords[i];
 
-    const int loop_index_0 = looptri.tri[0];
-    const int loop_index_1 = looptri.tri[1];
-    const int loop_index_2 = looptri.tri[2];
+      const int loop_index_0 = looptri.tri[0];
+      const int loop_index_1 = looptri.tri[1];
+      const int loop_index_2 = looptri.tri[2];
 
-    const T v0 = data_in[loop_index_0];
-    const T v1 = data_in[loop_index_1];
-    const T v2 = data_in[loop_index_2];
+      const T v0 = data_in[loop_index_0];
+      const T v1 = data_in[loop_index_1];
+      const T v2 = data_in[loop_index_2];
 
-    const T interpolated_value = attribute_math::mix3(bary_coord, v0, v1, v2);
-    data_out[i] = interpolated_value;
-  }
+      const T interpolated_value = attribute_math::mix3(bary_coord, v0, v1, v2);
+      data_out[i] = interpolated_value;
+    }
+  });
 }
 
 void sample_corner_attribute(const Mesh &mesh,
@@ -127,12 +133,14 @@ void sample_face_attribute(const Mesh &mesh,
   const Span<MLoopTri> looptris{BKE_mesh_runtime_looptri_ensure(&mesh),
                                 BKE_mesh_runtime_looptri_len(&mesh)};
 
-  for (const int i : data_out.index_range()) {
-    const int looptri_index = looptri_indices[i];
-    const MLoopTri &looptri = looptris[looptri_index];
-    const int poly_index = looptri.poly;
-    data_out[i] = data_in[poly_index];
-  }
+  threading::parallel_for(data_out.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int looptri_index = looptri_indices[i];
+      const MLoopTri &looptri = looptris[looptri_index];
+      const int poly_index = looptri.poly;
+      data_out[i] = data_in[poly_index];
+    }
+  });
 }
 
 void sample_face_attribute(const Mesh &mesh,
@@ -170,20 +178,22 @@ Span<float3> MeshAttributeInterpolator::ensure_barycentric_coords()
   const Span<MLoopTri> looptris{BKE_mesh_runtime_looptri_ensure(mesh_),
                                 BKE_mesh_runtime_looptri_len(mesh_)};
 
-  for (const int i : bary_coords_.index_range()) {
-    const int looptri_index = looptri_indices_[i];
-    const MLoopTri &looptri = looptris[looptri_index];
+  threading::parallel_for(bary_coords_.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int looptri_index = looptri_indices_[i];
+      const MLoopTri &looptri = looptris[looptri_index];
 
-    const int v0_index = mesh_->mloop[looptri.tri[0]].v;
-    const int v1_index = mesh_->mloop[looptri.tri[1]].v;
-    const int v2_index = mesh_->mloop[looptri.tri[2]].v;
+      const int v0_index = mesh_->mloop[looptri.tri[0]].v;
+      const int v1_index = mesh_->mloop[looptri.tri[1]].v;
+      const int v2_index = mesh_->mloop[looptri.tri[2]].v;
 
-    interp_weights_tri_v3(bary_coords_[i],
-                          mesh_->mvert[v0_index].co,
-                          mesh_->mvert[v1_index].co,
-                          mesh_->mvert[v2_index].co,
-                          positions_[i]);
-  }
+      interp_weights_tri_v3(bary_coords_[i],
+                            mesh_->mvert[v0_index].co,
+                            mesh_->mvert[v1_index].co,
+                            mesh_->mvert[v2_index].co,
+                            positions_[i]);
+    }
+  });
   return bary_coords_;
 }
 
@@ -198,20 +208,23 @@ Span<float3> MeshAttributeInterpolator::ensure_nearest_weights()
   const Span<MLoopTri> looptris{BKE_mesh_runtime_looptri_ensure(mesh_),
                                 BKE_mesh_runtime_looptri_len(mesh_)};
 
-  for (const int i : nearest_weights_.index_range()) {
-    const int looptri_index = looptri_indices_[i];
-    const MLoopTri &looptri = looptris[looptri_index];
+  threading::parallel_for(nearest_weights_.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int looptri_index = looptri_indices_[i];
+      const MLoopTri &looptri = looptris[looptri_index];
 
-    const int v0_index = mesh_->mloop[looptri.tri[0]].v;
-    const int v1_index = mesh_->mloop[looptri.tri[1]].v;
-    const int v2_index = mesh_->mloop[looptri.tri[2]].v;
+      const int v0_index = mesh_->mloop[looptri.tri[0]].v;
+      const int v1_index = mesh_->mloop[looptri.tri[1]].v;
+      const int v2_index = mesh_->mloop[looptri.tri[2]].v;
 
-    const float d0 = len_squared_v3v3(positions_[i], mesh_->mvert[v0_index].co);
-    const float d1 = len_squared_v3v3(positions_[i], mesh_->mvert[v1_index].co);
-    const float d2 = len_squared_v3v3(positions_[i], mesh_->mvert[v2_index].co);
+      const float d0 = len_squared_v3v3(positions_[i], mesh_->mvert[v0_index].co);
+      const float d1 = len_squared_v3v3(positions_[i], mesh_->mvert[v1_index].co);
+      const float d2 = len_squared_v3v3(positions_[i], mesh_->mvert[v2_index].co);
 
-    nearest_weights_[i] = MIN3_PAIR(d0, d1, d2, float3(1, 0, 0), float3(0, 1, 0), float3(0, 0, 1));
-  }
+      nearest_weights_[i] = MIN3_PAIR(
+          d0, d1, d2, float3(1, 0, 0), float3(0, 1, 0), float3(0, 0, 1));
+    }
+  });
   return nearest_weights_;
 }
 
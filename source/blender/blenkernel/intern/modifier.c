@@ -51,6 +51,7 @@
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
+#include "BLI_profile.h"
 #include "BLI_session_uuid.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.h"
@@ -1050,7 +1051,10 @@ struct Mesh *BKE_modifier_modify_mesh(ModifierData *md,
   if (mti->dependsOnNormals && mti->dependsOnNormals(md)) {
     modwrap_dependsOnNormals(me);
   }
-  return mti->modifyMesh(md, ctx, me);
+  BLI_PROFILE_SCOPE_BEGIN(profile, mti->name);
+  Mesh *result = mti->modifyMesh(md, ctx, me);
+  BLI_PROFILE_SCOPE_END(profile);
+  return result;
 }
 
 void BKE_modifier_deform_verts(ModifierData *md,
@@ -1065,7 +1069,9 @@ void BKE_modifier_deform_verts(ModifierData *md,
   if (me && mti->dependsOnNormals && mti->dependsOnNormals(md)) {
     modwrap_dependsOnNormals(me);
   }
+  BLI_PROFILE_SCOPE_BEGIN(profile, mti->name);
   mti->deformVerts(md, ctx, me, vertexCos, numVerts);
+  BLI_PROFILE_SCOPE_END(profile);
 }
 
 void BKE_modifier_deform_vertsEM(ModifierData *md,
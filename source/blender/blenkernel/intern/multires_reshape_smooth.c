@@ -259,6 +259,20 @@ static void linear_grid_element_interpolate(LinearGridElement *result,
 /** \name Surface
  * \{ */
 
+typedef struct BaseSurfaceGridsAllocateData {
+  SurfaceGrid *surface_grid;
+  int grid_area;
+} BaseSurfaceGridsAllocateData;
+
+static void base_surface_grids_allocate_task(void *__restrict userdata_v,
+                                             const int grid_index,
+                                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BaseSurfaceGridsAllocateData *data = userdata_v;
+  data->surface_grid[grid_index].points = MEM_calloc_arrayN(
+      sizeof(SurfacePoint), data->grid_area, "delta grid displacement");
+}
+
 static void base_surface_grids_allocate(MultiresReshapeSmoothContext *reshape_smooth_context)
 {
   const MultiresReshapeContext *reshape_context = reshape_smooth_context->reshape_context;
@@ -269,10 +283,18 @@ static void base_surface_grids_allocate(MultiresReshapeSmoothContext *reshape_sm
 
   SurfaceGrid *surface_grid = MEM_malloc_arrayN(num_grids, sizeof(SurfaceGrid), "delta grids");
 
-  for (int grid_index = 0; grid_index < num_grids; ++grid_index) {
-    surface_grid[grid_index].points = MEM_calloc_arrayN(
-        sizeof(SurfacePoint), grid_area, "delta grid displacement");
-  }
+  BaseSurfaceGridsAllocateData data;
+  data.surface_grid = surface_grid;
+  data.grid_area = grid_area;
+
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
+  parallel_range_settings.min_iter_per_thread = 1;
+
+  /* Allocation (and, more importantly, zeroing) of dense grids is well worth threading: grids are
+   * independent, so simply do one task per grid. */
+  BLI_task_parallel_range(
+      0, num_grids, &data, base_surface_grids_allocate_task, &parallel_range_settings);
 
   reshape_smooth_context->base_surface_grids = surface_grid;
 }
@@ -1050,21 +1072,48 @@ typedef void(ReshapeSubdivCoarsePositionCb)(
     const Vertex *vertex,
     float r_P[3]);
 
+typedef struct ReshapeSubdivCoarsePositionsTaskData {
+  const MultiresReshapeSmoothContext *reshape_smooth_context;
+  ReshapeSubdivCoarsePositionCb *coarse_position_cb;
+} ReshapeSubdivCoarsePositionsTaskData;
+
+static void reshape_subdiv_set_coarse_position_task(void *__restrict userdata_v,
+                                                    const int vertex_index,
+                                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ReshapeSubdivCoarsePositionsTaskData *data = userdata_v;
+  const MultiresReshapeSmoothContext *reshape_smooth_context = data->reshape_smooth_context;
+  Subdiv *reshape_subdiv = reshape_smooth_context->reshape_subdiv;
+
+  const Vertex *vertex = &reshape_smooth_context->geometry.vertices[vertex_index];
+  float P[3];
+  data->coarse_position_cb(reshape_smooth_context, vertex, P);
+
+  /* NOTE: Every vertex writes into its own region of the coarse positions buffer, so this is
+   * safe to do from multiple threads. */
+  reshape_subdiv->evaluator->setCoarsePositions(reshape_subdiv->evaluator, P, vertex_index, 1);
+}
+
 /* Refine subdivision surface topology at a reshape level for new coarse vertices positions. */
 static void reshape_subdiv_refine(const MultiresReshapeSmoothContext *reshape_smooth_context,
                                   ReshapeSubdivCoarsePositionCb coarse_position_cb)
 {
   Subdiv *reshape_subdiv = reshape_smooth_context->reshape_subdiv;
 
-  /* TODO(sergey): For non-trivial coarse_position_cb we should multi-thread this loop. */
+  /* Coarse position evaluation is where all the expensive limit surface and tangent matrix
+   * calculation happens, so multi-thread it. The refinement itself is threaded internally by
+   * OpenSubdiv. */
+  ReshapeSubdivCoarsePositionsTaskData data;
+  data.reshape_smooth_context = reshape_smooth_context;
+  data.coarse_position_cb = coarse_position_cb;
+
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
 
   const int num_vertices = reshape_smooth_context->geometry.num_vertices;
-  for (int i = 0; i < num_vertices; ++i) {
-    const Vertex *vertex = &reshape_smooth_context->geometry.vertices[i];
-    float P[3];
-    coarse_position_cb(reshape_smooth_context, vertex, P);
-    reshape_subdiv->evaluator->setCoarsePositions(reshape_subdiv->evaluator, P, i, 1);
-  }
+  BLI_task_parallel_range(
+      0, num_vertices, &data, reshape_subdiv_set_coarse_position_task, &parallel_range_settings);
+
   reshape_subdiv->evaluator->refine(reshape_subdiv->evaluator);
 }
 
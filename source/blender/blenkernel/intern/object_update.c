@@ -385,6 +385,16 @@ void BKE_object_data_batch_cache_dirty_tag(ID *object_data)
 
 void BKE_object_batch_cache_dirty_tag(Object *ob)
 {
+  if (ob->type == OB_MESH) {
+    Mesh *me = ob->data;
+    /* The edit-mesh is shared with the original data-block (see #update_mesh_edit_mode_pointers), so hints
+     * left there by edit-mode operators are visible here. Deform-only operations (transform)
+     * allow keeping the expensive topology dependent buffers. */
+    if (me->edit_mesh != NULL && BKE_editmesh_deform_only_update_consume(me->edit_mesh)) {
+      BKE_mesh_batch_cache_dirty_tag(me, BKE_MESH_BATCH_DIRTY_DEFORM);
+      return;
+    }
+  }
   BKE_object_data_batch_cache_dirty_tag(ob->data);
 }
 
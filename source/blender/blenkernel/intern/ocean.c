@@ -199,7 +199,7 @@ float BKE_ocean_jminus_to_foam(float jminus, float coverage)
   return foam;
 }
 
-void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float v)
+static void ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float v)
 {
   int i0, i1, j0, j1;
   float frac_x, frac_z;
@@ -216,8 +216,6 @@ void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float
     v += 1.0f;
   }
 
-  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
-
   uu = u * oc->_M;
   vv = v * oc->_N;
 
@@ -266,7 +264,33 @@ void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float
     }
   }
 #  undef BILERP
+}
 
+void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float v)
+{
+  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
+  ocean_eval_uv(oc, ocr, u, v);
+  BLI_rw_mutex_unlock(&oc->oceanmutex);
+}
+
+/**
+ * Variant of #BKE_ocean_eval_uv for evaluating many samples from a parallel
+ * loop: taking the ocean read lock for every sample costs enough to make such
+ * loops slower than a serial one, so the caller takes the lock once around the
+ * whole batch with #BKE_ocean_eval_lock / #BKE_ocean_eval_unlock instead.
+ */
+void BKE_ocean_eval_uv_no_lock(struct Ocean *oc, struct OceanResult *ocr, float u, float v)
+{
+  ocean_eval_uv(oc, ocr, u, v);
+}
+
+void BKE_ocean_eval_lock(struct Ocean *oc)
+{
+  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
+}
+
+void BKE_ocean_eval_unlock(struct Ocean *oc)
+{
   BLI_rw_mutex_unlock(&oc->oceanmutex);
 }
 
@@ -1596,6 +1620,21 @@ void BKE_ocean_eval_uv(struct Ocean *UNUSED(oc),
 {
 }
 
+void BKE_ocean_eval_uv_no_lock(struct Ocean *UNUSED(oc),
+                               struct OceanResult *UNUSED(ocr),
+                               float UNUSED(u),
+                               float UNUSED(v))
+{
+}
+
+void BKE_ocean_eval_lock(struct Ocean *UNUSED(oc))
+{
+}
+
+void BKE_ocean_eval_unlock(struct Ocean *UNUSED(oc))
+{
+}
+
 /* use catmullrom interpolation rather than linear */
 void BKE_ocean_eval_uv_catrom(struct Ocean *UNUSED(oc),
                               struct OceanResult *UNUSED(ocr),
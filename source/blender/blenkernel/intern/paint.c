@@ -1436,6 +1436,12 @@ static void sculptsession_free_pbvh(Object *object)
   MEM_SAFE_FREE(ss->vertex_info.connected_component);
   MEM_SAFE_FREE(ss->vertex_info.boundary);
 
+  MEM_SAFE_FREE(ss->neighbors_cache.offsets);
+  MEM_SAFE_FREE(ss->neighbors_cache.neighbors);
+
+  MEM_SAFE_FREE(ss->geodesic_cache.initial_vertices);
+  MEM_SAFE_FREE(ss->geodesic_cache.dists);
+
   MEM_SAFE_FREE(ss->fake_neighbors.fake_neighbor_index);
 }
 
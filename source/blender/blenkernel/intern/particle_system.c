@@ -1379,8 +1379,14 @@ void psys_update_particle_tree(ParticleSystem *psys, float cfra)
         totpart++;
       }
 
-      BLI_kdtree_3d_free(psys->tree);
-      psys->tree = BLI_kdtree_3d_new(psys->totpart);
+      /* Reuse the tree from the previous step when there is one, boids rebuild
+       * this every step and the allocation churn is measurable on large flocks. */
+      if (psys->tree) {
+        BLI_kdtree_3d_clear(psys->tree, psys->totpart);
+      }
+      else {
+        psys->tree = BLI_kdtree_3d_new(psys->totpart);
+      }
 
       LOOP_SHOWN_PARTICLES
       {
@@ -3819,6 +3825,33 @@ static void dynamics_step_sph_classical_integrate_task_cb_ex(void *__restrict us
   }
 }
 
+static void dynamics_step_newton_task_cb_ex(void *__restrict userdata,
+                                            const int p,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  DynamicStepSolverTaskData *data = userdata;
+  ParticleSimulationData *sim = data->sim;
+  ParticleSystem *psys = sim->psys;
+  ParticleSettings *part = psys->part;
+
+  ParticleData *pa;
+
+  if ((pa = psys->particles + p)->state.time <= 0.0f) {
+    return;
+  }
+
+  /* do global forces & effectors */
+  basic_integrate(sim, p, pa->state.time, data->cfra);
+
+  /* deflection */
+  if (sim->colliders) {
+    collision_check(sim, p, pa->state.time, data->cfra);
+  }
+
+  /* rotations */
+  basic_rotate(part, pa, pa->state.time, data->timestep);
+}
+
 /* unbaked particles are calculated dynamically */
 static void dynamics_step(ParticleSimulationData *sim, float cfra)
 {
@@ -3947,19 +3980,21 @@ static void dynamics_step(ParticleSimulationData *sim, float cfra)
 
   switch (part->phystype) {
     case PART_PHYS_NEWTON: {
-      LOOP_DYNAMIC_PARTICLES
-      {
-        /* do global forces & effectors */
-        basic_integrate(sim, p, pa->state.time, cfra);
-
-        /* deflection */
-        if (sim->colliders) {
-          collision_check(sim, p, pa->state.time, cfra);
-        }
+      /* Newtonian particles are independent of each other: forces, effector
+       * lookups and collider raycasts only read shared data, the same way the
+       * SPH solvers below already use them from parallel tasks. */
+      DynamicStepSolverTaskData task_data = {
+          .sim = sim,
+          .cfra = cfra,
+          .timestep = timestep,
+          .dtime = dtime,
+      };
 
-        /* rotations */
-        basic_rotate(part, pa, pa->state.time, timestep);
-      }
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.use_threading = (psys->totpart > 100);
+      BLI_task_parallel_range(
+          0, psys->totpart, &task_data, dynamics_step_newton_task_cb_ex, &settings);
       break;
     }
     case PART_PHYS_BOIDS: {
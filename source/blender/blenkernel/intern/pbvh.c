@@ -678,6 +678,11 @@ PBVH *BKE_pbvh_new(void)
 
 void BKE_pbvh_free(PBVH *pbvh)
 {
+  if (pbvh->draw_buffers_task_pool != NULL) {
+    BLI_task_pool_work_and_wait(pbvh->draw_buffers_task_pool);
+    BLI_task_pool_free(pbvh->draw_buffers_task_pool);
+  }
+
   for (int i = 0; i < pbvh->totnode; i++) {
     PBVHNode *node = &pbvh->nodes[i];
 
@@ -1258,17 +1263,11 @@ static int pbvh_get_buffers_update_flags(PBVH *UNUSED(pbvh))
   return update_flags;
 }
 
-static void pbvh_update_draw_buffer_cb(void *__restrict userdata,
-                                       const int n,
-                                       const TaskParallelTLS *__restrict UNUSED(tls))
+static void pbvh_node_draw_buffers_extract(PBVH *pbvh, PBVHNode *node)
 {
   /* Create and update draw buffers. The functions called here must not
    * do any OpenGL calls. Flags are not cleared immediately, that happens
    * after GPU_pbvh_buffer_flush() which does the final OpenGL calls. */
-  PBVHUpdateData *data = userdata;
-  PBVH *pbvh = data->pbvh;
-  PBVHNode *node = data->nodes[n];
-
   if (node->flag & PBVH_RebuildDrawBuffers) {
     switch (pbvh->type) {
       case PBVH_GRIDS:
@@ -1331,27 +1330,110 @@ static void pbvh_update_draw_buffer_cb(void *__restrict userdata,
   }
 }
 
-static void pbvh_update_draw_buffers(PBVH *pbvh, PBVHNode **nodes, int totnode, int update_flag)
+static void pbvh_update_draw_buffer_cb(void *__restrict userdata,
+                                       const int n,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  if ((update_flag & PBVH_RebuildDrawBuffers) || ELEM(pbvh->type, PBVH_GRIDS, PBVH_BMESH)) {
-    /* Free buffers uses OpenGL, so not in parallel. */
-    for (int n = 0; n < totnode; n++) {
-      PBVHNode *node = nodes[n];
-      if (node->flag & PBVH_RebuildDrawBuffers) {
-        GPU_pbvh_buffers_free(node->draw_buffers);
-        node->draw_buffers = NULL;
+  PBVHUpdateData *data = userdata;
+  PBVHNode *node = data->nodes[n];
+
+  if (node->flag & PBVH_DrawBufferStaged) {
+    /* Already filled by a background task, only needs the GPU upload. */
+    return;
+  }
+
+  pbvh_node_draw_buffers_extract(data->pbvh, node);
+}
+
+static void pbvh_free_draw_buffers_gl(PBVH *pbvh, PBVHNode **nodes, int totnode)
+{
+  /* Free buffers uses OpenGL, so not in parallel. */
+  for (int n = 0; n < totnode; n++) {
+    PBVHNode *node = nodes[n];
+    if (node->flag & PBVH_DrawBufferStaged) {
+      /* Already handled when the background extraction was started. */
+      continue;
+    }
+    if (node->flag & PBVH_RebuildDrawBuffers) {
+      GPU_pbvh_buffers_free(node->draw_buffers);
+      node->draw_buffers = NULL;
+    }
+    else if ((node->flag & PBVH_UpdateDrawBuffers) && node->draw_buffers) {
+      if (pbvh->type == PBVH_GRIDS) {
+        GPU_pbvh_grid_buffers_update_free(
+            node->draw_buffers, pbvh->grid_flag_mats, node->prim_indices);
       }
-      else if ((node->flag & PBVH_UpdateDrawBuffers) && node->draw_buffers) {
-        if (pbvh->type == PBVH_GRIDS) {
-          GPU_pbvh_grid_buffers_update_free(
-              node->draw_buffers, pbvh->grid_flag_mats, node->prim_indices);
-        }
-        else if (pbvh->type == PBVH_BMESH) {
-          GPU_pbvh_bmesh_buffers_update_free(node->draw_buffers);
-        }
+      else if (pbvh->type == PBVH_BMESH) {
+        GPU_pbvh_bmesh_buffers_update_free(node->draw_buffers);
       }
     }
   }
+}
+
+static void pbvh_draw_buffers_extract_task_cb(TaskPool *__restrict pool, void *taskdata)
+{
+  PBVH *pbvh = BLI_task_pool_user_data(pool);
+  PBVHNode *node = taskdata;
+
+  pbvh_node_draw_buffers_extract(pbvh, node);
+
+  /* No atomics needed: until the pool is joined again, nothing else writes node flags
+   * (brush steps join before modifying, drawing joins before uploading). */
+  node->flag |= PBVH_DrawBufferStaged;
+}
+
+void BKE_pbvh_draw_buffers_join(PBVH *pbvh)
+{
+  if (pbvh->draw_buffers_task_pool != NULL) {
+    BLI_task_pool_work_and_wait(pbvh->draw_buffers_task_pool);
+  }
+}
+
+void BKE_pbvh_draw_buffers_update_async(PBVH *pbvh)
+{
+  PBVHNode **nodes;
+  int totnode;
+
+  const int search_flag = PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers;
+  BKE_pbvh_search_gather(
+      pbvh, update_search_cb, POINTER_FROM_INT(search_flag), &nodes, &totnode);
+
+  if (totnode == 0) {
+    MEM_SAFE_FREE(nodes);
+    return;
+  }
+
+  /* Finish any batch still in flight before re-reading node state. */
+  BKE_pbvh_draw_buffers_join(pbvh);
+
+  /* OpenGL frees have to happen here on the calling thread,
+   * the CPU side fill is pushed to the workers. */
+  pbvh_free_draw_buffers_gl(pbvh, nodes, totnode);
+
+  if (pbvh->draw_buffers_task_pool == NULL) {
+    pbvh->draw_buffers_task_pool = BLI_task_pool_create(pbvh, TASK_PRIORITY_HIGH);
+  }
+
+  for (int n = 0; n < totnode; n++) {
+    PBVHNode *node = nodes[n];
+    if (node->flag & PBVH_DrawBufferStaged) {
+      continue;
+    }
+    BLI_task_pool_push(
+        pbvh->draw_buffers_task_pool, pbvh_draw_buffers_extract_task_cb, node, false, NULL);
+  }
+
+  MEM_SAFE_FREE(nodes);
+}
+
+static void pbvh_update_draw_buffers(PBVH *pbvh, PBVHNode **nodes, int totnode, int update_flag)
+{
+  /* Let background extraction finish first, staged nodes then only need the upload below. */
+  BKE_pbvh_draw_buffers_join(pbvh);
+
+  if ((update_flag & PBVH_RebuildDrawBuffers) || ELEM(pbvh->type, PBVH_GRIDS, PBVH_BMESH)) {
+    pbvh_free_draw_buffers_gl(pbvh, nodes, totnode);
+  }
 
   /* Parallel creation and update of draw buffers. */
   PBVHUpdateData data = {
@@ -1371,7 +1453,7 @@ static void pbvh_update_draw_buffers(PBVH *pbvh, PBVHNode **nodes, int totnode,
       GPU_pbvh_buffers_update_flush(node->draw_buffers);
     }
 
-    node->flag &= ~(PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers);
+    node->flag &= ~(PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers | PBVH_DrawBufferStaged);
   }
 }
 
@@ -1733,32 +1815,38 @@ void BKE_pbvh_node_mark_update(PBVHNode *node)
 {
   node->flag |= PBVH_UpdateNormals | PBVH_UpdateBB | PBVH_UpdateOriginalBB |
                 PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+  node->flag &= ~PBVH_DrawBufferStaged;
 }
 
 void BKE_pbvh_node_mark_update_mask(PBVHNode *node)
 {
   node->flag |= PBVH_UpdateMask | PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+  node->flag &= ~PBVH_DrawBufferStaged;
 }
 
 void BKE_pbvh_node_mark_update_color(PBVHNode *node)
 {
   node->flag |= PBVH_UpdateColor | PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+  node->flag &= ~PBVH_DrawBufferStaged;
 }
 
 void BKE_pbvh_node_mark_update_visibility(PBVHNode *node)
 {
   node->flag |= PBVH_UpdateVisibility | PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers |
                 PBVH_UpdateRedraw;
+  node->flag &= ~PBVH_DrawBufferStaged;
 }
 
 void BKE_pbvh_node_mark_rebuild_draw(PBVHNode *node)
 {
   node->flag |= PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+  node->flag &= ~PBVH_DrawBufferStaged;
 }
 
 void BKE_pbvh_node_mark_redraw(PBVHNode *node)
 {
   node->flag |= PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+  node->flag &= ~PBVH_DrawBufferStaged;
 }
 
 void BKE_pbvh_node_mark_normals_update(PBVHNode *node)
@@ -2647,6 +2735,34 @@ bool BKE_pbvh_node_frustum_exclude_AABB(PBVHNode *node, void *data)
   return test_frustum_aabb(bb_min, bb_max, data) != ISECT_INSIDE;
 }
 
+void BKE_pbvh_get_vert_normals_dirty(PBVH *pbvh, BLI_bitmap *r_dirty_verts)
+{
+  /* Export the partial update tags as a plain dirty-vertex bitmap, for incremental normal
+   * updates outside the PBVH itself (see #BKE_mesh_calc_normals_partial). Only meaningful
+   * for face type trees, others don't own mesh vertices. */
+  if (pbvh->type != PBVH_FACES) {
+    return;
+  }
+
+  PBVHNode **nodes;
+  int totnode;
+
+  BKE_pbvh_search_gather(
+      pbvh, update_search_cb, POINTER_FROM_INT(PBVH_UpdateNormals), &nodes, &totnode);
+
+  for (int n = 0; n < totnode; n++) {
+    const PBVHNode *node = nodes[n];
+    for (int i = 0; i < node->uniq_verts; i++) {
+      const int v = node->vert_indices[i];
+      if (pbvh->verts[v].flag & ME_VERT_PBVH_UPDATE) {
+        BLI_BITMAP_ENABLE(r_dirty_verts, v);
+      }
+    }
+  }
+
+  MEM_SAFE_FREE(nodes);
+}
+
 void BKE_pbvh_update_normals(PBVH *pbvh, struct SubdivCCG *subdiv_ccg)
 {
   /* Update normals */
@@ -25,6 +25,7 @@
 #include "BLI_heap_simple.h"
 #include "BLI_math.h"
 #include "BLI_memarena.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_DerivedMesh.h"
@@ -940,54 +941,138 @@ static void short_edge_queue_edge_add(EdgeQueueContext *eq_ctx, BMEdge *e)
   }
 }
 
-static void long_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+/** The face filter shared by long/short edge queue creation (thread-safe, read-only). */
+static bool edge_queue_face_in_range(EdgeQueueContext *eq_ctx, BMFace *f)
 {
 #ifdef USE_EDGEQUEUE_FRONTFACE
   if (eq_ctx->q->use_view_normal) {
     if (dot_v3v3(f->no, eq_ctx->q->view_normal) < 0.0f) {
-      return;
+      return false;
     }
   }
 #endif
 
-  if (eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f)) {
-    /* Check each edge of the face */
-    BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
-    BMLoop *l_iter = l_first;
-    do {
+  return eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f);
+}
+
+static void long_edge_queue_face_add_edges(EdgeQueueContext *eq_ctx, BMFace *f)
+{
+  /* Check each edge of the face */
+  BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
+  BMLoop *l_iter = l_first;
+  do {
 #ifdef USE_EDGEQUEUE_EVEN_SUBDIV
-      const float len_sq = BM_edge_calc_length_squared(l_iter->e);
-      if (len_sq > eq_ctx->q->limit_len_squared) {
-        long_edge_queue_edge_add_recursive(
-            eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->q->limit_len);
-      }
+    const float len_sq = BM_edge_calc_length_squared(l_iter->e);
+    if (len_sq > eq_ctx->q->limit_len_squared) {
+      long_edge_queue_edge_add_recursive(
+          eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->q->limit_len);
+    }
 #else
-      long_edge_queue_edge_add(eq_ctx, l_iter->e);
+    long_edge_queue_edge_add(eq_ctx, l_iter->e);
 #endif
-    } while ((l_iter = l_iter->next) != l_first);
+  } while ((l_iter = l_iter->next) != l_first);
+}
+
+static void short_edge_queue_face_add_edges(EdgeQueueContext *eq_ctx, BMFace *f)
+{
+  BMLoop *l_iter;
+  BMLoop *l_first;
+
+  /* Check each edge of the face */
+  l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+  do {
+    short_edge_queue_edge_add(eq_ctx, l_iter->e);
+  } while ((l_iter = l_iter->next) != l_first);
+}
+
+/* Gather faces intersecting the brush region in parallel over nodes, the
+ * geometric tests dominate queue creation on dense meshes. The edge tags and
+ * the heap the surviving faces feed are shared, so that part stays serial,
+ * as do the actual topology changes (BMesh and its mempools are not safe to
+ * mutate from multiple threads). */
+
+typedef struct EdgeQueueFacesTaskData {
+  EdgeQueueContext *eq_ctx;
+  PBVHNode **nodes;
+  /** Per node array of faces passing the range test, NULL when none do. */
+  BMFace ***faces;
+  int *faces_len;
+} EdgeQueueFacesTaskData;
+
+static void edge_queue_faces_in_range_task_cb(void *__restrict userdata,
+                                              const int n,
+                                              const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  EdgeQueueFacesTaskData *data = userdata;
+  PBVHNode *node = data->nodes[n];
+  const uint bm_faces_len = BLI_gset_len(node->bm_faces);
+  BMFace **faces = NULL;
+  int faces_len = 0;
+
+  if (bm_faces_len != 0) {
+    GSetIterator gs_iter;
+
+    faces = MEM_mallocN(sizeof(*faces) * bm_faces_len, __func__);
+    GSET_ITER (gs_iter, node->bm_faces) {
+      BMFace *f = BLI_gsetIterator_getKey(&gs_iter);
+
+      if (edge_queue_face_in_range(data->eq_ctx, f)) {
+        faces[faces_len++] = f;
+      }
+    }
+    if (faces_len == 0) {
+      MEM_freeN(faces);
+      faces = NULL;
+    }
   }
+
+  data->faces[n] = faces;
+  data->faces_len[n] = faces_len;
 }
 
-static void short_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+static void edge_queue_faces_add_all(EdgeQueueContext *eq_ctx,
+                                     PBVH *pbvh,
+                                     void (*face_add_edges_fn)(EdgeQueueContext *, BMFace *))
 {
-#ifdef USE_EDGEQUEUE_FRONTFACE
-  if (eq_ctx->q->use_view_normal) {
-    if (dot_v3v3(f->no, eq_ctx->q->view_normal) < 0.0f) {
-      return;
+  EdgeQueueFacesTaskData data;
+  TaskParallelSettings settings;
+  PBVHNode **nodes = MEM_mallocN(sizeof(*nodes) * pbvh->totnode, __func__);
+  int totnode = 0;
+
+  for (int n = 0; n < pbvh->totnode; n++) {
+    PBVHNode *node = &pbvh->nodes[n];
+
+    /* Check leaf nodes marked for topology update */
+    if ((node->flag & PBVH_Leaf) && (node->flag & PBVH_UpdateTopology) &&
+        !(node->flag & PBVH_FullyHidden)) {
+      nodes[totnode++] = node;
     }
   }
-#endif
 
-  if (eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f)) {
-    BMLoop *l_iter;
-    BMLoop *l_first;
+  if (totnode != 0) {
+    data.eq_ctx = eq_ctx;
+    data.nodes = nodes;
+    data.faces = MEM_mallocN(sizeof(*data.faces) * totnode, __func__);
+    data.faces_len = MEM_mallocN(sizeof(*data.faces_len) * totnode, __func__);
 
-    /* Check each edge of the face */
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      short_edge_queue_edge_add(eq_ctx, l_iter->e);
-    } while ((l_iter = l_iter->next) != l_first);
+    BKE_pbvh_parallel_range_settings(&settings, true, totnode);
+    BLI_task_parallel_range(0, totnode, &data, edge_queue_faces_in_range_task_cb, &settings);
+
+    /* Serial fix-up: feed the shared heap in node order. */
+    for (int n = 0; n < totnode; n++) {
+      for (int i = 0; i < data.faces_len[n]; i++) {
+        face_add_edges_fn(eq_ctx, data.faces[n][i]);
+      }
+      if (data.faces[n]) {
+        MEM_freeN(data.faces[n]);
+      }
+    }
+
+    MEM_freeN(data.faces_len);
+    MEM_freeN(data.faces);
   }
+
+  MEM_freeN(nodes);
 }
 
 /* Create a priority queue containing vertex pairs connected by a long
@@ -1035,22 +1120,7 @@ static void long_edge_queue_create(EdgeQueueContext *eq_ctx,
   pbvh_bmesh_edge_tag_verify(pbvh);
 #endif
 
-  for (int n = 0; n < pbvh->totnode; n++) {
-    PBVHNode *node = &pbvh->nodes[n];
-
-    /* Check leaf nodes marked for topology update */
-    if ((node->flag & PBVH_Leaf) && (node->flag & PBVH_UpdateTopology) &&
-        !(node->flag & PBVH_FullyHidden)) {
-      GSetIterator gs_iter;
-
-      /* Check each face */
-      GSET_ITER (gs_iter, node->bm_faces) {
-        BMFace *f = BLI_gsetIterator_getKey(&gs_iter);
-
-        long_edge_queue_face_add(eq_ctx, f);
-      }
-    }
-  }
+  edge_queue_faces_add_all(eq_ctx, pbvh, long_edge_queue_face_add_edges);
 }
 
 /* Create a priority queue containing vertex pairs connected by a
@@ -1094,22 +1164,7 @@ static void short_edge_queue_create(EdgeQueueContext *eq_ctx,
     eq_ctx->q->edge_queue_tri_in_range = edge_queue_tri_in_sphere;
   }
 
-  for (int n = 0; n < pbvh->totnode; n++) {
-    PBVHNode *node = &pbvh->nodes[n];
-
-    /* Check leaf nodes marked for topology update */
-    if ((node->flag & PBVH_Leaf) && (node->flag & PBVH_UpdateTopology) &&
-        !(node->flag & PBVH_FullyHidden)) {
-      GSetIterator gs_iter;
-
-      /* Check each face */
-      GSET_ITER (gs_iter, node->bm_faces) {
-        BMFace *f = BLI_gsetIterator_getKey(&gs_iter);
-
-        short_edge_queue_face_add(eq_ctx, f);
-      }
-    }
-  }
+  edge_queue_faces_add_all(eq_ctx, pbvh, short_edge_queue_face_add_edges);
 }
 
 /*************************** Topology update **************************/
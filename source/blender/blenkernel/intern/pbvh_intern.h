@@ -154,6 +154,10 @@ struct PBVH {
    * don't need to remain valid after */
   BLI_bitmap *vert_bitmap;
 
+  /* Workers filling draw buffers in the background, lazily created
+   * (see BKE_pbvh_draw_buffers_update_async). */
+  struct TaskPool *draw_buffers_task_pool;
+
 #ifdef PERFCNTRS
   int perf_modified;
 #endif
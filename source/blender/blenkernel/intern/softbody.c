@@ -59,6 +59,7 @@
 #include "BLI_ghash.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -281,12 +282,57 @@ typedef struct ccd_Mesh {
   float bbmax[3];
 } ccd_Mesh;
 
+BLI_INLINE void ccd_mima_add_vert(ccdf_minmax *mima, const float v[3], const float hull)
+{
+  mima->minx = min_ff(mima->minx, v[0] - hull);
+  mima->miny = min_ff(mima->miny, v[1] - hull);
+  mima->minz = min_ff(mima->minz, v[2] - hull);
+  mima->maxx = max_ff(mima->maxx, v[0] + hull);
+  mima->maxy = max_ff(mima->maxy, v[1] + hull);
+  mima->maxz = max_ff(mima->maxz, v[2] + hull);
+}
+
+typedef struct CCDMimaTaskData {
+  ccd_Mesh *pccd_M;
+  float hull;
+} CCDMimaTaskData;
+
+/* Walk the list of faces and find the OBB they live in, independent per face. */
+static void ccd_mesh_mima_task_cb(void *__restrict userdata,
+                                  const int i,
+                                  const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  CCDMimaTaskData *data = userdata;
+  ccd_Mesh *pccd_M = data->pccd_M;
+  ccdf_minmax *mima = &pccd_M->mima[i];
+  const MVertTri *vt = &pccd_M->tri[i];
+
+  mima->minx = mima->miny = mima->minz = 1e30f;
+  mima->maxx = mima->maxy = mima->maxz = -1e30f;
+
+  for (int j = 0; j < 3; j++) {
+    ccd_mima_add_vert(mima, pccd_M->mvert[vt->tri[j]].co, data->hull);
+  }
+  if (pccd_M->mprevvert) {
+    for (int j = 0; j < 3; j++) {
+      ccd_mima_add_vert(mima, pccd_M->mprevvert[vt->tri[j]].co, data->hull);
+    }
+  }
+}
+
+static void ccd_mesh_mima_update(ccd_Mesh *pccd_M, const float hull)
+{
+  CCDMimaTaskData data = {.pccd_M = pccd_M, .hull = hull};
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, pccd_M->tri_num, &data, ccd_mesh_mima_task_cb, &settings);
+}
+
 static ccd_Mesh *ccd_mesh_make(Object *ob)
 {
   CollisionModifierData *cmd;
   ccd_Mesh *pccd_M = NULL;
-  ccdf_minmax *mima;
-  const MVertTri *vt;
   float hull;
   int i;
 
@@ -334,45 +380,13 @@ static ccd_Mesh *ccd_mesh_make(Object *ob)
   /* OBBs for idea1 */
   pccd_M->mima = MEM_mallocN(sizeof(ccdf_minmax) * pccd_M->tri_num, "ccd_Mesh_Faces_mima");
 
-  /* anyhoo we need to walk the list of faces and find OBB they live in */
-  for (i = 0, mima = pccd_M->mima, vt = pccd_M->tri; i < pccd_M->tri_num; i++, mima++, vt++) {
-    const float *v;
-
-    mima->minx = mima->miny = mima->minz = 1e30f;
-    mima->maxx = mima->maxy = mima->maxz = -1e30f;
-
-    v = pccd_M->mvert[vt->tri[0]].co;
-    mima->minx = min_ff(mima->minx, v[0] - hull);
-    mima->miny = min_ff(mima->miny, v[1] - hull);
-    mima->minz = min_ff(mima->minz, v[2] - hull);
-    mima->maxx = max_ff(mima->maxx, v[0] + hull);
-    mima->maxy = max_ff(mima->maxy, v[1] + hull);
-    mima->maxz = max_ff(mima->maxz, v[2] + hull);
-
-    v = pccd_M->mvert[vt->tri[1]].co;
-    mima->minx = min_ff(mima->minx, v[0] - hull);
-    mima->miny = min_ff(mima->miny, v[1] - hull);
-    mima->minz = min_ff(mima->minz, v[2] - hull);
-    mima->maxx = max_ff(mima->maxx, v[0] + hull);
-    mima->maxy = max_ff(mima->maxy, v[1] + hull);
-    mima->maxz = max_ff(mima->maxz, v[2] + hull);
-
-    v = pccd_M->mvert[vt->tri[2]].co;
-    mima->minx = min_ff(mima->minx, v[0] - hull);
-    mima->miny = min_ff(mima->miny, v[1] - hull);
-    mima->minz = min_ff(mima->minz, v[2] - hull);
-    mima->maxx = max_ff(mima->maxx, v[0] + hull);
-    mima->maxy = max_ff(mima->maxy, v[1] + hull);
-    mima->maxz = max_ff(mima->maxz, v[2] + hull);
-  }
+  ccd_mesh_mima_update(pccd_M, hull);
 
   return pccd_M;
 }
 static void ccd_mesh_update(Object *ob, ccd_Mesh *pccd_M)
 {
   CollisionModifierData *cmd;
-  ccdf_minmax *mima;
-  const MVertTri *vt;
   float hull;
   int i;
 
@@ -429,63 +443,7 @@ static void ccd_mesh_update(Object *ob, ccd_Mesh *pccd_M)
     pccd_M->bbmax[2] = max_ff(pccd_M->bbmax[2], v[2] + hull);
   }
 
-  /* anyhoo we need to walk the list of faces and find OBB they live in */
-  for (i = 0, mima = pccd_M->mima, vt = pccd_M->tri; i < pccd_M->tri_num; i++, mima++, vt++) {
-    const float *v;
-
-    mima->minx = mima->miny = mima->minz = 1e30f;
-    mima->maxx = mima->maxy = mima->maxz = -1e30f;
-
-    /* mvert */
-    v = pccd_M->mvert[vt->tri[0]].co;
-    mima->minx = min_ff(mima->minx, v[0] - hull);
-    mima->miny = min_ff(mima->miny, v[1] - hull);
-    mima->minz = min_ff(mima->minz, v[2] - hull);
-    mima->maxx = max_ff(mima->maxx, v[0] + hull);
-    mima->maxy = max_ff(mima->maxy, v[1] + hull);
-    mima->maxz = max_ff(mima->maxz, v[2] + hull);
-
-    v = pccd_M->mvert[vt->tri[1]].co;
-    mima->minx = min_ff(mima->minx, v[0] - hull);
-    mima->miny = min_ff(mima->miny, v[1] - hull);
-    mima->minz = min_ff(mima->minz, v[2] - hull);
-    mima->maxx = max_ff(mima->maxx, v[0] + hull);
-    mima->maxy = max_ff(mima->maxy, v[1] + hull);
-    mima->maxz = max_ff(mima->maxz, v[2] + hull);
-
-    v = pccd_M->mvert[vt->tri[2]].co;
-    mima->minx = min_ff(mima->minx, v[0] - hull);
-    mima->miny = min_ff(mima->miny, v[1] - hull);
-    mima->minz = min_ff(mima->minz, v[2] - hull);
-    mima->maxx = max_ff(mima->maxx, v[0] + hull);
-    mima->maxy = max_ff(mima->maxy, v[1] + hull);
-    mima->maxz = max_ff(mima->maxz, v[2] + hull);
-
-    /* mprevvert */
-    v = pccd_M->mprevvert[vt->tri[0]].co;
-    mima->minx = min_ff(mima->minx, v[0] - hull);
-    mima->miny = min_ff(mima->miny, v[1] - hull);
-    mima->minz = min_ff(mima->minz, v[2] - hull);
-    mima->maxx = max_ff(mima->maxx, v[0] + hull);
-    mima->maxy = max_ff(mima->maxy, v[1] + hull);
-    mima->maxz = max_ff(mima->maxz, v[2] + hull);
-
-    v = pccd_M->mprevvert[vt->tri[1]].co;
-    mima->minx = min_ff(mima->minx, v[0] - hull);
-    mima->miny = min_ff(mima->miny, v[1] - hull);
-    mima->minz = min_ff(mima->minz, v[2] - hull);
-    mima->maxx = max_ff(mima->maxx, v[0] + hull);
-    mima->maxy = max_ff(mima->maxy, v[1] + hull);
-    mima->maxz = max_ff(mima->maxz, v[2] + hull);
-
-    v = pccd_M->mprevvert[vt->tri[2]].co;
-    mima->minx = min_ff(mima->minx, v[0] - hull);
-    mima->miny = min_ff(mima->miny, v[1] - hull);
-    mima->minz = min_ff(mima->minz, v[2] - hull);
-    mima->maxx = max_ff(mima->maxx, v[0] + hull);
-    mima->maxy = max_ff(mima->maxy, v[1] + hull);
-    mima->maxz = max_ff(mima->maxz, v[2] + hull);
-  }
+  ccd_mesh_mima_update(pccd_M, hull);
 }
 
 static void ccd_mesh_free(ccd_Mesh *ccdm)
@@ -27,6 +27,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_blenlib.h"
+#include "BLI_hash.h"
 #include "BLI_iterator.h"
 #include "BLI_math.h"
 #include "BLI_threads.h"
@@ -1014,6 +1015,11 @@ void BKE_sound_free_waveform(bSound *sound)
       if (waveform->data) {
         MEM_freeN(waveform->data);
       }
+      for (int level = 0; level < SOUND_WAVEFORM_PYRAMID_LEVELS; level++) {
+        if (waveform->pyramid[level]) {
+          MEM_freeN(waveform->pyramid[level]);
+        }
+      }
       MEM_freeN(waveform);
     }
 
@@ -1023,55 +1029,214 @@ void BKE_sound_free_waveform(bSound *sound)
   sound->tags &= ~SOUND_TAGS_WAVEFORM_NO_RELOAD;
 }
 
-void BKE_sound_read_waveform(Main *bmain, bSound *sound, short *stop)
+/* Magic identifying waveform cache files, with a version to invalidate outdated copies. */
+#define SOUND_WAVEFORM_CACHE_MAGIC "BLENWAVE"
+#define SOUND_WAVEFORM_CACHE_VERSION 1
+
+typedef struct SoundWaveformCacheHeader {
+  char magic[8];
+  int version;
+  int samples_per_second;
+  int length;
+  int _pad;
+  /* Size and modification time of the source file the samples were decoded from. */
+  int64_t source_size;
+  int64_t source_mtime;
+} SoundWaveformCacheHeader;
+
+/**
+ * Build the downsampled min/max/rms levels used to draw zoomed out timelines. Each level
+ * aggregates two samples of the previous one, so building all levels is linear in the
+ * waveform length.
+ */
+static void sound_waveform_pyramid_build(SoundWaveform *waveform)
 {
-  bool need_close_audio_handles = false;
-  if (sound->playback_handle == NULL) {
-    /* TODO(sergey): Make it fully independent audio handle. */
-    sound_load_audio(bmain, sound, true);
-    need_close_audio_handles = true;
+  const float *src = waveform->data;
+  int src_length = waveform->length;
+
+  for (int level = 0; level < SOUND_WAVEFORM_PYRAMID_LEVELS; level++) {
+    const int length = src_length / 2;
+    if (length == 0) {
+      break;
+    }
+    float *dst = MEM_mallocN(sizeof(float[3]) * length, "SoundWaveform.pyramid");
+    for (int i = 0; i < length; i++) {
+      const float *a = src + (size_t)(i * 2) * 3;
+      const float *b = a + 3;
+      dst[i * 3 + 0] = min_ff(a[0], b[0]);
+      dst[i * 3 + 1] = max_ff(a[1], b[1]);
+      dst[i * 3 + 2] = max_ff(a[2], b[2]);
+    }
+    waveform->pyramid[level] = dst;
+    waveform->pyramid_length[level] = length;
+    src = dst;
+    src_length = length;
   }
+}
 
-  AUD_SoundInfo info = AUD_getInfo(sound->playback_handle);
-  SoundWaveform *waveform = MEM_mallocN(sizeof(SoundWaveform), "SoundWaveform");
+/**
+ * Get the path of the waveform cache file for this sound, along with the current size and
+ * modification time of the source file that are used to validate the cache. Cache files live in
+ * the proxy directory next to the blend file, so they are cleaned up together with proxies.
+ */
+static bool sound_waveform_cache_params_get(
+    Main *bmain, bSound *sound, char r_path[FILE_MAX], int64_t *r_size, int64_t *r_mtime)
+{
+  const char *blendfile_path = BKE_main_blendfile_path(bmain);
+  if (blendfile_path[0] == '\0') {
+    /* Without a blend file there is no place for the proxy directory. */
+    return false;
+  }
+  if (sound->packedfile != NULL) {
+    /* Packed sounds have no file on disk to validate the cache against. */
+    return false;
+  }
 
-  if (info.length > 0) {
-    int length = info.length * SOUND_WAVE_SAMPLES_PER_SECOND;
+  char filepath_abs[FILE_MAX];
+  BLI_strncpy(filepath_abs, sound->filepath, sizeof(filepath_abs));
+  BLI_path_abs(filepath_abs, ID_BLEND_PATH(bmain, &sound->id));
 
-    waveform->data = MEM_mallocN(sizeof(float[3]) * length, "SoundWaveform.samples");
-    waveform->length = AUD_readSound(
-        sound->playback_handle, waveform->data, length, SOUND_WAVE_SAMPLES_PER_SECOND, stop);
+  BLI_stat_t st;
+  if (BLI_stat(filepath_abs, &st) == -1) {
+    return false;
   }
-  else {
-    /* Create an empty waveform here if the sound couldn't be
-     * read. This indicates that reading the waveform is "done",
-     * whereas just setting sound->waveform to NULL causes other
-     * code to think the waveform still needs to be created. */
-    waveform->data = NULL;
-    waveform->length = 0;
+  *r_size = (int64_t)st.st_size;
+  *r_mtime = (int64_t)st.st_mtime;
+
+  char dir[FILE_MAX];
+  BLI_split_dir_part(blendfile_path, dir, sizeof(dir));
+
+  BLI_snprintf(r_path,
+               FILE_MAX,
+               "%sBL_proxy" SEP_STR "waveform" SEP_STR "%08x.bwav",
+               dir,
+               BLI_hash_string(filepath_abs));
+  return true;
+}
+
+static SoundWaveform *sound_waveform_cache_read(Main *bmain, bSound *sound)
+{
+  char path[FILE_MAX];
+  int64_t source_size, source_mtime;
+  if (!sound_waveform_cache_params_get(bmain, sound, path, &source_size, &source_mtime)) {
+    return NULL;
   }
 
-  if (*stop) {
-    if (waveform->data) {
-      MEM_freeN(waveform->data);
+  FILE *file = BLI_fopen(path, "rb");
+  if (file == NULL) {
+    return NULL;
+  }
+
+  SoundWaveformCacheHeader header;
+  SoundWaveform *waveform = NULL;
+  if (fread(&header, sizeof(header), 1, file) == 1 &&
+      memcmp(header.magic, SOUND_WAVEFORM_CACHE_MAGIC, sizeof(header.magic)) == 0 &&
+      header.version == SOUND_WAVEFORM_CACHE_VERSION &&
+      header.samples_per_second == SOUND_WAVE_SAMPLES_PER_SECOND && header.length >= 0 &&
+      header.source_size == source_size && header.source_mtime == source_mtime) {
+    waveform = MEM_callocN(sizeof(SoundWaveform), "SoundWaveform");
+    waveform->length = header.length;
+    if (header.length > 0) {
+      waveform->data = MEM_mallocN(sizeof(float[3]) * header.length, "SoundWaveform.samples");
+      if (fread(waveform->data, sizeof(float[3]), header.length, file) != (size_t)header.length) {
+        MEM_freeN(waveform->data);
+        MEM_freeN(waveform);
+        waveform = NULL;
+      }
     }
-    MEM_freeN(waveform);
-    BLI_spin_lock(sound->spinlock);
-    sound->tags &= ~SOUND_TAGS_WAVEFORM_LOADING;
-    BLI_spin_unlock(sound->spinlock);
+  }
+  fclose(file);
+  return waveform;
+}
+
+static void sound_waveform_cache_write(Main *bmain, bSound *sound, const SoundWaveform *waveform)
+{
+  char path[FILE_MAX];
+  int64_t source_size, source_mtime;
+  if (!sound_waveform_cache_params_get(bmain, sound, path, &source_size, &source_mtime)) {
     return;
   }
 
+  char dir[FILE_MAX];
+  BLI_split_dir_part(path, dir, sizeof(dir));
+  if (!BLI_dir_create_recursive(dir)) {
+    return;
+  }
+
+  FILE *file = BLI_fopen(path, "wb");
+  if (file == NULL) {
+    return;
+  }
+
+  SoundWaveformCacheHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, SOUND_WAVEFORM_CACHE_MAGIC, sizeof(header.magic));
+  header.version = SOUND_WAVEFORM_CACHE_VERSION;
+  header.samples_per_second = SOUND_WAVE_SAMPLES_PER_SECOND;
+  header.length = waveform->length;
+  header.source_size = source_size;
+  header.source_mtime = source_mtime;
+
+  fwrite(&header, sizeof(header), 1, file);
+  if (waveform->length > 0) {
+    fwrite(waveform->data, sizeof(float[3]), waveform->length, file);
+  }
+  fclose(file);
+}
+
+void BKE_sound_read_waveform(Main *bmain, bSound *sound, short *stop)
+{
+  SoundWaveform *waveform = sound_waveform_cache_read(bmain, sound);
+
+  if (waveform == NULL) {
+    bool need_close_audio_handles = false;
+    if (sound->playback_handle == NULL) {
+      /* TODO(sergey): Make it fully independent audio handle. */
+      sound_load_audio(bmain, sound, true);
+      need_close_audio_handles = true;
+    }
+
+    AUD_SoundInfo info = AUD_getInfo(sound->playback_handle);
+    waveform = MEM_callocN(sizeof(SoundWaveform), "SoundWaveform");
+
+    if (info.length > 0) {
+      int length = info.length * SOUND_WAVE_SAMPLES_PER_SECOND;
+
+      waveform->data = MEM_mallocN(sizeof(float[3]) * length, "SoundWaveform.samples");
+      waveform->length = AUD_readSound(
+          sound->playback_handle, waveform->data, length, SOUND_WAVE_SAMPLES_PER_SECOND, stop);
+    }
+    /* When the sound couldn't be read an empty waveform is kept. This indicates that reading
+     * the waveform is "done", whereas just setting sound->waveform to NULL causes other code
+     * to think the waveform still needs to be created. */
+
+    if (*stop) {
+      if (waveform->data) {
+        MEM_freeN(waveform->data);
+      }
+      MEM_freeN(waveform);
+      BLI_spin_lock(sound->spinlock);
+      sound->tags &= ~SOUND_TAGS_WAVEFORM_LOADING;
+      BLI_spin_unlock(sound->spinlock);
+      return;
+    }
+
+    /* Cache the samples on disk, so reopening the file does not decode the sound again. */
+    sound_waveform_cache_write(bmain, sound, waveform);
+
+    if (need_close_audio_handles) {
+      sound_free_audio(sound);
+    }
+  }
+
+  sound_waveform_pyramid_build(waveform);
+
   BKE_sound_free_waveform(sound);
 
   BLI_spin_lock(sound->spinlock);
   sound->waveform = waveform;
   sound->tags &= ~SOUND_TAGS_WAVEFORM_LOADING;
   BLI_spin_unlock(sound->spinlock);
-
-  if (need_close_audio_handles) {
-    sound_free_audio(sound);
-  }
 }
 
 static void sound_update_base(Scene *scene, Object *object, void *new_set)
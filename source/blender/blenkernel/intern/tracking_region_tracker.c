@@ -244,12 +244,21 @@ static bool configure_and_run_tracker(ImBuf *destination_ibuf,
   frame_width = destination_ibuf->x;
   frame_height = destination_ibuf->y;
 
+  /* Tracking is not possible without a reference search area, avoid converting
+   * the destination search patch only to throw it away. */
+  if (reference_search_area == NULL) {
+    return false;
+  }
+
   /* for now track to the same search area dimension as marker has got for current frame
    * will make all tracked markers in currently tracked segment have the same search area
    * size, but it's quite close to what is actually needed
    */
   patch_new = track_get_search_floatbuf(
       destination_ibuf, track, marker, &new_search_area_width, &new_search_area_height);
+  if (patch_new == NULL) {
+    return false;
+  }
 
   /* configure the tracker */
   tracking_configure_tracker(track, mask, is_backward, &options);
@@ -261,10 +270,6 @@ static bool configure_and_run_tracker(ImBuf *destination_ibuf,
   tracking_get_marker_coords_for_tracking(
       frame_width, frame_height, marker, dst_pixel_x, dst_pixel_y);
 
-  if (patch_new == NULL || reference_search_area == NULL) {
-    return false;
-  }
-
   /* run the tracker! */
   tracked = libmv_trackRegion(&options,
                               reference_search_area,
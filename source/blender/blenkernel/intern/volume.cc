@@ -329,8 +329,15 @@ struct VolumeGrid {
      * holding a mutex lock. */
     blender::threading::isolate_task([&] {
       try {
+        /* Memory-map the file and delay-load leaf node buffers: only the tree
+         * topology is read here, voxel data is paged in on first access. The
+         * grid keeps the mapped file alive through its leaf buffers, so huge
+         * caches can be opened without reading them into RAM up front.
+         * setCopyMaxBytes(0) disables the temp-file copy that would otherwise
+         * defeat the mapping. */
+        const bool delay_load = true;
         file.setCopyMaxBytes(0);
-        file.open();
+        file.open(delay_load);
         openvdb::GridBase::Ptr vdb_grid = file.readGrid(name());
         entry->grid->setTree(vdb_grid->baseTreePtr());
       }
@@ -402,6 +409,19 @@ struct VolumeGrid {
     return (name_meta) ? name_meta->value().c_str() : "";
   }
 
+  char *file_cache_key() const
+  {
+    /* Only file-backed grids have a stable identity: their file cache entry is
+     * never modified in place, so filepath, grid name and simplify level fully
+     * determine the tree contents. In-memory grids can be edited at any time
+     * and so can not be identified across frame changes. */
+    if (entry == nullptr) {
+      return nullptr;
+    }
+    return BLI_sprintfN(
+        "%s @ %s @ %d", entry->filepath.c_str(), entry->grid_name.c_str(), simplify_level);
+  }
+
   const char *error_message() const
   {
     if (is_loaded && entry && !entry->error_msg.empty()) {
@@ -824,8 +844,10 @@ bool BKE_volume_load(const Volume *volume, const Main *bmain)
   openvdb::GridPtrVec vdb_grids;
 
   try {
+    /* Delay-load so only grid metadata is read, see VolumeGrid::load(). */
+    const bool delay_load = true;
     file.setCopyMaxBytes(0);
-    file.open();
+    file.open(delay_load);
     vdb_grids = *(file.readAllGridMetadata());
     grids.metadata = file.getMetadata();
   }
@@ -1289,6 +1311,16 @@ const char *BKE_volume_grid_name(const VolumeGrid *volume_grid)
 #endif
 }
 
+char *BKE_volume_grid_file_cache_key(const VolumeGrid *volume_grid)
+{
+#ifdef WITH_OPENVDB
+  return volume_grid->file_cache_key();
+#else
+  UNUSED_VARS(volume_grid);
+  return NULL;
+#endif
+}
+
 #ifdef WITH_OPENVDB
 VolumeGridType BKE_volume_grid_type_openvdb(const openvdb::GridBase &grid)
 {
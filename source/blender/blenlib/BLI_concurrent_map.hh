@@ -0,0 +1,168 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * A `blender::ConcurrentMap<Key, Value>` is an associative container that can be safely written
+ * to and read from by multiple threads at the same time, e.g. from within a
+ * #BLI_task_parallel_range callback. It is intended for parallel deduplication passes
+ * (merge-by-distance, CustomData layer deduplication), where many workers insert into a shared
+ * map and contention on a single lock would serialize the loop.
+ *
+ * Internally the key space is split over a fixed number of shards. Each shard is a regular
+ * open-addressing `blender::Map` protected by its own mutex, so threads only contend when their
+ * keys hash to the same shard. This keeps the implementation small and reuses the existing map,
+ * at the cost of locking a (rarely contended) mutex per operation.
+ *
+ * Differences to `blender::Map` the caller has to be aware of:
+ * - Methods return values by copy instead of by reference/pointer, since a reference into a
+ *   shard could be invalidated by a concurrent insertion into the same shard.
+ * - There is no general iterator. #foreach_item locks one shard at a time and must not be called
+ *   while other threads are writing.
+ */
+
+#include <array>
+#include <mutex>
+#include <optional>
+
+#include "BLI_map.hh"
+#include "BLI_utility_mixins.hh"
+
+namespace blender {
+
+template<typename Key,
+         typename Value,
+         typename Hash = DefaultHash<Key>,
+         /* Has to be a power of two. More shards reduce contention but increase the (small)
+          * fixed memory footprint of an empty map. */
+         int64_t ShardsNum = 64>
+class ConcurrentMap : NonCopyable, NonMovable {
+ private:
+  static_assert(ShardsNum >= 2 && is_power_of_2_constexpr(ShardsNum));
+
+  struct Shard {
+    std::mutex mutex;
+    Map<Key,
+        Value,
+        default_inline_buffer_capacity(sizeof(Key) + sizeof(Value)),
+        DefaultProbingStrategy,
+        Hash>
+        map;
+  };
+
+  std::array<Shard, ShardsNum> shards_;
+
+  Shard &shard_for_key(const Key &key)
+  {
+    const uint64_t hash = Hash{}(key);
+    /* The low bits of the hash are used by the probing inside the shard, derive the shard index
+     * from well mixed high bits so both remain independent. This matters for e.g. integer keys
+     * whose default hash is close to the identity. */
+    const uint64_t mixed = hash * 0x9e3779b97f4a7c15ull;
+    return shards_[mixed >> (64 - log2_floor_constexpr(ShardsNum))];
+  }
+
+ public:
+  ConcurrentMap() = default;
+
+  /**
+   * Insert a new key-value-pair if the key does not exist yet.
+   * Returns true when the pair was newly inserted, false when the key existed already.
+   */
+  bool add(const Key &key, const Value &value)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.add(key, value);
+  }
+
+  /**
+   * Return the value of the key if it exists, otherwise insert \a value and return it.
+   * This is the primitive deduplication operation: all threads racing on the same key observe
+   * the same winning value.
+   */
+  Value lookup_or_add(const Key &key, const Value &value)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.lookup_or_add(key, value);
+  }
+
+  /**
+   * Same as #lookup_or_add, but the value is only created (by calling \a create_value) when the
+   * key is actually missing. The callback runs under the shard lock and therefore must not
+   * access the map itself.
+   */
+  template<typename CreateValueF> Value lookup_or_add_cb(const Key &key, CreateValueF create_value)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.lookup_or_add_cb(key, create_value);
+  }
+
+  /**
+   * Return a copy of the value corresponding to the key, or nothing when the key is not in the
+   * map. Note that by the time the caller inspects the result, a concurrent writer may have
+   * added the key already.
+   */
+  std::optional<Value> lookup_try(const Key &key)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    const Value *value = shard.map.lookup_ptr(key);
+    if (value == nullptr) {
+      return std::nullopt;
+    }
+    return *value;
+  }
+
+  bool contains(const Key &key)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.contains(key);
+  }
+
+  /**
+   * Number of key-value-pairs over all shards. Only a snapshot while writers are active.
+   */
+  int64_t size()
+  {
+    int64_t size = 0;
+    for (Shard &shard : shards_) {
+      std::lock_guard lock{shard.mutex};
+      size += shard.map.size();
+    }
+    return size;
+  }
+
+  /**
+   * Call \a func for every key-value-pair. Shards are locked one at a time; concurrent writes
+   * during the iteration are not supported.
+   */
+  template<typename FuncT> void foreach_item(const FuncT &func)
+  {
+    for (Shard &shard : shards_) {
+      std::lock_guard lock{shard.mutex};
+      shard.map.foreach_item(func);
+    }
+  }
+};
+
+}  // namespace blender
@@ -153,6 +153,10 @@ void BLI_bvhtree_balance(BVHTree *tree);
 bool BLI_bvhtree_update_node(
     BVHTree *tree, int index, const float co[3], const float co_moving[3], int numpoints);
 void BLI_bvhtree_update_tree(BVHTree *tree);
+/* Same as BLI_bvhtree_update_tree, but updates the branch bounds of each tree level in
+ * parallel. Worthwhile for refitting large topology-stable trees every frame (deforming
+ * collider meshes), small trees fall back to the serial loop. */
+void BLI_bvhtree_refit(BVHTree *tree);
 
 int BLI_bvhtree_overlap_thread_num(const BVHTree *tree);
 
@@ -217,6 +221,26 @@ int BLI_bvhtree_ray_cast(BVHTree *tree,
                          BVHTree_RayCastCallback callback,
                          void *userdata);
 
+/**
+ * Cast many rays against the same tree, traversing packets of rays together
+ * with SIMD ray/node tests where supported (falls back to single-ray casts
+ * otherwise). Intended for callers which cast one ray per vertex against an
+ * identical tree (shrinkwrap projection, mesh remapping), where single-ray
+ * traversal is memory-latency bound.
+ *
+ * \param origins, directions: arrays of \a num_rays rays (directions must be unit length).
+ * \param hits: array of \a num_rays hits, initialized like for #BLI_bvhtree_ray_cast
+ * (`index = -1`, `dist` set to the maximum cast distance).
+ */
+void BLI_bvhtree_ray_cast_batch_simd(BVHTree *tree,
+                                     const float (*origins)[3],
+                                     const float (*directions)[3],
+                                     int num_rays,
+                                     float radius,
+                                     BVHTreeRayHit *hits,
+                                     BVHTree_RayCastCallback callback,
+                                     void *userdata);
+
 void BLI_bvhtree_ray_cast_all_ex(BVHTree *tree,
                                  const float co[3],
                                  const float dir[3],
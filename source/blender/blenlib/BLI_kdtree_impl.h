@@ -37,6 +37,7 @@ typedef struct KDTreeNearest {
 
 KDTree *BLI_kdtree_nd_(new)(unsigned int maxsize);
 void BLI_kdtree_nd_(free)(KDTree *tree);
+void BLI_kdtree_nd_(clear)(KDTree *tree, unsigned int maxsize) ATTR_NONNULL(1);
 void BLI_kdtree_nd_(balance)(KDTree *tree) ATTR_NONNULL(1);
 
 void BLI_kdtree_nd_(insert)(KDTree *tree, int index, const float co[KD_DIMS]) ATTR_NONNULL(1, 3);
@@ -44,6 +45,11 @@ int BLI_kdtree_nd_(find_nearest)(const KDTree *tree,
                                  const float co[KD_DIMS],
                                  KDTreeNearest *r_nearest) ATTR_NONNULL(1, 2);
 
+void BLI_kdtree_nd_(find_nearest_batch)(const KDTree *tree,
+                                        const float (*cos)[KD_DIMS],
+                                        KDTreeNearest *r_nearest,
+                                        unsigned int queries_len) ATTR_NONNULL(1, 2, 3);
+
 int BLI_kdtree_nd_(find_nearest_n)(const KDTree *tree,
                                    const float co[KD_DIMS],
                                    KDTreeNearest *r_nearest,
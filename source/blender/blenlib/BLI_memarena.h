@@ -54,6 +54,25 @@ void BLI_memarena_merge(MemArena *ma_dst, MemArena *ma_src) ATTR_NONNULL(1, 2);
 
 void BLI_memarena_clear(MemArena *ma) ATTR_NONNULL(1);
 
+/* Thread-safe chained arena: hands out a private sub-arena per calling thread, all of them
+ * freed (or merged away) together with the parent. This allows parallel geometry algorithms
+ * to keep arena-style allocation without contending on a shared arena, see the implementation
+ * for details & caveats. */
+
+struct MemArenaThreadSafe;
+typedef struct MemArenaThreadSafe MemArenaThreadSafe;
+
+MemArenaThreadSafe *BLI_memarena_threadsafe_new(const size_t bufsize, const char *name)
+    ATTR_WARN_UNUSED_RESULT ATTR_RETURNS_NONNULL ATTR_NONNULL(2) ATTR_MALLOC;
+void BLI_memarena_threadsafe_free(MemArenaThreadSafe *ma_ts) ATTR_NONNULL(1);
+void BLI_memarena_threadsafe_use_calloc(MemArenaThreadSafe *ma_ts) ATTR_NONNULL(1);
+void BLI_memarena_threadsafe_use_align(MemArenaThreadSafe *ma_ts,
+                                       const size_t align) ATTR_NONNULL(1);
+MemArena *BLI_memarena_threadsafe_local(MemArenaThreadSafe *ma_ts) ATTR_WARN_UNUSED_RESULT
+    ATTR_RETURNS_NONNULL ATTR_NONNULL(1);
+void BLI_memarena_threadsafe_merge(MemArena *ma_dst, MemArenaThreadSafe *ma_ts)
+    ATTR_NONNULL(1, 2);
+
 #ifdef __cplusplus
 }
 #endif
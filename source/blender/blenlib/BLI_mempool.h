@@ -87,6 +87,16 @@ enum {
    * order of allocation when no chunks have been freed.
    */
   BLI_MEMPOOL_ALLOW_ITER = (1 << 0),
+  /** Allow calling #BLI_mempool_alloc & #BLI_mempool_free from multiple threads at once.
+   *
+   * Allocations are served from small per-thread magazines which are refilled from
+   * (and flushed back to) the shared free list in batches, so threads only take the
+   * shared lock once per batch instead of contending on every element.
+   *
+   * \note with this flag set, empty chunks are only reclaimed by
+   * #BLI_mempool_clear & #BLI_mempool_destroy, not when the last element is freed.
+   */
+  BLI_MEMPOOL_THREAD_CACHE = (1 << 1),
 };
 
 void BLI_mempool_iternew(BLI_mempool *pool, BLI_mempool_iter *iter) ATTR_NONNULL();
@@ -36,18 +36,45 @@ struct BLI_mmap_file;
 
 typedef struct BLI_mmap_file BLI_mmap_file;
 
+/* How the mapping will be accessed, allows the OS to optimize readahead.
+ * Only a hint, reads behave the same either way. */
+typedef enum eBLI_mmap_advise {
+  BLI_MMAP_ADVISE_NORMAL = 0,
+  /* The file will be read front to back (e.g. parsing a whole file). */
+  BLI_MMAP_ADVISE_SEQUENTIAL = 1,
+  /* Reads will jump around the file (e.g. seeking to indexed blocks). */
+  BLI_MMAP_ADVISE_RANDOM = 2,
+} eBLI_mmap_advise;
+
 /* Prepares an opened file for memory-mapped IO.
  * May return NULL if the operation fails.
  * Note that this seeks to the end of the file to determine its length. */
 BLI_mmap_file *BLI_mmap_open(int fd) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT;
 
+/* Same as BLI_mmap_open, but optionally maps the file writable (writes go through to the
+ * file, which must be opened with a matching mode) and passes an access-pattern hint to
+ * the OS. */
+BLI_mmap_file *BLI_mmap_open_ex(int fd,
+                                bool writable,
+                                eBLI_mmap_advise advise) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT;
+
 /* Reads length bytes from file at the given offset into dest.
  * Returns whether the operation was successful (may fail when reading beyond the file
  * end or when IO errors occur). */
 bool BLI_mmap_read(BLI_mmap_file *file, void *dest, size_t offset, size_t length)
     ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1);
 
+/* Writes length bytes from src into the file at the given offset.
+ * The file has to be mapped writable. Returns whether the operation was successful. */
+bool BLI_mmap_write(BLI_mmap_file *file, const void *src, size_t offset, size_t length)
+    ATTR_NONNULL(1);
+
+/* Asks the OS to start reading in the given range in the background.
+ * Only a hint, may do nothing on some platforms. */
+void BLI_mmap_prefetch(BLI_mmap_file *file, size_t offset, size_t length) ATTR_NONNULL(1);
+
 void *BLI_mmap_get_pointer(BLI_mmap_file *file) ATTR_WARN_UNUSED_RESULT;
+size_t BLI_mmap_get_length(const BLI_mmap_file *file) ATTR_WARN_UNUSED_RESULT;
 
 void BLI_mmap_free(BLI_mmap_file *file) ATTR_NONNULL(1);
 
@@ -0,0 +1,70 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#pragma once
+
+/** \file
+ * \ingroup BLI
+ *
+ * Low overhead named-scope profiler, always compiled in.
+ *
+ * Scopes cost a timer read and a single atomic increment when recording is
+ * enabled and nearly nothing when it is not, so instrumentation can stay in
+ * release builds. Recorded events can be written out in the chrome-tracing
+ * JSON format (load via `chrome://tracing` or https://ui.perfetto.dev).
+ *
+ * \note The scope name is stored by pointer and must outlive the recording
+ * session, use string literals.
+ */
+
+#include "BLI_utildefines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct BLI_ProfileScope {
+  const char *name;
+  double time_start;
+} BLI_ProfileScope;
+
+/** Start recording. Allocates the (fixed size) event buffer. */
+void BLI_profile_enable(void);
+/** Stop recording, keeping recorded events for #BLI_profile_dump_json. */
+void BLI_profile_disable(void);
+/** Free all recorded events (implies #BLI_profile_disable). */
+void BLI_profile_clear(void);
+
+bool BLI_profile_is_enabled(void);
+
+void BLI_profile_scope_begin(BLI_ProfileScope *scope, const char *name);
+void BLI_profile_scope_end(const BLI_ProfileScope *scope);
+
+/**
+ * Write recorded events as chrome-tracing JSON.
+ * \return true on success.
+ */
+bool BLI_profile_dump_json(const char *filepath);
+
+#define BLI_PROFILE_SCOPE_BEGIN(scope_var, scope_name) \
+  BLI_ProfileScope scope_var; \
+  BLI_profile_scope_begin(&scope_var, scope_name)
+
+#define BLI_PROFILE_SCOPE_END(scope_var) BLI_profile_scope_end(&scope_var)
+
+#ifdef __cplusplus
+}
+#endif
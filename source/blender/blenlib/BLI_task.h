@@ -176,6 +176,14 @@ typedef struct TaskParallelSettings {
    * having a global use_threading switch based on just range size.
    */
   int min_iter_per_thread;
+  /* Use work-stealing of fine-grained chunks between worker threads instead
+   * of an even static partitioning of the range. Worth enabling when the
+   * per-iteration cost varies a lot (e.g. modifier loops over mixed-density
+   * meshes), where a static split leaves threads idle at the tail while one
+   * of them finishes the expensive chunk. Adds some scheduling overhead, so
+   * keep it disabled for uniform workloads.
+   */
+  bool use_work_stealing;
 } TaskParallelSettings;
 
 BLI_INLINE void BLI_parallel_range_settings_defaults(TaskParallelSettings *settings);
@@ -659,4 +659,67 @@ inline void devirtualize_varray2(const VArray<T1> &varray1,
   func(varray1, varray2);
 }
 
+/**
+ * Same as `devirtualize_varray2`, but devirtualizes three virtual arrays at the same time.
+ * This instantiates the given function eight times, so it should only be used for kernels where
+ * the virtual call overhead per element is significant compared to the work done per element.
+ */
+template<typename T1, typename T2, typename T3, typename Func>
+inline void devirtualize_varray3(const VArray<T1> &varray1,
+                                 const VArray<T2> &varray2,
+                                 const VArray<T3> &varray3,
+                                 const Func &func,
+                                 bool enable = true)
+{
+  /* Support disabling the devirtualization to simplify benchmarking. */
+  if (enable) {
+    const bool is_span1 = varray1.is_span();
+    const bool is_span2 = varray2.is_span();
+    const bool is_span3 = varray3.is_span();
+    const bool is_single1 = varray1.is_single();
+    const bool is_single2 = varray2.is_single();
+    const bool is_single3 = varray3.is_single();
+    if ((is_span1 || is_single1) && (is_span2 || is_single2) && (is_span3 || is_single3)) {
+      /* Devirtualize the third array with the first two already devirtualized. Only nest when all
+       * three arrays can actually be devirtualized, so the mixed cases fall through to the single
+       * fallback below instead of multiplying out partially optimized versions. */
+      auto devirtualize_third = [&](const auto &varray1, const auto &varray2) {
+        if (is_span3) {
+          const VArray_For_Span<T3> varray3_span{varray3.get_internal_span()};
+          func(varray1, varray2, varray3_span);
+        }
+        else {
+          const VArray_For_Single<T3> varray3_single{varray3.get_internal_single(),
+                                                     varray3.size()};
+          func(varray1, varray2, varray3_single);
+        }
+      };
+      if (is_span1 && is_span2) {
+        const VArray_For_Span<T1> varray1_span{varray1.get_internal_span()};
+        const VArray_For_Span<T2> varray2_span{varray2.get_internal_span()};
+        devirtualize_third(varray1_span, varray2_span);
+      }
+      else if (is_span1 && is_single2) {
+        const VArray_For_Span<T1> varray1_span{varray1.get_internal_span()};
+        const VArray_For_Single<T2> varray2_single{varray2.get_internal_single(), varray2.size()};
+        devirtualize_third(varray1_span, varray2_single);
+      }
+      else if (is_single1 && is_span2) {
+        const VArray_For_Single<T1> varray1_single{varray1.get_internal_single(), varray1.size()};
+        const VArray_For_Span<T2> varray2_span{varray2.get_internal_span()};
+        devirtualize_third(varray1_single, varray2_span);
+      }
+      else {
+        const VArray_For_Single<T1> varray1_single{varray1.get_internal_single(), varray1.size()};
+        const VArray_For_Single<T2> varray2_single{varray2.get_internal_single(), varray2.size()};
+        devirtualize_third(varray1_single, varray2_single);
+      }
+      return;
+    }
+  }
+  /* This fallback is used even when some of the inputs could be optimized, see the matching
+   * comment in #devirtualize_varray2. */
+  func(varray1, varray2, varray3);
+}
+
 }  // namespace blender
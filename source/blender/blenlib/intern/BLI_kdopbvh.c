@@ -44,6 +44,8 @@
 #include "BLI_heap_simple.h"
 #include "BLI_kdopbvh.h"
 #include "BLI_math.h"
+#include "BLI_math_bits.h"
+#include "BLI_simd.h"
 #include "BLI_stack.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
@@ -1054,6 +1056,62 @@ void BLI_bvhtree_update_tree(BVHTree *tree)
     node_join(tree, *index);
   }
 }
+typedef struct BVHRefitData {
+  BVHTree *tree;
+  /* Implicit tree layout, `branches_array[1]` is the root (see #non_recursive_bvh_div_nodes). */
+  BVHNode *branches_array;
+} BVHRefitData;
+
+static void bvhtree_refit_task_cb(void *__restrict userdata,
+                                  const int j,
+                                  const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BVHRefitData *data = userdata;
+  node_join(data->tree, &data->branches_array[j]);
+}
+
+/**
+ * Parallel version of #BLI_bvhtree_update_tree.
+ * Call #BLI_bvhtree_update_node() first for every node/point/triangle.
+ */
+void BLI_bvhtree_refit(BVHTree *tree)
+{
+  const int tree_type = tree->tree_type;
+  const int tree_offset = 2 - tree_type;
+  const int num_branches = tree->totbranch;
+
+  if (tree->totleaf <= KDOPBVH_THREAD_LEAF_THRESHOLD) {
+    BLI_bvhtree_update_tree(tree);
+    return;
+  }
+
+  /* The branches were built level by level into an implicit tree (children of implicit
+   * branch `i` start at `i * tree_type + tree_offset`, see #non_recursive_bvh_div_nodes).
+   * Walk the same level ranges in reverse: within a level the branches are independent of
+   * each other and can be joined in parallel, while all their children were already
+   * refitted by the deeper levels (or are leaves). */
+  int level_starts[64];
+  int num_levels = 0;
+  for (int i = 1; i <= num_branches; i = i * tree_type + tree_offset) {
+    level_starts[num_levels++] = i;
+  }
+
+  BVHRefitData data = {
+      .tree = tree,
+      .branches_array = tree->nodearray + (tree->totleaf - 1),
+  };
+
+  for (int level = num_levels - 1; level >= 0; level--) {
+    const int i = level_starts[level];
+    const int i_stop = min_ii(i * tree_type + tree_offset, num_branches + 1);
+
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 256;
+    BLI_task_parallel_range(i, i_stop, &data, bvhtree_refit_task_cb, &settings);
+  }
+}
+
 /**
  * Number of times #BLI_bvhtree_insert has been called.
  * mainly useful for asserts functions to check we added the correct number.
@@ -2077,6 +2135,182 @@ void BLI_bvhtree_ray_cast_all(BVHTree *tree,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name BLI_bvhtree_ray_cast_batch_simd
+ *
+ * Traverses packets of rays together, testing all rays of a packet against a node
+ * with a single SIMD slab test. Leaf/primitive intersection stays scalar (per ray),
+ * only the (dominant) node rejection is vectorized.
+ *
+ * \{ */
+
+#ifdef BLI_HAVE_SSE2
+
+#  define BVH_RAY_PACKET_SIZE 4
+
+typedef struct BVHRayPacketData {
+  /* Ray data in SoA layout, one SSE lane per ray of the packet. */
+  __m128 origin[3];
+  __m128 idot_axis[3];
+  /* Current nearest hit distance per lane, kept in sync with `rays[*].hit.dist`. */
+  float dist[BVH_RAY_PACKET_SIZE];
+  /* Lanes which contain an actual ray (the last packet may be partially filled). */
+  int lane_mask;
+
+  /* Per-ray scalar state, used for leaf tests and traversal order. */
+  BVHRayCastData rays[BVH_RAY_PACKET_SIZE];
+  int num_rays;
+} BVHRayPacketData;
+
+/* Slab test of all rays of the packet against the node bounding volume at once,
+ * the min/max formulation handles mixed ray directions without the per-ray index
+ * reordering that #fast_ray_nearest_hit uses.
+ * Returns a bitmask of lanes whose ray may hit the node. */
+static int packet_ray_node_test(const BVHRayPacketData *data, const BVHNode *node)
+{
+  const float *bv = node->bv;
+  __m128 tmin = _mm_setzero_ps();
+  __m128 tmax = _mm_loadu_ps(data->dist);
+
+  for (int i = 0; i < 3; i++, bv += 2) {
+    const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(bv[0]), data->origin[i]),
+                                 data->idot_axis[i]);
+    const __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(bv[1]), data->origin[i]),
+                                 data->idot_axis[i]);
+    tmin = _mm_max_ps(tmin, _mm_min_ps(t1, t2));
+    tmax = _mm_min_ps(tmax, _mm_max_ps(t1, t2));
+  }
+  return _mm_movemask_ps(_mm_cmple_ps(tmin, tmax)) & data->lane_mask;
+}
+
+static void dfs_raycast_packet(BVHRayPacketData *data, const BVHNode *node)
+{
+  const int hit_mask = packet_ray_node_test(data, node);
+  if (hit_mask == 0) {
+    return;
+  }
+
+  if (node->totnode == 0) {
+    for (int lane = 0; lane < data->num_rays; lane++) {
+      if ((hit_mask & (1 << lane)) == 0) {
+        continue;
+      }
+      BVHRayCastData *ray = &data->rays[lane];
+      const float dist = fast_ray_nearest_hit(ray, node);
+      if (dist >= ray->hit.dist) {
+        continue;
+      }
+      if (ray->callback) {
+        ray->callback(ray->userdata, node->index, &ray->ray, &ray->hit);
+      }
+      else {
+        ray->hit.index = node->index;
+        ray->hit.dist = dist;
+        madd_v3_v3v3fl(ray->hit.co, ray->ray.origin, ray->ray.direction, dist);
+      }
+      data->dist[lane] = ray->hit.dist;
+    }
+  }
+  else {
+    /* Pick the loop direction from the first active ray, packets are expected to
+     * be coherent so this is a good ordering for the whole packet. */
+    const BVHRayCastData *first_ray = &data->rays[bitscan_forward_i(hit_mask)];
+    if (first_ray->ray_dot_axis[node->main_axis] > 0.0f) {
+      for (int i = 0; i != node->totnode; i++) {
+        dfs_raycast_packet(data, node->children[i]);
+      }
+    }
+    else {
+      for (int i = node->totnode - 1; i >= 0; i--) {
+        dfs_raycast_packet(data, node->children[i]);
+      }
+    }
+  }
+}
+
+#endif /* BLI_HAVE_SSE2 */
+
+void BLI_bvhtree_ray_cast_batch_simd(BVHTree *tree,
+                                     const float (*origins)[3],
+                                     const float (*directions)[3],
+                                     int num_rays,
+                                     float radius,
+                                     BVHTreeRayHit *hits,
+                                     BVHTree_RayCastCallback callback,
+                                     void *userdata)
+{
+#ifdef BLI_HAVE_SSE2
+  BVHNode *root = tree->nodes[tree->totleaf];
+
+  /* The packet node test does not support sphere-casts,
+   * those keep using the single-ray path. */
+  if (root && (radius == 0.0f)) {
+    for (int ray_start = 0; ray_start < num_rays; ray_start += BVH_RAY_PACKET_SIZE) {
+      BVHRayPacketData data;
+      data.num_rays = MIN2(num_rays - ray_start, BVH_RAY_PACKET_SIZE);
+      data.lane_mask = (1 << data.num_rays) - 1;
+
+      float origin_soa[3][BVH_RAY_PACKET_SIZE];
+      float idot_soa[3][BVH_RAY_PACKET_SIZE];
+
+      for (int lane = 0; lane < data.num_rays; lane++) {
+        const int ray_index = ray_start + lane;
+        BVHRayCastData *ray = &data.rays[lane];
+
+        BLI_ASSERT_UNIT_V3(directions[ray_index]);
+
+        ray->tree = tree;
+        ray->callback = callback;
+        ray->userdata = userdata;
+        copy_v3_v3(ray->ray.origin, origins[ray_index]);
+        copy_v3_v3(ray->ray.direction, directions[ray_index]);
+        ray->ray.radius = 0.0f;
+        bvhtree_ray_cast_data_precalc(ray, BVH_RAYCAST_DEFAULT);
+        memcpy(&ray->hit, &hits[ray_index], sizeof(ray->hit));
+
+        data.dist[lane] = ray->hit.dist;
+        for (int i = 0; i < 3; i++) {
+          origin_soa[i][lane] = ray->ray.origin[i];
+          idot_soa[i][lane] = ray->idot_axis[i];
+        }
+      }
+      /* Duplicate the last ray into unused lanes so they never produce a hit. */
+      for (int lane = data.num_rays; lane < BVH_RAY_PACKET_SIZE; lane++) {
+        data.dist[lane] = -FLT_MAX;
+        for (int i = 0; i < 3; i++) {
+          origin_soa[i][lane] = origin_soa[i][data.num_rays - 1];
+          idot_soa[i][lane] = idot_soa[i][data.num_rays - 1];
+        }
+      }
+      for (int i = 0; i < 3; i++) {
+        data.origin[i] = _mm_loadu_ps(origin_soa[i]);
+        data.idot_axis[i] = _mm_loadu_ps(idot_soa[i]);
+      }
+
+      dfs_raycast_packet(&data, root);
+
+      for (int lane = 0; lane < data.num_rays; lane++) {
+        memcpy(&hits[ray_start + lane], &data.rays[lane].hit, sizeof(hits[0]));
+      }
+    }
+    return;
+  }
+#endif /* BLI_HAVE_SSE2 */
+
+  for (int ray_index = 0; ray_index < num_rays; ray_index++) {
+    BLI_bvhtree_ray_cast_ex(tree,
+                            origins[ray_index],
+                            directions[ray_index],
+                            radius,
+                            &hits[ray_index],
+                            callback,
+                            userdata,
+                            BVH_RAYCAST_DEFAULT);
+  }
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name BLI_bvhtree_range_query
  *
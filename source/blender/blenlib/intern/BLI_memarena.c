@@ -36,6 +36,7 @@
 
 #include "BLI_asan.h"
 #include "BLI_memarena.h"
+#include "BLI_threads.h"
 #include "BLI_strict_flags.h"
 #include "BLI_utildefines.h"
 
@@ -263,3 +264,120 @@ void BLI_memarena_clear(MemArena *ma)
   VALGRIND_DESTROY_MEMPOOL(ma);
   VALGRIND_CREATE_MEMPOOL(ma, 0, false);
 }
+
+/* -------------------------------------------------------------------- */
+/** \name Thread-Safe Chained Arena
+ *
+ * A parent holding one private #MemArena per thread that asked for one.
+ * Allocation stays the plain (lock free) #BLI_memarena_alloc on the sub-arena,
+ * only the sub-arena lookup takes a lock, so callers inside parallel loops
+ * should fetch their local arena once per task and reuse the pointer.
+ * \{ */
+
+typedef struct MemArenaThreadLocal {
+  struct MemArenaThreadLocal *next;
+  pthread_t thread;
+  MemArena *arena;
+} MemArenaThreadLocal;
+
+struct MemArenaThreadSafe {
+  /* Single linked list, typically only a handful of entries (one per worker thread). */
+  MemArenaThreadLocal *locals;
+  SpinLock lock;
+
+  /* Settings applied to every sub-arena on creation. */
+  size_t bufsize;
+  size_t align;
+  bool use_calloc;
+  const char *name;
+};
+
+MemArenaThreadSafe *BLI_memarena_threadsafe_new(const size_t bufsize, const char *name)
+{
+  MemArenaThreadSafe *ma_ts = MEM_callocN(sizeof(*ma_ts), "memarena threadsafe");
+  ma_ts->bufsize = bufsize;
+  ma_ts->name = name;
+  BLI_spin_init(&ma_ts->lock);
+  return ma_ts;
+}
+
+void BLI_memarena_threadsafe_use_calloc(MemArenaThreadSafe *ma_ts)
+{
+  BLI_assert(ma_ts->locals == NULL);
+  ma_ts->use_calloc = true;
+}
+
+void BLI_memarena_threadsafe_use_align(MemArenaThreadSafe *ma_ts, const size_t align)
+{
+  BLI_assert(ma_ts->locals == NULL);
+  ma_ts->align = align;
+}
+
+/**
+ * \return the sub-arena owned exclusively by the calling thread, creating it on first use.
+ * The returned arena stays valid until the parent is freed or merged away.
+ */
+MemArena *BLI_memarena_threadsafe_local(MemArenaThreadSafe *ma_ts)
+{
+  const pthread_t self = pthread_self();
+  MemArenaThreadLocal *local;
+
+  BLI_spin_lock(&ma_ts->lock);
+  for (local = ma_ts->locals; local; local = local->next) {
+    if (pthread_equal(local->thread, self)) {
+      break;
+    }
+  }
+  if (UNLIKELY(local == NULL)) {
+    local = MEM_mallocN(sizeof(*local), __func__);
+    local->thread = self;
+    local->arena = BLI_memarena_new(ma_ts->bufsize, ma_ts->name);
+    if (ma_ts->use_calloc) {
+      BLI_memarena_use_calloc(local->arena);
+    }
+    if (ma_ts->align != 0) {
+      BLI_memarena_use_align(local->arena, ma_ts->align);
+    }
+    local->next = ma_ts->locals;
+    ma_ts->locals = local;
+  }
+  BLI_spin_unlock(&ma_ts->lock);
+
+  return local->arena;
+}
+
+static void memarena_threadsafe_free_ex(MemArenaThreadSafe *ma_ts, MemArena *ma_merge_dst)
+{
+  MemArenaThreadLocal *local_next;
+  for (MemArenaThreadLocal *local = ma_ts->locals; local; local = local_next) {
+    local_next = local->next;
+    if (ma_merge_dst) {
+      BLI_memarena_merge(ma_merge_dst, local->arena);
+    }
+    BLI_memarena_free(local->arena);
+    MEM_freeN(local);
+  }
+  BLI_spin_end(&ma_ts->lock);
+  MEM_freeN(ma_ts);
+}
+
+/**
+ * Free the parent and all sub-arenas (and with them, every allocation made through them).
+ * Not thread-safe, no other thread may still be allocating.
+ */
+void BLI_memarena_threadsafe_free(MemArenaThreadSafe *ma_ts)
+{
+  memarena_threadsafe_free_ex(ma_ts, NULL);
+}
+
+/**
+ * Transfer ownership of all allocations into \a ma_dst (which must be set up with matching
+ * alignment & calloc use, see #BLI_memarena_merge), then free the parent. Useful when the
+ * results of a parallel stage have to outlive it in a regular arena.
+ */
+void BLI_memarena_threadsafe_merge(MemArena *ma_dst, MemArenaThreadSafe *ma_ts)
+{
+  memarena_threadsafe_free_ex(ma_ts, ma_dst);
+}
+
+/** \} */
@@ -34,6 +34,7 @@
 
 #include "atomic_ops.h"
 
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "BLI_mempool.h"         /* own include */
@@ -107,6 +108,25 @@ typedef struct BLI_mempool_chunk {
   struct BLI_mempool_chunk *next;
 } BLI_mempool_chunk;
 
+/** Number of cache stripes for #BLI_MEMPOOL_THREAD_CACHE pools (power of two).
+ * Threads map onto stripes, each protected by its own lock, so a hash collision
+ * between two threads only costs contention, never correctness. */
+#define MEMPOOL_CACHE_NUM 64
+/** Number of elements moved between a thread cache and the shared free list at once. */
+#define MEMPOOL_CACHE_MAGAZINE_SIZE 64
+
+/**
+ * Per-thread magazine of free elements for #BLI_MEMPOOL_THREAD_CACHE pools,
+ * padded so stripes don't false-share cache lines.
+ */
+typedef struct BLI_mempool_cache {
+  SpinLock lock;
+  /** Local free element list, same interleaved storage as #BLI_mempool.free. */
+  BLI_freenode *free;
+  uint count;
+  char _pad[64];
+} BLI_mempool_cache;
+
 /**
  * The mempool, stores and tracks memory \a chunks and elements within those chunks \a free.
  */
@@ -132,6 +152,10 @@ struct BLI_mempool {
   uint maxchunks;
   /** Number of elements currently in use. */
   uint totused;
+  /** Cache stripes, NULL unless #BLI_MEMPOOL_THREAD_CACHE is set. */
+  BLI_mempool_cache *caches;
+  /** Protects \a chunks, \a chunk_tail & \a free when \a caches is used. */
+  SpinLock chunks_lock;
 #ifdef USE_TOTALLOC
   /** Number of elements allocated in total. */
   uint totalloc;
@@ -317,6 +341,16 @@ BLI_mempool *BLI_mempool_create(uint esize, uint totelem, uint pchunk, uint flag
 #endif
   pool->totused = 0;
 
+  pool->caches = NULL;
+  if (flag & BLI_MEMPOOL_THREAD_CACHE) {
+    pool->caches = MEM_callocN(sizeof(BLI_mempool_cache) * MEMPOOL_CACHE_NUM,
+                               "BLI_mempool.caches");
+    for (i = 0; i < MEMPOOL_CACHE_NUM; i++) {
+      BLI_spin_init(&pool->caches[i].lock);
+    }
+    BLI_spin_init(&pool->chunks_lock);
+  }
+
   if (totelem) {
     /* Allocate the actual chunks. */
     for (i = 0; i < maxchunks; i++) {
@@ -332,10 +366,133 @@ BLI_mempool *BLI_mempool_create(uint esize, uint totelem, uint pchunk, uint flag
   return pool;
 }
 
+/**
+ * \return the cache stripe serving the current thread.
+ */
+BLI_INLINE BLI_mempool_cache *mempool_cache_get(BLI_mempool *pool)
+{
+#ifdef __APPLE__
+  /* No cheap native TLS on all deployment targets, hash the (pointer sized) thread ID
+   * instead. Collisions between threads are harmless, stripes carry their own lock. */
+  const uint id = (uint)((uintptr_t)pthread_self() >> 6);
+#else
+  /* Lazily assign compact per-thread IDs so threads spread evenly over the stripes. */
+  static ThreadLocal(uint) thread_id = 0;
+  static uint thread_id_counter = 1;
+  uint id = thread_id;
+  if (UNLIKELY(id == 0)) {
+    id = atomic_add_and_fetch_uint32(&thread_id_counter, 1);
+    thread_id = id;
+  }
+#endif
+  return &pool->caches[id & (uint)(MEMPOOL_CACHE_NUM - 1)];
+}
+
+/**
+ * #BLI_mempool_alloc for #BLI_MEMPOOL_THREAD_CACHE pools, refills the magazine of the
+ * calling thread from the shared free list in one batch when it runs empty.
+ */
+static void *mempool_alloc_cached(BLI_mempool *pool)
+{
+  BLI_mempool_cache *cache = mempool_cache_get(pool);
+  BLI_freenode *free_pop;
+
+  BLI_spin_lock(&cache->lock);
+
+  if (UNLIKELY(cache->free == NULL)) {
+    uint n = 0;
+    BLI_spin_lock(&pool->chunks_lock);
+    if (UNLIKELY(pool->free == NULL)) {
+      /* Need to allocate a new chunk. */
+      BLI_mempool_chunk *mpchunk = mempool_chunk_alloc(pool);
+      mempool_chunk_add(pool, mpchunk, NULL);
+    }
+    while (pool->free && (n < MEMPOOL_CACHE_MAGAZINE_SIZE)) {
+      BLI_freenode *node = pool->free;
+      pool->free = node->next;
+      node->next = cache->free;
+      cache->free = node;
+      n++;
+    }
+    BLI_spin_unlock(&pool->chunks_lock);
+    cache->count = n;
+  }
+
+  free_pop = cache->free;
+  cache->free = free_pop->next;
+  cache->count--;
+
+  BLI_spin_unlock(&cache->lock);
+
+  if (pool->flag & BLI_MEMPOOL_ALLOW_ITER) {
+    free_pop->freeword = USEDWORD;
+  }
+
+  atomic_add_and_fetch_uint32(&pool->totused, 1);
+
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MEMPOOL_ALLOC(pool, free_pop, pool->esize);
+#endif
+
+  return (void *)free_pop;
+}
+
+/**
+ * #BLI_mempool_free counterpart of #mempool_alloc_cached, flushes a batch back to the
+ * shared free list when the magazine of the calling thread grows too large.
+ */
+static void mempool_free_cached(BLI_mempool *pool, void *addr)
+{
+  BLI_mempool_cache *cache = mempool_cache_get(pool);
+  BLI_freenode *newhead = addr;
+
+  if (pool->flag & BLI_MEMPOOL_ALLOW_ITER) {
+#ifndef NDEBUG
+    /* This will detect double free's. */
+    BLI_assert(newhead->freeword != FREEWORD);
+#endif
+    newhead->freeword = FREEWORD;
+  }
+
+  BLI_spin_lock(&cache->lock);
+
+  newhead->next = cache->free;
+  cache->free = newhead;
+  cache->count++;
+
+  if (UNLIKELY(cache->count > MEMPOOL_CACHE_MAGAZINE_SIZE * 2)) {
+    /* Unlink a magazine worth of elements and give it back to the shared list. */
+    BLI_freenode *flush_head = cache->free;
+    BLI_freenode *flush_tail = flush_head;
+    for (uint n = 1; n < MEMPOOL_CACHE_MAGAZINE_SIZE; n++) {
+      flush_tail = flush_tail->next;
+    }
+    cache->free = flush_tail->next;
+    cache->count -= MEMPOOL_CACHE_MAGAZINE_SIZE;
+
+    BLI_spin_lock(&pool->chunks_lock);
+    flush_tail->next = pool->free;
+    pool->free = flush_head;
+    BLI_spin_unlock(&pool->chunks_lock);
+  }
+
+  BLI_spin_unlock(&cache->lock);
+
+  atomic_sub_and_fetch_uint32(&pool->totused, 1);
+
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MEMPOOL_FREE(pool, addr);
+#endif
+}
+
 void *BLI_mempool_alloc(BLI_mempool *pool)
 {
   BLI_freenode *free_pop;
 
+  if (UNLIKELY(pool->caches != NULL)) {
+    return mempool_alloc_cached(pool);
+  }
+
   if (UNLIKELY(pool->free == NULL)) {
     /* Need to allocate a new chunk. */
     BLI_mempool_chunk *mpchunk = mempool_chunk_alloc(pool);
@@ -376,6 +533,11 @@ void BLI_mempool_free(BLI_mempool *pool, void *addr)
 {
   BLI_freenode *newhead = addr;
 
+  if (UNLIKELY(pool->caches != NULL)) {
+    mempool_free_cached(pool, addr);
+    return;
+  }
+
 #ifndef NDEBUG
   {
     BLI_mempool_chunk *chunk;
@@ -754,6 +916,13 @@ void BLI_mempool_clear_ex(BLI_mempool *pool, const int totelem_reserve)
   /* re-initialize */
   pool->free = NULL;
   pool->totused = 0;
+  if (pool->caches) {
+    /* Magazines point into the free lists rebuilt below, drop them. */
+    for (uint i = 0; i < MEMPOOL_CACHE_NUM; i++) {
+      pool->caches[i].free = NULL;
+      pool->caches[i].count = 0;
+    }
+  }
 #ifdef USE_TOTALLOC
   pool->totalloc = 0;
 #endif
@@ -783,6 +952,14 @@ void BLI_mempool_destroy(BLI_mempool *pool)
 {
   mempool_chunk_free_all(pool->chunks);
 
+  if (pool->caches) {
+    for (uint i = 0; i < MEMPOOL_CACHE_NUM; i++) {
+      BLI_spin_end(&pool->caches[i].lock);
+    }
+    BLI_spin_end(&pool->chunks_lock);
+    MEM_freeN(pool->caches);
+  }
+
 #ifdef WITH_MEM_VALGRIND
   VALGRIND_DESTROY_MEMPOOL(pool);
 #endif
@@ -51,6 +51,9 @@ struct BLI_mmap_file {
   /* Flag to indicate IO errors. Needs to be volatile since it's being set from
    * within the signal handler, which is not part of the normal execution flow. */
   volatile bool io_error;
+
+  /* Whether the mapping allows writing through to the file. */
+  bool writable;
 };
 
 #ifndef WIN32
@@ -87,9 +90,10 @@ static void sigbus_handler(int sig, siginfo_t *siginfo, void *ptr)
     if (error_addr >= file->memory && error_addr < file->memory + file->length) {
       file->io_error = true;
 
-      /* Replace the mapped memory with zeroes. */
+      /* Replace the mapped memory with zeroes, keeping the original protection. */
+      const int prot = file->writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
       const void *mapped_memory = mmap(
-          file->memory, file->length, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+          file->memory, file->length, prot, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
       if (mapped_memory == MAP_FAILED) {
         fprintf(stderr, "SIGBUS handler: Error replacing mapped file with zeros\n");
       }
@@ -144,7 +148,7 @@ static void sigbus_handler_remove(BLI_mmap_file *file)
 }
 #endif
 
-BLI_mmap_file *BLI_mmap_open(int fd)
+BLI_mmap_file *BLI_mmap_open_ex(int fd, const bool writable, const eBLI_mmap_advise advise)
 {
   void *memory, *handle = NULL;
   size_t length = BLI_lseek(fd, 0, SEEK_END);
@@ -155,26 +159,39 @@ BLI_mmap_file *BLI_mmap_open(int fd)
     return NULL;
   }
 
-  /* Map the given file to memory. */
-  memory = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  /* Map the given file to memory. Writes have to go through to the file,
+   * so writable mappings are shared instead of private. */
+  const int prot = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+  memory = mmap(NULL, length, prot, writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
   if (memory == MAP_FAILED) {
     return NULL;
   }
+
+  /* Tell the kernel about the expected access pattern, so it can size its
+   * readahead accordingly. Failure is harmless, so it's not checked. */
+  if (advise == BLI_MMAP_ADVISE_SEQUENTIAL) {
+    madvise(memory, length, MADV_SEQUENTIAL);
+  }
+  else if (advise == BLI_MMAP_ADVISE_RANDOM) {
+    madvise(memory, length, MADV_RANDOM);
+  }
 #else
   /* Convert the POSIX-style file descriptor to a Windows handle. */
   void *file_handle = (void *)_get_osfhandle(fd);
   /* Memory mapping on Windows is a two-step process - first we create a mapping,
    * then we create a view into that mapping.
    * In our case, one view that spans the entire file is enough. */
-  handle = CreateFileMapping(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+  handle = CreateFileMapping(file_handle, NULL, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, NULL);
   if (handle == NULL) {
     return NULL;
   }
-  memory = MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+  memory = MapViewOfFile(handle, writable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, 0);
   if (memory == NULL) {
     CloseHandle(handle);
     return NULL;
   }
+  /* Windows has no mapping-level access-pattern hint. */
+  UNUSED_VARS(advise);
 #endif
 
   /* Now that the mapping was successful, allocate memory and set up the BLI_mmap_file. */
@@ -182,6 +199,7 @@ BLI_mmap_file *BLI_mmap_open(int fd)
   file->memory = memory;
   file->handle = handle;
   file->length = length;
+  file->writable = writable;
 
 #ifndef WIN32
   /* Register the file with the error handler. */
@@ -218,11 +236,66 @@ bool BLI_mmap_read(BLI_mmap_file *file, void *dest, size_t offset, size_t length
   return !file->io_error;
 }
 
+BLI_mmap_file *BLI_mmap_open(int fd)
+{
+  return BLI_mmap_open_ex(fd, false, BLI_MMAP_ADVISE_NORMAL);
+}
+
+bool BLI_mmap_write(BLI_mmap_file *file, const void *src, size_t offset, size_t length)
+{
+  BLI_assert(file->writable);
+  if (!file->writable || file->io_error || (offset + length > file->length)) {
+    return false;
+  }
+
+#ifndef WIN32
+  /* If an error occurs in this call, sigbus_handler will be called and will set
+   * file->io_error to true. */
+  memcpy(file->memory + offset, src, length);
+#else
+  /* On Windows, we use exception handling to be notified of errors. */
+  __try {
+    memcpy(file->memory + offset, src, length);
+  }
+  __except (GetExceptionCode() == EXCEPTION_IN_PAGE_ERROR ? EXCEPTION_EXECUTE_HANDLER :
+                                                            EXCEPTION_CONTINUE_SEARCH) {
+    file->io_error = true;
+    return false;
+  }
+#endif
+
+  return !file->io_error;
+}
+
+void BLI_mmap_prefetch(BLI_mmap_file *file, size_t offset, size_t length)
+{
+  if (offset + length > file->length) {
+    return;
+  }
+
+#ifndef WIN32
+  /* Page alignment is required by some implementations, round down. */
+  const size_t page_mask = ~((size_t)sysconf(_SC_PAGESIZE) - 1);
+  const size_t start = ((size_t)file->memory + offset) & page_mask;
+  const size_t end = (size_t)file->memory + offset + length;
+  madvise((void *)start, end - start, MADV_WILLNEED);
+#else
+  /* No portable equivalent that's worth the complexity here,
+   * reads simply fault the pages in on demand. */
+  UNUSED_VARS(file, offset, length);
+#endif
+}
+
 void *BLI_mmap_get_pointer(BLI_mmap_file *file)
 {
   return file->memory;
 }
 
+size_t BLI_mmap_get_length(const BLI_mmap_file *file)
+{
+  return file->length;
+}
+
 void BLI_mmap_free(BLI_mmap_file *file)
 {
 #ifndef WIN32
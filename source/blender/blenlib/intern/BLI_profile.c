@@ -0,0 +1,139 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/** \file
+ * \ingroup bli
+ *
+ * Events are claimed from a pre-allocated global buffer with a single atomic
+ * increment, so scopes never take a lock and threads never contend beyond the
+ * shared counter. Once the buffer is full further events are dropped (and
+ * counted) rather than stalling the instrumented code.
+ */
+
+#include <stdio.h>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_profile.h"
+#include "BLI_threads.h"
+#include "BLI_utildefines.h"
+
+#include "PIL_time.h"
+
+#include "atomic_ops.h"
+
+typedef struct ProfileEvent {
+  const char *name;
+  double time_start;
+  double time_end;
+  uint64_t thread_id;
+} ProfileEvent;
+
+/* 1M events (~32MB), enough for several seconds of densely instrumented
+ * frames. Fixed size keeps the hot path to one atomic add. */
+#define PROFILE_EVENTS_MAX (1 << 20)
+
+static struct {
+  ProfileEvent *events;
+  /** Total events claimed, may exceed #PROFILE_EVENTS_MAX when dropping. */
+  uint32_t events_num;
+  bool is_enabled;
+} g_profile = {NULL, 0, false};
+
+void BLI_profile_enable(void)
+{
+  if (g_profile.events == NULL) {
+    g_profile.events = MEM_mallocN(sizeof(ProfileEvent) * PROFILE_EVENTS_MAX, __func__);
+    g_profile.events_num = 0;
+  }
+  g_profile.is_enabled = true;
+}
+
+void BLI_profile_disable(void)
+{
+  g_profile.is_enabled = false;
+}
+
+void BLI_profile_clear(void)
+{
+  g_profile.is_enabled = false;
+  MEM_SAFE_FREE(g_profile.events);
+  g_profile.events_num = 0;
+}
+
+bool BLI_profile_is_enabled(void)
+{
+  return g_profile.is_enabled;
+}
+
+void BLI_profile_scope_begin(BLI_ProfileScope *scope, const char *name)
+{
+  scope->name = name;
+  scope->time_start = g_profile.is_enabled ? PIL_check_seconds_timer() : 0.0;
+}
+
+void BLI_profile_scope_end(const BLI_ProfileScope *scope)
+{
+  if (!g_profile.is_enabled) {
+    return;
+  }
+  const double time_end = PIL_check_seconds_timer();
+  const uint32_t i = atomic_fetch_and_add_uint32(&g_profile.events_num, 1);
+  if (i >= PROFILE_EVENTS_MAX) {
+    return;
+  }
+  ProfileEvent *event = &g_profile.events[i];
+  event->name = scope->name;
+  event->time_start = scope->time_start;
+  event->time_end = time_end;
+  event->thread_id = (uint64_t)(uintptr_t)pthread_self();
+}
+
+bool BLI_profile_dump_json(const char *filepath)
+{
+  if (g_profile.events == NULL) {
+    return false;
+  }
+  FILE *f = fopen(filepath, "w");
+  if (f == NULL) {
+    return false;
+  }
+
+  const uint32_t events_num = MIN2(g_profile.events_num, (uint32_t)PROFILE_EVENTS_MAX);
+  if (g_profile.events_num > events_num) {
+    fprintf(stderr,
+            "BLI_profile: dropped %u events (buffer full)\n",
+            g_profile.events_num - events_num);
+  }
+
+  fprintf(f, "{\"traceEvents\":[\n");
+  for (uint32_t i = 0; i < events_num; i++) {
+    const ProfileEvent *event = &g_profile.events[i];
+    /* Time-stamps are in microseconds in the chrome-tracing format. */
+    fprintf(f,
+            "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%llu,"
+            "\"ts\":%.3f,\"dur\":%.3f}%s\n",
+            event->name,
+            (unsigned long long)event->thread_id,
+            event->time_start * 1e6,
+            (event->time_end - event->time_start) * 1e6,
+            (i + 1 < events_num) ? "," : "");
+  }
+  fprintf(f, "]}\n");
+
+  fclose(f);
+  return true;
+}
@@ -104,6 +104,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
+#include "BLI_task.h"
 
 #include "BLI_strict_flags.h"
 
@@ -910,6 +911,71 @@ static hash_key key_from_chunk_ref(const BArrayInfo *info,
   return key;
 }
 
+#  ifdef USE_HASH_TABLE_KEY_CACHE
+
+/* Don't fan out tiny reference lists, the task overhead would eat the gain. */
+#    define BCHUNK_PARALLEL_HASH_MIN 64
+
+typedef struct ParallelChunkHashData {
+  const BArrayInfo *info;
+  const BChunkRef **cref_array;
+} ParallelChunkHashData;
+
+typedef struct ParallelChunkHashTLS {
+  /* Lazily allocated per worker, see #key_from_chunk_ref. */
+  hash_key *hash_store;
+} ParallelChunkHashTLS;
+
+static void chunk_hash_parallel_func(void *__restrict userdata,
+                                     const int iter,
+                                     const TaskParallelTLS *__restrict tls)
+{
+  ParallelChunkHashData *data = userdata;
+  ParallelChunkHashTLS *hash_tls = tls->userdata_chunk;
+  if (UNLIKELY(hash_tls->hash_store == NULL)) {
+    hash_tls->hash_store = MEM_mallocN(sizeof(hash_key) * data->info->accum_read_ahead_len,
+                                       __func__);
+  }
+  /* Only called for chunks whose key is unset, the computed key is written into the
+   * (shared) chunk key cache. Two workers may reach the same chunk through different
+   * references, both then store the identical key, which is harmless. */
+  key_from_chunk_ref(
+      data->info, data->cref_array[iter], hash_tls->hash_store, data->info->accum_read_ahead_len);
+}
+
+static void chunk_hash_parallel_free(const void *__restrict UNUSED(userdata),
+                                     void *__restrict chunk)
+{
+  ParallelChunkHashTLS *hash_tls = chunk;
+  MEM_SAFE_FREE(hash_tls->hash_store);
+}
+
+/**
+ * Fill the key cache of all chunks in \a cref_array using all cores.
+ * The serial table build afterwards then only reads cached keys.
+ */
+static void chunk_hash_array_ensure_parallel(const BArrayInfo *info,
+                                             const BChunkRef **cref_array,
+                                             const uint cref_array_len)
+{
+  ParallelChunkHashData data;
+  data.info = info;
+  data.cref_array = cref_array;
+
+  ParallelChunkHashTLS tls_data = {NULL};
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.userdata_chunk = &tls_data;
+  settings.userdata_chunk_size = sizeof(tls_data);
+  settings.func_free = chunk_hash_parallel_free;
+  settings.min_iter_per_thread = 8;
+
+  BLI_task_parallel_range(0, (int)cref_array_len, &data, chunk_hash_parallel_func, &settings);
+}
+
+#  endif /* USE_HASH_TABLE_KEY_CACHE */
+
 static const BChunkRef *table_lookup(const BArrayInfo *info,
                                      BTableRef **table,
                                      const size_t table_len,
@@ -1256,6 +1322,32 @@ static BChunkList *bchunk_list_from_data_merge(const BArrayInfo *info,
       }
 #endif
 
+#if defined(USE_HASH_TABLE_ACCUMULATE) && defined(USE_HASH_TABLE_KEY_CACHE)
+      /* Compute missing chunk keys over all cores before the serial table fill below,
+       * which then only reads them from the key cache. For large undo pushes the
+       * accumulated hashing is the dominant cost of the push. */
+      {
+        const BChunkRef **cref_array = MEM_mallocN(
+            sizeof(*cref_array) * chunk_list_reference_remaining_len, __func__);
+        uint cref_array_len = 0;
+        const BChunkRef *cref_iter = cref;
+        size_t bytes_remaining = chunk_list_reference_bytes_remaining;
+        while ((cref_iter != chunk_list_reference_last) &&
+               (bytes_remaining >= info->accum_read_ahead_bytes)) {
+          if (cref_iter->link->key == HASH_TABLE_KEY_UNSET) {
+            BLI_assert(cref_array_len < chunk_list_reference_remaining_len);
+            cref_array[cref_array_len++] = cref_iter;
+          }
+          bytes_remaining -= cref_iter->link->data_len;
+          cref_iter = cref_iter->next;
+        }
+        if (cref_array_len >= BCHUNK_PARALLEL_HASH_MIN) {
+          chunk_hash_array_ensure_parallel(info, cref_array, cref_array_len);
+        }
+        MEM_freeN((void *)cref_array);
+      }
+#endif
+
       while ((cref != chunk_list_reference_last) &&
              (chunk_list_reference_bytes_remaining >= info->accum_read_ahead_bytes)) {
         hash_key key = key_from_chunk_ref(info,
@@ -42,6 +42,8 @@
 #define USE_FREE_STRIP
 /* slight bias, needed when packing many boxes the _exact_ same size */
 #define USE_PACK_BIAS
+/* spatial grid accelerating the collision search for large inputs */
+#define USE_ISECT_GRID
 
 /* BoxPacker for backing 2D rectangles into a square
  *
@@ -192,6 +194,133 @@ static float max_ff(const float a, const float b)
   return b > a ? b : a;
 }
 
+#ifdef USE_ISECT_GRID
+/* -------------------------------------------------------------------- */
+/** \name Spatial Grid
+ *
+ * Uniform grid over the estimated packing area so finding a colliding box
+ * tests the few boxes sharing cells with the candidate placement instead of
+ * every box packed so far. Boxes placed outside the estimated area clamp
+ * into the border cells, which costs extra tests but never misses an
+ * intersection (clamping is monotonic, overlapping intervals stay
+ * overlapping).
+ * \{ */
+
+typedef struct BoxGridCell {
+  uint *items;
+  uint len;
+  uint alloc;
+} BoxGridCell;
+
+typedef struct BoxGrid {
+  BoxGridCell *cells;
+  uint dim;
+  /** Divide coordinates by the cell size. */
+  float scale;
+} BoxGrid;
+
+/** Use the slow linear search below this many boxes. */
+#define GRID_BOXES_MIN 64
+
+BLI_INLINE uint box_grid_co(const BoxGrid *grid, const float f)
+{
+  int i = (int)(f * grid->scale);
+  if (i < 0) {
+    i = 0;
+  }
+  if (i > (int)grid->dim - 1) {
+    i = (int)grid->dim - 1;
+  }
+  return (uint)i;
+}
+
+static BoxGrid *box_grid_create(const BoxPack *boxarray, const uint len)
+{
+  float area = 0.0f;
+  float side;
+  uint i, dim;
+  BoxGrid *grid;
+
+  for (i = 0; i < len; i++) {
+    area += box_area(&boxarray[i]);
+  }
+  if (!(area > 0.0f) || !isfinite(area)) {
+    return NULL;
+  }
+  /* Packing overshoots the square root bound, allow for slack. */
+  side = sqrtf(area) * 1.5f;
+
+  dim = (uint)sqrtf((float)len);
+  CLAMP(dim, 4, 256);
+
+  grid = MEM_mallocN(sizeof(*grid), __func__);
+  grid->cells = MEM_callocN(sizeof(BoxGridCell) * (size_t)dim * (size_t)dim, __func__);
+  grid->dim = dim;
+  grid->scale = (float)dim / side;
+  return grid;
+}
+
+static void box_grid_free(BoxGrid *grid)
+{
+  uint i;
+  if (grid == NULL) {
+    return;
+  }
+  for (i = 0; i < grid->dim * grid->dim; i++) {
+    if (grid->cells[i].items) {
+      MEM_freeN(grid->cells[i].items);
+    }
+  }
+  MEM_freeN(grid->cells);
+  MEM_freeN(grid);
+}
+
+static void box_grid_insert(BoxGrid *grid, const uint box_index, const BoxPack *box)
+{
+  const uint xmin = box_grid_co(grid, box_xmin_get(box));
+  const uint xmax = box_grid_co(grid, box_xmax_get(box));
+  const uint ymin = box_grid_co(grid, box_ymin_get(box));
+  const uint ymax = box_grid_co(grid, box_ymax_get(box));
+  uint x, y;
+
+  for (y = ymin; y <= ymax; y++) {
+    for (x = xmin; x <= xmax; x++) {
+      BoxGridCell *cell = &grid->cells[y * grid->dim + x];
+      if (cell->len == cell->alloc) {
+        cell->alloc = cell->alloc ? cell->alloc * 2 : 4;
+        cell->items = MEM_reallocN(cell->items, sizeof(uint) * cell->alloc);
+      }
+      cell->items[cell->len++] = box_index;
+    }
+  }
+}
+
+/** Find any placed box intersecting \a box, NULL when the placement is free. */
+static BoxPack *box_grid_isect_find(const BoxGrid *grid, BoxPack *boxarray, const BoxPack *box)
+{
+  const uint xmin = box_grid_co(grid, box_xmin_get(box));
+  const uint xmax = box_grid_co(grid, box_xmax_get(box));
+  const uint ymin = box_grid_co(grid, box_ymin_get(box));
+  const uint ymax = box_grid_co(grid, box_ymax_get(box));
+  uint x, y, i;
+
+  for (y = ymin; y <= ymax; y++) {
+    for (x = xmin; x <= xmax; x++) {
+      const BoxGridCell *cell = &grid->cells[y * grid->dim + x];
+      for (i = 0; i < cell->len; i++) {
+        BoxPack *box_test = &boxarray[cell->items[i]];
+        if (box_isect(box, box_test)) {
+          return box_test;
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+/** \} */
+#endif /* USE_ISECT_GRID */
+
 #ifdef USE_PACK_BIAS
 /* set when used is enabled */
 static void vert_bias_update(BoxVert *v)
@@ -302,6 +431,9 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
   BoxVert *vert;           /* The current vert. */
 
   struct VertSortContext vs_ctx;
+#ifdef USE_ISECT_GRID
+  BoxGrid *grid = NULL;
+#endif
 
   if (!len) {
     *r_tot_x = tot_x;
@@ -312,6 +444,12 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
   /* Sort boxes, biggest first */
   qsort(boxarray, (size_t)len, sizeof(BoxPack), box_areasort);
 
+#ifdef USE_ISECT_GRID
+  if (len >= GRID_BOXES_MIN) {
+    grid = box_grid_create(boxarray, len);
+  }
+#endif
+
   /* Add verts to the boxes, these are only used internally. */
   vert = MEM_mallocN(sizeof(BoxVert[4]) * (size_t)len, "BoxPack Verts");
   vertex_pack_indices = MEM_mallocN(sizeof(int[3]) * (size_t)len, "BoxPack Indices");
@@ -382,6 +520,11 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
     vertex_pack_indices[i] = box->v[i + 1]->index;
   }
   verts_pack_len = 3;
+#ifdef USE_ISECT_GRID
+  if (grid) {
+    box_grid_insert(grid, 0, box);
+  }
+#endif
   box++; /* next box, needed for the loop below */
   /* ...done packing the first box */
 
@@ -453,10 +596,20 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
              * big speedup */
             isect = true;
           }
+#ifdef USE_ISECT_GRID
+          else if (grid) {
+            box_test = box_grid_isect_find(grid, boxarray, box);
+            if (box_test) {
+              /* Store the last intersecting here as cache
+               * for faster checking next time around */
+              vert->isect_cache[j] = box_test;
+              isect = true;
+            }
+          }
+#endif
           else {
-            /* do a full search for colliding box
-             * this is really slow, some spatially divided
-             * data-structure would be better */
+            /* do a full search for colliding box,
+             * only used when there are too few boxes for the grid */
             for (box_test = boxarray; box_test != box; box_test++) {
               if (box_isect(box, box_test)) {
                 /* Store the last intersecting here as cache
@@ -474,6 +627,12 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
             tot_x = max_ff(box_xmax_get(box), tot_x);
             tot_y = max_ff(box_ymax_get(box), tot_y);
 
+#ifdef USE_ISECT_GRID
+            if (grid) {
+              box_grid_insert(grid, box_index, box);
+            }
+#endif
+
             /* Place the box */
             vert->free &= (signed char)(~quad_flag(j));
 
@@ -674,6 +833,9 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
     box = boxarray + box_index;
     box->v[0] = box->v[1] = box->v[2] = box->v[3] = NULL;
   }
+#ifdef USE_ISECT_GRID
+  box_grid_free(grid);
+#endif
   MEM_freeN(vertex_pack_indices);
   MEM_freeN(vs_ctx.vertarray);
 }
@@ -28,9 +28,15 @@
 #include "BLI_endian_switch.h"
 #include "BLI_filereader.h"
 #include "BLI_math_base.h"
+#include "BLI_threads.h"
+#include "BLI_utildefines.h"
 
 #include "MEM_guardedalloc.h"
 
+/* Special values for the prefetch request/result frame fields. */
+#define PREFETCH_FRAME_NONE -1
+#define PREFETCH_FRAME_EXIT -2
+
 typedef struct {
   FileReader reader;
 
@@ -46,8 +52,35 @@ typedef struct {
     size_t *uncompressed_ofs;
 
     char *cached_content;
+    size_t cached_content_size;
     int cached_frame;
   } seek;
+
+  /* Background decompression of the next frame while the caller consumes the current one, so
+   * that sequential reads (the initial datablock parsing pass of .blend loading) overlap
+   * decompression with the work done on the decompressed data. The main thread still performs
+   * the base file reads, the worker only runs ZSTD_decompressDCtx with its own context. */
+  struct {
+    bool use;
+    /* Frame of the previous cache request, used to detect sequential access. Only ever
+     * touched by the reading thread. */
+    int last_frame;
+    ListBase threadbase;
+    ThreadMutex mutex;
+    ThreadCondition cond;
+    ZSTD_DCtx *ctx;
+
+    /* Request, set by the main thread (compressed data ownership passes to the worker). */
+    int requested_frame;
+    char *compressed_data;
+    size_t compressed_size;
+
+    /* Result, set by the worker. */
+    int ready_frame;
+    char *uncompressed_data;
+    size_t uncompressed_size;
+    size_t buffer_size;
+  } prefetch;
 } ZstdReader;
 
 static bool zstd_read_u32(FileReader *base, uint32_t *val)
@@ -170,6 +203,120 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
+static void *zstd_prefetch_thread_run(void *data)
+{
+  ZstdReader *zstd = data;
+
+  BLI_mutex_lock(&zstd->prefetch.mutex);
+  while (true) {
+    while (zstd->prefetch.requested_frame == PREFETCH_FRAME_NONE) {
+      BLI_condition_wait(&zstd->prefetch.cond, &zstd->prefetch.mutex);
+    }
+    if (zstd->prefetch.requested_frame == PREFETCH_FRAME_EXIT) {
+      break;
+    }
+
+    const int frame = zstd->prefetch.requested_frame;
+    char *compressed_data = zstd->prefetch.compressed_data;
+    const size_t compressed_size = zstd->prefetch.compressed_size;
+    zstd->prefetch.compressed_data = NULL;
+
+    const size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
+                                     zstd->seek.uncompressed_ofs[frame];
+    if (zstd->prefetch.buffer_size < uncompressed_size) {
+      MEM_SAFE_FREE(zstd->prefetch.uncompressed_data);
+      zstd->prefetch.uncompressed_data = MEM_mallocN(uncompressed_size, __func__);
+      zstd->prefetch.buffer_size = uncompressed_size;
+    }
+    char *uncompressed_data = zstd->prefetch.uncompressed_data;
+
+    /* The buffers now belong to the worker until requested_frame is cleared, decompression can
+     * run without the lock held. */
+    BLI_mutex_unlock(&zstd->prefetch.mutex);
+    const size_t res = ZSTD_decompressDCtx(zstd->prefetch.ctx,
+                                           uncompressed_data,
+                                           uncompressed_size,
+                                           compressed_data,
+                                           compressed_size);
+    MEM_freeN(compressed_data);
+    BLI_mutex_lock(&zstd->prefetch.mutex);
+
+    if (ZSTD_isError(res) || res < uncompressed_size) {
+      /* On failure the main thread falls back to synchronous decompression. */
+      zstd->prefetch.ready_frame = PREFETCH_FRAME_NONE;
+    }
+    else {
+      zstd->prefetch.ready_frame = frame;
+      zstd->prefetch.uncompressed_size = uncompressed_size;
+    }
+    zstd->prefetch.requested_frame = PREFETCH_FRAME_NONE;
+    BLI_condition_notify_all(&zstd->prefetch.cond);
+  }
+  BLI_mutex_unlock(&zstd->prefetch.mutex);
+
+  return NULL;
+}
+
+/* Hand the given frame to the background worker, unless it is still busy or holds a result
+ * which was not consumed yet. Reading the compressed bytes stays on the calling thread, since
+ * the base reader is not thread-safe. */
+static void zstd_prefetch_frame(ZstdReader *zstd, int frame)
+{
+  if (frame >= zstd->seek.num_frames) {
+    return;
+  }
+
+  BLI_mutex_lock(&zstd->prefetch.mutex);
+  const bool worker_idle = (zstd->prefetch.requested_frame == PREFETCH_FRAME_NONE);
+  /* Discard a stale result from a mis-predicted prefetch. */
+  if (worker_idle) {
+    zstd->prefetch.ready_frame = PREFETCH_FRAME_NONE;
+  }
+  BLI_mutex_unlock(&zstd->prefetch.mutex);
+  if (!worker_idle) {
+    return;
+  }
+
+  const size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] -
+                                 zstd->seek.compressed_ofs[frame];
+  char *compressed_data = MEM_mallocN(compressed_size, __func__);
+  if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
+      zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size) {
+    MEM_freeN(compressed_data);
+    return;
+  }
+
+  BLI_mutex_lock(&zstd->prefetch.mutex);
+  zstd->prefetch.compressed_data = compressed_data;
+  zstd->prefetch.compressed_size = compressed_size;
+  zstd->prefetch.requested_frame = frame;
+  BLI_condition_notify_all(&zstd->prefetch.cond);
+  BLI_mutex_unlock(&zstd->prefetch.mutex);
+}
+
+/* Take the decompressed frame from the worker if it has it (or is currently working on it),
+ * swapping buffers instead of copying. Returns false when the frame has to be decompressed
+ * synchronously. */
+static bool zstd_prefetch_take_result(ZstdReader *zstd, int frame)
+{
+  bool taken = false;
+
+  BLI_mutex_lock(&zstd->prefetch.mutex);
+  while (zstd->prefetch.requested_frame == frame) {
+    BLI_condition_wait(&zstd->prefetch.cond, &zstd->prefetch.mutex);
+  }
+  if (zstd->prefetch.ready_frame == frame) {
+    SWAP(char *, zstd->seek.cached_content, zstd->prefetch.uncompressed_data);
+    SWAP(size_t, zstd->seek.cached_content_size, zstd->prefetch.buffer_size);
+    zstd->seek.cached_frame = frame;
+    zstd->prefetch.ready_frame = PREFETCH_FRAME_NONE;
+    taken = true;
+  }
+  BLI_mutex_unlock(&zstd->prefetch.mutex);
+
+  return taken;
+}
+
 /* Ensure that the currently loaded frame is the correct one. */
 static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
 {
@@ -178,19 +325,36 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
     return zstd->seek.cached_content;
   }
 
-  /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
-  MEM_SAFE_FREE(zstd->seek.cached_content);
+  const bool is_sequential = (frame == 0 || frame == zstd->prefetch.last_frame + 1);
+  zstd->prefetch.last_frame = frame;
+
+  if (zstd->prefetch.use && zstd_prefetch_take_result(zstd, frame)) {
+    /* Keep the pipeline going while the caller is busy with the current frame. */
+    if (is_sequential) {
+      zstd_prefetch_frame(zstd, frame + 1);
+    }
+    return zstd->seek.cached_content;
+  }
+
+  /* Cached frame doesn't match, so cache the wanted one instead. All frames except the
+   * last one have the same uncompressed size, so the cache buffer can nearly always be
+   * reused instead of reallocated (scattered reads during linking alternate frames a lot). */
+  zstd->seek.cached_frame = -1;
 
   size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
   size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
                              zstd->seek.uncompressed_ofs[frame];
 
-  char *uncompressed_data = MEM_mallocN(uncompressed_size, __func__);
+  if (zstd->seek.cached_content_size < uncompressed_size) {
+    MEM_SAFE_FREE(zstd->seek.cached_content);
+    zstd->seek.cached_content = MEM_mallocN(uncompressed_size, __func__);
+    zstd->seek.cached_content_size = uncompressed_size;
+  }
+  char *uncompressed_data = zstd->seek.cached_content;
   char *compressed_data = MEM_mallocN(compressed_size, __func__);
   if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
       zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size) {
     MEM_freeN(compressed_data);
-    MEM_freeN(uncompressed_data);
     return NULL;
   }
 
@@ -198,12 +362,17 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
       zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
   MEM_freeN(compressed_data);
   if (ZSTD_isError(res) || res < uncompressed_size) {
-    MEM_freeN(uncompressed_data);
     return NULL;
   }
 
   zstd->seek.cached_frame = frame;
-  zstd->seek.cached_content = uncompressed_data;
+
+  /* Only read ahead for sequential access, scattered reads during linking would just make the
+   * worker churn on frames which are never used. */
+  if (zstd->prefetch.use && is_sequential) {
+    zstd_prefetch_frame(zstd, frame + 1);
+  }
+
   return uncompressed_data;
 }
 
@@ -289,12 +458,35 @@ static ssize_t zstd_read(FileReader *reader, void *buffer, size_t size)
   return output.pos;
 }
 
+static void zstd_prefetch_end(ZstdReader *zstd)
+{
+  /* Wait for a possibly running decompression before requesting the exit, the worker clears
+   * the requested frame when it is done with it. */
+  BLI_mutex_lock(&zstd->prefetch.mutex);
+  while (zstd->prefetch.requested_frame != PREFETCH_FRAME_NONE) {
+    BLI_condition_wait(&zstd->prefetch.cond, &zstd->prefetch.mutex);
+  }
+  zstd->prefetch.requested_frame = PREFETCH_FRAME_EXIT;
+  BLI_condition_notify_all(&zstd->prefetch.cond);
+  BLI_mutex_unlock(&zstd->prefetch.mutex);
+
+  BLI_threadpool_end(&zstd->prefetch.threadbase);
+  BLI_condition_end(&zstd->prefetch.cond);
+  BLI_mutex_end(&zstd->prefetch.mutex);
+  ZSTD_freeDCtx(zstd->prefetch.ctx);
+  MEM_SAFE_FREE(zstd->prefetch.compressed_data);
+  MEM_SAFE_FREE(zstd->prefetch.uncompressed_data);
+}
+
 static void zstd_close(FileReader *reader)
 {
   ZstdReader *zstd = (ZstdReader *)reader;
 
   ZSTD_freeDCtx(zstd->ctx);
   if (zstd->reader.seek) {
+    if (zstd->prefetch.use) {
+      zstd_prefetch_end(zstd);
+    }
     MEM_freeN(zstd->seek.uncompressed_ofs);
     MEM_freeN(zstd->seek.compressed_ofs);
     MEM_freeN(zstd->seek.cached_content);
@@ -317,6 +509,20 @@ FileReader *BLI_filereader_new_zstd(FileReader *base)
   if (zstd_read_seek_table(zstd)) {
     zstd->reader.read = zstd_read_seekable;
     zstd->reader.seek = zstd_seek;
+
+    /* Overlapping decompression with consumption only pays off when there are enough frames
+     * to pipeline and an extra core to run on. */
+    zstd->prefetch.use = (zstd->seek.num_frames > 2) && (BLI_system_thread_count() > 1);
+    if (zstd->prefetch.use) {
+      BLI_mutex_init(&zstd->prefetch.mutex);
+      BLI_condition_init(&zstd->prefetch.cond);
+      zstd->prefetch.ctx = ZSTD_createDCtx();
+      zstd->prefetch.requested_frame = PREFETCH_FRAME_NONE;
+      zstd->prefetch.ready_frame = PREFETCH_FRAME_NONE;
+      zstd->prefetch.last_frame = PREFETCH_FRAME_NONE;
+      BLI_threadpool_init(&zstd->prefetch.threadbase, zstd_prefetch_thread_run, 1);
+      BLI_threadpool_insert(&zstd->prefetch.threadbase, zstd);
+    }
   }
   else {
     zstd->reader.read = zstd_read;
@@ -22,6 +22,8 @@
 
 #include "BLI_kdtree_impl.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
+
 #include "BLI_strict_flags.h"
 #include "BLI_utildefines.h"
 
@@ -45,10 +47,10 @@ typedef struct KDTreeNode {
 struct KDTree {
   KDTreeNode *nodes;
   uint nodes_len;
+  uint nodes_len_capacity; /* max size of the tree */
   uint root;
 #ifdef DEBUG
-  bool is_balanced;        /* ensure we call balance first */
-  uint nodes_len_capacity; /* max size of the tree */
+  bool is_balanced; /* ensure we call balance first */
 #endif
 };
 
@@ -103,11 +105,11 @@ KDTree *BLI_kdtree_nd_(new)(uint nodes_len_capacity)
   tree = MEM_mallocN(sizeof(KDTree), "KDTree");
   tree->nodes = MEM_mallocN(sizeof(KDTreeNode) * nodes_len_capacity, "KDTreeNode");
   tree->nodes_len = 0;
+  tree->nodes_len_capacity = nodes_len_capacity;
   tree->root = KD_NODE_ROOT_IS_INIT;
 
 #ifdef DEBUG
   tree->is_balanced = false;
-  tree->nodes_len_capacity = nodes_len_capacity;
 #endif
 
   return tree;
@@ -121,6 +123,26 @@ void BLI_kdtree_nd_(free)(KDTree *tree)
   }
 }
 
+/**
+ * Remove all points, so the tree can be filled again for the next time step.
+ * The node storage is grown when needed but never shrunk, so a tree that is
+ * rebuilt every step reuses its allocation instead of churning the allocator.
+ */
+void BLI_kdtree_nd_(clear)(KDTree *tree, uint nodes_len_capacity)
+{
+  if (nodes_len_capacity > tree->nodes_len_capacity) {
+    tree->nodes = MEM_reallocN(tree->nodes, sizeof(KDTreeNode) * nodes_len_capacity);
+    tree->nodes_len_capacity = nodes_len_capacity;
+  }
+
+  tree->nodes_len = 0;
+  tree->root = KD_NODE_ROOT_IS_INIT;
+
+#ifdef DEBUG
+  tree->is_balanced = false;
+#endif
+}
+
 /**
  * Construction: first insert points, then call balance. Normal is optional.
  */
@@ -145,20 +167,16 @@ void BLI_kdtree_nd_(insert)(KDTree *tree, int index, const float co[KD_DIMS])
 #endif
 }
 
-static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+/**
+ * Quick-sort style partitioning, so the median element on \a axis ends up at the
+ * median position with smaller elements before and greater elements after it.
+ * \return the median position.
+ */
+static uint kdtree_balance_partition(KDTreeNode *nodes, uint nodes_len, const uint axis)
 {
-  KDTreeNode *node;
   float co;
   uint left, right, median, i, j;
 
-  if (nodes_len <= 0) {
-    return KD_NODE_UNSET;
-  }
-  else if (nodes_len == 1) {
-    return 0 + ofs;
-  }
-
-  /* Quick-sort style sorting around median. */
   left = 0;
   right = nodes_len - 1;
   median = nodes_len / 2;
@@ -190,6 +208,23 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
     }
   }
 
+  return median;
+}
+
+static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+{
+  KDTreeNode *node;
+  uint median;
+
+  if (nodes_len <= 0) {
+    return KD_NODE_UNSET;
+  }
+  else if (nodes_len == 1) {
+    return 0 + ofs;
+  }
+
+  median = kdtree_balance_partition(nodes, nodes_len, axis);
+
   /* set node and sort subnodes */
   node = &nodes[median];
   node->d = axis;
@@ -201,6 +236,65 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
   return median + ofs;
 }
 
+/* Minimum number of nodes a subtree needs before balancing it is worth a task of its own. */
+#define KD_BALANCE_PARALLEL_LEAF 4096
+
+typedef struct KDTreeBalanceTask {
+  KDTreeNode *nodes;
+  uint nodes_len;
+  uint axis;
+  uint ofs;
+  /** Where the parent expects the resulting subtree root index. */
+  uint *r_node;
+} KDTreeBalanceTask;
+
+static void kdtree_balance_push_task(
+    TaskPool *pool, KDTreeNode *nodes, uint nodes_len, uint axis, uint ofs, uint *r_node);
+
+/**
+ * Same as #kdtree_balance, but fans the (disjoint) subtrees out over the task pool,
+ * descending into the right subtree on the current thread while the left one runs as a task.
+ */
+static uint kdtree_balance_threaded(
+    TaskPool *pool, KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+{
+  KDTreeNode *node;
+  uint median;
+
+  if (nodes_len < KD_BALANCE_PARALLEL_LEAF) {
+    return kdtree_balance(nodes, nodes_len, axis, ofs);
+  }
+
+  median = kdtree_balance_partition(nodes, nodes_len, axis);
+
+  node = &nodes[median];
+  node->d = axis;
+  axis = (axis + 1) % KD_DIMS;
+  kdtree_balance_push_task(pool, nodes, median, axis, ofs, &node->left);
+  node->right = kdtree_balance_threaded(
+      pool, nodes + median + 1, (nodes_len - (median + 1)), axis, (median + 1) + ofs);
+
+  return median + ofs;
+}
+
+static void kdtree_balance_task_run(TaskPool *__restrict pool, void *taskdata)
+{
+  KDTreeBalanceTask *task = taskdata;
+  *task->r_node = kdtree_balance_threaded(pool, task->nodes, task->nodes_len, task->axis, task->ofs);
+}
+
+static void kdtree_balance_push_task(
+    TaskPool *pool, KDTreeNode *nodes, uint nodes_len, uint axis, uint ofs, uint *r_node)
+{
+  KDTreeBalanceTask *task = MEM_mallocN(sizeof(*task), __func__);
+  task->nodes = nodes;
+  task->nodes_len = nodes_len;
+  task->axis = axis;
+  task->ofs = ofs;
+  task->r_node = r_node;
+  BLI_task_pool_push(pool, kdtree_balance_task_run, task, true, NULL);
+}
+
 void BLI_kdtree_nd_(balance)(KDTree *tree)
 {
   if (tree->root != KD_NODE_ROOT_IS_INIT) {
@@ -210,7 +304,15 @@ void BLI_kdtree_nd_(balance)(KDTree *tree)
     }
   }
 
-  tree->root = kdtree_balance(tree->nodes, tree->nodes_len, 0, 0);
+  if (tree->nodes_len >= KD_BALANCE_PARALLEL_LEAF * 2) {
+    TaskPool *task_pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+    kdtree_balance_push_task(task_pool, tree->nodes, tree->nodes_len, 0, 0, &tree->root);
+    BLI_task_pool_work_and_wait(task_pool);
+    BLI_task_pool_free(task_pool);
+  }
+  else {
+    tree->root = kdtree_balance(tree->nodes, tree->nodes_len, 0, 0);
+  }
 
 #ifdef DEBUG
   tree->is_balanced = true;
@@ -332,6 +434,44 @@ int BLI_kdtree_nd_(find_nearest)(const KDTree *tree,
   return min_node->index;
 }
 
+typedef struct KDTreeNearestBatchData {
+  const KDTree *tree;
+  const float (*cos)[KD_DIMS];
+  KDTreeNearest *r_nearest;
+} KDTreeNearestBatchData;
+
+static void kdtree_nearest_batch_fn(void *__restrict userdata,
+                                    const int i,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  KDTreeNearestBatchData *data = userdata;
+  data->r_nearest[i].index = BLI_kdtree_nd_(find_nearest)(
+      data->tree, data->cos[i], &data->r_nearest[i]);
+}
+
+/**
+ * A version of #BLI_kdtree_3d_find_nearest that answers an array of queries at once,
+ * distributing them over all cores. Intended for callers which issue millions of
+ * back-to-back queries against the same tree (particle distribution, remeshing),
+ * where per-query function call and scheduling overhead dominates.
+ *
+ * \param cos: array of \a queries_len query coordinates.
+ * \param r_nearest: array of \a queries_len results, index is -1 when nothing was found.
+ */
+void BLI_kdtree_nd_(find_nearest_batch)(const KDTree *tree,
+                                        const float (*cos)[KD_DIMS],
+                                        KDTreeNearest *r_nearest,
+                                        uint queries_len)
+{
+  KDTreeNearestBatchData data = {tree, cos, r_nearest};
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  /* Queries are cheap, only spread out reasonably large batches. */
+  settings.use_threading = (queries_len >= 512);
+  settings.min_iter_per_thread = 256;
+  BLI_task_parallel_range(0, (int)queries_len, &data, kdtree_nearest_batch_fn, &settings);
+}
+
 /**
  * A version of #BLI_kdtree_3d_find_nearest which runs a callback
  * to filter out values.
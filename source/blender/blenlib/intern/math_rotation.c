@@ -24,6 +24,7 @@
  */
 
 #include "BLI_math.h"
+#include "BLI_simd.h"
 
 #include "BLI_strict_flags.h"
 
@@ -2079,6 +2080,19 @@ void add_weighted_dq_dq(DualQuat *dq_sum, const DualQuat *dq, float weight)
   }
 
   /* interpolate rotation and translation */
+#ifdef BLI_HAVE_SSE2
+  {
+    __m128 weight_vec = _mm_set1_ps(weight);
+
+    __m128 quat_sum = _mm_loadu_ps(dq_sum->quat);
+    quat_sum = _mm_add_ps(quat_sum, _mm_mul_ps(_mm_loadu_ps(dq->quat), weight_vec));
+    _mm_storeu_ps(dq_sum->quat, quat_sum);
+
+    __m128 trans_sum = _mm_loadu_ps(dq_sum->trans);
+    trans_sum = _mm_add_ps(trans_sum, _mm_mul_ps(_mm_loadu_ps(dq->trans), weight_vec));
+    _mm_storeu_ps(dq_sum->trans, trans_sum);
+  }
+#else
   dq_sum->quat[0] += weight * dq->quat[0];
   dq_sum->quat[1] += weight * dq->quat[1];
   dq_sum->quat[2] += weight * dq->quat[2];
@@ -2088,21 +2102,34 @@ void add_weighted_dq_dq(DualQuat *dq_sum, const DualQuat *dq, float weight)
   dq_sum->trans[1] += weight * dq->trans[1];
   dq_sum->trans[2] += weight * dq->trans[2];
   dq_sum->trans[3] += weight * dq->trans[3];
+#endif
 
   /* Interpolate scale - but only if there is scale present. If any dual
    * quaternions without scale are added, they will be compensated for in
    * normalize_dq. */
   if (dq->scale_weight) {
-    float wmat[4][4];
-
     if (flipped) {
       /* we don't want negative weights for scaling */
       weight = -weight;
     }
 
+#ifdef BLI_HAVE_SSE2
+    {
+      __m128 weight_vec = _mm_set1_ps(weight);
+
+      for (int i = 0; i < 4; i++) {
+        __m128 row_sum = _mm_loadu_ps(dq_sum->scale[i]);
+        row_sum = _mm_add_ps(row_sum, _mm_mul_ps(_mm_loadu_ps(dq->scale[i]), weight_vec));
+        _mm_storeu_ps(dq_sum->scale[i], row_sum);
+      }
+    }
+#else
+    float wmat[4][4];
+
     copy_m4_m4(wmat, (float(*)[4])dq->scale);
     mul_m4_fl(wmat, weight);
     add_m4_m4m4(dq_sum->scale, dq_sum->scale, wmat);
+#endif
     dq_sum->scale_weight += weight;
   }
 }
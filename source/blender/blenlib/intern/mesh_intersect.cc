@@ -2693,38 +2693,52 @@ static void calc_subdivided_non_cluster_tris(Array<IMesh> &r_tri_subdivided,
  * We have already done the CDT for the triangles in the cluster, whose
  * result is in cluster_subdivided[c] for each cluster c.
  */
+static void extract_cluster_tris(Array<IMesh> &tri_subdivided,
+                                 const IMesh &tm,
+                                 const CoplanarClusterInfo &clinfo,
+                                 const Array<CDT_data> &cluster_subdivided,
+                                 const int c,
+                                 IMeshArena *arena)
+{
+  const CoplanarCluster &cl = clinfo.cluster(c);
+  const CDT_data &cd = cluster_subdivided[c];
+  /* Each triangle in cluster c should be an input triangle in cd.input_faces.
+   * (See prepare_cdt_input_for_cluster.)
+   * So accumulate a Vector of Face* for each input face by going through the
+   * output faces and making a Face for each input face that it is part of.
+   * (The Boolean algorithm wants duplicates if a given output triangle is part
+   * of more than one input triangle.)
+   */
+  int n_cluster_tris = cl.tot_tri();
+  const CDT_result<mpq_class> &cdt_out = cd.cdt_out;
+  BLI_assert(cd.input_face.size() == n_cluster_tris);
+  Array<Vector<Face *>> face_vec(n_cluster_tris);
+  for (int cdt_out_t : cdt_out.face.index_range()) {
+    for (int cdt_in_t : cdt_out.face_orig[cdt_out_t]) {
+      Face *f = cdt_tri_as_imesh_face(cdt_out_t, cdt_in_t, cd, tm, arena);
+      face_vec[cdt_in_t].append(f);
+    }
+  }
+  for (int cdt_in_t : cd.input_face.index_range()) {
+    int tm_t = cd.input_face[cdt_in_t];
+    BLI_assert(tri_subdivided[tm_t].face_size() == 0);
+    tri_subdivided[tm_t] = IMesh(face_vec[cdt_in_t]);
+  }
+}
+
 static void calc_cluster_tris(Array<IMesh> &tri_subdivided,
                               const IMesh &tm,
                               const CoplanarClusterInfo &clinfo,
                               const Array<CDT_data> &cluster_subdivided,
                               IMeshArena *arena)
 {
-  for (int c : clinfo.index_range()) {
-    const CoplanarCluster &cl = clinfo.cluster(c);
-    const CDT_data &cd = cluster_subdivided[c];
-    /* Each triangle in cluster c should be an input triangle in cd.input_faces.
-     * (See prepare_cdt_input_for_cluster.)
-     * So accumulate a Vector of Face* for each input face by going through the
-     * output faces and making a Face for each input face that it is part of.
-     * (The Boolean algorithm wants duplicates if a given output triangle is part
-     * of more than one input triangle.)
-     */
-    int n_cluster_tris = cl.tot_tri();
-    const CDT_result<mpq_class> &cdt_out = cd.cdt_out;
-    BLI_assert(cd.input_face.size() == n_cluster_tris);
-    Array<Vector<Face *>> face_vec(n_cluster_tris);
-    for (int cdt_out_t : cdt_out.face.index_range()) {
-      for (int cdt_in_t : cdt_out.face_orig[cdt_out_t]) {
-        Face *f = cdt_tri_as_imesh_face(cdt_out_t, cdt_in_t, cd, tm, arena);
-        face_vec[cdt_in_t].append(f);
-      }
-    }
-    for (int cdt_in_t : cd.input_face.index_range()) {
-      int tm_t = cd.input_face[cdt_in_t];
-      BLI_assert(tri_subdivided[tm_t].face_size() == 0);
-      tri_subdivided[tm_t] = IMesh(face_vec[cdt_in_t]);
+  /* The clusters are disjoint, so their triangles can be extracted in parallel. The arena is
+   * locked internally while threading is in use. */
+  threading::parallel_for(clinfo.index_range(), 1, [&](IndexRange range) {
+    for (const int c : range) {
+      extract_cluster_tris(tri_subdivided, tm, clinfo, cluster_subdivided, c, arena);
     }
-  }
+  });
 }
 
 static CDT_data calc_cluster_subdivided(const CoplanarClusterInfo &clinfo,
@@ -3080,9 +3094,15 @@ IMesh trimesh_nary_intersect(const IMesh &tm_in,
             << "\n";
 #  endif
   Array<CDT_data> cluster_subdivided(clinfo.tot_cluster());
-  for (int c : clinfo.index_range()) {
-    cluster_subdivided[c] = calc_cluster_subdivided(clinfo, c, *tm_clean, tri_ov, itt_map, arena);
-  }
+  /* The clusters can be subdivided independently: each CDT only reads the triangle mesh, the
+   * overlap data and the already calculated intersections. Use a grain size of 1 because
+   * individual clusters can be arbitrarily expensive. */
+  threading::parallel_for(clinfo.index_range(), 1, [&](IndexRange range) {
+    for (const int c : range) {
+      cluster_subdivided[c] = calc_cluster_subdivided(
+          clinfo, c, *tm_clean, tri_ov, itt_map, arena);
+    }
+  });
 #  ifdef PERFDEBUG
   double cluster_subdivide_time = PIL_check_seconds_timer();
   std::cout << "subdivided clusters found, time = "
@@ -36,6 +36,7 @@
 #  include <tbb/enumerable_thread_specific.h>
 #  include <tbb/parallel_for.h>
 #  include <tbb/parallel_reduce.h>
+#  include <tbb/partitioner.h>
 #endif
 
 #ifdef WITH_TBB
@@ -115,17 +116,38 @@ void BLI_task_parallel_range(const int start,
   /* Multithreading. */
   if (settings->use_threading && BLI_task_scheduler_num_threads() > 1) {
     RangeTask task(func, userdata, settings);
-    const size_t grainsize = MAX2(settings->min_iter_per_thread, 1);
+    size_t grainsize = MAX2(settings->min_iter_per_thread, 1);
+
+    if (settings->use_work_stealing) {
+      /* Split the range into many more chunks than there are threads, so that
+       * the per-thread deques of the TBB scheduler can steal and re-split work
+       * from threads that got stuck on expensive iterations. Chunks still
+       * respect min_iter_per_thread so tiny ranges don't drown in overhead. */
+      const size_t num_chunks = (size_t)BLI_task_scheduler_num_threads() * 8;
+      const size_t steal_grainsize = MAX2((size_t)(stop - start) / num_chunks, 1);
+      grainsize = MAX2(MIN2(grainsize, steal_grainsize), 1);
+    }
+
     const tbb::blocked_range<int> range(start, stop, grainsize);
 
     if (settings->func_reduce) {
-      parallel_reduce(range, task);
+      if (settings->use_work_stealing) {
+        parallel_reduce(range, task, tbb::simple_partitioner());
+      }
+      else {
+        parallel_reduce(range, task);
+      }
       if (settings->userdata_chunk) {
         memcpy(settings->userdata_chunk, task.userdata_chunk, settings->userdata_chunk_size);
       }
     }
     else {
-      parallel_for(range, task);
+      if (settings->use_work_stealing) {
+        parallel_for(range, task, tbb::simple_partitioner());
+      }
+      else {
+        parallel_for(range, task);
+      }
     }
     return;
   }
@@ -0,0 +1,68 @@
+/* Apache License, Version 2.0 */
+
+#include "BLI_concurrent_map.hh"
+#include "BLI_task.h"
+#include "testing/testing.h"
+
+namespace blender::tests {
+
+TEST(concurrent_map, AddAndLookup)
+{
+  ConcurrentMap<int, float> map;
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_TRUE(map.add(2, 5.0f));
+  EXPECT_FALSE(map.add(2, 7.0f));
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_EQ(*map.lookup_try(2), 5.0f);
+  EXPECT_FALSE(map.lookup_try(3).has_value());
+}
+
+TEST(concurrent_map, LookupOrAdd)
+{
+  ConcurrentMap<int, int> map;
+  EXPECT_EQ(map.lookup_or_add(10, 1), 1);
+  EXPECT_EQ(map.lookup_or_add(10, 2), 1);
+  EXPECT_EQ(map.lookup_or_add_cb(20, []() { return 3; }), 3);
+  EXPECT_EQ(map.lookup_or_add_cb(20, []() { return 4; }), 3);
+  EXPECT_EQ(map.size(), 2);
+}
+
+TEST(concurrent_map, ForeachItem)
+{
+  ConcurrentMap<int, int> map;
+  for (int i = 0; i < 100; i++) {
+    map.add(i, i * 2);
+  }
+  int sum_keys = 0;
+  int sum_values = 0;
+  map.foreach_item([&](int key, int value) {
+    sum_keys += key;
+    sum_values += value;
+  });
+  EXPECT_EQ(sum_keys, 4950);
+  EXPECT_EQ(sum_values, 9900);
+}
+
+static void concurrent_insert_cb(void *__restrict userdata,
+                                 const int iter,
+                                 const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ConcurrentMap<int, int> &map = *static_cast<ConcurrentMap<int, int> *>(userdata);
+  /* Many iterations race on the same key, all have to observe the winning value. */
+  const int key = iter % 100;
+  const int value = map.lookup_or_add(key, iter);
+  EXPECT_EQ(value % 100, key);
+}
+
+TEST(concurrent_map, ParallelInsert)
+{
+  ConcurrentMap<int, int> map;
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0, 10000, &map, concurrent_insert_cb, &settings);
+  EXPECT_EQ(map.size(), 100);
+}
+
+}  // namespace blender::tests
@@ -143,12 +143,29 @@ TEST_CONST(TenE, "1.e+1", 10.0)
 TEST_CONST(Half, ".5", 0.5)
 
 TEST_CONST(Pi, "pi", M_PI)
+TEST_CONST(E, "e", M_E)
+TEST_CONST(Tau, "tau", 2.0 * M_PI)
 TEST_CONST(True, "True", TRUE_VAL)
 TEST_CONST(False, "False", FALSE_VAL)
 
 TEST_CONST(Sqrt, "sqrt(4)", 2.0)
 TEST_EVAL(Sqrt, "sqrt(x)", 4.0, 2.0)
 
+TEST_CONST(Hypot, "hypot(3, 4)", 5.0)
+TEST_EVAL(Hypot, "hypot(x, 4)", 3.0, 5.0)
+
+TEST_CONST(CopySign, "copysign(2, -1)", -2.0)
+TEST_EVAL(CopySign, "copysign(x, -1)", 2.0, -2.0)
+
+TEST_CONST(Tanh, "tanh(0)", 0.0)
+TEST_EVAL(Tanh, "tanh(x)", 0.0, 0.0)
+TEST_EVAL(ASinh, "asinh(sinh(x))", 0.5, 0.5)
+TEST_EVAL(ACosh, "acosh(cosh(x))", 0.5, 0.5)
+TEST_EVAL(ATanh, "atanh(tanh(x))", 0.5, 0.5)
+
+TEST_CONST(Log2, "log2(4)", 2.0)
+TEST_CONST(Log10, "log10(100)", 2.0)
+
 TEST_CONST(FMod, "fmod(3.5, 2)", 1.5)
 TEST_EVAL(FMod, "fmod(x, 2)", 3.5, 1.5)
 
@@ -132,3 +132,96 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+/**
+ * Cast the same random rays with #BLI_bvhtree_ray_cast_batch_simd and with per-ray
+ * #BLI_bvhtree_ray_cast_ex, the packet traversal must find the same hits.
+ */
+static void ray_cast_batch_test(int points_len, int rays_len, float radius, int random_seed)
+{
+  struct RNG *rng = BLI_rng_new(random_seed);
+  /* The epsilon pads every leaf into a real box, so rays through the point cloud actually hit. */
+  BVHTree *tree = BLI_bvhtree_new(points_len, 0.2f, 8, 8);
+
+  float(*points)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+  for (int i = 0; i < points_len; i++) {
+    for (int j = 0; j < 3; j++) {
+      points[i][j] = BLI_rng_get_float(rng) * 2.0f - 1.0f;
+    }
+    BLI_bvhtree_insert(tree, i, points[i], 1);
+  }
+  BLI_bvhtree_balance(tree);
+
+  float(*origins)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * rays_len, __func__);
+  float(*directions)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * rays_len, __func__);
+  BVHTreeRayHit *hits_batch = (BVHTreeRayHit *)MEM_mallocN(sizeof(BVHTreeRayHit) * rays_len,
+                                                           __func__);
+
+  for (int i = 0; i < rays_len; i++) {
+    for (int j = 0; j < 3; j++) {
+      origins[i][j] = (BLI_rng_get_float(rng) * 2.0f - 1.0f) * 2.0f;
+      directions[i][j] = BLI_rng_get_float(rng) * 2.0f - 1.0f;
+    }
+    if (normalize_v3(directions[i]) == 0.0f) {
+      directions[i][2] = 1.0f;
+    }
+    hits_batch[i].index = -1;
+    hits_batch[i].dist = BVH_RAYCAST_DIST_MAX;
+  }
+
+  BLI_bvhtree_ray_cast_batch_simd(
+      tree, origins, directions, rays_len, radius, hits_batch, nullptr, nullptr);
+
+  int hits_found = 0;
+  for (int i = 0; i < rays_len; i++) {
+    BVHTreeRayHit hit_single;
+    hit_single.index = -1;
+    hit_single.dist = BVH_RAYCAST_DIST_MAX;
+    BLI_bvhtree_ray_cast_ex(tree,
+                            origins[i],
+                            directions[i],
+                            radius,
+                            &hit_single,
+                            nullptr,
+                            nullptr,
+                            BVH_RAYCAST_DEFAULT);
+
+    EXPECT_EQ(hits_batch[i].index, hit_single.index);
+    EXPECT_EQ(hits_batch[i].dist, hit_single.dist);
+    if (hit_single.index != -1) {
+      EXPECT_EQ_ARRAY(hits_batch[i].co, hit_single.co, 3);
+      hits_found++;
+    }
+  }
+  /* Guard against the inputs degenerating into an all-miss (or all-hit) comparison. */
+  if (rays_len >= 100) {
+    EXPECT_GT(hits_found, 0);
+    EXPECT_LT(hits_found, rays_len);
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+  MEM_freeN(origins);
+  MEM_freeN(directions);
+  MEM_freeN(hits_batch);
+}
+
+TEST(kdopbvh, RayCastBatch_1)
+{
+  ray_cast_batch_test(100, 1, 0.0f, 1234);
+}
+/* Not a multiple of the packet size, exercises the partial last packet. */
+TEST(kdopbvh, RayCastBatch_5)
+{
+  ray_cast_batch_test(100, 5, 0.0f, 123);
+}
+TEST(kdopbvh, RayCastBatch_500)
+{
+  ray_cast_batch_test(500, 500, 0.0f, 12);
+}
+/* Sphere-cast takes the single-ray fallback path. */
+TEST(kdopbvh, RayCastBatchRadius_500)
+{
+  ray_cast_batch_test(500, 500, 0.1f, 12);
+}
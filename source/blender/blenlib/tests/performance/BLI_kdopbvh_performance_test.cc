@@ -0,0 +1,145 @@
+/* Apache License, Version 2.0 */
+
+#include "testing/testing.h"
+
+#include <float.h>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_utildefines.h"
+
+#include "BLI_kdopbvh.h"
+#include "BLI_math_vector.h"
+#include "BLI_rand.h"
+
+#include "PIL_time_utildefines.h"
+
+/* Random point clouds are enough to exercise build, refit and the query
+ * traversals, which is where BVH time goes for real meshes as well. */
+
+static float *gen_random_verts(const int verts_num, const uint seed)
+{
+  float *verts = (float *)MEM_mallocN(sizeof(float[3]) * (size_t)verts_num, __func__);
+  RNG *rng = BLI_rng_new(seed);
+  for (int i = 0; i < verts_num; i++) {
+    verts[i * 3 + 0] = BLI_rng_get_float(rng);
+    verts[i * 3 + 1] = BLI_rng_get_float(rng);
+    verts[i * 3 + 2] = BLI_rng_get_float(rng);
+  }
+  BLI_rng_free(rng);
+  return verts;
+}
+
+static BVHTree *build_tree(const float *verts, const int verts_num, const float epsilon)
+{
+  BVHTree *tree = BLI_bvhtree_new(verts_num, epsilon, 8, 6);
+  for (int i = 0; i < verts_num; i++) {
+    BLI_bvhtree_insert(tree, i, &verts[i * 3], 1);
+  }
+  BLI_bvhtree_balance(tree);
+  return tree;
+}
+
+static void kdopbvh_build_test(const char *id, const int verts_num)
+{
+  printf("\n========== STARTING %s ==========\n", id);
+
+  float *verts = gen_random_verts(verts_num, 42);
+  BVHTree *tree;
+
+  {
+    TIMEIT_START(build);
+    tree = build_tree(verts, verts_num, 0.0f);
+    TIMEIT_END(build);
+  }
+
+  {
+    TIMEIT_START(refit);
+    BLI_bvhtree_refit(tree);
+    TIMEIT_END(refit);
+  }
+
+  BLI_bvhtree_free(tree);
+  MEM_freeN(verts);
+
+  printf("========== ENDED %s ==========\n\n", id);
+}
+
+static void kdopbvh_find_nearest_test(const char *id, const int verts_num, const int queries_num)
+{
+  printf("\n========== STARTING %s ==========\n", id);
+
+  float *verts = gen_random_verts(verts_num, 42);
+  float *queries = gen_random_verts(queries_num, 7);
+  BVHTree *tree = build_tree(verts, verts_num, 0.0f);
+  int found = 0;
+
+  {
+    TIMEIT_START(find_nearest);
+    for (int i = 0; i < queries_num; i++) {
+      BVHTreeNearest nearest;
+      nearest.index = -1;
+      nearest.dist_sq = FLT_MAX;
+      if (BLI_bvhtree_find_nearest(tree, &queries[i * 3], &nearest, NULL, NULL) != -1) {
+        found++;
+      }
+    }
+    TIMEIT_END(find_nearest);
+  }
+  EXPECT_EQ(found, queries_num);
+
+  BLI_bvhtree_free(tree);
+  MEM_freeN(queries);
+  MEM_freeN(verts);
+
+  printf("========== ENDED %s ==========\n\n", id);
+}
+
+static void kdopbvh_overlap_test(const char *id, const int verts_num)
+{
+  printf("\n========== STARTING %s ==========\n", id);
+
+  float *verts_a = gen_random_verts(verts_num, 42);
+  float *verts_b = gen_random_verts(verts_num, 7);
+  /* A non-zero epsilon so the point trees actually overlap. */
+  BVHTree *tree_a = build_tree(verts_a, verts_num, 0.01f);
+  BVHTree *tree_b = build_tree(verts_b, verts_num, 0.01f);
+
+  {
+    uint overlap_tot = 0;
+    TIMEIT_START(overlap);
+    BVHTreeOverlap *overlap = BLI_bvhtree_overlap(tree_a, tree_b, &overlap_tot, NULL, NULL);
+    TIMEIT_END(overlap);
+    printf("overlap pairs: %u\n", overlap_tot);
+    if (overlap) {
+      MEM_freeN(overlap);
+    }
+  }
+
+  BLI_bvhtree_free(tree_b);
+  BLI_bvhtree_free(tree_a);
+  MEM_freeN(verts_b);
+  MEM_freeN(verts_a);
+
+  printf("========== ENDED %s ==========\n\n", id);
+}
+
+TEST(kdopbvh, Build100k)
+{
+  kdopbvh_build_test("BVHTree build/refit - 100000 verts", 100000);
+}
+
+TEST(kdopbvh, Build1000k)
+{
+  kdopbvh_build_test("BVHTree build/refit - 1000000 verts", 1000000);
+}
+
+TEST(kdopbvh, FindNearest100k)
+{
+  kdopbvh_find_nearest_test("BVHTree find_nearest - 100000 verts, 100000 queries", 100000, 100000);
+}
+
+TEST(kdopbvh, Overlap100k)
+{
+  kdopbvh_overlap_test("BVHTree overlap - 2 x 100000 verts", 100000);
+}
@@ -20,6 +20,8 @@
  * \brief defines for blend-file codes.
  */
 
+#include "BLI_sys_types.h"
+
 /* INTEGER CODES */
 #ifdef __BIG_ENDIAN__
 /* Big Endian */
@@ -71,3 +73,30 @@ enum {
 };
 
 #define BLEN_THUMB_MEMSIZE_FILE(_x, _y) (sizeof(int) * (2 + (size_t)(_x) * (size_t)(_y)))
+
+/**
+ * Entry of the optional data-block index appended past the #ENDB block, mapping ID names to the
+ * file offset of their first #BHead. This allows the file browser and asset system to seek
+ * straight to a data-block (its preview for example) instead of walking every block header in
+ * the file. Since readers stop at #ENDB, older versions of Blender simply ignore the index.
+ */
+typedef struct BlendFileIndexEntry {
+  /** Offset of the data-block's #BHead from the start of the (uncompressed) stream. */
+  uint64_t offset;
+  /** Full ID name, including the two character type prefix (#MAX_ID_NAME). */
+  char name[66];
+  char _pad[6];
+} BlendFileIndexEntry;
+
+/**
+ * Fixed size footer at the very end of the stream, directly preceded by the
+ * #BlendFileIndexEntry array. Stored in the endianness given by the file header,
+ * like everything else in the file.
+ */
+typedef struct BlendFileIndexFooter {
+  uint64_t num_entries;
+  /** #BLEND_FILE_INDEX_MAGIC (not null terminated). */
+  char magic[8];
+} BlendFileIndexFooter;
+
+#define BLEND_FILE_INDEX_MAGIC "BlendIdx"
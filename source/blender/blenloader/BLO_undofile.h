@@ -96,5 +96,9 @@ extern struct Main *BLO_memfile_main_get(struct MemFile *memfile,
                                          struct Main *bmain,
                                          struct Scene **r_scene);
 extern bool BLO_memfile_write_file(struct MemFile *memfile, const char *filename);
+extern void *BLO_memfile_flatten(const MemFile *memfile, size_t *r_buffer_size);
+extern bool BLO_memfile_buffer_write_file(const void *buffer,
+                                          size_t buffer_size,
+                                          const char *filename);
 
 FileReader *BLO_memfile_new_filereader(MemFile *memfile, int undo_direction);
@@ -258,6 +258,36 @@ static BHead *blo_blendhandle_read_preview_rects(FileData *fd,
   return bhead;
 }
 
+/**
+ * Read the #PreviewImage stored in the blocks following the ID block \a id_bhead
+ * (if the ID has one).
+ */
+static PreviewImage *blo_blendhandle_read_preview(FileData *fd,
+                                                  BHead *id_bhead,
+                                                  const int sdna_preview_image)
+{
+  for (BHead *bhead = blo_bhead_next(fd, id_bhead); bhead; bhead = blo_bhead_next(fd, bhead)) {
+    if (bhead->code != DATA) {
+      /* We were looking for a preview image, but didn't find any belonging to block. So it doesn't
+       * exist. */
+      break;
+    }
+    if (bhead->SDNAnr == sdna_preview_image) {
+      PreviewImage *preview_from_file = BLO_library_read_struct(fd, bhead, "PreviewImage");
+
+      if (preview_from_file == NULL) {
+        break;
+      }
+
+      PreviewImage *result = MEM_dupallocN(preview_from_file);
+      bhead = blo_blendhandle_read_preview_rects(fd, bhead, result, preview_from_file);
+      MEM_freeN(preview_from_file);
+      return result;
+    }
+  }
+  return NULL;
+}
+
 /**
  * Get the PreviewImage of a single data block in a file.
  * (e.g. all the scene previews in a file).
@@ -272,35 +302,32 @@ PreviewImage *BLO_blendhandle_get_preview_for_id(BlendHandle *bh,
                                                  const char *name)
 {
   FileData *fd = (FileData *)bh;
-  bool looking = false;
   const int sdna_preview_image = DNA_struct_find_nr(fd->filesdna, "PreviewImage");
 
-  for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
-    if (bhead->code == DATA) {
-      if (looking && bhead->SDNAnr == sdna_preview_image) {
-        PreviewImage *preview_from_file = BLO_library_read_struct(fd, bhead, "PreviewImage");
-
-        if (preview_from_file == NULL) {
-          break;
-        }
+  /* Try the data-block index written along with the file first, a couple of seeks instead of
+   * walking every block header in the file (which is what makes indexing big asset libraries
+   * I/O bound). Falls back to the scan below for files without an index. */
+  char idname_full[MAX_ID_NAME];
+  *((short *)idname_full) = (short)ofblocktype;
+  BLI_strncpy(idname_full + 2, name, sizeof(idname_full) - 2);
+
+  BHead *bhead = blo_bhead_from_index(fd, idname_full);
+  if (bhead != NULL) {
+    PreviewImage *result = blo_blendhandle_read_preview(fd, bhead, sdna_preview_image);
+    blo_bhead_cache_reset(fd);
+    return result;
+  }
 
-        PreviewImage *result = MEM_dupallocN(preview_from_file);
-        bhead = blo_blendhandle_read_preview_rects(fd, bhead, result, preview_from_file);
-        MEM_freeN(preview_from_file);
-        return result;
-      }
-    }
-    else if (looking || bhead->code == ENDB) {
-      /* We were looking for a preview image, but didn't find any belonging to block. So it doesn't
-       * exist. */
-      break;
-    }
-    else if (bhead->code == ofblocktype) {
+  for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+    if (bhead->code == ofblocktype) {
       const char *idname = blo_bhead_id_name(fd, bhead);
       if (STREQ(&idname[2], name)) {
-        looking = true;
+        return blo_blendhandle_read_preview(fd, bhead, sdna_preview_image);
       }
     }
+    else if (bhead->code == ENDB) {
+      break;
+    }
   }
 
   return NULL;
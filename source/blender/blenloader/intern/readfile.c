@@ -998,6 +998,110 @@ static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
 }
 #endif /* USE_BHEAD_READ_ON_DEMAND */
 
+/**
+ * Read the optional data-block index appended past the #ENDB block (see #BlendFileIndexEntry),
+ * making it available to #blo_bhead_from_index.
+ *
+ * \return false when the file has no (valid) index, or cannot seek.
+ */
+static bool blo_filedata_index_ensure(FileData *fd)
+{
+  if (fd->index_checked) {
+    return fd->index_entries != NULL;
+  }
+  fd->index_checked = true;
+
+  if (fd->file->seek == NULL || (fd->flags & FD_FLAGS_IS_MEMFILE)) {
+    return false;
+  }
+
+  const off64_t offset_backup = fd->file->offset;
+  const off64_t file_size = fd->file->seek(fd->file, 0, SEEK_END);
+
+  BlendFileIndexFooter footer;
+  if (file_size >= (off64_t)sizeof(footer) &&
+      fd->file->seek(fd->file, file_size - (off64_t)sizeof(footer), SEEK_SET) != -1 &&
+      fd->file->read(fd->file, &footer, sizeof(footer)) == (ssize_t)sizeof(footer) &&
+      memcmp(footer.magic, BLEND_FILE_INDEX_MAGIC, sizeof(footer.magic)) == 0) {
+    if (fd->flags & FD_FLAGS_SWITCH_ENDIAN) {
+      BLI_endian_switch_uint64(&footer.num_entries);
+    }
+    /* Bound the entry count before multiplying, a malformed footer must not wrap the size
+     * computation (or the `int` cast below) into a short allocation. */
+    const uint64_t num_entries_max = ((uint64_t)file_size - sizeof(footer)) /
+                                     sizeof(BlendFileIndexEntry);
+    if (footer.num_entries > 0 && footer.num_entries <= num_entries_max &&
+        footer.num_entries <= INT_MAX) {
+      const uint64_t entries_len = footer.num_entries * sizeof(BlendFileIndexEntry);
+      BlendFileIndexEntry *entries = MEM_mallocN((size_t)entries_len, "blend file index");
+      if (fd->file->seek(
+              fd->file, file_size - (off64_t)(sizeof(footer) + entries_len), SEEK_SET) != -1 &&
+          fd->file->read(fd->file, entries, (size_t)entries_len) == (ssize_t)entries_len) {
+        if (fd->flags & FD_FLAGS_SWITCH_ENDIAN) {
+          for (uint64_t i = 0; i < footer.num_entries; i++) {
+            BLI_endian_switch_uint64(&entries[i].offset);
+          }
+        }
+        fd->index_entries = entries;
+        fd->index_num_entries = (int)footer.num_entries;
+      }
+      else {
+        MEM_freeN(entries);
+      }
+    }
+  }
+
+  fd->file->seek(fd->file, offset_backup, SEEK_SET);
+  return fd->index_entries != NULL;
+}
+
+/**
+ * Seek straight to the #BHead of the data-block \a idname_full (full name including the two
+ * character type prefix), using the index footer written along with the file. Iterating from
+ * the returned #BHead with #blo_bhead_next works as usual.
+ *
+ * \warning This invalidates the cached block list: any previously returned #BHead is freed, and
+ * iteration from #blo_bhead_first only becomes meaningful again after #blo_bhead_cache_reset.
+ *
+ * \return NULL when the file has no index or no such data-block.
+ */
+BHead *blo_bhead_from_index(FileData *fd, const char *idname_full)
+{
+  /* The idname hash stores pointers into the cached block list which is invalidated below,
+   * don't mix the two (the hash is only used while linking libraries anyway). */
+  if (fd->bhead_idname_hash != NULL) {
+    return NULL;
+  }
+  if (!blo_filedata_index_ensure(fd)) {
+    return NULL;
+  }
+
+  for (int i = 0; i < fd->index_num_entries; i++) {
+    const BlendFileIndexEntry *entry = &fd->index_entries[i];
+    if (STREQ(entry->name, idname_full)) {
+      BLI_freelistN(&fd->bhead_list);
+      fd->is_eof = false;
+      if (fd->file->seek(fd->file, (off64_t)entry->offset, SEEK_SET) == -1) {
+        return NULL;
+      }
+      /* The cached list is empty, so this reads the block at the entry's offset. */
+      return blo_bhead_first(fd);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Restore sequential iteration from #blo_bhead_first after #blo_bhead_from_index invalidated
+ * the cached block list (block headers get re-read from the start of the file).
+ */
+void blo_bhead_cache_reset(FileData *fd)
+{
+  BLI_freelistN(&fd->bhead_list);
+  fd->is_eof = false;
+  fd->file->seek(fd->file, SIZEOFBLENDERHEADER, SEEK_SET);
+}
+
 /* Warning! Caller's responsibility to ensure given bhead **is** an ID one! */
 const char *blo_bhead_id_name(const FileData *fd, const BHead *bhead)
 {
@@ -1395,6 +1499,9 @@ void blo_filedata_free(FileData *fd)
     if (fd->bheadmap) {
       MEM_freeN(fd->bheadmap);
     }
+    if (fd->index_entries) {
+      MEM_freeN(fd->index_entries);
+    }
 
 #ifdef USE_GHASH_BHEAD
     if (fd->bhead_idname_hash) {
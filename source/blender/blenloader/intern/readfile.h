@@ -111,6 +111,13 @@ typedef struct FileData {
   struct BHeadSort *bheadmap;
   int tot_bheadmap;
 
+  /** Optional data-block index read from the index footer (see #BlendFileIndexEntry),
+   * NULL when the file was written without one. */
+  struct BlendFileIndexEntry *index_entries;
+  int index_num_entries;
+  /** Avoid searching the footer more than once. */
+  bool index_checked;
+
   /** See: #USE_GHASH_BHEAD. */
   struct GHash *bhead_idname_hash;
 
@@ -157,6 +164,9 @@ BHead *blo_bhead_first(FileData *fd);
 BHead *blo_bhead_next(FileData *fd, BHead *thisblock);
 BHead *blo_bhead_prev(FileData *fd, BHead *thisblock);
 
+BHead *blo_bhead_from_index(FileData *fd, const char *idname_full);
+void blo_bhead_cache_reset(FileData *fd);
+
 const char *blo_bhead_id_name(const FileData *fd, const BHead *bhead);
 struct AssetMetaData *blo_bhead_id_asset_data_address(const FileData *fd, const BHead *bhead);
 
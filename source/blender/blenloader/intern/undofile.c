@@ -24,6 +24,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -42,6 +43,7 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
+#include "BLI_utildefines.h"
 
 #include "BLO_readfile.h"
 #include "BLO_undofile.h"
@@ -217,13 +219,12 @@ struct Main *BLO_memfile_main_get(struct MemFile *memfile,
 }
 
 /**
- * Saves .blend using undo buffer.
+ * Shared between #BLO_memfile_write_file and #BLO_memfile_buffer_write_file.
  *
- * \return success.
+ * \return the file descriptor, or -1 on failure (with the error printed to stderr).
  */
-bool BLO_memfile_write_file(struct MemFile *memfile, const char *filename)
+static int memfile_write_open(const char *filename)
 {
-  MemFileChunk *chunk;
   int file, oflags;
 
   /* NOTE: This is currently used for autosave and 'quit.blend',
@@ -249,6 +250,22 @@ bool BLO_memfile_write_file(struct MemFile *memfile, const char *filename)
             "Unable to save '%s': %s\n",
             filename,
             errno ? strerror(errno) : "Unknown error opening file");
+  }
+  return file;
+}
+
+/**
+ * Saves .blend using undo buffer.
+ *
+ * \return success.
+ */
+bool BLO_memfile_write_file(struct MemFile *memfile, const char *filename)
+{
+  MemFileChunk *chunk;
+  int file;
+
+  file = memfile_write_open(filename);
+  if (file == -1) {
     return false;
   }
 
@@ -275,6 +292,71 @@ bool BLO_memfile_write_file(struct MemFile *memfile, const char *filename)
   return true;
 }
 
+/**
+ * Copies the entire contents of \a memfile into a single newly allocated buffer,
+ * so it can be written to disk without keeping a reference to the undo data
+ * (which may be freed or modified while a background write is in progress).
+ *
+ * \return the buffer (to be freed by the caller), its size in \a r_buffer_size.
+ */
+void *BLO_memfile_flatten(const MemFile *memfile, size_t *r_buffer_size)
+{
+  char *buffer = MEM_mallocN(memfile->size, __func__);
+  size_t offset = 0;
+
+  for (MemFileChunk *chunk = memfile->chunks.first; chunk; chunk = chunk->next) {
+    memcpy(buffer + offset, chunk->buf, chunk->size);
+    offset += chunk->size;
+  }
+  BLI_assert(offset == memfile->size);
+
+  *r_buffer_size = offset;
+  return buffer;
+}
+
+/**
+ * Writes a flattened memfile buffer (see #BLO_memfile_flatten) to disk.
+ * Unlike #BLO_memfile_write_file this is safe to call from a thread,
+ * since the buffer is not shared with the undo system.
+ *
+ * \return success.
+ */
+bool BLO_memfile_buffer_write_file(const void *buffer, size_t buffer_size, const char *filename)
+{
+  int file = memfile_write_open(filename);
+  if (file == -1) {
+    return false;
+  }
+
+  const char *ptr = buffer;
+  size_t remaining = buffer_size;
+  while (remaining > 0) {
+    /* Write in bounded steps, `write()` cannot take more than INT_MAX on some platforms. */
+#ifdef _WIN32
+    const uint write_size = (uint)MIN2(remaining, (size_t)INT_MAX);
+#else
+    const size_t write_size = remaining;
+#endif
+    const ssize_t written = write(file, ptr, write_size);
+    if (written <= 0) {
+      break;
+    }
+    ptr += written;
+    remaining -= (size_t)written;
+  }
+
+  close(file);
+
+  if (remaining != 0) {
+    fprintf(stderr,
+            "Unable to save '%s': %s\n",
+            filename,
+            errno ? strerror(errno) : "Unknown error writing file");
+    return false;
+  }
+  return true;
+}
+
 static ssize_t undo_read(FileReader *reader, void *buffer, size_t size)
 {
   UndoReader *undo = (UndoReader *)reader;
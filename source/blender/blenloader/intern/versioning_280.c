@@ -3423,7 +3423,9 @@ void blo_do_versions_280(FileData *fd, Library *UNUSED(lib), Main *bmain)
             }
             case SPACE_NODE: {
               SpaceNode *snode = (SpaceNode *)sl;
-              snode->flag &= ~(SNODE_FLAG_UNUSED_6 | SNODE_FLAG_UNUSED_10 | SNODE_FLAG_UNUSED_11);
+              /* NOTE: (1 << 6) was never saved in files and is now reused as
+               * #SNODE_SHOW_TIMINGS, so it's still cleared here by value. */
+              snode->flag &= ~((1 << 6) | SNODE_FLAG_UNUSED_10 | SNODE_FLAG_UNUSED_11);
               break;
             }
             case SPACE_PROPERTIES: {
@@ -182,11 +182,16 @@ struct WriteWrap {
   int file_handle;
   struct {
     ListBase threadpool;
+    ListBase writer_threadpool;
     ListBase tasks;
+    /** Compressed frames handed over by workers, consumed by the writer thread. */
+    ListBase compressed_blocks;
     ThreadMutex mutex;
     ThreadCondition condition;
     int next_frame;
     int num_frames;
+    /** Set on close once all workers finished, makes the writer thread exit. */
+    bool compression_finished;
 
     int level;
     ListBase frames;
@@ -228,6 +233,15 @@ typedef struct {
   WriteWrap *ww;
 } ZstdWriteBlockTask;
 
+typedef struct ZstdCompressedBlock {
+  struct ZstdCompressedBlock *next, *prev;
+  void *data;
+  /** Zero when compression of this frame failed. */
+  size_t compressed_size;
+  size_t uncompressed_size;
+  int frame_number;
+} ZstdCompressedBlock;
+
 static void *zstd_write_task(void *userdata)
 {
   ZstdWriteBlockTask *task = userdata;
@@ -240,33 +254,72 @@ static void *zstd_write_task(void *userdata)
 
   MEM_freeN(task->data);
 
+  ZstdCompressedBlock *block = MEM_mallocN(sizeof(ZstdCompressedBlock), "Zstd compressed block");
+  block->data = out_buf;
+  block->compressed_size = ZSTD_isError(out_size) ? 0 : out_size;
+  block->uncompressed_size = task->size;
+  block->frame_number = task->frame_number;
+
+  /* Hand the block over to the writer thread. Unlike writing it here, this doesn't block the
+   * worker until all earlier frames have hit the disk, so it's free for the next frame. */
   BLI_mutex_lock(&ww->zstd.mutex);
+  BLI_addtail(&ww->zstd.compressed_blocks, block);
+  BLI_mutex_unlock(&ww->zstd.mutex);
+  BLI_condition_notify_all(&ww->zstd.condition);
 
-  while (ww->zstd.next_frame != task->frame_number) {
-    BLI_condition_wait(&ww->zstd.condition, &ww->zstd.mutex);
-  }
+  return NULL;
+}
 
-  if (ZSTD_isError(out_size)) {
-    ww->zstd.write_error = true;
+/* Workers push blocks in compression order, find the one that's next in the stream. */
+static ZstdCompressedBlock *zstd_writer_pop_next_block(WriteWrap *ww)
+{
+  LISTBASE_FOREACH (ZstdCompressedBlock *, block, &ww->zstd.compressed_blocks) {
+    if (block->frame_number == ww->zstd.next_frame) {
+      BLI_remlink(&ww->zstd.compressed_blocks, block);
+      return block;
+    }
   }
-  else {
-    if (ww_write_none(ww, out_buf, out_size) == out_size) {
+  return NULL;
+}
+
+static void *zstd_writer_task(void *userdata)
+{
+  WriteWrap *ww = userdata;
+
+  BLI_mutex_lock(&ww->zstd.mutex);
+  while (true) {
+    ZstdCompressedBlock *block = zstd_writer_pop_next_block(ww);
+    if (block == NULL) {
+      if (ww->zstd.compression_finished) {
+        break;
+      }
+      BLI_condition_wait(&ww->zstd.condition, &ww->zstd.mutex);
+      continue;
+    }
+    BLI_mutex_unlock(&ww->zstd.mutex);
+
+    /* Write outside of the mutex, workers only need it to push new blocks. */
+    bool success = (block->compressed_size != 0) && !ww->zstd.write_error;
+    if (success) {
+      success = ww_write_none(ww, block->data, block->compressed_size) == block->compressed_size;
+    }
+    if (success) {
       ZstdFrame *frameinfo = MEM_mallocN(sizeof(ZstdFrame), "zstd frameinfo");
-      frameinfo->uncompressed_size = task->size;
-      frameinfo->compressed_size = out_size;
+      frameinfo->uncompressed_size = block->uncompressed_size;
+      frameinfo->compressed_size = block->compressed_size;
       BLI_addtail(&ww->zstd.frames, frameinfo);
     }
-    else {
+    MEM_freeN(block->data);
+    MEM_freeN(block);
+
+    BLI_mutex_lock(&ww->zstd.mutex);
+    if (!success) {
       ww->zstd.write_error = true;
     }
+    ww->zstd.next_frame++;
   }
-
-  ww->zstd.next_frame++;
-
   BLI_mutex_unlock(&ww->zstd.mutex);
-  BLI_condition_notify_all(&ww->zstd.condition);
 
-  MEM_freeN(out_buf);
   return NULL;
 }
 
@@ -282,6 +335,10 @@ static bool ww_open_zstd(WriteWrap *ww, const char *filepath)
   BLI_mutex_init(&ww->zstd.mutex);
   BLI_condition_init(&ww->zstd.condition);
 
+  /* The writer thread is mostly I/O bound, so it's not counted towards the workers. */
+  BLI_threadpool_init(&ww->zstd.writer_threadpool, zstd_writer_task, 1);
+  BLI_threadpool_insert(&ww->zstd.writer_threadpool, ww);
+
   return true;
 }
 
@@ -328,9 +385,17 @@ static void zstd_write_seekable_frames(WriteWrap *ww)
 
 static bool ww_close_zstd(WriteWrap *ww)
 {
+  /* First wait for the compression workers, then let the writer thread catch up with the
+   * remaining frames. */
   BLI_threadpool_end(&ww->zstd.threadpool);
   BLI_freelistN(&ww->zstd.tasks);
 
+  BLI_mutex_lock(&ww->zstd.mutex);
+  ww->zstd.compression_finished = true;
+  BLI_mutex_unlock(&ww->zstd.mutex);
+  BLI_condition_notify_all(&ww->zstd.condition);
+  BLI_threadpool_end(&ww->zstd.writer_threadpool);
+
   BLI_mutex_end(&ww->zstd.mutex);
   BLI_condition_end(&ww->zstd.condition);
 
@@ -426,6 +491,18 @@ typedef struct {
   size_t write_len;
 #endif
 
+  /** Offset in the (uncompressed) stream where the next #mywrite will land,
+   * used to record data-block offsets for the index footer. */
+  size_t stream_offset;
+
+  /** Data-block index entries collected while writing, written as the index footer
+   * (see #BlendFileIndexEntry). Not used for undo. */
+  struct {
+    BlendFileIndexEntry *entries;
+    uint num_entries;
+    uint num_alloc;
+  } index;
+
   /** Set on unlikely case of an error (ignores further file writing). */
   bool error;
 
@@ -500,6 +577,9 @@ static void writedata_free(WriteData *wd)
   if (wd->buffer.buf) {
     MEM_freeN(wd->buffer.buf);
   }
+  if (wd->index.entries) {
+    MEM_freeN(wd->index.entries);
+  }
   MEM_freeN(wd);
 }
 
@@ -540,6 +620,7 @@ static void mywrite(WriteData *wd, const void *adr, size_t len)
 #ifdef USE_WRITE_DATA_LEN
   wd->write_len += len;
 #endif
+  wd->stream_offset += len;
 
   if (wd->buffer.buf == NULL) {
     writedata_do_write(wd, adr, len);
@@ -1087,6 +1168,47 @@ static void write_thumb(WriteData *wd, const BlendThumbnail *thumb)
  * \{ */
 
 /* if MemFile * there's filesave to memory */
+BLI_STATIC_ASSERT(sizeof(BlendFileIndexEntry) == 80, "Index entry layout changed")
+
+/**
+ * Record the stream offset where the #BHead of \a id is about to be written,
+ * for the index footer (see #BlendFileIndexEntry).
+ */
+static void write_file_index_entry_add(WriteData *wd, const ID *id)
+{
+  if (wd->index.num_entries == wd->index.num_alloc) {
+    wd->index.num_alloc = MAX2(wd->index.num_alloc * 2, 1024);
+    wd->index.entries = MEM_reallocN(wd->index.entries,
+                                     sizeof(*wd->index.entries) * wd->index.num_alloc);
+  }
+
+  BlendFileIndexEntry *entry = &wd->index.entries[wd->index.num_entries++];
+  /* Zero the entry so no uninitialized bytes (name tail, padding) end up in the file. */
+  memset(entry, 0, sizeof(*entry));
+  entry->offset = (uint64_t)wd->stream_offset;
+  BLI_strncpy(entry->name, id->name, sizeof(entry->name));
+}
+
+/**
+ * Append the data-block index past the #ENDB block, so readers which only look for a single
+ * data-block (preview extraction for the file browser and asset system) can seek to it directly
+ * instead of walking every block header. Readers stop at #ENDB, so older versions of Blender
+ * ignore the index entirely. See #BlendFileIndexEntry for the layout.
+ */
+static void write_file_index(WriteData *wd)
+{
+  if (wd->index.num_entries == 0) {
+    return;
+  }
+
+  mywrite(wd, wd->index.entries, sizeof(*wd->index.entries) * wd->index.num_entries);
+
+  BlendFileIndexFooter footer;
+  footer.num_entries = wd->index.num_entries;
+  memcpy(footer.magic, BLEND_FILE_INDEX_MAGIC, sizeof(footer.magic));
+  mywrite(wd, &footer, sizeof(footer));
+}
+
 static bool write_file_handle(Main *mainvar,
                               WriteWrap *ww,
                               MemFile *compare,
@@ -1193,6 +1315,10 @@ static bool write_file_handle(Main *mainvar,
 
         mywrite_id_begin(wd, id);
 
+        if (!wd->use_memfile) {
+          write_file_index_entry_add(wd, id);
+        }
+
         memcpy(id_buffer, id, idtype_struct_size);
 
         /* Clear runtime data to reduce false detection of changed data in undo/redo context. */
@@ -1259,6 +1385,10 @@ static bool write_file_handle(Main *mainvar,
   bhead.code = ENDB;
   mywrite(wd, &bhead, sizeof(BHead));
 
+  if (!wd->use_memfile) {
+    write_file_index(wd);
+  }
+
   blo_join_main(&mainlist);
 
   return mywrite_end(wd);
@@ -0,0 +1,77 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#include "COM_BufferCache.h"
+
+namespace blender::compositor {
+
+/** Maximum amount of memory used by cached buffers. */
+constexpr int64_t BUFFERS_BYTES_MAX = 256 * 1024 * 1024;
+
+BufferCache &BufferCache::get()
+{
+  static BufferCache instance;
+  return instance;
+}
+
+MemoryBuffer *BufferCache::get_buffer(size_t key)
+{
+  std::lock_guard lock(mutex_);
+  for (CachedBuffer &cached : buffers_) {
+    if (cached.key == key) {
+      return new MemoryBuffer(*cached.buffer);
+    }
+  }
+  return nullptr;
+}
+
+void BufferCache::put_buffer(size_t key, const MemoryBuffer &buffer)
+{
+  const int64_t bytes = buffer_bytes(buffer);
+  if (bytes > BUFFERS_BYTES_MAX) {
+    return;
+  }
+
+  std::lock_guard lock(mutex_);
+  for (const CachedBuffer &cached : buffers_) {
+    if (cached.key == key) {
+      return;
+    }
+  }
+  while (buffers_bytes_ + bytes > BUFFERS_BYTES_MAX) {
+    buffers_bytes_ -= buffer_bytes(*buffers_.first().buffer);
+    buffers_.remove(0);
+  }
+  buffers_.append({key, std::make_unique<MemoryBuffer>(buffer)});
+  buffers_bytes_ += bytes;
+}
+
+void BufferCache::clear()
+{
+  std::lock_guard lock(mutex_);
+  buffers_.clear();
+  buffers_bytes_ = 0;
+}
+
+int64_t BufferCache::buffer_bytes(const MemoryBuffer &buffer)
+{
+  return (int64_t)buffer.get_memory_width() * buffer.get_memory_height() *
+         buffer.get_elem_bytes_len();
+}
+
+}  // namespace blender::compositor
@@ -0,0 +1,72 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include "BLI_vector.hh"
+
+#include "COM_MemoryBuffer.h"
+
+#ifdef WITH_CXX_GUARDEDALLOC
+#  include "MEM_guardedalloc.h"
+#endif
+
+namespace blender::compositor {
+
+/**
+ * Cache of operations rendered buffers kept across executions. Buffers are keyed by a hash of the
+ * operation parameters and its full chain of inputs, so a cached buffer may only be reused when
+ * re-rendering the operation would produce the exact same result (see
+ * `FullFrameExecutionModel::operation_cache_key`). Entries are evicted oldest first once the
+ * cache exceeds its memory budget.
+ */
+class BufferCache {
+ private:
+  struct CachedBuffer {
+    size_t key;
+    std::unique_ptr<MemoryBuffer> buffer;
+  };
+
+  /** Cached buffers in insertion order (oldest first). */
+  Vector<CachedBuffer> buffers_;
+  int64_t buffers_bytes_ = 0;
+  std::mutex mutex_;
+
+ public:
+  static BufferCache &get();
+
+  /**
+   * Get a copy (owned by the caller) of the buffer cached for given key. Returns nullptr when
+   * there is no cached buffer.
+   */
+  MemoryBuffer *get_buffer(size_t key);
+  void put_buffer(size_t key, const MemoryBuffer &buffer);
+  void clear();
+
+ private:
+  static int64_t buffer_bytes(const MemoryBuffer &buffer);
+
+#ifdef WITH_CXX_GUARDEDALLOC
+  MEM_CXX_CLASS_ALLOC_FUNCS("COM:BufferCache")
+#endif
+};
+
+}  // namespace blender::compositor
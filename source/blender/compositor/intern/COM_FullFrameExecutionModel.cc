@@ -17,6 +17,8 @@
  */
 
 #include "COM_FullFrameExecutionModel.h"
+#include "COM_BufferCache.h"
+#include "COM_ConstantOperation.h"
 #include "COM_Debug.h"
 #include "COM_ExecutionGroup.h"
 #include "COM_ReadBufferOperation.h"
@@ -53,9 +55,87 @@ void FullFrameExecutionModel::execute(ExecutionSystem &exec_system)
   DebugInfo::graphviz(&exec_system, "compositor_prior_rendering");
 
   determine_areas_to_render_and_reads();
+  determine_content_hashes();
   render_operations();
 }
 
+void FullFrameExecutionModel::determine_content_hashes()
+{
+  for (NodeOperation *op : operations_) {
+    operation_content_hash(op);
+  }
+}
+
+/**
+ * Hash that identifies the operation result across executions: the operation type and parameters
+ * hashes combined with the content hashes of the full chain of inputs. Returns `std::nullopt`
+ * when the operation or any non-constant input doesn't implement `hash_output_params`.
+ */
+std::optional<size_t> FullFrameExecutionModel::operation_content_hash(NodeOperation *op)
+{
+  if (const std::optional<size_t> *hash = content_hashes_.lookup_ptr(op)) {
+    return *hash;
+  }
+  /* Operations form a DAG, but guard against cycles anyway as recursion depends on it. */
+  content_hashes_.add(op, std::nullopt);
+
+  const std::optional<NodeOperationHash> op_hash = op->generate_hash();
+  if (!op_hash) {
+    return std::nullopt;
+  }
+
+  size_t hash = get_default_hash_2(op_hash->get_type_hash(), op_hash->get_params_hash());
+  const int num_inputs = op->getNumberOfInputSockets();
+  for (int i = 0; i < num_inputs; i++) {
+    NodeOperation *input_op = op->get_input_operation(i);
+    if (input_op->get_flags().is_constant_operation) {
+      /* Constant inputs are hashed by value so that operations only fed different constants
+       * (e.g. a tweaked slider) get different hashes. */
+      const float *elem = ((ConstantOperation *)input_op)->get_constant_elem();
+      const int num_channels = COM_data_type_num_channels(op->getInputSocket(i)->getDataType());
+      for (int ch = 0; ch < num_channels; ch++) {
+        hash = get_default_hash_2(hash, get_default_hash(elem[ch]));
+      }
+    }
+    else {
+      const std::optional<size_t> input_hash = operation_content_hash(input_op);
+      if (!input_hash) {
+        return std::nullopt;
+      }
+      hash = get_default_hash_2(hash, *input_hash);
+    }
+  }
+
+  content_hashes_.add_overwrite(op, hash);
+  return hash;
+}
+
+/**
+ * Key identifying the buffer rendered for given operation areas across executions. Returns
+ * `std::nullopt` for operations that may not be cached: operations with side effects and
+ * operations without a content hash.
+ */
+std::optional<size_t> FullFrameExecutionModel::operation_cache_key(NodeOperation *op,
+                                                                  Span<rcti> areas)
+{
+  if (op->isOutputOperation(context_.isRendering()) || op->get_flags().is_constant_operation) {
+    return std::nullopt;
+  }
+  const std::optional<size_t> content_hash = content_hashes_.lookup_default(op, std::nullopt);
+  if (!content_hash) {
+    return std::nullopt;
+  }
+
+  /* Only rendered areas have valid buffer contents, fold them into the key so a cached buffer is
+   * only reused when it covers the same areas. */
+  size_t key = *content_hash;
+  for (const rcti &area : areas) {
+    key = get_default_hash_2(key, get_default_hash_2(area.xmin, area.xmax));
+    key = get_default_hash_2(key, get_default_hash_2(area.ymin, area.ymax));
+  }
+  return key;
+}
+
 void FullFrameExecutionModel::determine_areas_to_render_and_reads()
 {
   const bool is_rendering = context_.isRendering();
@@ -97,17 +177,29 @@ MemoryBuffer *FullFrameExecutionModel::create_operation_buffer(NodeOperation *op
 
 void FullFrameExecutionModel::render_operation(NodeOperation *op)
 {
-  Vector<MemoryBuffer *> input_bufs = get_input_buffers(op);
-
   const bool has_outputs = op->getNumberOfOutputSockets() > 0;
-  MemoryBuffer *op_buf = has_outputs ? create_operation_buffer(op) : nullptr;
+  MemoryBuffer *op_buf = nullptr;
   if (op->getWidth() > 0 && op->getHeight() > 0) {
     Span<rcti> areas = active_buffers_.get_areas_to_render(op);
-    op->render(op_buf, areas, input_bufs);
-    DebugInfo::operation_rendered(op, op_buf);
+    const std::optional<size_t> cache_key = operation_cache_key(op, areas);
+    if (cache_key) {
+      op_buf = BufferCache::get().get_buffer(*cache_key);
+    }
+    if (op_buf == nullptr) {
+      Vector<MemoryBuffer *> input_bufs = get_input_buffers(op);
+      op_buf = has_outputs ? create_operation_buffer(op) : nullptr;
+      op->render(op_buf, areas, input_bufs);
+      DebugInfo::operation_rendered(op, op_buf);
+      if (cache_key && op_buf != nullptr && !op_buf->is_a_single_elem()) {
+        BufferCache::get().put_buffer(*cache_key, *op_buf);
+      }
+    }
+  }
+  else if (has_outputs) {
+    /* Even if operation has no resolution set the empty buffer. It will be clipped with a
+     * TranslateOperation from convert resolutions if linked to an operation with resolution. */
+    op_buf = create_operation_buffer(op);
   }
-  /* Even if operation has no resolution set the empty buffer. It will be clipped with a
-   * TranslateOperation from convert resolutions if linked to an operation with resolution. */
   active_buffers_.set_rendered_buffer(op, std::unique_ptr<MemoryBuffer>(op_buf));
 
   operation_finished(op);
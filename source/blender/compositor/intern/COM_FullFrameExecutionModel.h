@@ -18,6 +18,10 @@
 
 #pragma once
 
+#include <optional>
+
+#include "BLI_map.hh"
+
 #include "COM_ExecutionModel.h"
 
 #ifdef WITH_CXX_GUARDEDALLOC
@@ -50,6 +54,12 @@ class FullFrameExecutionModel : public ExecutionModel {
    */
   Vector<eCompositorPriority> priorities_;
 
+  /**
+   * Hashes identifying operations results across executions, used for caching rendered buffers.
+   * Operations that can't be hashed map to `std::nullopt`.
+   */
+  Map<NodeOperation *, std::optional<size_t>> content_hashes_;
+
  public:
   FullFrameExecutionModel(CompositorContext &context,
                           SharedOperationBuffers &shared_buffers,
@@ -59,6 +69,9 @@ class FullFrameExecutionModel : public ExecutionModel {
 
  private:
   void determine_areas_to_render_and_reads();
+  void determine_content_hashes();
+  std::optional<size_t> operation_content_hash(NodeOperation *op);
+  std::optional<size_t> operation_cache_key(NodeOperation *op, Span<rcti> areas);
   void render_operations();
   void render_output_dependencies(NodeOperation *output_op);
   Vector<MemoryBuffer *> get_input_buffers(NodeOperation *op);
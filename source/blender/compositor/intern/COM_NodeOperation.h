@@ -287,6 +287,16 @@ struct NodeOperationHash {
     return operation_;
   }
 
+  size_t get_type_hash() const
+  {
+    return type_hash_;
+  }
+
+  size_t get_params_hash() const
+  {
+    return params_hash_;
+  }
+
   bool operator==(const NodeOperationHash &other) const
   {
     return type_hash_ == other.type_hash_ && parents_hash_ == other.parents_hash_ &&
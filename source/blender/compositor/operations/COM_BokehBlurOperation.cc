@@ -20,6 +20,7 @@
 #include "COM_ConstantOperation.h"
 
 #include "BLI_math.h"
+#include "BLI_simd.h"
 #include "COM_OpenCLDevice.h"
 
 #include "RE_pipeline.h"
@@ -92,13 +93,13 @@ void BokehBlurOperation::initExecution()
 
 void BokehBlurOperation::executePixel(float output[4], int x, int y, void *data)
 {
-  float color_accum[4];
+  float ATTR_ALIGN(16) color_accum[4];
   float tempBoundingBox[4];
-  float bokeh[4];
+  float ATTR_ALIGN(16) bokeh[4];
 
   this->m_inputBoundingBoxReader->readSampled(tempBoundingBox, x, y, PixelSampler::Nearest);
   if (tempBoundingBox[0] > 0.0f) {
-    float multiplier_accum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float ATTR_ALIGN(16) multiplier_accum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
     MemoryBuffer *inputBuffer = (MemoryBuffer *)data;
     const rcti &input_rect = inputBuffer->get_rect();
     float *buffer = inputBuffer->getBuffer();
@@ -129,6 +130,10 @@ void BokehBlurOperation::executePixel(float output[4], int x, int y, void *data)
     int offsetadd = getOffsetAdd() * COM_DATA_TYPE_COLOR_CHANNELS;
 
     float m = this->m_bokehDimension / pixelSize;
+#ifdef BLI_HAVE_SSE2
+    __m128 accum_color = _mm_load_ps(color_accum);
+    __m128 accum_mult = _mm_load_ps(multiplier_accum);
+#endif
     for (int ny = miny; ny < maxy; ny += step) {
       int bufferindex = ((minx - bufferstartx) * COM_DATA_TYPE_COLOR_CHANNELS) +
                         ((ny - bufferstarty) * COM_DATA_TYPE_COLOR_CHANNELS * bufferwidth);
@@ -136,11 +141,22 @@ void BokehBlurOperation::executePixel(float output[4], int x, int y, void *data)
         float u = this->m_bokehMidX - (nx - x) * m;
         float v = this->m_bokehMidY - (ny - y) * m;
         this->m_inputBokehProgram->readSampled(bokeh, u, v, PixelSampler::Nearest);
+#ifdef BLI_HAVE_SSE2
+        const __m128 reg_bokeh = _mm_load_ps(bokeh);
+        accum_color = _mm_add_ps(accum_color,
+                                 _mm_mul_ps(reg_bokeh, _mm_load_ps(&buffer[bufferindex])));
+        accum_mult = _mm_add_ps(accum_mult, reg_bokeh);
+#else
         madd_v4_v4v4(color_accum, bokeh, &buffer[bufferindex]);
         add_v4_v4(multiplier_accum, bokeh);
+#endif
         bufferindex += offsetadd;
       }
     }
+#ifdef BLI_HAVE_SSE2
+    _mm_store_ps(color_accum, accum_color);
+    _mm_store_ps(multiplier_accum, accum_mult);
+#endif
     output[0] = color_accum[0] * (1.0f / multiplier_accum[0]);
     output[1] = color_accum[1] * (1.0f / multiplier_accum[1]);
     output[2] = color_accum[2] * (1.0f / multiplier_accum[2]);
@@ -350,8 +366,8 @@ void BokehBlurOperation::update_memory_buffer_partial(MemoryBuffer *output,
       continue;
     }
 
-    float color_accum[4] = {0};
-    float multiplier_accum[4] = {0};
+    float ATTR_ALIGN(16) color_accum[4] = {0};
+    float ATTR_ALIGN(16) multiplier_accum[4] = {0};
     if (pixel_size < 2) {
       image_input->read_elem(x, y, color_accum);
       multiplier_accum[0] = 1.0f;
@@ -367,17 +383,31 @@ void BokehBlurOperation::update_memory_buffer_partial(MemoryBuffer *output,
     const int elem_stride = image_input->elem_stride * step;
     const int row_stride = image_input->row_stride * step;
     const float *row_color = image_input->get_elem(minx, miny);
+#ifdef BLI_HAVE_SSE2
+    __m128 accum_color = _mm_load_ps(color_accum);
+    __m128 accum_mult = _mm_load_ps(multiplier_accum);
+#endif
     for (int ny = miny; ny < maxy; ny += step, row_color += row_stride) {
       const float *color = row_color;
       const float v = m_bokehMidY - (ny - y) * m;
       for (int nx = minx; nx < maxx; nx += step, color += elem_stride) {
         const float u = m_bokehMidX - (nx - x) * m;
-        float bokeh[4];
+        float ATTR_ALIGN(16) bokeh[4];
         bokeh_input->read_elem_checked(u, v, bokeh);
+#ifdef BLI_HAVE_SSE2
+        const __m128 reg_bokeh = _mm_load_ps(bokeh);
+        accum_color = _mm_add_ps(accum_color, _mm_mul_ps(reg_bokeh, _mm_load_ps(color)));
+        accum_mult = _mm_add_ps(accum_mult, reg_bokeh);
+#else
         madd_v4_v4v4(color_accum, bokeh, color);
         add_v4_v4(multiplier_accum, bokeh);
+#endif
       }
     }
+#ifdef BLI_HAVE_SSE2
+    _mm_store_ps(color_accum, accum_color);
+    _mm_store_ps(multiplier_accum, accum_mult);
+#endif
     it.out[0] = color_accum[0] * (1.0f / multiplier_accum[0]);
     it.out[1] = color_accum[1] * (1.0f / multiplier_accum[1]);
     it.out[2] = color_accum[2] * (1.0f / multiplier_accum[2]);
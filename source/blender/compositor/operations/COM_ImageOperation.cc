@@ -112,6 +112,19 @@ void BaseImageOperation::deinitExecution()
   }
 }
 
+void BaseImageOperation::hash_output_params()
+{
+  hash_params(m_image ? m_image->id.session_uuid : 0, m_framenumber);
+  /* The backing #ImBuf is replaced whenever the image contents change (reload, painting,
+   * generated image edits), so its pointer together with its pixel buffers identifies the version
+   * of the pixel data. */
+  ImBuf *stackbuf = getImBuf();
+  if (stackbuf) {
+    hash_params(stackbuf, stackbuf->rect_float, stackbuf->rect);
+  }
+  BKE_image_release_ibuf(this->m_image, stackbuf, nullptr);
+}
+
 void BaseImageOperation::determineResolution(unsigned int resolution[2],
                                              unsigned int /*preferredResolution*/[2])
 {
@@ -59,6 +59,8 @@ class BaseImageOperation : public MultiThreadedOperation {
 
   virtual ImBuf *getImBuf();
 
+  void hash_output_params() override;
+
  public:
   void initExecution() override;
   void deinitExecution() override;
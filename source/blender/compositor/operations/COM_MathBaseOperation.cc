@@ -51,6 +51,11 @@ void MathBaseOperation::deinitExecution()
   this->m_inputValue3Operation = nullptr;
 }
 
+void MathBaseOperation::hash_output_params()
+{
+  hash_param(m_useClamp);
+}
+
 void MathBaseOperation::determineResolution(unsigned int resolution[2],
                                             unsigned int preferredResolution[2])
 {
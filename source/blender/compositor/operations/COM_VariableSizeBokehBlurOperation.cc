@@ -18,6 +18,7 @@
 
 #include "COM_VariableSizeBokehBlurOperation.h"
 #include "BLI_math.h"
+#include "BLI_simd.h"
 #include "COM_ExecutionSystem.h"
 #include "COM_OpenCLDevice.h"
 
@@ -100,10 +101,10 @@ void VariableSizeBokehBlurOperation::executePixel(float output[4], int x, int y,
   float *inputSizeFloatBuffer = inputSizeBuffer->getBuffer();
   float *inputProgramFloatBuffer = inputProgramBuffer->getBuffer();
   float readColor[4];
-  float bokeh[4];
+  float ATTR_ALIGN(16) bokeh[4];
   float tempSize[4];
-  float multiplier_accum[4];
-  float color_accum[4];
+  float ATTR_ALIGN(16) multiplier_accum[4];
+  float ATTR_ALIGN(16) color_accum[4];
 
   const float max_dim = MAX2(m_width, m_height);
   const float scalar = this->m_do_size_scale ? (max_dim / 100.0f) : 1.0f;
@@ -141,6 +142,10 @@ void VariableSizeBokehBlurOperation::executePixel(float output[4], int x, int y,
     const int addXStepColor = addXStepValue * COM_DATA_TYPE_COLOR_CHANNELS;
 
     if (size_center > this->m_threshold) {
+#ifdef BLI_HAVE_SSE2
+      __m128 accum_color = _mm_load_ps(color_accum);
+      __m128 accum_mult = _mm_load_ps(multiplier_accum);
+#endif
       for (int ny = miny; ny < maxy; ny += addYStepValue) {
         float dy = ny - y;
         int offsetValueNy = ny * inputSizeBuffer->getWidth();
@@ -159,8 +164,16 @@ void VariableSizeBokehBlurOperation::executePixel(float output[4], int x, int y,
                         (dy / size) * (float)((COM_BLUR_BOKEH_PIXELS / 2) - 1),
                 };
                 inputBokehBuffer->read(bokeh, uv[0], uv[1]);
+#ifdef BLI_HAVE_SSE2
+                const __m128 reg_bokeh = _mm_load_ps(bokeh);
+                accum_color = _mm_add_ps(
+                    accum_color,
+                    _mm_mul_ps(reg_bokeh, _mm_load_ps(&inputProgramFloatBuffer[offsetColorNxNy])));
+                accum_mult = _mm_add_ps(accum_mult, reg_bokeh);
+#else
                 madd_v4_v4v4(color_accum, bokeh, &inputProgramFloatBuffer[offsetColorNxNy]);
                 add_v4_v4(multiplier_accum, bokeh);
+#endif
               }
             }
           }
@@ -168,6 +181,10 @@ void VariableSizeBokehBlurOperation::executePixel(float output[4], int x, int y,
           offsetValueNxNy += addXStepValue;
         }
       }
+#ifdef BLI_HAVE_SSE2
+      _mm_store_ps(color_accum, accum_color);
+      _mm_store_ps(multiplier_accum, accum_mult);
+#endif
     }
 
     output[0] = color_accum[0] / multiplier_accum[0];
@@ -313,8 +330,8 @@ void VariableSizeBokehBlurOperation::get_area_of_interest(const int input_idx,
 }
 
 struct PixelData {
-  float multiplier_accum[4];
-  float color_accum[4];
+  float ATTR_ALIGN(16) multiplier_accum[4];
+  float ATTR_ALIGN(16) color_accum[4];
   float threshold;
   float scalar;
   float size_center;
@@ -354,6 +371,10 @@ static void blur_pixel(int x, int y, PixelData &p)
   const int size_elem_stride = p.size_input->elem_stride * p.step;
   const float *row_color = p.image_input->get_elem(minx, miny);
   const float *row_size = p.size_input->get_elem(minx, miny);
+#ifdef BLI_HAVE_SSE2
+  __m128 accum_color = _mm_load_ps(p.color_accum);
+  __m128 accum_mult = _mm_load_ps(p.multiplier_accum);
+#endif
   for (int ny = miny; ny < maxy;
        ny += p.step, row_size += size_row_stride, row_color += color_row_stride) {
     const float dy = ny - y;
@@ -379,12 +400,22 @@ static void blur_pixel(int x, int y, PixelData &p)
                       (dx / size) * (float)((COM_BLUR_BOKEH_PIXELS / 2) - 1);
       const float v = (float)(COM_BLUR_BOKEH_PIXELS / 2) +
                       (dy / size) * (float)((COM_BLUR_BOKEH_PIXELS / 2) - 1);
-      float bokeh[4];
+      float ATTR_ALIGN(16) bokeh[4];
       p.bokeh_input->read_elem_checked(u, v, bokeh);
+#ifdef BLI_HAVE_SSE2
+      const __m128 reg_bokeh = _mm_load_ps(bokeh);
+      accum_color = _mm_add_ps(accum_color, _mm_mul_ps(reg_bokeh, _mm_load_ps(color)));
+      accum_mult = _mm_add_ps(accum_mult, reg_bokeh);
+#else
       madd_v4_v4v4(p.color_accum, bokeh, color);
       add_v4_v4(p.multiplier_accum, bokeh);
+#endif
     }
   }
+#ifdef BLI_HAVE_SSE2
+  _mm_store_ps(p.color_accum, accum_color);
+  _mm_store_ps(p.multiplier_accum, accum_mult);
+#endif
 }
 
 void VariableSizeBokehBlurOperation::update_memory_buffer_partial(MemoryBuffer *output,
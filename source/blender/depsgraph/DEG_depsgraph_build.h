@@ -75,9 +75,20 @@ void DEG_graph_tag_relations_update(struct Depsgraph *graph);
 /* Create or update relations in the specified graph. */
 void DEG_graph_relations_update(struct Depsgraph *graph);
 
+/* Check whether relations of the given graph are tagged for update. */
+bool DEG_graph_relations_need_update(const struct Depsgraph *graph);
+
 /* Tag all relations in the database for update. */
 void DEG_relations_tag_update(struct Main *bmain);
 
+/* Tag relations for update in all graphs which contain the given ID.
+ *
+ * Use this instead of #DEG_relations_tag_update when the change is known to be local to the
+ * given datablock (adding or removing a constraint, for example): graphs which do not contain
+ * the datablock can not have relations to it and are left untouched, avoiding a full rebuild
+ * of every registered graph. */
+void DEG_relations_tag_update_id(struct Main *bmain, struct ID *id);
+
 /* Add Dependencies  ----------------------------- */
 
 /* Handle for components to define their dependencies from callbacks.
@@ -62,6 +62,14 @@ void DEG_debug_stats_gnuplot(const struct Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/* Write a plain text report of per-operation evaluation times to the stream, most expensive
+ * datablocks and operations first. Times are accumulated over every evaluation of the graph
+ * since it was built (or since the last reset). */
+void DEG_debug_profile_dump(const struct Depsgraph *graph, FILE *fp);
+
+/* Reset the accumulated per-operation timing information. */
+void DEG_debug_profile_reset(struct Depsgraph *graph);
+
 /* ************************************************ */
 
 /* Compare two dependency graphs. */
@@ -0,0 +1,133 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/** \file
+ * \ingroup depsgraph
+ *
+ * Plain text dump of per-operation evaluation timing, for finding which
+ * operations (a handful of expensive drivers, for example) dominate the
+ * evaluation without bisecting the scene by hand.
+ */
+
+#include "DEG_depsgraph_debug.h"
+
+#include <algorithm>
+
+#include "intern/depsgraph.h"
+#include "intern/node/deg_node_component.h"
+#include "intern/node/deg_node_id.h"
+#include "intern/node/deg_node_operation.h"
+
+#include "DNA_ID.h"
+
+namespace blender::deg {
+namespace {
+
+struct ProfileEntry {
+  const OperationNode *node;
+  double accum_time;
+};
+
+struct IDProfileEntry {
+  const IDNode *id_node;
+  double accum_time;
+  int num_operations;
+};
+
+bool profile_entry_comparator(const ProfileEntry &a, const ProfileEntry &b)
+{
+  return a.accum_time > b.accum_time;
+}
+
+bool id_profile_entry_comparator(const IDProfileEntry &a, const IDProfileEntry &b)
+{
+  return a.accum_time > b.accum_time;
+}
+
+void deg_debug_profile_dump(const Depsgraph *graph, FILE *stream)
+{
+  /* Gather operations which have been evaluated at least once, and aggregate
+   * their time per datablock. */
+  Vector<ProfileEntry> entries;
+  Map<const IDNode *, IDProfileEntry> id_entries;
+  double total_time = 0.0;
+  for (const OperationNode *node : graph->operations) {
+    if (node->num_evaluations == 0) {
+      continue;
+    }
+    entries.append({node, node->accum_eval_time});
+    total_time += node->accum_eval_time;
+
+    const IDNode *id_node = node->owner->owner;
+    IDProfileEntry &id_entry = id_entries.lookup_or_add(id_node, {id_node, 0.0, 0});
+    id_entry.accum_time += node->accum_eval_time;
+    id_entry.num_operations++;
+  }
+
+  fprintf(stream, "Depsgraph evaluation profile: %s\n", graph->debug.name.c_str());
+  fprintf(stream, "Total evaluation time: %f ms over %d operations\n\n", total_time * 1000.0,
+          (int)entries.size());
+
+  /* Per-datablock summary, most expensive first. */
+  Vector<IDProfileEntry> sorted_id_entries;
+  for (const IDProfileEntry &id_entry : id_entries.values()) {
+    sorted_id_entries.append(id_entry);
+  }
+  std::sort(sorted_id_entries.begin(), sorted_id_entries.end(), id_profile_entry_comparator);
+  fprintf(stream, "Datablocks:\n");
+  fprintf(stream, "%14s %10s  %s\n", "total ms", "ops", "datablock");
+  for (const IDProfileEntry &id_entry : sorted_id_entries) {
+    fprintf(stream,
+            "%14f %10d  %s\n",
+            id_entry.accum_time * 1000.0,
+            id_entry.num_operations,
+            id_entry.id_node->id_orig->name);
+  }
+
+  /* Per-operation breakdown, most expensive first. */
+  std::sort(entries.begin(), entries.end(), profile_entry_comparator);
+  fprintf(stream, "\nOperations:\n");
+  fprintf(stream, "%14s %14s %10s  %s\n", "total ms", "last ms", "evals", "operation");
+  for (const ProfileEntry &entry : entries) {
+    const OperationNode *node = entry.node;
+    fprintf(stream,
+            "%14f %14f %10d  %s\n",
+            node->accum_eval_time * 1000.0,
+            node->last_eval_time * 1000.0,
+            node->num_evaluations,
+            node->full_identifier().c_str());
+  }
+}
+
+}  // namespace
+}  // namespace blender::deg
+
+void DEG_debug_profile_dump(const Depsgraph *graph, FILE *stream)
+{
+  const blender::deg::Depsgraph *deg_graph = reinterpret_cast<const blender::deg::Depsgraph *>(
+      graph);
+  blender::deg::deg_debug_profile_dump(deg_graph, stream);
+}
+
+void DEG_debug_profile_reset(Depsgraph *graph)
+{
+  blender::deg::Depsgraph *deg_graph = reinterpret_cast<blender::deg::Depsgraph *>(graph);
+  for (blender::deg::OperationNode *node : deg_graph->operations) {
+    node->last_eval_time = 0.0;
+    node->accum_eval_time = 0.0;
+    node->num_evaluations = 0;
+  }
+}
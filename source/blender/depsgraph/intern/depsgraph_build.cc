@@ -312,6 +312,13 @@ void DEG_graph_relations_update(Depsgraph *graph)
   DEG_graph_build_from_view_layer(graph);
 }
 
+/* Check whether relations of the given graph are tagged for update. */
+bool DEG_graph_relations_need_update(const Depsgraph *graph)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
+  return deg_graph->need_update;
+}
+
 /* Tag all relations for update. */
 void DEG_relations_tag_update(Main *bmain)
 {
@@ -320,3 +327,17 @@ void DEG_relations_tag_update(Main *bmain)
     DEG_graph_tag_relations_update(reinterpret_cast<Depsgraph *>(depsgraph));
   }
 }
+
+/* Tag relations for update in all graphs which contain the given ID. */
+void DEG_relations_tag_update_id(Main *bmain, ID *id)
+{
+  DEG_GLOBAL_DEBUG_PRINTF(TAG, "%s: Tagging relations of %s for update.\n", __func__, id->name);
+  for (deg::Depsgraph *depsgraph : deg::get_all_registered_graphs(bmain)) {
+    /* Graphs without a node for the ID can not have any relation to or from it: a change which
+     * makes the ID part of such graph always tags the ID which gained the reference as well. */
+    if (depsgraph->find_id_node(id) == nullptr) {
+      continue;
+    }
+    DEG_graph_tag_relations_update(reinterpret_cast<Depsgraph *>(depsgraph));
+  }
+}
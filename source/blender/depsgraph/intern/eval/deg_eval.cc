@@ -104,14 +104,16 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
 
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
-  /* Perform operation. */
+  /* Perform operation, keeping track of the execution time so the next evaluation can schedule
+   * expensive chains of operations first. */
+  const double start_time = PIL_check_seconds_timer();
+  operation_node->evaluate(depsgraph);
+  const double elapsed_time = PIL_check_seconds_timer() - start_time;
+  operation_node->last_eval_time = elapsed_time;
+  operation_node->accum_eval_time += elapsed_time;
+  operation_node->num_evaluations++;
   if (state->do_stats) {
-    const double start_time = PIL_check_seconds_timer();
-    operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += PIL_check_seconds_timer() - start_time;
-  }
-  else {
-    operation_node->evaluate(depsgraph);
+    operation_node->stats.current_time += elapsed_time;
   }
 }
 
@@ -178,10 +180,76 @@ void calculate_pending_parents(Depsgraph *graph)
   }
 }
 
+/* Cost assumed for operations which have no timing information yet (never evaluated, or cheaper
+ * than the timer resolution), so that on the first evaluation the critical path degrades to the
+ * length of the dependency chain. */
+constexpr double kUnmeasuredOperationTime = 1e-6;
+
+/* Calculate for every operation the cost of the most expensive chain of operations which starts
+ * at it, based on execution times from the previous evaluation. Scheduling ready operations in
+ * descending order of this cost makes long serial chains start as early as possible instead of
+ * waiting behind trivial-but-numerous nodes. */
+void calculate_critical_path_times(Depsgraph *graph)
+{
+  enum {
+    STATE_UNVISITED = 0,
+    STATE_PENDING,
+    STATE_DONE,
+  };
+  for (OperationNode *node : graph->operations) {
+    node->custom_flags = STATE_UNVISITED;
+  }
+  /* Iterative post-order traversal: children (outlinks) are finished before their parents, so
+   * by the time a node is popped the longest path of all its children is known. Relations
+   * tagged as cyclic are ignored, which makes the traversed graph a DAG. */
+  Vector<OperationNode *> traversal_stack;
+  for (OperationNode *root : graph->operations) {
+    if (root->custom_flags != STATE_UNVISITED) {
+      continue;
+    }
+    traversal_stack.append(root);
+    while (!traversal_stack.is_empty()) {
+      OperationNode *node = traversal_stack.last();
+      if (node->custom_flags == STATE_UNVISITED) {
+        node->custom_flags = STATE_PENDING;
+        for (Relation *rel : node->outlinks) {
+          if (rel->flag & RELATION_FLAG_CYCLIC) {
+            continue;
+          }
+          OperationNode *child = (OperationNode *)rel->to;
+          BLI_assert(child->type == NodeType::OPERATION);
+          if (child->custom_flags == STATE_UNVISITED) {
+            traversal_stack.append(child);
+          }
+        }
+      }
+      else {
+        traversal_stack.remove_last();
+        if (node->custom_flags == STATE_DONE) {
+          /* Node can be on the stack multiple times when it has multiple parents. */
+          continue;
+        }
+        node->custom_flags = STATE_DONE;
+        double longest_child_path = 0.0;
+        for (const Relation *rel : node->outlinks) {
+          if (rel->flag & RELATION_FLAG_CYCLIC) {
+            continue;
+          }
+          const OperationNode *child = (const OperationNode *)rel->to;
+          longest_child_path = max(longest_child_path, child->critical_path_time);
+        }
+        node->critical_path_time = max(node->last_eval_time, kUnmeasuredOperationTime) +
+                                   longest_child_path;
+      }
+    }
+  }
+}
+
 void initialize_execution(DepsgraphEvalState *state, Depsgraph *graph)
 {
   const bool do_stats = state->do_stats;
   calculate_pending_parents(graph);
+  calculate_critical_path_times(graph);
   /* Clear tags and other things which needs to be clear. */
   for (OperationNode *node : graph->operations) {
     if (do_stats) {
@@ -281,7 +349,16 @@ void schedule_graph(DepsgraphEvalState *state,
                     ScheduleFunction *schedule_function,
                     ScheduleFunctionArgs... schedule_function_args)
 {
-  for (OperationNode *node : state->graph->operations) {
+  /* Submit entry points in descending order of their critical path, so workers pick up the
+   * longest dependency chains before the trivial ones. The task pool has no per-task priority,
+   * submission order is the only control over which ready operation runs first. */
+  Vector<OperationNode *> sorted_nodes(state->graph->operations.as_span());
+  std::stable_sort(sorted_nodes.begin(),
+                   sorted_nodes.end(),
+                   [](const OperationNode *a, const OperationNode *b) {
+                     return a->critical_path_time > b->critical_path_time;
+                   });
+  for (OperationNode *node : sorted_nodes) {
     schedule_node(state, node, false, schedule_function, schedule_function_args...);
   }
 }
@@ -292,7 +369,18 @@ void schedule_children(DepsgraphEvalState *state,
                        ScheduleFunction *schedule_function,
                        ScheduleFunctionArgs... schedule_function_args)
 {
-  for (Relation *rel : node->outlinks) {
+  /* Submit children with the most expensive remaining chain first, see schedule_graph(). The
+   * relation order itself is left untouched: it is shared state, while this runs per-task. */
+  Vector<Relation *, 8> sorted_outlinks(node->outlinks.as_span());
+  if (sorted_outlinks.size() > 1) {
+    std::stable_sort(sorted_outlinks.begin(), sorted_outlinks.end(), [](const Relation *rel_a,
+                                                                        const Relation *rel_b) {
+      const OperationNode *child_a = (const OperationNode *)rel_a->to;
+      const OperationNode *child_b = (const OperationNode *)rel_b->to;
+      return child_a->critical_path_time > child_b->critical_path_time;
+    });
+  }
+  for (Relation *rel : sorted_outlinks) {
     OperationNode *child = (OperationNode *)rel->to;
     BLI_assert(child->type == NodeType::OPERATION);
     if (child->scheduled) {
@@ -209,7 +209,13 @@ const char *operationCodeAsString(OperationCode opcode)
   return "UNKNOWN";
 }
 
-OperationNode::OperationNode() : name_tag(-1), flag(0)
+OperationNode::OperationNode()
+    : last_eval_time(0.0),
+      accum_eval_time(0.0),
+      num_evaluations(0),
+      critical_path_time(0.0),
+      name_tag(-1),
+      flag(0)
 {
 }
 
@@ -265,6 +265,18 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Execution time of this operation measured during the most recent evaluation, in seconds.
+   * Used as a cost estimate for scheduling, zero for operations which were never evaluated. */
+  double last_eval_time;
+  /* Execution time and number of evaluations accumulated over the lifetime of the graph, for
+   * profiling (see DEG_debug_profile_dump). */
+  double accum_eval_time;
+  int num_evaluations;
+  /* Length of the most expensive chain of operations which starts at this node, based on
+   * last_eval_time. Calculated at the beginning of graph evaluation, so that operations which
+   * unlock the longest remaining work are scheduled first. */
+  double critical_path_time;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
@@ -986,6 +986,13 @@ static void eevee_lightbake_cache_create(EEVEE_Data *vedata, EEVEE_LightBake *lb
 
 static void eevee_lightbake_copy_irradiance(EEVEE_LightBake *lbake, LightCache *lcache)
 {
+  if (GPU_texture_copy_array_support() && lbake->grid_prev != NULL) {
+    /* Copy on the GPU. Avoids stalling the pipeline with a full read-back between bounces.
+     * Both textures have the same size, see #EEVEE_lightcache_validate. */
+    GPU_texture_copy(lbake->grid_prev, lcache->grid_tx.tex);
+    return;
+  }
+
   DRW_TEXTURE_FREE_SAFE(lbake->grid_prev);
 
   /* Copy texture by reading back and re-uploading it. */
@@ -934,10 +934,20 @@ void EEVEE_materials_cache_finish(EEVEE_ViewLayerData *UNUSED(sldata), EEVEE_Dat
 {
   EEVEE_PrivateData *pd = vedata->stl->g_data;
   EEVEE_EffectsInfo *effects = vedata->stl->effects;
+  EEVEE_PassList *psl = vedata->psl;
 
   BLI_ghash_free(pd->material_hash, NULL, NULL);
   pd->material_hash = NULL;
 
+  /* Shading groups draw in depth-equal passes, so their submission order does not matter and
+   * they can be sorted to reduce shader switches between materials sharing the same shader. */
+  DRW_pass_sort_shgroup_shader(psl->material_ps);
+  DRW_pass_sort_shgroup_shader(psl->material_cull_ps);
+  DRW_pass_sort_shgroup_shader(psl->material_refract_ps);
+  DRW_pass_sort_shgroup_shader(psl->material_refract_cull_ps);
+  DRW_pass_sort_shgroup_shader(psl->material_sss_ps);
+  DRW_pass_sort_shgroup_shader(psl->material_sss_cull_ps);
+
   SET_FLAG_FROM_TEST(effects->enabled_effects, effects->sss_surface_count > 0, EFFECT_SSS);
 }
 
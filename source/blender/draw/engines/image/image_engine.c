@@ -98,11 +98,44 @@ static void image_cache_image_add(DRWShadingGroup *grp, Image *image, ImBuf *ibu
   }
 }
 
-static void space_image_gpu_texture_get(Image *image,
+/* Texture created by the engine itself, for depth and single channel display. The texture is
+ * kept across redraws and only rebuilt when the underlying buffers change, so panning and
+ * zooming a large image does not upload its pixels again on every redraw. The key pointers are
+ * only compared, never dereferenced: buffers of these images (depth and single channel render
+ * passes) are replaced wholesale, not edited in place. */
+static GPUTexture *image_engine_texture_ensure(IMAGE_Data *vedata,
+                                               ImBuf *ibuf,
+                                               const void *pixels_key,
+                                               const int display_flag,
+                                               const int width,
+                                               const int height,
+                                               eGPUTextureFormat format,
+                                               const float *data)
+{
+  IMAGE_TextureList *txl = vedata->txl;
+  IMAGE_PrivateData *pd = vedata->stl->pd;
+
+  if (txl->image_texture) {
+    if (pd->cached_ibuf == ibuf && pd->cached_pixels == pixels_key &&
+        pd->cached_display_flag == display_flag) {
+      return txl->image_texture;
+    }
+    GPU_texture_free(txl->image_texture);
+    txl->image_texture = NULL;
+  }
+
+  txl->image_texture = GPU_texture_create_2d(__func__, width, height, 0, format, data);
+  pd->cached_ibuf = ibuf;
+  pd->cached_pixels = pixels_key;
+  pd->cached_display_flag = display_flag;
+  return txl->image_texture;
+}
+
+static void space_image_gpu_texture_get(IMAGE_Data *vedata,
+                                        Image *image,
                                         ImageUser *iuser,
                                         ImBuf *ibuf,
                                         GPUTexture **r_gpu_texture,
-                                        bool *r_owns_texture,
                                         GPUTexture **r_tex_tile_data)
 {
   const DRWContextState *draw_ctx = DRW_context_state_get();
@@ -127,8 +160,7 @@ static void space_image_gpu_texture_get(Image *image,
     BLI_assert(image->type == IMA_TYPE_R_RESULT);
 
     float zero[4] = {0, 0, 0, 0};
-    *r_gpu_texture = GPU_texture_create_2d(__func__, 1, 1, 0, GPU_RGBA16F, zero);
-    *r_owns_texture = true;
+    *r_gpu_texture = image_engine_texture_ensure(vedata, ibuf, NULL, 0, 1, 1, GPU_RGBA16F, zero);
     return;
   }
 
@@ -138,24 +170,26 @@ static void space_image_gpu_texture_get(Image *image,
       BLI_assert_msg(0, "Integer based depth buffers not supported");
     }
     else if (ibuf->zbuf_float) {
-      *r_gpu_texture = GPU_texture_create_2d(
-          __func__, ibuf->x, ibuf->y, 0, GPU_R16F, ibuf->zbuf_float);
-      *r_owns_texture = true;
+      *r_gpu_texture = image_engine_texture_ensure(
+          vedata, ibuf, ibuf->zbuf_float, sima_flag, ibuf->x, ibuf->y, GPU_R16F, ibuf->zbuf_float);
     }
     else if (ibuf->rect_float && ibuf->channels == 1) {
-      *r_gpu_texture = GPU_texture_create_2d(
-          __func__, ibuf->x, ibuf->y, 0, GPU_R16F, ibuf->rect_float);
-      *r_owns_texture = true;
+      *r_gpu_texture = image_engine_texture_ensure(vedata,
+                                                   ibuf,
+                                                   ibuf->rect_float,
+                                                   sima_flag,
+                                                   ibuf->x,
+                                                   ibuf->y,
+                                                   GPU_R16F,
+                                                   ibuf->rect_float);
     }
   }
   else if (image->source == IMA_SRC_TILED) {
     *r_gpu_texture = BKE_image_get_gpu_tiles(image, iuser, ibuf);
     *r_tex_tile_data = BKE_image_get_gpu_tilemap(image, iuser, NULL);
-    *r_owns_texture = false;
   }
   else {
     *r_gpu_texture = BKE_image_get_gpu_texture(image, iuser, ibuf);
-    *r_owns_texture = false;
   }
 }
 
@@ -163,19 +197,17 @@ static void space_node_gpu_texture_get(Image *image,
                                        ImageUser *iuser,
                                        ImBuf *ibuf,
                                        GPUTexture **r_gpu_texture,
-                                       bool *r_owns_texture,
                                        GPUTexture **r_tex_tile_data)
 {
   *r_gpu_texture = BKE_image_get_gpu_texture(image, iuser, ibuf);
-  *r_owns_texture = false;
   *r_tex_tile_data = NULL;
 }
 
-static void image_gpu_texture_get(Image *image,
+static void image_gpu_texture_get(IMAGE_Data *vedata,
+                                  Image *image,
                                   ImageUser *iuser,
                                   ImBuf *ibuf,
                                   GPUTexture **r_gpu_texture,
-                                  bool *r_owns_texture,
                                   GPUTexture **r_tex_tile_data)
 {
   if (!image) {
@@ -186,11 +218,10 @@ static void image_gpu_texture_get(Image *image,
   const char space_type = draw_ctx->space_data->spacetype;
 
   if (space_type == SPACE_IMAGE) {
-    space_image_gpu_texture_get(
-        image, iuser, ibuf, r_gpu_texture, r_owns_texture, r_tex_tile_data);
+    space_image_gpu_texture_get(vedata, image, iuser, ibuf, r_gpu_texture, r_tex_tile_data);
   }
   else if (space_type == SPACE_NODE) {
-    space_node_gpu_texture_get(image, iuser, ibuf, r_gpu_texture, r_owns_texture, r_tex_tile_data);
+    space_node_gpu_texture_get(image, iuser, ibuf, r_gpu_texture, r_tex_tile_data);
   }
 }
 
@@ -205,7 +236,7 @@ static void image_cache_image(IMAGE_Data *vedata, Image *image, ImageUser *iuser
   const Scene *scene = draw_ctx->scene;
 
   GPUTexture *tex_tile_data = NULL;
-  image_gpu_texture_get(image, iuser, ibuf, &pd->texture, &pd->owns_texture, &tex_tile_data);
+  image_gpu_texture_get(vedata, image, iuser, ibuf, &pd->texture, &tex_tile_data);
 
   if (pd->texture) {
     static float color[4] = {1.0f, 1.0f, 1.0f, 1.0f};
@@ -407,11 +438,6 @@ static void image_draw_finish(IMAGE_Data *ved)
   }
   pd->image = NULL;
   pd->ibuf = NULL;
-
-  if (pd->texture && pd->owns_texture) {
-    GPU_texture_free(pd->texture);
-    pd->owns_texture = false;
-  }
   pd->texture = NULL;
 }
 
@@ -37,6 +37,12 @@ typedef struct IMAGE_PassList {
   DRWPass *image_pass;
 } IMAGE_PassList;
 
+typedef struct IMAGE_TextureList {
+  /* Texture created by the engine itself for depth and single channel display. Kept across
+   * redraws so panning and zooming a large image does not upload its pixels again every redraw. */
+  struct GPUTexture *image_texture;
+} IMAGE_TextureList;
+
 typedef struct IMAGE_PrivateData {
   void *lock;
   struct ImBuf *ibuf;
@@ -44,7 +50,12 @@ typedef struct IMAGE_PrivateData {
   struct DRWView *view;
 
   struct GPUTexture *texture;
-  bool owns_texture;
+
+  /* State that `image_texture` was created from, to detect when it has to be rebuilt. Only used
+   * as keys for comparison, never dereferenced. */
+  struct ImBuf *cached_ibuf;
+  const void *cached_pixels;
+  int cached_display_flag;
 } IMAGE_PrivateData;
 
 typedef struct IMAGE_StorageList {
@@ -54,7 +65,7 @@ typedef struct IMAGE_StorageList {
 typedef struct IMAGE_Data {
   void *engine_type;
   DRWViewportEmptyList *fbl;
-  DRWViewportEmptyList *txl;
+  IMAGE_TextureList *txl;
   IMAGE_PassList *psl;
   IMAGE_StorageList *stl;
 } IMAGE_Data;
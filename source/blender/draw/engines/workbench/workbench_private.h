@@ -277,8 +277,6 @@ typedef struct WORKBENCH_PrivateData {
   struct DRWShadingGroup *shadow_pass_grp[2];
   struct DRWShadingGroup *shadow_fail_grp[2];
   struct DRWShadingGroup *shadow_fail_caps_grp[2];
-  /** If the shadow has changed direction and ob bboxes needs to be updated. */
-  bool shadow_changed;
 
   /* Temporal Antialiasing */
   /** Total number of samples to after which TAA stops accumulating samples. */
@@ -377,6 +375,8 @@ typedef struct WORKBENCH_ObjectData {
   /* Min, max in shadow space */
   float shadow_min[3], shadow_max[3];
   BoundBox shadow_bbox;
+  /* Shadow direction the cached bounding box was computed for. */
+  float shadow_bbox_direction[3];
   bool shadow_bbox_dirty;
 } WORKBENCH_ObjectData;
 
@@ -58,10 +58,7 @@ static void compute_parallel_lines_nor_and_dist(const float v1[2],
 
 static void workbench_shadow_update(WORKBENCH_PrivateData *wpd)
 {
-  wpd->shadow_changed = !compare_v3v3(
-      wpd->shadow_cached_direction, wpd->shadow_direction_ws, 1e-5f);
-
-  if (wpd->shadow_changed) {
+  if (!compare_v3v3(wpd->shadow_cached_direction, wpd->shadow_direction_ws, 1e-5f)) {
     const float up[3] = {0.0f, 0.0f, 1.0f};
     unit_m4(wpd->shadow_mat);
 
@@ -185,7 +182,11 @@ static BoundBox *workbench_shadow_object_shadow_bbox_get(WORKBENCH_PrivateData *
                                                          Object *ob,
                                                          WORKBENCH_ObjectData *oed)
 {
-  if (oed->shadow_bbox_dirty || wpd->shadow_changed) {
+  /* The bounding box is cached against the light direction, so rotating the light transforms
+   * each box only once per frame instead of once per culling query. Transform and geometry
+   * updates are covered by the dirty flag. */
+  if (oed->shadow_bbox_dirty ||
+      !compare_v3v3(oed->shadow_bbox_direction, wpd->shadow_cached_direction, 1e-5f)) {
     float tmp_mat[4][4];
     mul_m4_m4m4(tmp_mat, wpd->shadow_inv, ob->obmat);
 
@@ -208,6 +209,7 @@ static BoundBox *workbench_shadow_object_shadow_bbox_get(WORKBENCH_PrivateData *
     for (int i = 0; i < 8; i++) {
       mul_m4_v3(wpd->shadow_mat, oed->shadow_bbox.vec[i]);
     }
+    copy_v3_v3(oed->shadow_bbox_direction, wpd->shadow_cached_direction);
     oed->shadow_bbox_dirty = false;
   }
 
@@ -239,6 +239,10 @@ typedef struct DRWVolumeGrid {
   /* 3D texture. */
   struct GPUTexture *texture;
 
+  /* Key and size for the unused texture cache, set when the grid is file-backed. */
+  char *texture_cache_key;
+  size_t texture_bytes;
+
   /* Transform between 0..1 texture space and object space. */
   float texture_to_object[4][4];
   float object_to_texture[4][4];
@@ -250,6 +254,7 @@ typedef struct DRWVolumeGrid {
 
 DRWVolumeGrid *DRW_volume_batch_cache_get_grid(struct Volume *volume,
                                                const struct VolumeGrid *grid);
+void DRW_volume_free(void);
 struct GPUBatch *DRW_cache_volume_face_wireframe_get(struct Object *ob);
 struct GPUBatch *DRW_cache_volume_selection_surface_get(struct Object *ob);
 
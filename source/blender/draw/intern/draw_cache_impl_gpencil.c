@@ -40,6 +40,7 @@
 
 #include "BLI_hash.h"
 #include "BLI_polyfill_2d.h"
+#include "BLI_task.h"
 
 #include "draw_cache.h"
 #include "draw_cache_impl.h"
@@ -258,6 +259,11 @@ typedef struct gpIterData {
   int vert_len;
   int tri_len;
   int curve_len;
+  /* Strokes gathered during the count pass, so the buffer fill pass can run
+   * in parallel (each stroke owns a disjoint vertex/index range). */
+  bGPDstroke **strokes;
+  int stroke_len;
+  int stroke_len_alloc;
 } gpIterData;
 
 static GPUVertBuf *gpencil_dummy_buffer_get(void)
@@ -366,18 +372,23 @@ static void gpencil_buffer_add_fill(GPUIndexBufBuilder *ibo, const bGPDstroke *g
 {
   int tri_len = gps->tot_triangles;
   int v = gps->runtime.stroke_start;
+  /* Write at this stroke's own offset so strokes can be filled in parallel.
+   * The builder's index_len/min/max are fixed up by the caller. */
+  uint *ibo_data = ibo->data + (size_t)gps->runtime.fill_start * 3;
   for (int i = 0; i < tri_len; i++) {
     uint *tri = gps->triangles[i].verts;
-    GPU_indexbuf_add_tri_verts(ibo, v + tri[0], v + tri[1], v + tri[2]);
+    *ibo_data++ = v + tri[0];
+    *ibo_data++ = v + tri[1];
+    *ibo_data++ = v + tri[2];
   }
 }
 
-static void gpencil_stroke_iter_cb(bGPDlayer *UNUSED(gpl),
-                                   bGPDframe *UNUSED(gpf),
-                                   bGPDstroke *gps,
-                                   void *thunk)
+static void gpencil_stroke_fill_task_cb(void *__restrict userdata,
+                                        const int i,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  gpIterData *iter = (gpIterData *)thunk;
+  gpIterData *iter = (gpIterData *)userdata;
+  bGPDstroke *gps = iter->strokes[i];
   gpencil_buffer_add_stroke(iter->verts, iter->cols, gps);
   if (gps->tot_triangles > 0) {
     gpencil_buffer_add_fill(&iter->ibo, gps);
@@ -396,6 +407,13 @@ static void gpencil_object_verts_count_cb(bGPDlayer *UNUSED(gpl),
   gps->runtime.fill_start = iter->tri_len;
   iter->vert_len += gps->totpoints + 2 + gpencil_stroke_is_cyclic(gps);
   iter->tri_len += gps->tot_triangles;
+
+  /* Collect the stroke for the parallel fill pass. */
+  if (iter->stroke_len == iter->stroke_len_alloc) {
+    iter->stroke_len_alloc = MAX2(iter->stroke_len_alloc * 2, 512);
+    iter->strokes = MEM_recallocN(iter->strokes, sizeof(*iter->strokes) * iter->stroke_len_alloc);
+  }
+  iter->strokes[iter->stroke_len++] = gps;
 }
 
 static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfra)
@@ -421,6 +439,9 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
         .vert_len = 1, /* Start at 1 for the gl_InstanceID trick to work (see vert shader). */
         .tri_len = 0,
         .curve_len = 0,
+        .strokes = NULL,
+        .stroke_len = 0,
+        .stroke_len_alloc = 0,
     };
     BKE_gpencil_visible_stroke_advanced_iter(
         NULL, ob, NULL, gpencil_object_verts_count_cb, &iter, do_onion, cfra);
@@ -438,9 +459,20 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
     /* Create IBO. */
     GPU_indexbuf_init(&iter.ibo, GPU_PRIM_TRIS, iter.tri_len, iter.vert_len);
 
-    /* Fill buffers with data. */
-    BKE_gpencil_visible_stroke_advanced_iter(
-        NULL, ob, NULL, gpencil_stroke_iter_cb, &iter, do_onion, cfra);
+    /* Fill buffers with data. Strokes write disjoint vertex and index ranges
+     * (offsets were assigned by the count pass), so they can run in parallel. */
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (iter.stroke_len > 8);
+    BLI_task_parallel_range(0, iter.stroke_len, &iter, gpencil_stroke_fill_task_cb, &settings);
+
+    /* HACK since the fills bypassed the builder API to write at per-stroke
+     * offsets, set the number of indices and their range manually. */
+    iter.ibo.index_len = iter.tri_len * 3;
+    iter.ibo.index_min = 0;
+    iter.ibo.index_max = iter.vert_len;
+
+    MEM_SAFE_FREE(iter.strokes);
 
     /* Mark last 2 verts as invalid. */
     for (int i = 0; i < 2; i++) {
@@ -821,6 +821,34 @@ void DRW_mesh_batch_cache_dirty_tag(Mesh *me, eMeshBatchDirtyMode mode)
     case BKE_MESH_BATCH_DIRTY_ALL:
       cache->is_dirty = true;
       break;
+    case BKE_MESH_BATCH_DIRTY_DEFORM:
+      /* Only vertex coordinates changed, re-extract position dependent buffers and keep the
+       * (typically more expensive) topology & attribute buffers. */
+      FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.pos_nor);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.lnor);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edge_fac);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.tan);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.orco);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.mesh_analysis);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_pos);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_nor);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.skin_roots);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edituv_stretch_area);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edituv_stretch_angle);
+      }
+      batch_map = BATCH_MAP(vbo.pos_nor,
+                            vbo.lnor,
+                            vbo.edge_fac,
+                            vbo.tan,
+                            vbo.orco,
+                            vbo.mesh_analysis,
+                            vbo.fdots_pos,
+                            vbo.fdots_nor,
+                            vbo.skin_roots) |
+                  BATCH_MAP(vbo.edituv_stretch_area, vbo.edituv_stretch_angle);
+      mesh_batch_cache_discard_batch(cache, batch_map);
+      break;
     case BKE_MESH_BATCH_DIRTY_SHADING:
       mesh_batch_cache_discard_shaded_tri(cache);
       mesh_batch_cache_discard_uvedit(cache);
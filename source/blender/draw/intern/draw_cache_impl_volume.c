@@ -30,6 +30,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_base.h"
 #include "BLI_math_vector.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "DNA_object_types.h"
@@ -52,6 +53,112 @@
 
 static void volume_batch_cache_clear(Volume *volume);
 
+/* ---------------------------------------------------------------------- */
+/* Volume GPUTexture Cache
+ *
+ * Textures of file-backed grids are moved here when a volume's batch cache is
+ * discarded, keyed by #BKE_volume_grid_file_cache_key. Frame changes of a
+ * volume sequence then reuse already uploaded textures instead of extracting
+ * and uploading the voxels again, which makes scrubbing through cached
+ * simulations usable. */
+
+typedef struct VolumeTextureCacheEntry {
+  struct VolumeTextureCacheEntry *next, *prev;
+  /* Key from #BKE_volume_grid_file_cache_key, owned by the entry. */
+  char *key;
+  GPUTexture *texture;
+  float texture_to_object[4][4];
+  size_t bytes;
+} VolumeTextureCacheEntry;
+
+static struct {
+  /* Least recently used entries last. */
+  ListBase entries;
+  size_t bytes;
+} g_texture_cache = {{NULL, NULL}, 0};
+
+static ThreadMutex g_texture_cache_mutex = BLI_MUTEX_INITIALIZER;
+
+/* Maximum memory used by textures not referenced by any batch cache. */
+#define VOLUME_TEXTURE_CACHE_BYTES_MAX ((size_t)512 * 1024 * 1024)
+
+static void volume_texture_cache_entry_free(VolumeTextureCacheEntry *entry)
+{
+  g_texture_cache.bytes -= entry->bytes;
+  MEM_SAFE_FREE(entry->key);
+  DRW_TEXTURE_FREE_SAFE(entry->texture);
+  BLI_freelinkN(&g_texture_cache.entries, entry);
+}
+
+/* Take ownership of the grid's texture and key for later reuse. */
+static void volume_texture_cache_put(DRWVolumeGrid *grid)
+{
+  BLI_mutex_lock(&g_texture_cache_mutex);
+
+  /* An existing entry with the same key holds identical texture contents. */
+  bool found = false;
+  LISTBASE_FOREACH (VolumeTextureCacheEntry *, entry, &g_texture_cache.entries) {
+    if (STREQ(entry->key, grid->texture_cache_key)) {
+      found = true;
+      break;
+    }
+  }
+
+  if (!found) {
+    VolumeTextureCacheEntry *entry = MEM_callocN(sizeof(*entry), __func__);
+    entry->key = grid->texture_cache_key;
+    entry->texture = grid->texture;
+    copy_m4_m4(entry->texture_to_object, grid->texture_to_object);
+    entry->bytes = grid->texture_bytes;
+    BLI_addhead(&g_texture_cache.entries, entry);
+    g_texture_cache.bytes += entry->bytes;
+    grid->texture_cache_key = NULL;
+    grid->texture = NULL;
+
+    /* Evict least recently used entries over the memory budget. */
+    while (g_texture_cache.bytes > VOLUME_TEXTURE_CACHE_BYTES_MAX &&
+           g_texture_cache.entries.first != g_texture_cache.entries.last) {
+      volume_texture_cache_entry_free(g_texture_cache.entries.last);
+    }
+  }
+
+  BLI_mutex_unlock(&g_texture_cache_mutex);
+}
+
+/* Fill the grid from a cached texture with matching key, if any. */
+static bool volume_texture_cache_pop(DRWVolumeGrid *grid)
+{
+  bool found = false;
+
+  BLI_mutex_lock(&g_texture_cache_mutex);
+
+  LISTBASE_FOREACH (VolumeTextureCacheEntry *, entry, &g_texture_cache.entries) {
+    if (STREQ(entry->key, grid->texture_cache_key)) {
+      grid->texture = entry->texture;
+      grid->texture_bytes = entry->bytes;
+      copy_m4_m4(grid->texture_to_object, entry->texture_to_object);
+      invert_m4_m4(grid->object_to_texture, entry->texture_to_object);
+      entry->texture = NULL;
+      volume_texture_cache_entry_free(entry);
+      found = true;
+      break;
+    }
+  }
+
+  BLI_mutex_unlock(&g_texture_cache_mutex);
+
+  return found;
+}
+
+void DRW_volume_free(void)
+{
+  BLI_mutex_lock(&g_texture_cache_mutex);
+  while (g_texture_cache.entries.first) {
+    volume_texture_cache_entry_free(g_texture_cache.entries.first);
+  }
+  BLI_mutex_unlock(&g_texture_cache_mutex);
+}
+
 /* ---------------------------------------------------------------------- */
 /* Volume GPUBatch Cache */
 
@@ -132,6 +239,11 @@ static void volume_batch_cache_clear(Volume *volume)
 
   LISTBASE_FOREACH (DRWVolumeGrid *, grid, &cache->grids) {
     MEM_SAFE_FREE(grid->name);
+    if (grid->texture_cache_key && grid->texture) {
+      /* Keep textures of file-backed grids for reuse on e.g. frame change. */
+      volume_texture_cache_put(grid);
+    }
+    MEM_SAFE_FREE(grid->texture_cache_key);
     DRW_TEXTURE_FREE_SAFE(grid->texture);
   }
   BLI_freelistN(&cache->grids);
@@ -303,6 +415,14 @@ static DRWVolumeGrid *volume_grid_cache_get(const Volume *volume,
   cache_grid->name = BLI_strdup(name);
   BLI_addtail(&cache->grids, cache_grid);
 
+  /* Reuse a texture uploaded for the same file grid before, to avoid
+   * extracting and uploading the voxels again on every frame change of a
+   * volume sequence. */
+  cache_grid->texture_cache_key = BKE_volume_grid_file_cache_key(grid);
+  if (cache_grid->texture_cache_key && volume_texture_cache_pop(cache_grid)) {
+    return cache_grid;
+  }
+
   /* TODO: can we load this earlier, avoid accessing the global and take
    * advantage of dependency graph multi-threading? */
   BKE_volume_load(volume, G.main);
@@ -335,6 +455,10 @@ static DRWVolumeGrid *volume_grid_cache_get(const Volume *volume,
     if (cache_grid->texture != NULL) {
       GPU_texture_swizzle_set(cache_grid->texture, (channels == 3) ? "rgb1" : "rrr1");
       GPU_texture_wrap_mode(cache_grid->texture, false, false);
+      /* Half float per channel. */
+      cache_grid->texture_bytes = sizeof(short) * channels * (size_t)dense_grid.resolution[0] *
+                                  (size_t)dense_grid.resolution[1] *
+                                  (size_t)dense_grid.resolution[2];
       BKE_volume_dense_float_grid_clear(&dense_grid);
     }
     else {
@@ -2952,6 +2952,7 @@ void DRW_engines_free(void)
   DRW_shaders_free();
   DRW_hair_free();
   DRW_shape_cache_free();
+  DRW_volume_free();
   DRW_stats_free();
   DRW_globals_free();
 
@@ -2138,6 +2138,56 @@ void DRW_pass_sort_shgroup_z(DRWPass *pass)
   pass->shgroups.last = last;
 }
 
+static int pass_shgroup_shader_sort(const void *a, const void *b)
+{
+  const DRWShadingGroup *shgrp_a = (const DRWShadingGroup *)a;
+  const DRWShadingGroup *shgrp_b = (const DRWShadingGroup *)b;
+
+  if (shgrp_a->shader < shgrp_b->shader) {
+    return 1;
+  }
+  if (shgrp_a->shader > shgrp_b->shader) {
+    return -1;
+  }
+
+  /* If shaders are the same, keep original order. */
+  if (shgrp_a->z_sorting.original_index > shgrp_b->z_sorting.original_index) {
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * Sort Shading groups by their shader to reduce shader switches, useful when a pass contains
+ * many materials sharing the same shader (only their uniforms differ).
+ * Only valid for passes whose result does not depend on submission order
+ * (opaque geometry with depth testing for example).
+ */
+void DRW_pass_sort_shgroup_shader(DRWPass *pass)
+{
+  if (!(pass->shgroups.first && pass->shgroups.first->next)) {
+    /* Nothing to sort */
+    return;
+  }
+
+  uint index = 0;
+  DRWShadingGroup *shgroup = pass->shgroups.first;
+  do {
+    shgroup->z_sorting.original_index = index++;
+  } while ((shgroup = shgroup->next));
+
+  pass->shgroups.first = shgroup_sort_fn_r(pass->shgroups.first, pass_shgroup_shader_sort);
+
+  /* Find the new last */
+  DRWShadingGroup *last = pass->shgroups.first;
+  while ((last = last->next)) {
+    /* Reset the pass id for debugging. */
+    last->pass_handle = pass->handle;
+  }
+  pass->shgroups.last = last;
+}
+
 /**
  * Reverse Shading group submission order.
  */
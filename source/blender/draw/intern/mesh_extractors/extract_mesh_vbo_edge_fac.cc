@@ -37,7 +37,8 @@ namespace blender::draw {
 struct MeshExtract_EdgeFac_Data {
   uchar *vbo_data;
   bool use_edge_render;
-  /* Number of loop per edge. */
+  /* Number of loop per edge. Precomputed in the init function so that the iteration functions
+   * only read it and extraction can run over parallel ranges. */
   uchar *edge_loop_count;
 };
 
@@ -74,9 +75,6 @@ static void extract_edge_fac_init(const MeshRenderData *mr,
   MeshExtract_EdgeFac_Data *data = static_cast<MeshExtract_EdgeFac_Data *>(tls_data);
 
   if (mr->extract_type == MR_EXTRACT_MESH) {
-    data->edge_loop_count = static_cast<uchar *>(
-        MEM_callocN(sizeof(uint32_t) * mr->edge_len, __func__));
-
     /* HACK(fclem) Detecting the need for edge render.
      * We could have a flag in the mesh instead or check the modifier stack. */
     const MEdge *med = mr->medge;
@@ -86,6 +84,18 @@ static void extract_edge_fac_init(const MeshRenderData *mr,
         break;
       }
     }
+
+    if (!data->use_edge_render) {
+      /* Count loops per edge to detect non-manifold edges. */
+      data->edge_loop_count = static_cast<uchar *>(
+          MEM_callocN(sizeof(uchar) * mr->edge_len, __func__));
+      const MLoop *ml = mr->mloop;
+      for (int ml_index = 0; ml_index < mr->loop_len; ml_index++, ml++) {
+        if (data->edge_loop_count[ml->e] < 3) {
+          data->edge_loop_count[ml->e]++;
+        }
+      }
+    }
   }
   else {
     /* HACK to bypass non-manifold check in mesh_edge_fac_finish(). */
@@ -136,11 +146,6 @@ static void extract_edge_fac_iter_poly_mesh(const MeshRenderData *mr,
       data->vbo_data[ml_index] = (med->flag & ME_EDGERENDER) ? 255 : 0;
     }
     else {
-
-      /* Count loop per edge to detect non-manifold. */
-      if (data->edge_loop_count[ml->e] < 3) {
-        data->edge_loop_count[ml->e]++;
-      }
       if (data->edge_loop_count[ml->e] == 2) {
         /* Manifold */
         const int ml_index_last = mp->totloop + mp->loopstart - 1;
@@ -227,7 +232,7 @@ constexpr MeshExtract create_extractor_edge_fac()
   extractor.finish = extract_edge_fac_finish;
   extractor.data_type = MR_DATA_POLY_NOR;
   extractor.data_size = sizeof(MeshExtract_EdgeFac_Data);
-  extractor.use_threading = false;
+  extractor.use_threading = true;
   extractor.mesh_buffer_offset = offsetof(MeshBufferList, vbo.edge_fac);
   return extractor;
 }
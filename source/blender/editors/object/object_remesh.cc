@@ -127,21 +127,71 @@ static bool object_remesh_poll(bContext *C)
   return ED_operator_object_active_editable_mesh(C);
 }
 
-static int voxel_remesh_exec(bContext *C, wmOperator *op)
+struct VoxelRemeshJob {
+  /* from wmJob */
+  struct Object *owner;
+  short *stop, *do_update;
+  float *progress;
+
+  Scene *scene;
+
+  int success;
+  bool is_nonblocking_job;
+};
+
+static void voxel_remesh_free_job(void *customdata)
 {
-  Object *ob = CTX_data_active_object(C);
+  VoxelRemeshJob *vj = static_cast<VoxelRemeshJob *>(customdata);
+  MEM_freeN(vj);
+}
 
-  Mesh *mesh = static_cast<Mesh *>(ob->data);
+/* Called by the voxel remesh job to check the job 'stop' value. */
+static int voxel_remesh_break_job(void *customdata)
+{
+  VoxelRemeshJob *vj = (VoxelRemeshJob *)customdata;
 
-  if (mesh->remesh_voxel_size <= 0.0f) {
-    BKE_report(op->reports, RPT_ERROR, "Voxel remesher cannot run with a voxel size of 0.0");
-    return OPERATOR_CANCELLED;
+  /* See quadriflow_break_job, reusing the render break for now. */
+  bool should_break = (G.is_break);
+
+  if (should_break) {
+    vj->success = -1;
   }
 
-  if (mesh->totpoly == 0) {
-    return OPERATOR_CANCELLED;
+  return should_break;
+}
+
+/** Called from the level set conversion, #wmJob sends notifier. */
+static void voxel_remesh_update_job(void *customdata, float progress, int *cancel)
+{
+  VoxelRemeshJob *vj = static_cast<VoxelRemeshJob *>(customdata);
+
+  if (voxel_remesh_break_job(vj)) {
+    *cancel = 1;
+  }
+  else {
+    *cancel = 0;
+  }
+
+  *(vj->do_update) = true;
+  *(vj->progress) = progress;
+}
+
+static void voxel_remesh_start_job(void *customdata, short *stop, short *do_update, float *progress)
+{
+  VoxelRemeshJob *vj = static_cast<VoxelRemeshJob *>(customdata);
+
+  vj->stop = stop;
+  vj->do_update = do_update;
+  vj->progress = progress;
+  vj->success = 1;
+
+  if (vj->is_nonblocking_job) {
+    G.is_break = false; /* XXX shared with render - replace with job 'stop' switch */
   }
 
+  Object *ob = vj->owner;
+  Mesh *mesh = static_cast<Mesh *>(ob->data);
+
   /* Output mesh will be all smooth or all flat shading. */
   const bool smooth_normals = mesh->mpoly[0].flag & ME_SMOOTH;
 
@@ -150,16 +200,25 @@ static int voxel_remesh_exec(bContext *C, wmOperator *op)
     isovalue = mesh->remesh_voxel_size * 0.3f;
   }
 
-  Mesh *new_mesh = BKE_mesh_remesh_voxel(
-      mesh, mesh->remesh_voxel_size, mesh->remesh_voxel_adaptivity, isovalue);
+  Mesh *new_mesh = BKE_mesh_remesh_voxel(mesh,
+                                         mesh->remesh_voxel_size,
+                                         mesh->remesh_voxel_adaptivity,
+                                         isovalue,
+                                         voxel_remesh_update_job,
+                                         (void *)vj);
 
   if (!new_mesh) {
-    BKE_report(op->reports, RPT_ERROR, "Voxel remesher failed to create mesh");
-    return OPERATOR_CANCELLED;
+    *do_update = true;
+    *stop = 0;
+    if (vj->success == 1) {
+      /* This is not a user cancellation event. */
+      vj->success = 0;
+    }
+    return;
   }
 
   if (ob->mode == OB_MODE_SCULPT) {
-    ED_sculpt_undo_geometry_begin(ob, op->type->name);
+    ED_sculpt_undo_geometry_begin(ob, "Voxel Remesh");
   }
 
   if (mesh->flag & ME_REMESH_FIX_POLES && mesh->remesh_voxel_adaptivity <= 0.0f) {
@@ -199,13 +258,88 @@ static int voxel_remesh_exec(bContext *C, wmOperator *op)
   }
 
   if (ob->mode == OB_MODE_SCULPT) {
-    BKE_sculpt_ensure_orig_mesh_data(CTX_data_scene(C), ob);
+    BKE_sculpt_ensure_orig_mesh_data(vj->scene, ob);
     ED_sculpt_undo_geometry_end(ob);
   }
 
   BKE_mesh_batch_cache_dirty_tag(static_cast<Mesh *>(ob->data), BKE_MESH_BATCH_DIRTY_ALL);
-  DEG_id_tag_update(&ob->id, ID_RECALC_GEOMETRY);
-  WM_event_add_notifier(C, NC_GEOM | ND_DATA, ob->data);
+
+  *do_update = true;
+  *stop = 0;
+}
+
+static void voxel_remesh_end_job(void *customdata)
+{
+  VoxelRemeshJob *vj = (VoxelRemeshJob *)customdata;
+
+  Object *ob = vj->owner;
+
+  if (vj->is_nonblocking_job) {
+    WM_set_locked_interface(static_cast<wmWindowManager *>(G_MAIN->wm.first), false);
+  }
+
+  switch (vj->success) {
+    case 1:
+      DEG_id_tag_update(&ob->id, ID_RECALC_GEOMETRY);
+      WM_reportf(RPT_INFO, "Voxel remesher completed");
+      break;
+    case 0:
+      WM_reportf(RPT_ERROR, "Voxel remesher failed to create mesh");
+      break;
+    case -1:
+      WM_report(RPT_WARNING, "Voxel remesher cancelled");
+      break;
+  }
+}
+
+static int voxel_remesh_exec(bContext *C, wmOperator *op)
+{
+  Object *ob = CTX_data_active_object(C);
+
+  Mesh *mesh = static_cast<Mesh *>(ob->data);
+
+  if (mesh->remesh_voxel_size <= 0.0f) {
+    BKE_report(op->reports, RPT_ERROR, "Voxel remesher cannot run with a voxel size of 0.0");
+    return OPERATOR_CANCELLED;
+  }
+
+  if (mesh->totpoly == 0) {
+    return OPERATOR_CANCELLED;
+  }
+
+  VoxelRemeshJob *job = (VoxelRemeshJob *)MEM_mallocN(sizeof(VoxelRemeshJob), "VoxelRemeshJob");
+
+  job->owner = ob;
+  job->scene = CTX_data_scene(C);
+
+  if (op->flag == 0) {
+    /* This is called directly from the exec operator, this operation is now blocking */
+    job->is_nonblocking_job = false;
+    short stop = 0, do_update = true;
+    float progress;
+    voxel_remesh_start_job(job, &stop, &do_update, &progress);
+    voxel_remesh_end_job(job);
+    voxel_remesh_free_job(job);
+  }
+  else {
+    /* Non blocking call. For when the operator has been called from the GUI. */
+    job->is_nonblocking_job = true;
+
+    wmJob *wm_job = WM_jobs_get(CTX_wm_manager(C),
+                                CTX_wm_window(C),
+                                CTX_data_scene(C),
+                                "Voxel Remesh",
+                                WM_JOB_PROGRESS,
+                                WM_JOB_TYPE_VOXEL_REMESH);
+
+    WM_jobs_customdata_set(wm_job, job, voxel_remesh_free_job);
+    WM_jobs_timer(wm_job, 0.1, NC_GEOM | ND_DATA, NC_GEOM | ND_DATA);
+    WM_jobs_callbacks(wm_job, voxel_remesh_start_job, nullptr, nullptr, voxel_remesh_end_job);
+
+    WM_set_locked_interface(CTX_wm_manager(C), true);
+
+    WM_jobs_start(CTX_wm_manager(C), wm_job);
+  }
 
   return OPERATOR_FINISHED;
 }
@@ -149,6 +149,8 @@ typedef struct IconPreviewSize {
 } IconPreviewSize;
 
 typedef struct IconPreview {
+  struct IconPreview *next, *prev;
+
   Main *bmain;
   Depsgraph *depsgraph; /* May be NULL (see #WM_OT_previews_ensure). */
   Scene *scene;
@@ -159,8 +161,23 @@ typedef struct IconPreview {
   /* May be NULL, is used for rendering IDs that require some other object for it to be applied on
    * before the ID can be represented as an image, for example when rendering an Action. */
   struct Object *active_object;
+
+  /* Set when all sizes were rendered, so a preview of an interrupted batch is not marked as
+   * finished and gets re-queued by the UI instead. */
+  bool rendered;
 } IconPreview;
 
+/* All icon previews queued while a job is pending are batched into that one job, so a library
+ * refresh queuing hundreds of previews starts a single job instead of hundreds of serial ones. */
+typedef struct IconPreviewBatch {
+  ListBase previews; /* #IconPreview */
+} IconPreviewBatch;
+
+/* Name of the #Render shared by all icon preview renders. Icon results are copied to their
+ * preview image right after rendering, so unlike buttons previews there is no drawing code that
+ * needs a render per owner, and sharing lets a batch reuse one engine (see #RE_PreviewRender). */
+#define ICON_RENDER_SHARED_NAME "Icon Preview"
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -1168,7 +1185,26 @@ static void shader_preview_render(ShaderPreview *sp, ID *id, int split, int firs
     return;
   }
 
-  if (!split || first) {
+  if (sp->pr_method == PR_ICON_RENDER) {
+    /* The engine and its depsgraph may be reused from a previous icon render (see
+     * #RE_PreviewRender), while preview_prepare_scene() swaps datablocks in and out of the
+     * preview main directly. Tag relations and the IDs holding swapped pointers so a reused
+     * depsgraph picks the changes up. */
+    DEG_relations_tag_update(pr_main);
+    DEG_id_tag_update_ex(pr_main, &sce->id, ID_RECALC_BASE_FLAGS | ID_RECALC_COPY_ON_WRITE);
+    if (sce->world != NULL) {
+      DEG_id_tag_update_ex(pr_main, &sce->world->id, ID_RECALC_SHADING | ID_RECALC_COPY_ON_WRITE);
+    }
+    ViewLayer *view_layer = sce->view_layers.first;
+    LISTBASE_FOREACH (Base *, base, &view_layer->object_bases) {
+      if (base->object->id.name[2] == 'p') {
+        DEG_id_tag_update_ex(pr_main, &base->object->id, ID_RECALC_COPY_ON_WRITE);
+      }
+    }
+
+    BLI_strncpy(name, ICON_RENDER_SHARED_NAME, sizeof(name));
+  }
+  else if (!split || first) {
     sprintf(name, "Preview %p", sp->owner);
   }
   else {
@@ -1220,8 +1256,9 @@ static void shader_preview_render(ShaderPreview *sp, ID *id, int split, int firs
     shader_preview_texture(sp, (Tex *)id, sce, re);
   }
   else {
-    /* Render preview scene */
-    RE_PreviewRender(re, pr_main, sce);
+    /* Render preview scene. For icons, keep the engine alive for the next render in the batch;
+     * #icon_preview_startjob_all_sizes frees it when the whole batch is done. */
+    RE_PreviewRender(re, pr_main, sce, sp->pr_method == PR_ICON_RENDER);
   }
 
   ((Camera *)sce->camera->data)->lens = oldlens;
@@ -1629,12 +1666,11 @@ static int icon_previewimg_size_index_get(const IconPreviewSize *icon_size,
   return -1;
 }
 
-static void icon_preview_startjob_all_sizes(void *customdata,
-                                            short *stop,
-                                            short *do_update,
-                                            float *progress)
+static void icon_preview_render_all_sizes(IconPreview *ip,
+                                          short *stop,
+                                          short *do_update,
+                                          float *progress)
 {
-  IconPreview *ip = (IconPreview *)customdata;
   IconPreviewSize *cur_size;
 
   for (cur_size = ip->sizes.first; cur_size; cur_size = cur_size->next) {
@@ -1651,6 +1687,13 @@ static void icon_preview_startjob_all_sizes(void *customdata,
       continue;
     }
 
+    /* The size may have been finished already if this preview was re-queued while its previous
+     * batch was winding down, nothing to do then. */
+    const int size_index = icon_previewimg_size_index_get(cur_size, prv);
+    if (BKE_previewimg_is_finished(prv, size_index)) {
+      continue;
+    }
+
     /* check_engine_supports_preview() checks whether the engine supports "preview mode" (think:
      * Material Preview). This check is only relevant when the render function called below is
      * going to use such a mode. Object and Action render functions use Solid mode, though, so
@@ -1663,13 +1706,6 @@ static void icon_preview_startjob_all_sizes(void *customdata,
       continue;
     }
 
-#ifndef NDEBUG
-    {
-      int size_index = icon_previewimg_size_index_get(cur_size, prv);
-      BLI_assert(!BKE_previewimg_is_finished(prv, size_index));
-    }
-#endif
-
     if (ip->id != NULL) {
       switch (GS(ip->id->name)) {
         case ID_OB:
@@ -1686,6 +1722,36 @@ static void icon_preview_startjob_all_sizes(void *customdata,
     }
     other_id_types_preview_render(ip, cur_size, pr_method, stop, do_update, progress);
   }
+
+  ip->rendered = (*stop == 0);
+}
+
+static void icon_preview_startjob_all_sizes(void *customdata,
+                                            short *stop,
+                                            short *do_update,
+                                            float *progress)
+{
+  IconPreviewBatch *batch = (IconPreviewBatch *)customdata;
+  const int previews_num = BLI_listbase_count(&batch->previews);
+  int previews_done = 0;
+
+  LISTBASE_FOREACH (IconPreview *, ip, &batch->previews) {
+    if (*stop) {
+      break;
+    }
+
+    icon_preview_render_all_sizes(ip, stop, do_update, progress);
+
+    previews_done++;
+    *progress = (float)previews_done / (float)previews_num;
+  }
+
+  /* The preview engine and its depsgraph are kept alive between the icons of the batch, free
+   * them from this thread like the renders themselves (see #RE_PreviewRender). */
+  Render *re = RE_GetRender(ICON_RENDER_SHARED_NAME);
+  if (re != NULL) {
+    RE_PreviewRenderFreeEngine(re);
+  }
 }
 
 static void icon_preview_add_size(IconPreview *ip, uint *rect, int sizex, int sizey)
@@ -1711,62 +1777,87 @@ static void icon_preview_add_size(IconPreview *ip, uint *rect, int sizex, int si
 
 static void icon_preview_endjob(void *customdata)
 {
-  IconPreview *ip = customdata;
+  IconPreviewBatch *batch = customdata;
 
-  if (ip->id) {
+  LISTBASE_FOREACH (IconPreview *, ip, &batch->previews) {
+    if (ip->id) {
 
-    if (GS(ip->id->name) == ID_BR) {
-      WM_main_add_notifier(NC_BRUSH | NA_EDITED, ip->id);
-    }
+      if (GS(ip->id->name) == ID_BR) {
+        WM_main_add_notifier(NC_BRUSH | NA_EDITED, ip->id);
+      }
 #if 0
-    if (GS(ip->id->name) == ID_MA) {
-      Material *ma = (Material *)ip->id;
-      PreviewImage *prv_img = ma->preview;
-      int i;
-
-      /* signal to gpu texture */
-      for (i = 0; i < NUM_ICON_SIZES; i++) {
-        if (prv_img->gputexture[i]) {
-          GPU_texture_free(prv_img->gputexture[i]);
-          prv_img->gputexture[i] = NULL;
-          WM_main_add_notifier(NC_MATERIAL | ND_SHADING_DRAW, ip->id);
+      if (GS(ip->id->name) == ID_MA) {
+        Material *ma = (Material *)ip->id;
+        PreviewImage *prv_img = ma->preview;
+        int i;
+
+        /* signal to gpu texture */
+        for (i = 0; i < NUM_ICON_SIZES; i++) {
+          if (prv_img->gputexture[i]) {
+            GPU_texture_free(prv_img->gputexture[i]);
+            prv_img->gputexture[i] = NULL;
+            WM_main_add_notifier(NC_MATERIAL | ND_SHADING_DRAW, ip->id);
+          }
         }
       }
-    }
 #endif
-  }
+    }
 
-  if (ip->owner) {
-    PreviewImage *prv_img = ip->owner;
-    prv_img->tag &= ~PRV_TAG_DEFFERED_RENDERING;
+    if (ip->owner) {
+      PreviewImage *prv_img = ip->owner;
+      prv_img->tag &= ~PRV_TAG_DEFFERED_RENDERING;
 
-    LISTBASE_FOREACH (IconPreviewSize *, icon_size, &ip->sizes) {
-      int size_index = icon_previewimg_size_index_get(icon_size, prv_img);
-      BKE_previewimg_finish(prv_img, size_index);
-    }
+      /* Previews an interrupted batch did not get to are not finished, the UI re-queues them. */
+      if (ip->rendered) {
+        LISTBASE_FOREACH (IconPreviewSize *, icon_size, &ip->sizes) {
+          int size_index = icon_previewimg_size_index_get(icon_size, prv_img);
+          BKE_previewimg_finish(prv_img, size_index);
+        }
+      }
+
+      if (prv_img->tag & PRV_TAG_DEFFERED_DELETE) {
+        BLI_assert(prv_img->tag & PRV_TAG_DEFFERED);
+        BKE_previewimg_deferred_release(prv_img);
+      }
 
-    if (prv_img->tag & PRV_TAG_DEFFERED_DELETE) {
-      BLI_assert(prv_img->tag & PRV_TAG_DEFFERED);
-      BKE_previewimg_deferred_release(prv_img);
+      /* Signal icon_preview_free() that this preview image is dealt with. */
+      ip->owner = NULL;
     }
   }
 }
 
 static void icon_preview_free(void *customdata)
 {
-  IconPreview *ip = (IconPreview *)customdata;
+  IconPreviewBatch *batch = (IconPreviewBatch *)customdata;
+
+  LISTBASE_FOREACH_MUTABLE (IconPreview *, ip, &batch->previews) {
+    if (ip->owner) {
+      /* This batch was replaced before it ran (no endjob), release the tags that would keep the
+       * unrendered preview images from being re-queued or deleted. */
+      PreviewImage *prv_img = ip->owner;
+      if (prv_img->tag & PRV_TAG_DEFFERED_RENDERING) {
+        prv_img->tag &= ~PRV_TAG_DEFFERED_RENDERING;
+        if (prv_img->tag & PRV_TAG_DEFFERED_DELETE) {
+          BKE_previewimg_deferred_release(prv_img);
+        }
+      }
+    }
 
-  if (ip->id_copy) {
-    preview_id_copy_free(ip->id_copy);
+    if (ip->id_copy) {
+      preview_id_copy_free(ip->id_copy);
+    }
+
+    BLI_freelistN(&ip->sizes);
+    BLI_freelinkN(&batch->previews, ip);
   }
 
-  BLI_freelistN(&ip->sizes);
-  MEM_freeN(ip);
+  MEM_freeN(batch);
 }
 
 void ED_preview_icon_render(
     const bContext *C, Scene *scene, ID *id, uint *rect, int sizex, int sizey)
 {
+  IconPreviewBatch batch = {{NULL}};
   IconPreview ip = {NULL};
   short stop = false, update = false;
   float progress = 0.0f;
@@ -1785,9 +1876,11 @@ void ED_preview_icon_render(
 
   icon_preview_add_size(&ip, rect, sizex, sizey);
 
-  icon_preview_startjob_all_sizes(&ip, &stop, &update, &progress);
+  BLI_addtail(&batch.previews, &ip);
+
+  icon_preview_startjob_all_sizes(&batch, &stop, &update, &progress);
 
-  icon_preview_endjob(&ip);
+  icon_preview_endjob(&batch);
 
   BLI_freelistN(&ip.sizes);
   if (ip.id_copy != NULL) {
@@ -1798,35 +1891,58 @@ void ED_preview_icon_render(
 void ED_preview_icon_job(
     const bContext *C, void *owner, ID *id, uint *rect, int sizex, int sizey, const bool delay)
 {
+  wmWindowManager *wm = CTX_wm_manager(C);
   wmJob *wm_job;
-  IconPreview *ip, *old_ip;
+  IconPreviewBatch *batch;
+  IconPreview *ip = NULL;
 
   ED_preview_ensure_dbase();
 
-  /* suspended start means it starts after 1 timer step, see WM_jobs_timer below */
-  wm_job = WM_jobs_get(CTX_wm_manager(C),
+  /* All queued icon previews share a single job owned by the window manager, so a library
+   * refresh queuing hundreds of previews renders them as one batch instead of hundreds of
+   * consecutive jobs, each paying for scene evaluation (suspended start means the job starts
+   * after 1 timer step, see WM_jobs_timer below). */
+  wm_job = WM_jobs_get(wm,
                        CTX_wm_window(C),
-                       owner,
+                       wm,
                        "Icon Preview",
-                       WM_JOB_EXCL_RENDER,
+                       WM_JOB_EXCL_RENDER | WM_JOB_PROGRESS,
                        WM_JOB_TYPE_RENDER_PREVIEW);
 
-  ip = MEM_callocN(sizeof(IconPreview), "icon preview");
+  batch = MEM_callocN(sizeof(IconPreviewBatch), "icon preview batch");
+
+  /* Add previews from a not-yet-started batch to this one. A running batch cannot be touched;
+   * it is signalled to stop by #WM_jobs_customdata_set below, and previews it does not get to
+   * are re-queued when the UI draws them again. */
+  if (!WM_jobs_is_running(wm_job)) {
+    IconPreviewBatch *old_batch = WM_jobs_customdata_get(wm_job);
+    if (old_batch) {
+      BLI_movelisttolist(&batch->previews, &old_batch->previews);
+    }
+  }
 
-  /* render all resolutions from suspended job too */
-  old_ip = WM_jobs_customdata_get(wm_job);
-  if (old_ip) {
-    BLI_movelisttolist(&ip->sizes, &old_ip->sizes);
+  /* Render all resolutions of an already batched preview in the same entry. */
+  LISTBASE_FOREACH (IconPreview *, ip_iter, &batch->previews) {
+    if (ip_iter->owner == owner) {
+      ip = ip_iter;
+      break;
+    }
   }
 
-  /* customdata for preview thread */
-  ip->bmain = CTX_data_main(C);
-  ip->depsgraph = CTX_data_ensure_evaluated_depsgraph(C);
-  ip->scene = DEG_get_input_scene(ip->depsgraph);
-  ip->active_object = CTX_data_active_object(C);
-  ip->owner = owner;
-  ip->id = id;
-  ip->id_copy = duplicate_ids(id, false);
+  if (ip == NULL) {
+    ip = MEM_callocN(sizeof(IconPreview), "icon preview");
+
+    /* customdata for preview thread */
+    ip->bmain = CTX_data_main(C);
+    ip->depsgraph = CTX_data_ensure_evaluated_depsgraph(C);
+    ip->scene = DEG_get_input_scene(ip->depsgraph);
+    ip->active_object = CTX_data_active_object(C);
+    ip->owner = owner;
+    ip->id = id;
+    ip->id_copy = duplicate_ids(id, false);
+
+    BLI_addtail(&batch->previews, ip);
+  }
 
   icon_preview_add_size(ip, rect, sizex, sizey);
 
@@ -1840,7 +1956,7 @@ void ED_preview_icon_job(
   }
 
   /* setup job */
-  WM_jobs_customdata_set(wm_job, ip, icon_preview_free);
+  WM_jobs_customdata_set(wm_job, batch, icon_preview_free);
   WM_jobs_timer(wm_job, 0.1, NC_WINDOW, NC_WINDOW);
   /* Wait 2s to start rendering icon previews, to not bog down user interaction.
    * Particularly important for heavy scenes and Eevee using OpenGL that blocks
@@ -1848,7 +1964,7 @@ void ED_preview_icon_job(
   WM_jobs_delay_start(wm_job, (delay) ? 2.0 : 0.0);
   WM_jobs_callbacks(wm_job, icon_preview_startjob_all_sizes, NULL, NULL, icon_preview_endjob);
 
-  WM_jobs_start(CTX_wm_manager(C), wm_job);
+  WM_jobs_start(wm, wm_job);
 }
 
 void ED_preview_shader_job(const bContext *C,
@@ -380,6 +380,58 @@ static void brush_painter_mask_imbuf_partial_update(BrushPainter *painter,
   cache->tex_mask_old_h = diameter;
 }
 
+typedef struct CurveMaskForeachData {
+  ushort *mask;
+  Brush *brush;
+  int diameter;
+  float radius;
+  int aa_samples;
+  float aa_step;
+  float bpos[2];
+  float co, si;
+  float hardness;
+  float norm_factor;
+} CurveMaskForeachData;
+
+static void brush_painter_curve_mask_foreach_do(void *__restrict data_v,
+                                                const int y,
+                                                const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  CurveMaskForeachData *data = (CurveMaskForeachData *)data_v;
+  const int diameter = data->diameter;
+  const int aa_samples = data->aa_samples;
+  ushort *m = data->mask + (size_t)y * diameter;
+
+  for (int x = 0; x < diameter; x++, m++) {
+    float total_samples = 0;
+    for (int i = 0; i < aa_samples; i++) {
+      for (int j = 0; j < aa_samples; j++) {
+        float pixel_xy[2] = {x + (data->aa_step * i), y + (data->aa_step * j)};
+        float xy_rot[2];
+        sub_v2_v2(pixel_xy, data->bpos);
+
+        xy_rot[0] = data->co * pixel_xy[0] - data->si * pixel_xy[1];
+        xy_rot[1] = data->si * pixel_xy[0] + data->co * pixel_xy[1];
+
+        float len = len_v2(xy_rot);
+        float p = len / data->radius;
+        if (data->hardness < 1.0f) {
+          p = (p - data->hardness) / (1.0f - data->hardness);
+          p = 1.0f - p;
+          CLAMP(p, 0.0f, 1.0f);
+        }
+        else {
+          p = 1.0;
+        }
+        float hardness_factor = 3.0f * p * p - 2.0f * p * p * p;
+        float curve = BKE_brush_curve_strength_clamped(data->brush, len, data->radius);
+        total_samples += curve * hardness_factor;
+      }
+    }
+    *m = (ushort)(total_samples * data->norm_factor);
+  }
+}
+
 /* create a mask with the falloff strength */
 static ushort *brush_painter_curve_mask_new(BrushPainter *painter,
                                             int diameter,
@@ -390,10 +442,9 @@ static ushort *brush_painter_curve_mask_new(BrushPainter *painter,
 
   int offset = (int)floorf(diameter / 2.0f);
 
-  ushort *mask, *m;
+  ushort *mask;
 
   mask = MEM_mallocN(sizeof(ushort) * diameter * diameter, "brush_painter_mask");
-  m = mask;
 
   int aa_samples = 1.0f / (radius * 0.20f);
   if (brush->sampling_flag & BRUSH_PAINT_ANTIALIASING) {
@@ -408,47 +459,26 @@ static ushort *brush_painter_curve_mask_new(BrushPainter *painter,
   const float rotation = 0.0f;
 
   float aa_offset = 1.0f / (2.0f * (float)aa_samples);
-  float aa_step = 1.0f / (float)aa_samples;
 
-  float bpos[2];
-  bpos[0] = pos[0] - floorf(pos[0]) + offset - aa_offset;
-  bpos[1] = pos[1] - floorf(pos[1]) + offset - aa_offset;
-
-  const float co = cosf(DEG2RADF(rotation));
-  const float si = sinf(DEG2RADF(rotation));
-
-  float norm_factor = 65535.0f / (float)(aa_samples * aa_samples);
-
-  for (int y = 0; y < diameter; y++) {
-    for (int x = 0; x < diameter; x++, m++) {
-      float total_samples = 0;
-      for (int i = 0; i < aa_samples; i++) {
-        for (int j = 0; j < aa_samples; j++) {
-          float pixel_xy[2] = {x + (aa_step * i), y + (aa_step * j)};
-          float xy_rot[2];
-          sub_v2_v2(pixel_xy, bpos);
-
-          xy_rot[0] = co * pixel_xy[0] - si * pixel_xy[1];
-          xy_rot[1] = si * pixel_xy[0] + co * pixel_xy[1];
-
-          float len = len_v2(xy_rot);
-          float p = len / radius;
-          if (hardness < 1.0f) {
-            p = (p - hardness) / (1.0f - hardness);
-            p = 1.0f - p;
-            CLAMP(p, 0.0f, 1.0f);
-          }
-          else {
-            p = 1.0;
-          }
-          float hardness_factor = 3.0f * p * p - 2.0f * p * p * p;
-          float curve = BKE_brush_curve_strength_clamped(brush, len, radius);
-          total_samples += curve * hardness_factor;
-        }
-      }
-      *m = (ushort)(total_samples * norm_factor);
-    }
-  }
+  CurveMaskForeachData data;
+  data.mask = mask;
+  data.brush = brush;
+  data.diameter = diameter;
+  data.radius = radius;
+  data.aa_samples = aa_samples;
+  data.aa_step = 1.0f / (float)aa_samples;
+  data.bpos[0] = pos[0] - floorf(pos[0]) + offset - aa_offset;
+  data.bpos[1] = pos[1] - floorf(pos[1]) + offset - aa_offset;
+  data.co = cosf(DEG2RADF(rotation));
+  data.si = sinf(DEG2RADF(rotation));
+  data.hardness = hardness;
+  data.norm_factor = 65535.0f / (float)(aa_samples * aa_samples);
+
+  /* The brush curve was baked when the stroke started (see #paint_stroke_new),
+   * its evaluation is thread-safe here. */
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0, diameter, &data, brush_painter_curve_mask_foreach_do, &settings);
 
   return mask;
 }
@@ -1032,6 +1062,98 @@ static float paint_2d_ibuf_add_if(
   return w;
 }
 
+typedef struct LiftSoftenForeachData {
+  ImagePaintState *s;
+  ImBuf *ibuf;
+  ImBuf *ibufb;
+  int in_off[2];
+  int out_off[2];
+  int dim[2];
+  short paint_tile;
+  bool sharpen;
+  float threshold;
+} LiftSoftenForeachData;
+
+static void paint_2d_lift_soften_foreach_do(void *__restrict data_v,
+                                            const int y,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  LiftSoftenForeachData *data = (LiftSoftenForeachData *)data_v;
+  ImagePaintState *s = data->s;
+  ImBuf *ibuf = data->ibuf;
+  const short paint_tile = data->paint_tile;
+  BlurKernel *kernel = s->blurkernel;
+  int x, xi, yi, xo, yo, xk, yk;
+  float count;
+  float outrgb[4];
+  float rgba[4];
+
+  for (x = 0; x < data->dim[0]; x++) {
+    /* get input pixel */
+    xi = data->in_off[0] + x;
+    yi = data->in_off[1] + y;
+
+    count = 0.0;
+    if (paint_tile) {
+      paint_2d_ibuf_tile_convert(ibuf, &xi, &yi, paint_tile);
+      if (xi < ibuf->x && xi >= 0 && yi < ibuf->y && yi >= 0) {
+        paint_2d_ibuf_rgb_get(ibuf, xi, yi, rgba);
+      }
+      else {
+        zero_v4(rgba);
+      }
+    }
+    else {
+      /* coordinates have been clipped properly here, it should be safe to do this */
+      paint_2d_ibuf_rgb_get(ibuf, xi, yi, rgba);
+    }
+    zero_v4(outrgb);
+
+    for (yk = 0; yk < kernel->side; yk++) {
+      for (xk = 0; xk < kernel->side; xk++) {
+        count += paint_2d_ibuf_add_if(ibuf,
+                                      xi + xk - kernel->pixel_len,
+                                      yi + yk - kernel->pixel_len,
+                                      outrgb,
+                                      paint_tile,
+                                      kernel->wdata[xk + yk * kernel->side]);
+      }
+    }
+
+    if (count > 0.0f) {
+      mul_v4_fl(outrgb, 1.0f / (float)count);
+
+      if (data->sharpen) {
+        /* subtract blurred image from normal image gives high pass filter */
+        sub_v3_v3v3(outrgb, rgba, outrgb);
+
+        /* Now rgba_ub contains the edge result, but this should be converted to luminance to
+         * avoid colored speckles appearing in final image, and also to check for threshold. */
+        outrgb[0] = outrgb[1] = outrgb[2] = IMB_colormanagement_get_luminance(outrgb);
+        if (fabsf(outrgb[0]) > data->threshold) {
+          float mask = BKE_brush_alpha_get(s->scene, s->brush);
+          float alpha = rgba[3];
+          rgba[3] = outrgb[3] = mask;
+
+          /* add to enhance edges */
+          blend_color_add_float(outrgb, rgba, outrgb);
+          outrgb[3] = alpha;
+        }
+        else {
+          copy_v4_v4(outrgb, rgba);
+        }
+      }
+    }
+    else {
+      copy_v4_v4(outrgb, rgba);
+    }
+    /* write into brush buffer */
+    xo = data->out_off[0] + x;
+    yo = data->out_off[1] + y;
+    paint_2d_ibuf_rgb_set(data->ibufb, xo, yo, 0, outrgb);
+  }
+}
+
 static void paint_2d_lift_soften(ImagePaintState *s,
                                  ImagePaintTile *tile,
                                  ImBuf *ibuf,
@@ -1041,13 +1163,7 @@ static void paint_2d_lift_soften(ImagePaintState *s,
 {
   bool sharpen = (tile->cache.invert ^ ((s->brush->flag & BRUSH_DIR_IN) != 0));
   float threshold = s->brush->sharp_threshold;
-  int x, y, xi, yi, xo, yo, xk, yk;
-  float count;
   int out_off[2], in_off[2], dim[2];
-  int diff_pos[2];
-  float outrgb[4];
-  float rgba[4];
-  BlurKernel *kernel = s->blurkernel;
 
   dim[0] = ibufb->x;
   dim[1] = ibufb->y;
@@ -1063,75 +1179,20 @@ static void paint_2d_lift_soften(ImagePaintState *s,
     }
   }
 
-  /* find offset inside mask buffers to sample them */
-  sub_v2_v2v2_int(diff_pos, out_off, in_off);
-
-  for (y = 0; y < dim[1]; y++) {
-    for (x = 0; x < dim[0]; x++) {
-      /* get input pixel */
-      xi = in_off[0] + x;
-      yi = in_off[1] + y;
-
-      count = 0.0;
-      if (paint_tile) {
-        paint_2d_ibuf_tile_convert(ibuf, &xi, &yi, paint_tile);
-        if (xi < ibuf->x && xi >= 0 && yi < ibuf->y && yi >= 0) {
-          paint_2d_ibuf_rgb_get(ibuf, xi, yi, rgba);
-        }
-        else {
-          zero_v4(rgba);
-        }
-      }
-      else {
-        /* coordinates have been clipped properly here, it should be safe to do this */
-        paint_2d_ibuf_rgb_get(ibuf, xi, yi, rgba);
-      }
-      zero_v4(outrgb);
-
-      for (yk = 0; yk < kernel->side; yk++) {
-        for (xk = 0; xk < kernel->side; xk++) {
-          count += paint_2d_ibuf_add_if(ibuf,
-                                        xi + xk - kernel->pixel_len,
-                                        yi + yk - kernel->pixel_len,
-                                        outrgb,
-                                        paint_tile,
-                                        kernel->wdata[xk + yk * kernel->side]);
-        }
-      }
-
-      if (count > 0.0f) {
-        mul_v4_fl(outrgb, 1.0f / (float)count);
-
-        if (sharpen) {
-          /* subtract blurred image from normal image gives high pass filter */
-          sub_v3_v3v3(outrgb, rgba, outrgb);
-
-          /* Now rgba_ub contains the edge result, but this should be converted to luminance to
-           * avoid colored speckles appearing in final image, and also to check for threshold. */
-          outrgb[0] = outrgb[1] = outrgb[2] = IMB_colormanagement_get_luminance(outrgb);
-          if (fabsf(outrgb[0]) > threshold) {
-            float mask = BKE_brush_alpha_get(s->scene, s->brush);
-            float alpha = rgba[3];
-            rgba[3] = outrgb[3] = mask;
-
-            /* add to enhance edges */
-            blend_color_add_float(outrgb, rgba, outrgb);
-            outrgb[3] = alpha;
-          }
-          else {
-            copy_v4_v4(outrgb, rgba);
-          }
-        }
-      }
-      else {
-        copy_v4_v4(outrgb, rgba);
-      }
-      /* write into brush buffer */
-      xo = out_off[0] + x;
-      yo = out_off[1] + y;
-      paint_2d_ibuf_rgb_set(ibufb, xo, yo, 0, outrgb);
-    }
-  }
+  LiftSoftenForeachData data;
+  data.s = s;
+  data.ibuf = ibuf;
+  data.ibufb = ibufb;
+  copy_v2_v2_int(data.in_off, in_off);
+  copy_v2_v2_int(data.out_off, out_off);
+  copy_v2_v2_int(data.dim, dim);
+  data.paint_tile = paint_tile;
+  data.sharpen = sharpen;
+  data.threshold = threshold;
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0, dim[1], &data, paint_2d_lift_soften_foreach_do, &settings);
 }
 
 static void paint_2d_set_region(
@@ -850,6 +850,17 @@ void SCULPT_vertex_neighbors_get(SculptSession *ss,
                                  const bool include_duplicates,
                                  SculptVertexNeighborIter *iter)
 {
+  if (!include_duplicates && ss->neighbors_cache.offsets) {
+    const int start = ss->neighbors_cache.offsets[index];
+    iter->neighbors = &ss->neighbors_cache.neighbors[start];
+    iter->size = ss->neighbors_cache.offsets[index + 1] - start;
+    iter->capacity = iter->size;
+    iter->num_duplicates = 0;
+    iter->is_cached = true;
+    return;
+  }
+  iter->is_cached = false;
+
   switch (BKE_pbvh_type(ss->pbvh)) {
     case PBVH_FACES:
       sculpt_vertex_neighbors_get_faces(ss, index, iter);
@@ -863,6 +874,81 @@ void SCULPT_vertex_neighbors_get(SculptSession *ss,
   }
 }
 
+struct NeighborsCacheBuildData {
+  SculptSession *ss;
+  int *offsets;
+  int *neighbors;
+};
+
+static void sculpt_neighbors_cache_count_task_cb(void *__restrict userdata,
+                                                 const int i,
+                                                 const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct NeighborsCacheBuildData *build_data = userdata;
+  SculptVertexNeighborIter ni;
+  SCULPT_vertex_neighbors_get(build_data->ss, i, false, &ni);
+  /* Store at i + 1 so the prefix sum below turns counts into offsets. */
+  build_data->offsets[i + 1] = ni.size;
+  if (ni.neighbors != ni.neighbors_fixed) {
+    MEM_freeN(ni.neighbors);
+  }
+}
+
+static void sculpt_neighbors_cache_fill_task_cb(void *__restrict userdata,
+                                                const int i,
+                                                const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct NeighborsCacheBuildData *build_data = userdata;
+  SculptVertexNeighborIter ni;
+  SCULPT_vertex_neighbors_get(build_data->ss, i, false, &ni);
+  memcpy(&build_data->neighbors[build_data->offsets[i]], ni.neighbors, sizeof(int) * ni.size);
+  if (ni.neighbors != ni.neighbors_fixed) {
+    MEM_freeN(ni.neighbors);
+  }
+}
+
+void SCULPT_vertex_neighbors_cache_ensure(SculptSession *ss)
+{
+  if (ss->neighbors_cache.offsets != NULL) {
+    return;
+  }
+  if (BKE_pbvh_type(ss->pbvh) == PBVH_BMESH) {
+    /* Dynamic topology can change connectivity at any moment and vertex
+     * indices are not stable, there is nothing useful to cache. */
+    return;
+  }
+
+  const int totvert = SCULPT_vertex_count_get(ss);
+
+  struct NeighborsCacheBuildData build_data;
+  build_data.ss = ss;
+  build_data.offsets = MEM_callocN(sizeof(int) * ((size_t)totvert + 1),
+                                   "SculptNeighborsCache.offsets");
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+
+  BLI_task_parallel_range(0, totvert, &build_data, sculpt_neighbors_cache_count_task_cb, &settings);
+
+  for (int i = 1; i <= totvert; i++) {
+    build_data.offsets[i] += build_data.offsets[i - 1];
+  }
+
+  build_data.neighbors = MEM_mallocN(sizeof(int) * (size_t)build_data.offsets[totvert],
+                                     "SculptNeighborsCache.neighbors");
+  BLI_task_parallel_range(0, totvert, &build_data, sculpt_neighbors_cache_fill_task_cb, &settings);
+
+  ss->neighbors_cache.offsets = build_data.offsets;
+  ss->neighbors_cache.neighbors = build_data.neighbors;
+}
+
+void SCULPT_vertex_neighbors_cache_free(SculptSession *ss)
+{
+  MEM_SAFE_FREE(ss->neighbors_cache.offsets);
+  MEM_SAFE_FREE(ss->neighbors_cache.neighbors);
+}
+
 static bool sculpt_check_boundary_vertex_in_base_mesh(const SculptSession *ss, const int index)
 {
   BLI_assert(ss->vertex_info.boundary);
@@ -7744,6 +7830,11 @@ void SCULPT_flush_update_step(bContext *C, SculptUpdateType update_flags)
     multires_mark_as_modified(depsgraph, ob, MULTIRES_COORDS_MODIFIED);
   }
 
+  if (update_flags & (SCULPT_UPDATE_COORDS | SCULPT_UPDATE_VISIBILITY)) {
+    /* Changed coordinates or connectivity invalidate cached geodesic distances. */
+    SCULPT_geodesic_cache_free(ss);
+  }
+
   DEG_id_tag_update(&ob->id, ID_RECALC_SHADING);
 
   /* Only current viewport matters, slower update for all viewports will
@@ -7767,6 +7858,10 @@ void SCULPT_flush_update_step(bContext *C, SculptUpdateType update_flags)
       SCULPT_update_object_bounding_box(ob);
     }
 
+    /* Start filling the changed nodes' draw buffers on worker threads already,
+     * the redraw below then only has to do the GPU upload. */
+    BKE_pbvh_draw_buffers_update_async(ss->pbvh);
+
     if (SCULPT_get_redraw_rect(region, CTX_wm_region_view3d(C), ob, &r)) {
       if (ss->cache) {
         ss->cache->current_r = r;
@@ -7906,6 +8001,11 @@ static void sculpt_stroke_update_step(bContext *C,
 
   SCULPT_stroke_modifiers_check(C, ob, brush);
   sculpt_update_cache_variants(C, sd, ob, itemptr);
+
+  /* Draw buffer extraction from the previous step may still be running
+   * in the background, join it before modifying the mesh again. */
+  BKE_pbvh_draw_buffers_join(ss->pbvh);
+
   sculpt_restore_mesh(sd, ob);
 
   if (sd->flags & (SCULPT_DYNTOPO_DETAIL_CONSTANT | SCULPT_DYNTOPO_DETAIL_MANUAL)) {
@@ -192,6 +192,8 @@ void SCULPT_filter_cache_free(SculptSession *ss)
   MEM_SAFE_FREE(ss->filter_cache->detail_directions);
   MEM_SAFE_FREE(ss->filter_cache->limit_surface_co);
   MEM_SAFE_FREE(ss->filter_cache);
+
+  SCULPT_vertex_neighbors_cache_free(ss);
 }
 
 typedef enum eSculptMeshFilterType {
@@ -705,6 +707,12 @@ static int sculpt_mesh_filter_invoke(bContext *C, wmOperator *op, const wmEvent
 
   SCULPT_filter_cache_init(C, ob, sd, SCULPT_UNDO_COORDS);
 
+  if (sculpt_mesh_filter_needs_pmap(filter_type)) {
+    /* Whole-mesh filters iterate the neighbors of every vertex on each modal
+     * step, cache the connectivity for the duration of the filter. */
+    SCULPT_vertex_neighbors_cache_ensure(ss);
+  }
+
   FilterCache *filter_cache = ss->filter_cache;
   filter_cache->active_face_set = SCULPT_FACE_SET_NONE;
   filter_cache->automasking = SCULPT_automasking_cache_init(sd, NULL, ob);
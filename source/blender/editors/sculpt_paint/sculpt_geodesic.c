@@ -112,6 +112,26 @@ static bool sculpt_geodesic_mesh_test_dist_add(
   return false;
 }
 
+/* Check if all seeds of the cached distance field are part of the current seed set. */
+static bool sculpt_geodesic_cache_is_subset(const SculptGeodesicCache *cache,
+                                            GSet *initial_vertices)
+{
+  for (int i = 0; i < cache->initial_vertices_num; i++) {
+    if (!BLI_gset_haskey(initial_vertices, POINTER_FROM_INT(cache->initial_vertices[i]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void SCULPT_geodesic_cache_free(SculptSession *ss)
+{
+  MEM_SAFE_FREE(ss->geodesic_cache.initial_vertices);
+  ss->geodesic_cache.initial_vertices_num = 0;
+  MEM_SAFE_FREE(ss->geodesic_cache.dists);
+  ss->geodesic_cache.totvert = 0;
+}
+
 static float *SCULPT_geodesic_mesh_create(Object *ob,
                                           GSet *initial_vertices,
                                           const float limit_radius)
@@ -127,6 +147,20 @@ static float *SCULPT_geodesic_mesh_create(Object *ob,
   MEdge *edges = mesh->medge;
   MVert *verts = SCULPT_mesh_deformed_mverts_get(ss);
 
+  /* When the new seed set contains all cached seeds, distances can only decrease, so the
+   * propagation can start from the cached field and only flood the wavefront of the added seeds
+   * instead of traversing the entire mesh. Repeated Expand invocations hit this path constantly:
+   * identical seeds return a copy of the cache, slightly changed seeds update incrementally.
+   * Only used without a limit radius, which is how Expand requests the field. */
+  SculptGeodesicCache *cache = &ss->geodesic_cache;
+  const bool cache_usable = (limit_radius == FLT_MAX) && cache->dists &&
+                            cache->totvert == totvert &&
+                            sculpt_geodesic_cache_is_subset(cache, initial_vertices);
+
+  if (cache_usable && cache->initial_vertices_num == BLI_gset_len(initial_vertices)) {
+    return MEM_dupallocN(cache->dists);
+  }
+
   float *dists = MEM_malloc_arrayN(totvert, sizeof(float), "distances");
   BLI_bitmap *edge_tag = BLI_BITMAP_NEW(totedge, "edge tag");
 
@@ -152,19 +186,28 @@ static float *SCULPT_geodesic_mesh_create(Object *ob,
   BLI_LINKSTACK_INIT(queue);
   BLI_LINKSTACK_INIT(queue_next);
 
-  for (int i = 0; i < totvert; i++) {
-    if (BLI_gset_haskey(initial_vertices, POINTER_FROM_INT(i))) {
-      dists[i] = 0.0f;
+  GSetIterator gs_iter;
+
+  if (cache_usable) {
+    memcpy(dists, cache->dists, sizeof(float) * (size_t)totvert);
+    GSET_ITER (gs_iter, initial_vertices) {
+      dists[POINTER_AS_INT(BLI_gsetIterator_getKey(&gs_iter))] = 0.0f;
     }
-    else {
-      dists[i] = FLT_MAX;
+  }
+  else {
+    for (int i = 0; i < totvert; i++) {
+      if (BLI_gset_haskey(initial_vertices, POINTER_FROM_INT(i))) {
+        dists[i] = 0.0f;
+      }
+      else {
+        dists[i] = FLT_MAX;
+      }
     }
   }
 
   /* Masks vertices that are further than limit radius from an initial vertex. As there is no need
    * to define a distance to them the algorithm can stop earlier by skipping them. */
   BLI_bitmap *affected_vertex = BLI_BITMAP_NEW(totvert, "affected vertex");
-  GSetIterator gs_iter;
 
   if (limit_radius == FLT_MAX) {
     /* In this case, no need to loop through all initial vertices to check distances as they are
@@ -186,15 +229,30 @@ static float *SCULPT_geodesic_mesh_create(Object *ob,
     }
   }
 
-  /* Add edges adjacent to an initial vertex to the queue. */
-  for (int i = 0; i < totedge; i++) {
-    const int v1 = edges[i].v1;
-    const int v2 = edges[i].v2;
-    if (!BLI_BITMAP_TEST(affected_vertex, v1) && !BLI_BITMAP_TEST(affected_vertex, v2)) {
-      continue;
+  if (cache_usable) {
+    /* Only the seeds that were not part of the cached field can improve distances, seed the
+     * queue with their adjacent edges. */
+    GSET_ITER (gs_iter, initial_vertices) {
+      const int v = POINTER_AS_INT(BLI_gsetIterator_getKey(&gs_iter));
+      if (cache->dists[v] == 0.0f) {
+        continue;
+      }
+      for (int edge_map_index = 0; edge_map_index < ss->vemap[v].count; edge_map_index++) {
+        BLI_LINKSTACK_PUSH(queue, POINTER_FROM_INT(ss->vemap[v].indices[edge_map_index]));
+      }
     }
-    if (dists[v1] != FLT_MAX || dists[v2] != FLT_MAX) {
-      BLI_LINKSTACK_PUSH(queue, POINTER_FROM_INT(i));
+  }
+  else {
+    /* Add edges adjacent to an initial vertex to the queue. */
+    for (int i = 0; i < totedge; i++) {
+      const int v1 = edges[i].v1;
+      const int v2 = edges[i].v2;
+      if (!BLI_BITMAP_TEST(affected_vertex, v1) && !BLI_BITMAP_TEST(affected_vertex, v2)) {
+        continue;
+      }
+      if (dists[v1] != FLT_MAX || dists[v2] != FLT_MAX) {
+        BLI_LINKSTACK_PUSH(queue, POINTER_FROM_INT(i));
+      }
     }
   }
 
@@ -268,6 +326,20 @@ static float *SCULPT_geodesic_mesh_create(Object *ob,
   MEM_SAFE_FREE(edge_tag);
   MEM_SAFE_FREE(affected_vertex);
 
+  /* Store the new field for the next invocation. */
+  if (limit_radius == FLT_MAX && BLI_gset_len(initial_vertices) != 0) {
+    SCULPT_geodesic_cache_free(ss);
+    cache->initial_vertices_num = BLI_gset_len(initial_vertices);
+    cache->initial_vertices = MEM_malloc_arrayN(
+        cache->initial_vertices_num, sizeof(int), "SculptGeodesicCache.initial_vertices");
+    int seed_index = 0;
+    GSET_ITER (gs_iter, initial_vertices) {
+      cache->initial_vertices[seed_index++] = POINTER_AS_INT(BLI_gsetIterator_getKey(&gs_iter));
+    }
+    cache->dists = MEM_dupallocN(dists);
+    cache->totvert = totvert;
+  }
+
   return dists;
 }
 
@@ -134,6 +134,9 @@ typedef struct SculptVertexNeighborIter {
   /* Public */
   int index;
   bool is_duplicate;
+
+  /* The neighbors array points into the session cache, do not free. */
+  bool is_cached;
 } SculptVertexNeighborIter;
 
 void SCULPT_vertex_neighbors_get(struct SculptSession *ss,
@@ -141,6 +144,18 @@ void SCULPT_vertex_neighbors_get(struct SculptSession *ss,
                                  const bool include_duplicates,
                                  SculptVertexNeighborIter *iter);
 
+/**
+ * Build #SculptSession.neighbors_cache so neighbor lookups become a simple
+ * array indexing, which speeds up operations that iterate the neighbors of
+ * every vertex multiple times (mesh filters, smoothing).
+ *
+ * The cache snapshots the current connectivity: it may only be kept while a
+ * tool that cannot change topology, visibility or face sets is active, and
+ * it is never built for dynamic topology sculpting.
+ */
+void SCULPT_vertex_neighbors_cache_ensure(struct SculptSession *ss);
+void SCULPT_vertex_neighbors_cache_free(struct SculptSession *ss);
+
 /* Iterator over neighboring vertices. */
 #define SCULPT_VERTEX_NEIGHBORS_ITER_BEGIN(ss, v_index, neighbor_iterator) \
   SCULPT_vertex_neighbors_get(ss, v_index, false, &neighbor_iterator); \
@@ -160,7 +175,8 @@ void SCULPT_vertex_neighbors_get(struct SculptSession *ss,
 
 #define SCULPT_VERTEX_NEIGHBORS_ITER_END(neighbor_iterator) \
   } \
-  if (neighbor_iterator.neighbors != neighbor_iterator.neighbors_fixed) { \
+  if (!neighbor_iterator.is_cached && \
+      neighbor_iterator.neighbors != neighbor_iterator.neighbors_fixed) { \
     MEM_freeN(neighbor_iterator.neighbors); \
   } \
   ((void)0)
@@ -378,6 +394,9 @@ float *SCULPT_geodesic_from_vertex_and_symm(struct Sculpt *sd,
                                             const int vertex,
                                             const float limit_radius);
 float *SCULPT_geodesic_from_vertex(Object *ob, const int vertex, const float limit_radius);
+/* Free the cached distance field (see #SculptGeodesicCache). Needs to be called whenever
+coordinates or visibility change, repeated computations from a similar seed set reuse it. */
+void SCULPT_geodesic_cache_free(SculptSession *ss);
 
 /* Filters. */
 void SCULPT_filter_cache_init(struct bContext *C, Object *ob, Sculpt *sd, const int undo_type);
@@ -618,6 +637,14 @@ typedef struct SculptUndoNodeGeometry {
   int totpoly;
 } SculptUndoNodeGeometry;
 
+/* Compressed copy of one bulk array of a #SculptUndoNode, see sculpt_undo.c. */
+typedef struct SculptUndoCompressedArray {
+  /* Compressed payload, NULL while the raw array is resident. */
+  void *data;
+  /* Size of `data` in bytes (the raw size is derived from the vertex count). */
+  size_t size;
+} SculptUndoCompressedArray;
+
 typedef struct SculptUndoNode {
   struct SculptUndoNode *next, *prev;
 
@@ -633,6 +660,14 @@ typedef struct SculptUndoNode {
   float *mask;
   int totvert;
 
+  /* Compressed payloads for the arrays above. They are created when the
+   * stroke ends and expanded again before the node is restored; the raw
+   * pointer and its compressed payload are never set at the same time. */
+  SculptUndoCompressedArray co_compressed;
+  SculptUndoCompressedArray orig_co_compressed;
+  SculptUndoCompressedArray col_compressed;
+  SculptUndoCompressedArray mask_compressed;
+
   /* non-multires */
   int maxvert; /* to verify if totvert it still the same */
   int *index;  /* to restore into right location */
@@ -34,6 +34,8 @@
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
+#include "zstd.h"
+
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
 #include "DNA_object_types.h"
@@ -160,6 +162,176 @@ static void update_cb_partial(PBVHNode *node, void *userdata)
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Compressed Node Payloads
+ *
+ * The bulk arrays of COORDS, MASK and COLOR nodes (everything that scales
+ * with the vertex count) are compressed with ZSTD once the stroke ends and
+ * expanded again right before the nodes are restored. Together with the
+ * delta filter below this shrinks typical sculpt strokes by an order of
+ * magnitude, which directly translates into deeper undo history before
+ * #BKE_undosys_stack_limit_steps_and_memory_defaults starts dropping steps.
+ * \{ */
+
+/* Low level: compression runs on mouse release, favor latency over ratio. */
+#define SCULPT_UNDO_COMPRESS_LEVEL 3
+
+/**
+ * XOR each 32-bit word with the previous one (in-place, reversible).
+ * Neighboring vertices in a PBVH node are spatially close, so coordinates
+ * and masks share sign/exponent/high-mantissa bits and the filtered stream
+ * compresses far better than raw floats. A possible trailing partial word
+ * is left untouched.
+ */
+static void sculpt_undo_delta_encode(void *data, const size_t size)
+{
+  uint *words = data;
+  const size_t words_num = size / sizeof(uint);
+  uint prev = 0;
+  for (size_t i = 0; i < words_num; i++) {
+    const uint cur = words[i];
+    words[i] = cur ^ prev;
+    prev = cur;
+  }
+}
+
+static void sculpt_undo_delta_decode(void *data, const size_t size)
+{
+  uint *words = data;
+  const size_t words_num = size / sizeof(uint);
+  uint prev = 0;
+  for (size_t i = 0; i < words_num; i++) {
+    words[i] ^= prev;
+    prev = words[i];
+  }
+}
+
+static void sculpt_undo_array_compress(void **array_p,
+                                       const size_t size,
+                                       SculptUndoCompressedArray *compressed)
+{
+  if (*array_p == NULL || compressed->data != NULL || size == 0) {
+    return;
+  }
+
+  sculpt_undo_delta_encode(*array_p, size);
+
+  const size_t bound = ZSTD_compressBound(size);
+  void *buf = MEM_mallocN(bound, "SculptUndoCompressedArray");
+  const size_t compressed_size = ZSTD_compress(
+      buf, bound, *array_p, size, SCULPT_UNDO_COMPRESS_LEVEL);
+
+  if (ZSTD_isError(compressed_size) || compressed_size >= size) {
+    /* Keep the raw array when compression does not pay off. */
+    MEM_freeN(buf);
+    sculpt_undo_delta_decode(*array_p, size);
+    return;
+  }
+
+  compressed->data = MEM_reallocN(buf, compressed_size);
+  compressed->size = compressed_size;
+
+  MEM_freeN(*array_p);
+  *array_p = NULL;
+}
+
+static void sculpt_undo_array_decompress(void **array_p,
+                                         const size_t size,
+                                         SculptUndoCompressedArray *compressed,
+                                         const char *alloc_name)
+{
+  if (compressed->data == NULL) {
+    return;
+  }
+  BLI_assert(*array_p == NULL);
+
+  *array_p = MEM_mallocN(size, alloc_name);
+  ZSTD_decompress(*array_p, size, compressed->data, compressed->size);
+  sculpt_undo_delta_decode(*array_p, size);
+
+  MEM_freeN(compressed->data);
+  compressed->data = NULL;
+  compressed->size = 0;
+}
+
+static void sculpt_undo_node_compress(SculptUndoNode *unode)
+{
+  const size_t totvert = (size_t)unode->totvert;
+  sculpt_undo_array_compress(
+      (void **)&unode->co, sizeof(*unode->co) * totvert, &unode->co_compressed);
+  sculpt_undo_array_compress(
+      (void **)&unode->orig_co, sizeof(*unode->orig_co) * totvert, &unode->orig_co_compressed);
+  sculpt_undo_array_compress(
+      (void **)&unode->col, sizeof(*unode->col) * totvert, &unode->col_compressed);
+  sculpt_undo_array_compress(
+      (void **)&unode->mask, sizeof(*unode->mask) * totvert, &unode->mask_compressed);
+}
+
+static void sculpt_undo_node_decompress(SculptUndoNode *unode)
+{
+  const size_t totvert = (size_t)unode->totvert;
+  sculpt_undo_array_decompress(
+      (void **)&unode->co, sizeof(*unode->co) * totvert, &unode->co_compressed, "SculptUndoNode.co");
+  sculpt_undo_array_decompress((void **)&unode->orig_co,
+                               sizeof(*unode->orig_co) * totvert,
+                               &unode->orig_co_compressed,
+                               "undoSculpt orig_cos");
+  sculpt_undo_array_decompress((void **)&unode->col,
+                               sizeof(*unode->col) * totvert,
+                               &unode->col_compressed,
+                               "SculptUndoNode.col");
+  sculpt_undo_array_decompress((void **)&unode->mask,
+                               sizeof(*unode->mask) * totvert,
+                               &unode->mask_compressed,
+                               "SculptUndoNode.mask");
+}
+
+static void sculpt_undo_compress_task_cb(void *__restrict userdata,
+                                         const int i,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SculptUndoNode **nodes = userdata;
+  sculpt_undo_node_compress(nodes[i]);
+}
+
+static void sculpt_undo_decompress_task_cb(void *__restrict userdata,
+                                           const int i,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SculptUndoNode **nodes = userdata;
+  sculpt_undo_node_decompress(nodes[i]);
+}
+
+/**
+ * (De)compress the payloads of all nodes in \a lb, one node per task.
+ * Nodes without bulk arrays (face sets, geometry, dyntopo log) are no-ops.
+ */
+static void sculpt_undo_compress_nodes(ListBase *lb, const bool decompress)
+{
+  const int totnode = BLI_listbase_count(lb);
+  if (totnode == 0) {
+    return;
+  }
+
+  SculptUndoNode **nodes = MEM_mallocN(sizeof(*nodes) * (size_t)totnode, __func__);
+  int i = 0;
+  LISTBASE_FOREACH (SculptUndoNode *, unode, lb) {
+    nodes[i++] = unode;
+  }
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0,
+                          totnode,
+                          nodes,
+                          decompress ? sculpt_undo_decompress_task_cb : sculpt_undo_compress_task_cb,
+                          &settings);
+
+  MEM_freeN(nodes);
+}
+
+/** \} */
+
 static bool test_swap_v3_v3(float a[3], float b[3])
 {
   /* No need for float comparison here (memory is exactly equal or not). */
@@ -648,6 +820,13 @@ static void sculpt_undo_restore_list(bContext *C, Depsgraph *depsgraph, ListBase
   bool need_mask = false;
   bool need_refine_subdiv = false;
 
+  /* Undo can restore coordinates and visibility without going through the
+   * regular update flush, drop cached geodesic distances unconditionally. */
+  SCULPT_geodesic_cache_free(ss);
+
+  /* Expand compressed payloads before any values are swapped back. */
+  sculpt_undo_compress_nodes(lb, true);
+
   for (unode = lb->first; unode; unode = unode->next) {
     /* Restore pivot. */
     copy_v3_v3(ss->pivot_pos, unode->pivot_pos);
@@ -849,6 +1028,9 @@ static void sculpt_undo_restore_list(bContext *C, Depsgraph *depsgraph, ListBase
   }
 
   MEM_SAFE_FREE(undo_modified_grids);
+
+  /* Keep inactive steps compact, the arrays now hold the redo state. */
+  sculpt_undo_compress_nodes(lb, false);
 }
 
 static void sculpt_undo_free_list(ListBase *lb)
@@ -885,6 +1067,18 @@ static void sculpt_undo_free_list(ListBase *lb)
     if (unode->mask) {
       MEM_freeN(unode->mask);
     }
+    if (unode->co_compressed.data) {
+      MEM_freeN(unode->co_compressed.data);
+    }
+    if (unode->orig_co_compressed.data) {
+      MEM_freeN(unode->orig_co_compressed.data);
+    }
+    if (unode->col_compressed.data) {
+      MEM_freeN(unode->col_compressed.data);
+    }
+    if (unode->mask_compressed.data) {
+      MEM_freeN(unode->mask_compressed.data);
+    }
 
     if (unode->bm_entry) {
       BM_log_entry_drop(unode->bm_entry);
@@ -1414,6 +1608,29 @@ void SCULPT_undo_push_end_ex(const bool use_nested_undo)
     }
   }
 
+  /* Compress the bulk payloads now that the stroke is finished. This is done
+   * synchronously (one node per task) rather than from a detached background
+   * thread, since the step may be trimmed or restored at any point afterwards. */
+  sculpt_undo_compress_nodes(&usculpt->nodes, false);
+
+  /* Let the undo system account for the compressed sizes, so the memory limit
+   * translates into proportionally more undo steps. */
+  for (unode = usculpt->nodes.first; unode; unode = unode->next) {
+    const size_t totvert = (size_t)unode->totvert;
+    if (unode->co_compressed.data) {
+      usculpt->undo_size -= sizeof(*unode->co) * totvert - unode->co_compressed.size;
+    }
+    if (unode->orig_co_compressed.data) {
+      usculpt->undo_size -= sizeof(*unode->orig_co) * totvert - unode->orig_co_compressed.size;
+    }
+    if (unode->col_compressed.data) {
+      usculpt->undo_size -= sizeof(*unode->col) * totvert - unode->col_compressed.size;
+    }
+    if (unode->mask_compressed.data) {
+      usculpt->undo_size -= sizeof(*unode->mask) * totvert - unode->mask_compressed.size;
+    }
+  }
+
   /* We could remove this and enforce all callers run in an operator using 'OPTYPE_UNDO'. */
   wmWindowManager *wm = G_MAIN->wm.first;
   if (wm->op_undo_depth == 0 || use_nested_undo) {
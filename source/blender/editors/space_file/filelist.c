@@ -1428,6 +1428,83 @@ static void filelist_intern_free(FileListIntern *filelist_intern)
   MEM_SAFE_FREE(filelist_intern->filtered);
 }
 
+/* Session-wide cache of decoded preview images, keyed by file path and modification time.
+ *
+ * #IMB_thumb_manage already maintains the persistent on-disk thumbnail cache, but re-visiting a
+ * directory still decodes every thumbnail PNG from disk again since the filelist cache is
+ * cleared. Keep the decoded #ImBuf around (shared with the icon through its reference count) so
+ * browsing back and forth over large directories only pays the decode cost once per session. */
+
+typedef struct FileListPreviewCacheEntry {
+  ImBuf *imbuf;
+  int64_t mtime;
+} FileListPreviewCacheEntry;
+
+static struct {
+  /** Full file path (#MEM_mallocN string) -> #FileListPreviewCacheEntry. Lazily allocated. */
+  GHash *thumbs;
+  ThreadMutex lock;
+} g_preview_cache = {NULL, BLI_MUTEX_INITIALIZER};
+
+/** Bound the memory use of the cache, a large preview is 256x256 RGBA (256KB). */
+#define FILELIST_PREVIEW_CACHE_LIMIT 2048
+
+static void filelist_preview_cache_entry_free(void *val)
+{
+  FileListPreviewCacheEntry *entry = val;
+  IMB_freeImBuf(entry->imbuf);
+  MEM_freeN(entry);
+}
+
+static ImBuf *filelist_preview_cache_lookup(const char *path, const int64_t mtime)
+{
+  ImBuf *imbuf = NULL;
+  BLI_mutex_lock(&g_preview_cache.lock);
+  if (g_preview_cache.thumbs) {
+    FileListPreviewCacheEntry *entry = BLI_ghash_lookup(g_preview_cache.thumbs, path);
+    if (entry && (entry->mtime == mtime)) {
+      imbuf = entry->imbuf;
+      IMB_refImBuf(imbuf);
+    }
+  }
+  BLI_mutex_unlock(&g_preview_cache.lock);
+  return imbuf;
+}
+
+static void filelist_preview_cache_store(const char *path, const int64_t mtime, ImBuf *imbuf)
+{
+  BLI_mutex_lock(&g_preview_cache.lock);
+  if (!g_preview_cache.thumbs) {
+    g_preview_cache.thumbs = BLI_ghash_str_new(__func__);
+  }
+  else if (BLI_ghash_len(g_preview_cache.thumbs) >= FILELIST_PREVIEW_CACHE_LIMIT) {
+    /* Simply flush everything, an LRU is not worth the complexity here. */
+    BLI_ghash_clear(g_preview_cache.thumbs, MEM_freeN, filelist_preview_cache_entry_free);
+  }
+  else {
+    /* Drop a possibly outdated entry for this path. */
+    BLI_ghash_remove(
+        g_preview_cache.thumbs, path, MEM_freeN, filelist_preview_cache_entry_free);
+  }
+
+  FileListPreviewCacheEntry *entry = MEM_mallocN(sizeof(*entry), __func__);
+  IMB_refImBuf(imbuf);
+  entry->imbuf = imbuf;
+  entry->mtime = mtime;
+  BLI_ghash_insert(g_preview_cache.thumbs, BLI_strdup(path), entry);
+  BLI_mutex_unlock(&g_preview_cache.lock);
+}
+
+void filelist_preview_cache_free(void)
+{
+  BLI_mutex_lock(&g_preview_cache.lock);
+  if (g_preview_cache.thumbs) {
+    BLI_ghash_free(g_preview_cache.thumbs, MEM_freeN, filelist_preview_cache_entry_free);
+    g_preview_cache.thumbs = NULL;
+  }
+  BLI_mutex_unlock(&g_preview_cache.lock);
+}
+
 static void filelist_cache_preview_runf(TaskPool *__restrict pool, void *taskdata)
 {
   FileListEntryCache *cache = BLI_task_pool_user_data(pool);
@@ -1466,11 +1543,20 @@ static void filelist_cache_preview_runf(TaskPool *__restrict pool, void *taskdat
       source = THB_SOURCE_FONT;
     }
 
-    IMB_thumb_path_lock(preview->path);
-    /* Always generate biggest preview size for now, it's simpler and avoids having to re-generate
-     * in case user switch to a bigger preview size. */
-    ImBuf *imbuf = IMB_thumb_manage(preview->path, THB_LARGE, source);
-    IMB_thumb_path_unlock(preview->path);
+    BLI_stat_t status;
+    const int64_t mtime = (BLI_stat(preview->path, &status) != -1) ? (int64_t)status.st_mtime : 0;
+
+    ImBuf *imbuf = filelist_preview_cache_lookup(preview->path, mtime);
+    if (imbuf == NULL) {
+      IMB_thumb_path_lock(preview->path);
+      /* Always generate biggest preview size for now, it's simpler and avoids having to
+       * re-generate in case user switch to a bigger preview size. */
+      imbuf = IMB_thumb_manage(preview->path, THB_LARGE, source);
+      IMB_thumb_path_unlock(preview->path);
+      if (imbuf) {
+        filelist_preview_cache_store(preview->path, mtime, imbuf);
+      }
+    }
     if (imbuf) {
       preview->icon_id = BKE_icon_imbuf_create(imbuf);
     }
@@ -1065,6 +1065,7 @@ void ED_file_init(void)
 void ED_file_exit(void)
 {
   fsmenu_free();
+  filelist_preview_cache_free();
 
   if (G.background == false) {
     filelist_free_icons();
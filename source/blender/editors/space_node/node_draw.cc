@@ -22,6 +22,8 @@
  * \brief higher level node drawing for the node editor.
  */
 
+#include <iomanip>
+
 #include "MEM_guardedalloc.h"
 
 #include "DNA_light_types.h"
@@ -364,6 +366,19 @@ static void node_update_basis(const bContext *C, bNodeTree *ntree, bNode *node)
   locx = round(locx);
   locy = round(locy);
 
+  /* Skip laying out the buttons of nodes fully outside the view, this is the main per-redraw
+   * cost in big node trees. The cached rect and socket locations stay valid as long as the node
+   * did not move; once it scrolls into view it is laid out again. Note that the drawing code
+   * culls these nodes as well (see #node_draw_basis). */
+  if (!BLI_rctf_is_empty(&node->totr) && (node->totr.xmin == locx) && (node->totr.ymax == locy) &&
+      (node->totr.xmax == locx + NODE_WIDTH(node))) {
+    rctf node_rect = node->totr;
+    BLI_rctf_pad(&node_rect, NODE_SOCKSIZE, NODE_SOCKSIZE);
+    if (!BLI_rctf_isect(&node_rect, &CTX_wm_region(C)->v2d.cur, nullptr)) {
+      return;
+    }
+  }
+
   int dy = locy;
 
   /* Header. */
@@ -1502,6 +1517,50 @@ static void node_add_error_message_button(
   UI_block_emboss_set(node.block, UI_EMBOSS);
 }
 
+static void node_add_execution_time_label(const bContext *C, bNode &node, const rctf &rect)
+{
+  SpaceNode *snode = CTX_wm_space_node(C);
+  if ((snode->flag & SNODE_SHOW_TIMINGS) == 0) {
+    return;
+  }
+  const geo_log::NodeLog *node_log = geo_log::ModifierLog::find_node_by_node_editor_context(*snode,
+                                                                                            node);
+  if (node_log == nullptr) {
+    return;
+  }
+  const uint64_t exec_time_us = node_log->execution_time().count();
+  if (exec_time_us == 0) {
+    return;
+  }
+
+  std::string timing_str;
+  if (exec_time_us < 100) {
+    timing_str = "< 0.1 ms";
+  }
+  else {
+    /* Show a higher precision for fast nodes, the exact value matters less for slow ones. */
+    const int precision = (exec_time_us < 100000) ? 2 : (exec_time_us < 1000000) ? 1 : 0;
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(precision) << (exec_time_us / 1000.0f);
+    timing_str = stream.str() + " ms";
+  }
+
+  uiDefBut(node.block,
+           UI_BTYPE_LABEL,
+           0,
+           timing_str.c_str(),
+           (int)(rect.xmin + NODE_MARGIN_X),
+           (int)rect.ymax,
+           (short)(BLI_rctf_size_x(&rect) - NODE_MARGIN_X),
+           (short)NODE_DY,
+           nullptr,
+           0,
+           0,
+           0,
+           0,
+           "");
+}
+
 static void node_draw_basis(const bContext *C,
                             const View2D *v2d,
                             const SpaceNode *snode,
@@ -1620,6 +1679,7 @@ static void node_draw_basis(const bContext *C,
   }
 
   node_add_error_message_button(C, *ntree, *node, *rct, iconofs);
+  node_add_execution_time_label(C, *node, *rct);
 
   /* Title. */
   if (node->flag & SELECT) {
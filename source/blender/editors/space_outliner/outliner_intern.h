@@ -55,6 +55,11 @@ typedef struct SpaceOutliner_Runtime {
   /** Pointers to tree-store elements, grouped by `(id, type, nr)`
    *  in hash-table for faster searching. */
   struct GHash *treehash;
+
+  /** Pool the #TreeElement allocations are made from. The tree is rebuilt from scratch on most
+   *  changes, keeping the chunks around avoids hundreds of thousands of small (re)allocations
+   *  per redraw in big scenes. Lazily created. */
+  struct BLI_mempool *element_pool;
 } SpaceOutliner_Runtime;
 
 typedef enum TreeElementInsertType {
@@ -248,9 +253,11 @@ typedef enum TreeItemSelectAction {
 
 /* outliner_tree.c ----------------------------------------------- */
 
-void outliner_free_tree(ListBase *tree);
+void outliner_free_tree(struct SpaceOutliner *space_outliner, ListBase *tree);
 void outliner_cleanup_tree(struct SpaceOutliner *space_outliner);
-void outliner_free_tree_element(TreeElement *element, ListBase *parent_subtree);
+void outliner_free_tree_element(struct SpaceOutliner *space_outliner,
+                                TreeElement *element,
+                                ListBase *parent_subtree);
 
 void outliner_build_tree(struct Main *mainvar,
                          struct Scene *scene,
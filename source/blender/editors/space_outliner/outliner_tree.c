@@ -190,16 +190,16 @@ static void check_persistent(
 /* ********************************************************* */
 /* Tree Management */
 
-void outliner_free_tree(ListBase *tree)
+void outliner_free_tree(SpaceOutliner *space_outliner, ListBase *tree)
 {
   LISTBASE_FOREACH_MUTABLE (TreeElement *, element, tree) {
-    outliner_free_tree_element(element, tree);
+    outliner_free_tree_element(space_outliner, element, tree);
   }
 }
 
 void outliner_cleanup_tree(SpaceOutliner *space_outliner)
 {
-  outliner_free_tree(&space_outliner->tree);
+  outliner_free_tree(space_outliner, &space_outliner->tree);
   outliner_storage_cleanup(space_outliner);
 }
 
@@ -209,18 +209,20 @@ void outliner_cleanup_tree(SpaceOutliner *space_outliner)
  * \note Does not remove the #TreeStoreElem of \a element!
  * \param parent_subtree: Sub-tree of the parent element, so the list containing \a element.
  */
-void outliner_free_tree_element(TreeElement *element, ListBase *parent_subtree)
+void outliner_free_tree_element(SpaceOutliner *space_outliner,
+                                TreeElement *element,
+                                ListBase *parent_subtree)
 {
   BLI_assert(BLI_findindex(parent_subtree, element) > -1);
   BLI_remlink(parent_subtree, element);
 
-  outliner_free_tree(&element->subtree);
+  outliner_free_tree(space_outliner, &element->subtree);
 
   if (element->flag & TE_FREE_NAME) {
     MEM_freeN((void *)element->name);
   }
   outliner_tree_element_type_free(&element->type);
-  MEM_freeN(element);
+  BLI_mempool_free(space_outliner->runtime->element_pool, element);
 }
 
 /* ********************************************************* */
@@ -862,7 +864,11 @@ TreeElement *outliner_add_element(SpaceOutliner *space_outliner,
     BLI_assert(TREESTORE_ID_TYPE(id));
   }
 
-  TreeElement *te = MEM_callocN(sizeof(TreeElement), __func__);
+  if (space_outliner->runtime->element_pool == NULL) {
+    space_outliner->runtime->element_pool = BLI_mempool_create(
+        sizeof(TreeElement), 0, 512, BLI_MEMPOOL_NOP);
+  }
+  TreeElement *te = BLI_mempool_calloc(space_outliner->runtime->element_pool);
   /* add to the visual tree */
   BLI_addtail(lb, te);
   /* add to the storage */
@@ -1755,7 +1761,8 @@ static bool outliner_element_is_collection_or_object(TreeElement *te)
   return false;
 }
 
-static TreeElement *outliner_extract_children_from_subtree(TreeElement *element,
+static TreeElement *outliner_extract_children_from_subtree(SpaceOutliner *space_outliner,
+                                                           TreeElement *element,
                                                            ListBase *parent_subtree)
 {
   TreeElement *te_next = element->next;
@@ -1776,7 +1783,7 @@ static TreeElement *outliner_extract_children_from_subtree(TreeElement *element,
     }
   }
 
-  outliner_free_tree_element(element, parent_subtree);
+  outliner_free_tree_element(space_outliner, element, parent_subtree);
   return te_next;
 }
 
@@ -1796,7 +1803,7 @@ static int outliner_filter_subtree(SpaceOutliner *space_outliner,
       /* This also needs filtering the subtree prior (see T69246). */
       outliner_filter_subtree(
           space_outliner, view_layer, &te->subtree, search_string, exclude_filter);
-      te_next = outliner_extract_children_from_subtree(te, lb);
+      te_next = outliner_extract_children_from_subtree(space_outliner, te, lb);
       continue;
     }
     if ((exclude_filter & SO_FILTER_SEARCH) == 0) {
@@ -1821,7 +1828,7 @@ static int outliner_filter_subtree(SpaceOutliner *space_outliner,
       if ((!TSELEM_OPEN(tselem, space_outliner)) ||
           outliner_filter_subtree(
               space_outliner, view_layer, &te->subtree, search_string, exclude_filter) == 0) {
-        outliner_free_tree_element(te, lb);
+        outliner_free_tree_element(space_outliner, te, lb);
       }
     }
     else {
@@ -1898,7 +1905,7 @@ void outliner_build_tree(Main *mainvar,
   OutlinerTreeElementFocus focus;
   outliner_store_scrolling_position(space_outliner, region, &focus);
 
-  outliner_free_tree(&space_outliner->tree);
+  outliner_free_tree(space_outliner, &space_outliner->tree);
   outliner_storage_cleanup(space_outliner);
   outliner_tree_display_destroy(&space_outliner->runtime->tree_display);
 
@@ -602,23 +602,28 @@ static IMB_Proxy_Size seq_get_proxy_size_flags(bContext *C)
 
 static void seq_build_proxy(bContext *C, Sequence *seq)
 {
-  if (U.sequencer_proxy_setup != USER_SEQ_PROXY_SETUP_AUTOMATIC) {
-    return;
-  }
-
-  /* Enable and set proxy size. */
-  SEQ_proxy_set(seq, true);
-  seq->strip->proxy->build_size_flags = seq_get_proxy_size_flags(C);
-  seq->strip->proxy->build_flags |= SEQ_PROXY_SKIP_EXISTING;
-
-  /* Build proxy. */
-  GSet *file_list = BLI_gset_new(BLI_ghashutil_strhash_p, BLI_ghashutil_strcmp, "file list");
   wmJob *wm_job = ED_seq_proxy_wm_job_get(C);
   ProxyJob *pj = ED_seq_proxy_job_get(C, wm_job);
-  SEQ_proxy_rebuild_context(pj->main, pj->depsgraph, pj->scene, seq, file_list, &pj->queue);
-  BLI_gset_free(file_list, MEM_freeN);
 
-  if (!WM_jobs_is_running(wm_job)) {
+  if (U.sequencer_proxy_setup == USER_SEQ_PROXY_SETUP_AUTOMATIC) {
+    /* Enable and set proxy size. */
+    SEQ_proxy_set(seq, true);
+    seq->strip->proxy->build_size_flags = seq_get_proxy_size_flags(C);
+    seq->strip->proxy->build_flags |= SEQ_PROXY_SKIP_EXISTING;
+
+    /* Build proxy (timecode indices are built along with it). */
+    GSet *file_list = BLI_gset_new(BLI_ghashutil_strhash_p, BLI_ghashutil_strcmp, "file list");
+    SEQ_proxy_rebuild_context(pj->main, pj->depsgraph, pj->scene, seq, file_list, &pj->queue);
+    BLI_gset_free(file_list, MEM_freeN);
+  }
+  else {
+    /* Even without proxies, build the timecode index in the background on first use, so
+     * scrubbing long-GOP footage can seek precisely instead of decoding from the closest
+     * GOP start. */
+    SEQ_index_rebuild_context(pj->main, pj->depsgraph, pj->scene, seq, &pj->queue);
+  }
+
+  if (!BLI_listbase_is_empty(&pj->queue) && !WM_jobs_is_running(wm_job)) {
     G.is_break = false;
     WM_jobs_start(CTX_wm_manager(C), wm_job);
   }
@@ -416,33 +416,48 @@ static void draw_seq_waveform_overlay(View2D *v2d,
      * sample. */
     start_sample += (x1_offset - x1_adj) * samples_per_frame;
 
+    /* Pick a downsampled pyramid level when many samples map to one pixel, so zoomed out
+     * timelines do not iterate over the full resolution data. */
+    const float *wave_data = waveform->data;
+    int wave_length = waveform->length;
+    for (int level = 0; level < SOUND_WAVEFORM_PYRAMID_LEVELS && samples_per_pix > 2.0f;
+         level++) {
+      if (waveform->pyramid[level] == NULL) {
+        break;
+      }
+      wave_data = waveform->pyramid[level];
+      wave_length = waveform->pyramid_length[level];
+      start_sample /= 2.0f;
+      samples_per_pix /= 2.0f;
+    }
+
     for (int i = 0; i < pix_strip_len; i++) {
       float sample_offset = start_sample + i * samples_per_pix;
       int p = sample_offset;
 
-      if (p >= waveform->length) {
+      if (p >= wave_length) {
         break;
       }
 
-      float value_min = waveform->data[p * 3];
-      float value_max = waveform->data[p * 3 + 1];
-      float rms = waveform->data[p * 3 + 2];
+      float value_min = wave_data[p * 3];
+      float value_max = wave_data[p * 3 + 1];
+      float rms = wave_data[p * 3 + 2];
 
-      if (p + 1 < waveform->length) {
+      if (p + 1 < wave_length) {
         /* Use simple linear interpolation. */
         float f = sample_offset - p;
-        value_min = (1.0f - f) * value_min + f * waveform->data[p * 3 + 3];
-        value_max = (1.0f - f) * value_max + f * waveform->data[p * 3 + 4];
-        rms = (1.0f - f) * rms + f * waveform->data[p * 3 + 5];
+        value_min = (1.0f - f) * value_min + f * wave_data[p * 3 + 3];
+        value_max = (1.0f - f) * value_max + f * wave_data[p * 3 + 4];
+        rms = (1.0f - f) * rms + f * wave_data[p * 3 + 5];
         if (samples_per_pix > 1.0f) {
           /* We need to sum up the values we skip over until the next step. */
           float next_pos = sample_offset + samples_per_pix;
           int end_idx = next_pos;
 
-          for (int j = p + 1; (j < waveform->length) && (j < end_idx); j++) {
-            value_min = min_ff(value_min, waveform->data[j * 3]);
-            value_max = max_ff(value_max, waveform->data[j * 3 + 1]);
-            rms = max_ff(rms, waveform->data[j * 3 + 2]);
+          for (int j = p + 1; (j < wave_length) && (j < end_idx); j++) {
+            value_min = min_ff(value_min, wave_data[j * 3]);
+            value_max = max_ff(value_max, wave_data[j * 3 + 1]);
+            rms = max_ff(rms, wave_data[j * 3 + 2]);
           }
         }
       }
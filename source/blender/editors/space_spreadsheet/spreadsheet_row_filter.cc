@@ -14,9 +14,11 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+#include <algorithm>
 #include <cstring>
 
 #include "BLI_listbase.h"
+#include "BLI_task.hh"
 
 #include "DNA_collection_types.h"
 #include "DNA_screen_types.h"
@@ -43,16 +45,20 @@ static void apply_filter_operation(const ColumnValues &values,
                                    OperationFn check_fn,
                                    MutableSpan<bool> rows_included)
 {
-  for (const int i : rows_included.index_range()) {
-    if (!rows_included[i]) {
-      continue;
-    }
-    CellValue cell_value;
-    values.get_value(i, cell_value);
-    if (!check_fn(cell_value)) {
-      rows_included[i] = false;
+  /* Each row only reads the column values and writes its own flag, so evaluating the filter
+   * over millions of rows can simply be split over threads. */
+  threading::parallel_for(rows_included.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (!rows_included[i]) {
+        continue;
+      }
+      CellValue cell_value;
+      values.get_value(i, cell_value);
+      if (!check_fn(cell_value)) {
+        rows_included[i] = false;
+      }
     }
-  }
+  });
 }
 
 static void apply_row_filter(const SpreadsheetLayout &spreadsheet_layout,
@@ -267,6 +273,7 @@ static void apply_row_filter(const SpreadsheetLayout &spreadsheet_layout,
 
 static void index_vector_from_bools(Span<bool> selection, Vector<int64_t> &indices)
 {
+  indices.reserve(std::count(selection.begin(), selection.end(), true));
   for (const int i : selection.index_range()) {
     if (selection[i]) {
       indices.append(i);
@@ -31,6 +31,7 @@
 #include "BLI_linklist_stack.h"
 #include "BLI_math.h"
 #include "BLI_memarena.h"
+#include "BLI_task.h"
 
 #include "BKE_context.h"
 #include "BKE_crazyspace.h"
@@ -654,6 +655,36 @@ static void tc_mesh_customdatacorrect_apply_vert(struct TransCustomDataLayer *tc
   }
 }
 
+struct TransCustomDataLayerApplyData {
+  struct TransCustomDataLayer *tcld;
+  TransDataContainer *tc;
+  bool is_final;
+};
+
+static void tc_mesh_customdatacorrect_apply_vert_fn(void *__restrict userdata,
+                                                    const int i,
+                                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct TransCustomDataLayerApplyData *data = userdata;
+  struct TransCustomDataLayer *tcld = data->tcld;
+  struct TransCustomDataMergeGroup *merge_data = tcld->use_merge_group ?
+                                                     &tcld->merge_group.data[i] :
+                                                     NULL;
+  tc_mesh_customdatacorrect_apply_vert(
+      tcld, (TransDataBasic *)&data->tc->data[i], merge_data, data->is_final);
+}
+
+static void tc_mesh_customdatacorrect_apply_vert_mirror_fn(
+    void *__restrict userdata, const int i, const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct TransCustomDataLayerApplyData *data = userdata;
+  struct TransCustomDataLayer *tcld = data->tcld;
+  struct TransCustomDataMergeGroup *merge_data =
+      tcld->use_merge_group ? &tcld->merge_group.data[data->tc->data_len + i] : NULL;
+  tc_mesh_customdatacorrect_apply_vert(
+      tcld, (TransDataBasic *)&data->tc->data_mirror[i], merge_data, data->is_final);
+}
+
 static void tc_mesh_customdatacorrect_apply(TransDataContainer *tc, bool is_final)
 {
   struct TransCustomDataMesh *tcmd = tc->custom.type.data;
@@ -661,26 +692,27 @@ static void tc_mesh_customdatacorrect_apply(TransDataContainer *tc, bool is_fina
   if (tcld == NULL) {
     return;
   }
-  const bool use_merge_group = tcld->use_merge_group;
 
-  struct TransCustomDataMergeGroup *merge_data = tcld->merge_group.data;
-  TransData *tob = tc->data;
-  for (int i = tc->data_len; i--; tob++) {
-    tc_mesh_customdatacorrect_apply_vert(tcld, (TransDataBasic *)tob, merge_data, is_final);
+  /* Each vertex only writes into the custom-data blocks of its own loops
+   * (and its own merge-group entry), so vertices can be processed in parallel.
+   * The exception is the multi-res correction which interpolates into loops of
+   * neighboring faces, overlapping between vertices, so keep it single threaded. */
+  const bool use_threading = !(is_final && (tcld->cd_loop_mdisp_offset != -1));
 
-    if (use_merge_group) {
-      merge_data++;
-    }
-  }
+  struct TransCustomDataLayerApplyData data = {
+      .tcld = tcld,
+      .tc = tc,
+      .is_final = is_final,
+  };
 
-  TransDataMirror *td_mirror = tc->data_mirror;
-  for (int i = tc->data_mirror_len; i--; td_mirror++) {
-    tc_mesh_customdatacorrect_apply_vert(tcld, (TransDataBasic *)td_mirror, merge_data, is_final);
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = use_threading;
 
-    if (use_merge_group) {
-      merge_data++;
-    }
-  }
+  BLI_task_parallel_range(
+      0, tc->data_len, &data, tc_mesh_customdatacorrect_apply_vert_fn, &settings);
+  BLI_task_parallel_range(
+      0, tc->data_mirror_len, &data, tc_mesh_customdatacorrect_apply_vert_mirror_fn, &settings);
 }
 
 /** \} */
@@ -1482,10 +1514,116 @@ static void VertsToTransData(TransInfo *t,
   }
 }
 
+struct TransMeshVertsToTransData {
+  TransInfo *t;
+  TransDataContainer *tc;
+  BMEditMesh *em;
+  const struct TransIslandData *island_data;
+  struct TransMirrorData *mirror_data;
+  const struct TransMeshDataCrazySpace *crazyspace_data;
+  const float (*mtx)[3];
+  const float (*smtx)[3];
+  const float *dists;
+  const int *dists_index;
+  /** Destination slot per vertex: `[0..data_len)` indexes #TransDataContainer.data,
+   * `[data_len..)` indexes #TransDataContainer.data_mirror (offset by `data_len`),
+   * -1 skips the vertex. */
+  const int *vert_dest_index;
+  int cd_vert_bweight_offset;
+};
+
+static void createTransEditVerts_vert_fn(void *__restrict userdata,
+                                         const int a,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct TransMeshVertsToTransData *data = userdata;
+  const int dest_index = data->vert_dest_index[a];
+  if (dest_index == -1) {
+    return;
+  }
+
+  TransDataContainer *tc = data->tc;
+  BMesh *bm = data->em->bm;
+  BMVert *eve = BM_vert_at_index(bm, a);
+
+  int island_index = -1;
+  if (data->island_data->island_vert_map) {
+    const int connected_index = (data->dists_index && data->dists_index[a] != -1) ?
+                                    data->dists_index[a] :
+                                    a;
+    island_index = data->island_data->island_vert_map[connected_index];
+  }
+
+  if (dest_index >= tc->data_len) {
+    TransDataMirror *td_mirror = &tc->data_mirror[dest_index - tc->data_len];
+    const int elem_index = data->mirror_data->vert_map[a].index;
+    BMVert *v_src = BM_vert_at_index(bm, elem_index);
+
+    if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+      data->mirror_data->vert_map[a].flag |= TD_SELECTED;
+    }
+
+    td_mirror->extra = eve;
+    td_mirror->loc = eve->co;
+    copy_v3_v3(td_mirror->iloc, eve->co);
+    td_mirror->flag = data->mirror_data->vert_map[a].flag;
+    td_mirror->loc_src = v_src->co;
+    tc_mesh_transdata_center_copy(data->island_data, island_index, td_mirror->iloc, td_mirror->center);
+  }
+  else {
+    TransData *tob = &tc->data[dest_index];
+    TransDataExtension *tx = tc->data_ext ? &tc->data_ext[dest_index] : NULL;
+    float *bweight = (data->cd_vert_bweight_offset != -1) ?
+                         BM_ELEM_CD_GET_VOID_P(eve, data->cd_vert_bweight_offset) :
+                         NULL;
+    const int prop_mode = (data->t->flag & T_PROP_EDIT) ? (data->t->flag & T_PROP_EDIT_ALL) : 0;
+
+    /* Do not use the island center in case we are using islands
+     * only to get axis for snap/rotate to normal... */
+    VertsToTransData(data->t, tob, tx, data->em, eve, bweight, data->island_data, island_index);
+
+    /* selected */
+    if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+      tob->flag |= TD_SELECTED;
+    }
+
+    if (prop_mode) {
+      if (prop_mode & T_PROP_CONNECTED) {
+        tob->dist = data->dists[a];
+      }
+      else {
+        tob->flag |= TD_NOTCONNECTED;
+        tob->dist = FLT_MAX;
+      }
+    }
+
+    /* CrazySpace */
+    transform_convert_mesh_crazyspace_transdata_set(
+        data->mtx,
+        data->smtx,
+        data->crazyspace_data->defmats ? data->crazyspace_data->defmats[a] : NULL,
+        data->crazyspace_data->quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
+            data->crazyspace_data->quats[a] :
+            NULL,
+        tob);
+
+    if (tc->use_mirror_axis_any) {
+      if (tc->use_mirror_axis_x && fabsf(tob->loc[0]) < TRANSFORM_MAXDIST_MIRROR) {
+        tob->flag |= TD_MIRROR_EDGE_X;
+      }
+      if (tc->use_mirror_axis_y && fabsf(tob->loc[1]) < TRANSFORM_MAXDIST_MIRROR) {
+        tob->flag |= TD_MIRROR_EDGE_Y;
+      }
+      if (tc->use_mirror_axis_z && fabsf(tob->loc[2]) < TRANSFORM_MAXDIST_MIRROR) {
+        tob->flag |= TD_MIRROR_EDGE_Z;
+      }
+    }
+  }
+}
+
 void createTransEditVerts(TransInfo *t)
 {
   FOREACH_TRANS_DATA_CONTAINER (t, tc) {
-    TransDataExtension *tx = NULL;
     BMEditMesh *em = BKE_editmesh_from_object(tc->obedit);
     Mesh *me = tc->obedit->data;
     BMesh *bm = em->bm;
@@ -1608,8 +1746,7 @@ void createTransEditVerts(TransInfo *t)
        * but this stores loads of extra stuff, for TFM_SHRINKFATTEN its even more overkill
        * since we may not use the 'alt' transform mode to maintain shell thickness,
        * but with generic transform code its hard to lazy init vars */
-      tx = tc->data_ext = MEM_callocN(tc->data_len * sizeof(TransDataExtension),
-                                      "TransObData ext");
+      tc->data_ext = MEM_callocN(tc->data_len * sizeof(TransDataExtension), "TransObData ext");
     }
 
     int cd_vert_bweight_offset = -1;
@@ -1618,89 +1755,51 @@ void createTransEditVerts(TransInfo *t)
       cd_vert_bweight_offset = CustomData_get_offset(&bm->vdata, CD_BWEIGHT);
     }
 
-    TransData *tob = tc->data;
-    TransDataMirror *td_mirror = tc->data_mirror;
-    BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, a) {
-      if (BM_elem_flag_test(eve, BM_ELEM_HIDDEN)) {
-        continue;
-      }
-
-      int island_index = -1;
-      if (island_data.island_vert_map) {
-        const int connected_index = (dists_index && dists_index[a] != -1) ? dists_index[a] : a;
-        island_index = island_data.island_vert_map[connected_index];
-      }
-
-      if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
-        int elem_index = mirror_data.vert_map[a].index;
-        BMVert *v_src = BM_vert_at_index(bm, elem_index);
-
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          mirror_data.vert_map[a].flag |= TD_SELECTED;
+    /* Compute the destination slot of every vertex up-front so the conversion itself can run in
+     * parallel. The slot order matches the serial iteration so the resulting arrays are
+     * identical to the single threaded version. */
+    int *vert_dest_index = MEM_mallocN(bm->totvert * sizeof(int), __func__);
+    {
+      int data_index = 0, mirror_index = 0;
+      BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, a) {
+        if (BM_elem_flag_test(eve, BM_ELEM_HIDDEN)) {
+          vert_dest_index[a] = -1;
         }
-
-        td_mirror->extra = eve;
-        td_mirror->loc = eve->co;
-        copy_v3_v3(td_mirror->iloc, eve->co);
-        td_mirror->flag = mirror_data.vert_map[a].flag;
-        td_mirror->loc_src = v_src->co;
-        tc_mesh_transdata_center_copy(
-            &island_data, island_index, td_mirror->iloc, td_mirror->center);
-
-        td_mirror++;
-      }
-      else if (prop_mode || BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-        float *bweight = (cd_vert_bweight_offset != -1) ?
-                             BM_ELEM_CD_GET_VOID_P(eve, cd_vert_bweight_offset) :
-                             NULL;
-
-        /* Do not use the island center in case we are using islands
-         * only to get axis for snap/rotate to normal... */
-        VertsToTransData(t, tob, tx, em, eve, bweight, &island_data, island_index);
-        if (tx) {
-          tx++;
+        else if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
+          vert_dest_index[a] = data_len + mirror_index++;
         }
-
-        /* selected */
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          tob->flag |= TD_SELECTED;
+        else if (prop_mode || BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+          vert_dest_index[a] = data_index++;
         }
-
-        if (prop_mode) {
-          if (prop_mode & T_PROP_CONNECTED) {
-            tob->dist = dists[a];
-          }
-          else {
-            tob->flag |= TD_NOTCONNECTED;
-            tob->dist = FLT_MAX;
-          }
+        else {
+          vert_dest_index[a] = -1;
         }
+      }
+    }
 
-        /* CrazySpace */
-        transform_convert_mesh_crazyspace_transdata_set(
-            mtx,
-            smtx,
-            crazyspace_data.defmats ? crazyspace_data.defmats[a] : NULL,
-            crazyspace_data.quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
-                crazyspace_data.quats[a] :
-                NULL,
-            tob);
+    BM_mesh_elem_table_ensure(bm, BM_VERT);
 
-        if (tc->use_mirror_axis_any) {
-          if (tc->use_mirror_axis_x && fabsf(tob->loc[0]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_X;
-          }
-          if (tc->use_mirror_axis_y && fabsf(tob->loc[1]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_Y;
-          }
-          if (tc->use_mirror_axis_z && fabsf(tob->loc[2]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_Z;
-          }
-        }
+    struct TransMeshVertsToTransData user_data = {
+        .t = t,
+        .tc = tc,
+        .em = em,
+        .island_data = &island_data,
+        .mirror_data = &mirror_data,
+        .crazyspace_data = &crazyspace_data,
+        .mtx = mtx,
+        .smtx = smtx,
+        .dists = dists,
+        .dists_index = dists_index,
+        .vert_dest_index = vert_dest_index,
+        .cd_vert_bweight_offset = cd_vert_bweight_offset,
+    };
 
-        tob++;
-      }
-    }
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 1024;
+    BLI_task_parallel_range(0, bm->totvert, &user_data, createTransEditVerts_vert_fn, &settings);
+
+    MEM_freeN(vert_dest_index);
 
     transform_convert_mesh_islanddata_free(&island_data);
     transform_convert_mesh_mirrordata_free(&mirror_data);
@@ -2094,6 +2193,13 @@ void recalcData_mesh(TransInfo *t)
   tc_mesh_partial_types_calc(t, &partial_state);
 
   FOREACH_TRANS_DATA_CONTAINER (t, tc) {
+    struct TransCustomDataMesh *tcmd = tc->custom.type.data;
+    /* Transform only moves vertices, so the evaluation can keep topology dependent draw
+     * buffers, unless custom-data correction is also interpolating UV's & other loop data. */
+    if (tcmd == NULL || tcmd->cd_layer_correct == NULL) {
+      BKE_editmesh_deform_only_update_tag(BKE_editmesh_from_object(tc->obedit));
+    }
+
     DEG_id_tag_update(tc->obedit->data, ID_RECALC_GEOMETRY);
 
     tc_mesh_partial_update(t, tc, &partial_state);
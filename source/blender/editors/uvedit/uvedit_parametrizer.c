@@ -28,6 +28,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_rand.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "uvedit_parametrizer.h"
@@ -4597,61 +4598,107 @@ void param_construct_end(ParamHandle *handle,
   phandle->state = PHANDLE_STATE_CONSTRUCTED;
 }
 
+/* Charts are fully independent (each has its own solver context and only
+ * reads the handle aspect ratio), so begin/solve run one chart per task. */
+
+typedef struct ParamLSCMTaskData {
+  PHandle *phandle;
+  PBool live;
+  PBool abf;
+  /** Per chart solve result (1 solved, -1 failed, 0 skipped),
+   * counted after the parallel loop. */
+  signed char *result;
+} ParamLSCMTaskData;
+
+static void param_lscm_begin_task(void *__restrict userdata,
+                                  const int i,
+                                  const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ParamLSCMTaskData *data = (ParamLSCMTaskData *)userdata;
+  PFace *f;
+
+  for (f = data->phandle->charts[i]->faces; f; f = f->nextlink) {
+    p_face_backup_uvs(f);
+  }
+  p_chart_lscm_begin(data->phandle->charts[i], data->live, data->abf);
+}
+
 void param_lscm_begin(ParamHandle *handle, ParamBool live, ParamBool abf)
 {
   PHandle *phandle = (PHandle *)handle;
-  PFace *f;
-  int i;
+  ParamLSCMTaskData data;
+  TaskParallelSettings settings;
 
   param_assert(phandle->state == PHANDLE_STATE_CONSTRUCTED);
   phandle->state = PHANDLE_STATE_LSCM;
 
-  for (i = 0; i < phandle->ncharts; i++) {
-    for (f = phandle->charts[i]->faces; f; f = f->nextlink) {
-      p_face_backup_uvs(f);
+  data.phandle = phandle;
+  data.live = (PBool)live;
+  data.abf = (PBool)abf;
+  data.result = NULL;
+
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (phandle->ncharts > 1);
+  BLI_task_parallel_range(0, phandle->ncharts, &data, param_lscm_begin_task, &settings);
+}
+
+static void param_lscm_solve_task(void *__restrict userdata,
+                                  const int i,
+                                  const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ParamLSCMTaskData *data = (ParamLSCMTaskData *)userdata;
+  PChart *chart = data->phandle->charts[i];
+
+  if (chart->u.lscm.context) {
+    const PBool result = p_chart_lscm_solve(data->phandle, chart);
+
+    if (result && !(chart->flag & PCHART_HAS_PINS)) {
+      p_chart_rotate_minimum_area(chart);
     }
-    p_chart_lscm_begin(phandle->charts[i], (PBool)live, (PBool)abf);
+    else if (result && chart->u.lscm.single_pin) {
+      p_chart_rotate_fit_aabb(chart);
+      p_chart_lscm_transform_single_pin(chart);
+    }
+
+    if (!result || !(chart->flag & PCHART_HAS_PINS)) {
+      p_chart_lscm_end(chart);
+    }
+
+    data->result[i] = result ? 1 : -1;
   }
 }
 
 void param_lscm_solve(ParamHandle *handle, int *count_changed, int *count_failed)
 {
   PHandle *phandle = (PHandle *)handle;
-  PChart *chart;
+  ParamLSCMTaskData data;
+  TaskParallelSettings settings;
   int i;
 
   param_assert(phandle->state == PHANDLE_STATE_LSCM);
 
-  for (i = 0; i < phandle->ncharts; i++) {
-    chart = phandle->charts[i];
-
-    if (chart->u.lscm.context) {
-      const PBool result = p_chart_lscm_solve(phandle, chart);
-
-      if (result && !(chart->flag & PCHART_HAS_PINS)) {
-        p_chart_rotate_minimum_area(chart);
-      }
-      else if (result && chart->u.lscm.single_pin) {
-        p_chart_rotate_fit_aabb(chart);
-        p_chart_lscm_transform_single_pin(chart);
-      }
+  data.phandle = phandle;
+  data.live = data.abf = P_FALSE;
+  data.result = MEM_callocN(sizeof(signed char) * phandle->ncharts, "param_lscm_solve result");
 
-      if (!result || !(chart->flag & PCHART_HAS_PINS)) {
-        p_chart_lscm_end(chart);
-      }
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (phandle->ncharts > 1);
+  BLI_task_parallel_range(0, phandle->ncharts, &data, param_lscm_solve_task, &settings);
 
-      if (result) {
-        if (count_changed != NULL) {
-          *count_changed += 1;
-        }
+  for (i = 0; i < phandle->ncharts; i++) {
+    if (data.result[i] == 1) {
+      if (count_changed != NULL) {
+        *count_changed += 1;
       }
-      else {
-        if (count_failed != NULL) {
-          *count_failed += 1;
-        }
+    }
+    else if (data.result[i] == -1) {
+      if (count_failed != NULL) {
+        *count_failed += 1;
       }
     }
   }
+
+  MEM_freeN(data.result);
 }
 
 void param_lscm_end(ParamHandle *handle)
@@ -89,8 +89,13 @@ void ViewMap::Clean()
 
 ViewShape *ViewMap::viewShape(unsigned id)
 {
-  int index = _shapeIdToIndex[id];
-  return _VShapes[index];
+  /* Use find() rather than operator[], so concurrent lookups from the parallel visibility
+   * computation cannot insert into the map. */
+  id_to_index_map::const_iterator it = _shapeIdToIndex.find(id);
+  if (it == _shapeIdToIndex.end()) {
+    return nullptr;
+  }
+  return _VShapes[it->second];
 }
 
 void ViewMap::AddViewShape(ViewShape *iVShape)
@@ -25,6 +25,7 @@
 
 #include <optional>
 
+#include "BLI_function_ref.hh"
 #include "BLI_virtual_array.hh"
 
 #include "FN_generic_span.hh"
@@ -141,6 +142,26 @@ class GVArray {
   void materialize_to_uninitialized(void *dst) const;
   void materialize_to_uninitialized(const IndexMask mask, void *dst) const;
 
+  /**
+   * Number of elements materialized per chunk by #materialize_chunked. Small enough for the
+   * chunk buffer to stay in cache for common attribute types, large enough to amortize the
+   * per-chunk overhead.
+   */
+  static constexpr int64_t materialize_chunk_size = 1024;
+
+  /**
+   * Process the values of the virtual array in contiguous chunks. This should be preferred over
+   * calling #get in a loop: when the virtual array is a span internally, the span is handed out
+   * directly without any copy; a single value is filled into a chunk buffer only once; other
+   * implementations are materialized into a #materialize_chunk_size elements buffer chunk by
+   * chunk. Either way, per-element virtual dispatch stays out of the caller's loop.
+   *
+   * \param fn: Called with the range of indices a chunk corresponds to and a span containing
+   * the value for every index in that range. The span must not be referenced anymore after the
+   * callback returns.
+   */
+  void materialize_chunked(FunctionRef<void(IndexRange range, GSpan values)> fn) const;
+
   template<typename T> const VArray<T> *try_get_internal_varray() const
   {
     BLI_assert(type_->is<T>());
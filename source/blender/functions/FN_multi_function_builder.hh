@@ -174,8 +174,11 @@ class CustomMF_SI_SI_SI_SO : public MultiFunction {
                const VArray<In2> &in2,
                const VArray<In3> &in3,
                MutableSpan<Out1> out1) {
-      mask.foreach_index([&](int i) {
-        new (static_cast<void *>(&out1[i])) Out1(element_fn(in1[i], in2[i], in3[i]));
+      /* Devirtualization results in a 2-3x speedup for some simple functions. */
+      devirtualize_varray3(in1, in2, in3, [&](const auto &in1, const auto &in2, const auto &in3) {
+        mask.foreach_index([&](int i) {
+          new (static_cast<void *>(&out1[i])) Out1(element_fn(in1[i], in2[i], in3[i]));
+        });
       });
     };
   }
@@ -318,9 +321,12 @@ template<typename From, typename To> class CustomMF_Convert : public MultiFuncti
     const VArray<From> &inputs = params.readonly_single_input<From>(0);
     MutableSpan<To> outputs = params.uninitialized_single_output<To>(1);
 
-    for (int64_t i : mask) {
-      new (static_cast<void *>(&outputs[i])) To(inputs[i]);
-    }
+    /* Devirtualization results in a 2-3x speedup for some simple functions. */
+    devirtualize_varray(inputs, [&](const auto &inputs) {
+      for (int64_t i : mask) {
+        new (static_cast<void *>(&outputs[i])) To(inputs[i]);
+      }
+    });
   }
 };
 
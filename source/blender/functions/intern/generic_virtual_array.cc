@@ -90,6 +90,44 @@ void GVArray::materialize_to_uninitialized_impl(const IndexMask mask, void *dst)
   }
 }
 
+void GVArray::materialize_chunked(const FunctionRef<void(IndexRange range, GSpan values)> fn) const
+{
+  if (size_ == 0) {
+    return;
+  }
+  if (this->is_span()) {
+    fn(IndexRange(size_), this->get_internal_span());
+    return;
+  }
+
+  const int64_t chunk_capacity = std::min(materialize_chunk_size, size_);
+  DynamicStackBuffer<4096, 64> chunk_buffer(chunk_capacity * type_->size(), type_->alignment());
+  void *buffer = chunk_buffer.buffer();
+
+  if (this->is_single()) {
+    /* Fill the chunk buffer once and hand out (slices of) it for every chunk. */
+    BUFFER_FOR_CPP_TYPE_VALUE(*type_, single_value);
+    this->get_internal_single_to_uninitialized(single_value);
+    type_->fill_construct_n(single_value, buffer, chunk_capacity);
+    type_->destruct(single_value);
+    for (int64_t start = 0; start < size_; start += chunk_capacity) {
+      const int64_t chunk_size = std::min(chunk_capacity, size_ - start);
+      fn(IndexRange(start, chunk_size), GSpan(*type_, buffer, chunk_size));
+    }
+    type_->destruct_n(buffer, chunk_capacity);
+    return;
+  }
+
+  for (int64_t start = 0; start < size_; start += chunk_capacity) {
+    const int64_t chunk_size = std::min(chunk_capacity, size_ - start);
+    for (const int64_t i : IndexRange(start, chunk_size)) {
+      this->get_to_uninitialized(i, POINTER_OFFSET(buffer, type_->size() * (i - start)));
+    }
+    fn(IndexRange(start, chunk_size), GSpan(*type_, buffer, chunk_size));
+    type_->destruct_n(buffer, chunk_size);
+  }
+}
+
 void GVArray::get_impl(const int64_t index, void *r_value) const
 {
   type_->destruct(r_value);
@@ -60,6 +60,7 @@ bool GPU_crappy_amd_driver(void);
 bool GPU_compute_shader_support(void);
 bool GPU_shader_storage_buffer_objects_support(void);
 bool GPU_shader_image_load_store_support(void);
+bool GPU_texture_copy_array_support(void);
 
 bool GPU_mem_stats_supported(void);
 void GPU_mem_stats_get(int *totalmem, int *freemem);
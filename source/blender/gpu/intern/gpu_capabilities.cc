@@ -173,6 +173,12 @@ bool GPU_shader_image_load_store_support(void)
   return GCaps.shader_image_load_store_support;
 }
 
+/* Can #GPU_texture_copy be used on array (and 3D) textures. */
+bool GPU_texture_copy_array_support(void)
+{
+  return GCaps.texture_copy_array_support;
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
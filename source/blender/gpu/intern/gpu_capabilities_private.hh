@@ -56,6 +56,7 @@ struct GPUCapabilities {
   bool compute_shader_support = false;
   bool shader_storage_buffer_objects_support = false;
   bool shader_image_load_store_support = false;
+  bool texture_copy_array_support = false;
   /* OpenGL related workarounds. */
   bool mip_render_workaround = false;
   bool depth_blitting_workaround = false;
@@ -241,6 +241,7 @@ static void detect_workarounds()
     /* Turn off extensions. */
     GCaps.shader_image_load_store_support = false;
     GLContext::base_instance_support = false;
+    GLContext::buffer_storage_support = false;
     GLContext::clear_texture_support = false;
     GLContext::copy_image_support = false;
     GLContext::debug_layer_support = false;
@@ -421,6 +422,7 @@ GLint GLContext::max_ubo_binds = 0;
 GLint GLContext::max_ubo_size = 0;
 /** Extensions. */
 bool GLContext::base_instance_support = false;
+bool GLContext::buffer_storage_support = false;
 bool GLContext::clear_texture_support = false;
 bool GLContext::copy_image_support = false;
 bool GLContext::debug_layer_support = false;
@@ -476,6 +478,7 @@ void GLBackend::capabilities_init()
   glGetIntegerv(GL_MAX_FRAGMENT_UNIFORM_BLOCKS, &GLContext::max_ubo_binds);
   glGetIntegerv(GL_MAX_UNIFORM_BLOCK_SIZE, &GLContext::max_ubo_size);
   GLContext::base_instance_support = GLEW_ARB_base_instance;
+  GLContext::buffer_storage_support = GLEW_ARB_buffer_storage;
   GLContext::clear_texture_support = GLEW_ARB_clear_texture;
   GLContext::copy_image_support = GLEW_ARB_copy_image;
   GLContext::debug_layer_support = GLEW_VERSION_4_3 || GLEW_KHR_debug || GLEW_ARB_debug_output;
@@ -491,6 +494,9 @@ void GLBackend::capabilities_init()
 
   detect_workarounds();
 
+  /* After workarounds as they can disable the extension. */
+  GCaps.texture_copy_array_support = GLContext::copy_image_support;
+
   /* Disable this feature entirely when not debugging. */
   if ((G.debug & G_DEBUG_GPU) == 0) {
     GLContext::debug_layer_support = false;
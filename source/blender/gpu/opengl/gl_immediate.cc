@@ -23,6 +23,8 @@
  * Mimics old style opengl immediate mode drawing.
  */
 
+#include <cstring>
+
 #include "BKE_global.h"
 
 #include "gpu_context_private.hh"
@@ -42,6 +44,23 @@ namespace blender::gpu {
 /** \name Creation & Deletion
  * \{ */
 
+/**
+ * Allocate the data store of the currently bound buffer. When ARB_buffer_storage is available,
+ * the store is immutable and persistently mapped (coherent, so no explicit flushes are needed)
+ * and the mapped pointer is returned. Otherwise a mutable store is allocated and NULL is
+ * returned, the buffer is then mapped for every immBegin instead.
+ */
+static uchar *imm_buffer_storage_alloc(size_t size)
+{
+  if (GLContext::buffer_storage_support) {
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+    return (uchar *)glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+  }
+  glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+  return nullptr;
+}
+
 GLImmediate::GLImmediate()
 {
   glGenVertexArrays(1, &vao_id_);
@@ -50,12 +69,12 @@ GLImmediate::GLImmediate()
   buffer.buffer_size = DEFAULT_INTERNAL_BUFFER_SIZE;
   glGenBuffers(1, &buffer.vbo_id);
   glBindBuffer(GL_ARRAY_BUFFER, buffer.vbo_id);
-  glBufferData(GL_ARRAY_BUFFER, buffer.buffer_size, nullptr, GL_DYNAMIC_DRAW);
+  buffer.mapped = imm_buffer_storage_alloc(buffer.buffer_size);
 
   buffer_strict.buffer_size = DEFAULT_INTERNAL_BUFFER_SIZE;
   glGenBuffers(1, &buffer_strict.vbo_id);
   glBindBuffer(GL_ARRAY_BUFFER, buffer_strict.vbo_id);
-  glBufferData(GL_ARRAY_BUFFER, buffer_strict.buffer_size, nullptr, GL_DYNAMIC_DRAW);
+  buffer_strict.mapped = imm_buffer_storage_alloc(buffer_strict.buffer_size);
 
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glBindVertexArray(0);
@@ -69,6 +88,7 @@ GLImmediate::~GLImmediate()
 {
   glDeleteVertexArrays(1, &vao_id_);
 
+  /* Persistent mappings (if any) are released by the deletion. */
   glDeleteBuffers(1, &buffer.vbo_id);
   glDeleteBuffers(1, &buffer_strict.vbo_id);
 }
@@ -110,6 +130,19 @@ uchar *GLImmediate::begin()
   if (!recreate_buffer && ((bytes_needed + pre_padding) <= available_bytes)) {
     buffer_offset() += pre_padding;
   }
+  else if (GLContext::buffer_storage_support) {
+    /* Persistent storage is immutable so it cannot be orphaned. Recreating the buffer has the
+     * same effect: the driver keeps the old allocation alive until pending draws complete. */
+    glDeleteBuffers(1, &vbo_id());
+    glGenBuffers(1, &vbo_id());
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_id());
+    buffer_mapped() = imm_buffer_storage_alloc(buffer_size());
+    debug::object_label(
+        GL_BUFFER, vbo_id(), strict_vertex_len ? "ImmediateVboStrict" : "ImmediateVbo");
+    buffer_offset() = 0;
+    /* The deleted buffer name can be reused, make sure the vertex array is re-specified. */
+    bound_vbo_id_ = 0;
+  }
   else {
     /* orphan this buffer & start with a fresh one */
     glBufferData(GL_ARRAY_BUFFER, buffer_size(), nullptr, GL_DYNAMIC_DRAW);
@@ -124,11 +157,18 @@ uchar *GLImmediate::begin()
   }
 #endif
 
-  GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
-  if (!strict_vertex_len) {
-    access |= GL_MAP_FLUSH_EXPLICIT_BIT;
+  void *data;
+  if (buffer_mapped() != nullptr) {
+    /* Write straight into the persistent mapping, zero-copy & no driver synchronization. */
+    data = buffer_mapped() + buffer_offset();
+  }
+  else {
+    GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+    if (!strict_vertex_len) {
+      access |= GL_MAP_FLUSH_EXPLICIT_BIT;
+    }
+    data = glMapBufferRange(GL_ARRAY_BUFFER, buffer_offset(), bytes_needed, access);
   }
-  void *data = glMapBufferRange(GL_ARRAY_BUFFER, buffer_offset(), bytes_needed, access);
   BLI_assert(data != nullptr);
 
   bytes_mapped_ = bytes_needed;
@@ -146,10 +186,14 @@ void GLImmediate::end()
       buffer_bytes_used = vertex_buffer_size(&vertex_format, vertex_len);
       /* unused buffer bytes are available to the next immBegin */
     }
-    /* tell OpenGL what range was modified so it doesn't copy the whole mapped range */
-    glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, buffer_bytes_used);
+    if (buffer_mapped() == nullptr) {
+      /* tell OpenGL what range was modified so it doesn't copy the whole mapped range */
+      glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, buffer_bytes_used);
+    }
+  }
+  if (buffer_mapped() == nullptr) {
+    glUnmapBuffer(GL_ARRAY_BUFFER);
   }
-  glUnmapBuffer(GL_ARRAY_BUFFER);
 
   if (vertex_len > 0) {
     GLContext::get()->state_manager->apply_state();
@@ -157,8 +201,22 @@ void GLImmediate::end()
     /* We convert the offset in vertex offset from the buffer's start.
      * This works because we added some padding to align the first vertex vertex. */
     uint v_first = buffer_offset() / vertex_format.stride;
-    GLVertArray::update_bindings(
-        vao_id_, v_first, &vertex_format, reinterpret_cast<Shader *>(shader)->interface);
+
+    /* Bindings are baked without base offset and the starting vertex is passed to the draw call
+     * instead, so consecutive draws from the same buffer with the same format and shader reuse
+     * the vertex array as is. Re-specifying the attributes for every tiny draw is a large part
+     * of the driver overhead of interface drawing. */
+    const ShaderInterface *interface = reinterpret_cast<Shader *>(shader)->interface;
+    if (vbo_id() != bound_vbo_id_ || interface != bound_interface_ ||
+        memcmp(&vertex_format, &bound_format_, sizeof(GPUVertFormat)) != 0) {
+      GLVertArray::update_bindings(vao_id_, 0, &vertex_format, interface);
+      bound_vbo_id_ = vbo_id();
+      bound_interface_ = interface;
+      bound_format_ = vertex_format;
+    }
+    else {
+      glBindVertexArray(vao_id_);
+    }
 
     /* Update matrices. */
     GPU_shader_bind(shader);
@@ -166,7 +224,7 @@ void GLImmediate::end()
 #ifdef __APPLE__
     glDisable(GL_PRIMITIVE_RESTART);
 #endif
-    glDrawArrays(to_gl(prim_type), 0, vertex_len);
+    glDrawArrays(to_gl(prim_type), v_first, vertex_len);
 #ifdef __APPLE__
     glEnable(GL_PRIMITIVE_RESTART);
 #endif
@@ -33,6 +33,8 @@
 
 namespace blender::gpu {
 
+class ShaderInterface;
+
 /* size of internal buffer */
 #define DEFAULT_INTERNAL_BUFFER_SIZE (4 * 1024 * 1024)
 
@@ -48,11 +50,20 @@ class GLImmediate : public Immediate {
     size_t buffer_offset = 0;
     /** Size of the whole buffer in bytes. */
     size_t buffer_size = 0;
+    /** Persistently mapped data, when ARB_buffer_storage is available. Otherwise null and the
+     * buffer is mapped & unmapped for every immBegin/immEnd pair. */
+    uchar *mapped = nullptr;
   } buffer, buffer_strict;
   /** Size in bytes of the mapped region. */
   size_t bytes_mapped_ = 0;
   /** Vertex array for this immediate mode instance. */
   GLuint vao_id_ = 0;
+  /** Bindings currently baked into the vertex array. Consecutive draws with the same buffer,
+   * format and shader interface only differ by their starting vertex, so the per draw attribute
+   * re-specification can be skipped for them. */
+  GLuint bound_vbo_id_ = 0;
+  const ShaderInterface *bound_interface_ = nullptr;
+  GPUVertFormat bound_format_ = {};
 
  public:
   GLImmediate();
@@ -76,6 +87,11 @@ class GLImmediate : public Immediate {
   {
     return strict_vertex_len ? buffer_strict.buffer_size : buffer.buffer_size;
   };
+
+  uchar *&buffer_mapped(void)
+  {
+    return strict_vertex_len ? buffer_strict.mapped : buffer.mapped;
+  };
 };
 
 }  // namespace blender::gpu
@@ -21,8 +21,12 @@
  * \ingroup gpu
  */
 
+#include "BKE_appdir.h"
 #include "BKE_global.h"
 
+#include "BLI_fileops.h"
+#include "BLI_hash_md5.h"
+#include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_vector.hh"
 
@@ -189,21 +193,33 @@ GLuint GLShader::create_shader_stage(GLenum gl_stage, MutableSpan<const char *>
 
 void GLShader::vertex_shader_from_glsl(MutableSpan<const char *> sources)
 {
+  if (this->program_binary_defer(GL_VERTEX_SHADER, sources)) {
+    return;
+  }
   vert_shader_ = this->create_shader_stage(GL_VERTEX_SHADER, sources);
 }
 
 void GLShader::geometry_shader_from_glsl(MutableSpan<const char *> sources)
 {
+  if (this->program_binary_defer(GL_GEOMETRY_SHADER, sources)) {
+    return;
+  }
   geom_shader_ = this->create_shader_stage(GL_GEOMETRY_SHADER, sources);
 }
 
 void GLShader::fragment_shader_from_glsl(MutableSpan<const char *> sources)
 {
+  if (this->program_binary_defer(GL_FRAGMENT_SHADER, sources)) {
+    return;
+  }
   frag_shader_ = this->create_shader_stage(GL_FRAGMENT_SHADER, sources);
 }
 
 void GLShader::compute_shader_from_glsl(MutableSpan<const char *> sources)
 {
+  if (this->program_binary_defer(GL_COMPUTE_SHADER, sources)) {
+    return;
+  }
   compute_shader_ = this->create_shader_stage(GL_COMPUTE_SHADER, sources);
 }
 
@@ -213,7 +229,24 @@ bool GLShader::finalize()
     return false;
   }
 
-  glLinkProgram(shader_program_);
+  bool program_binary_loaded = false;
+  if (use_program_binary_cache_) {
+    program_binary_loaded = this->program_binary_load();
+    if (!program_binary_loaded) {
+      /* Cache miss, compile the deferred sources & link as usual. */
+      this->program_binary_defer_flush();
+      if (compilation_failed_) {
+        return false;
+      }
+    }
+  }
+
+  if (!program_binary_loaded) {
+    if (use_program_binary_cache_) {
+      glProgramParameteri(shader_program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(shader_program_);
+  }
 
   GLint status;
   glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
@@ -226,6 +259,10 @@ bool GLShader::finalize()
     return false;
   }
 
+  if (use_program_binary_cache_ && !program_binary_loaded) {
+    this->program_binary_store();
+  }
+
   interface = new GLShaderInterface(shader_program_);
 
   return true;
@@ -233,6 +270,207 @@ bool GLShader::finalize()
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Program binary cache
+ *
+ * Persist linked program binaries on disk (ARB_get_program_binary), so that warm sessions skip
+ * GLSL compilation entirely. Binaries are only valid for the exact driver that produced them,
+ * so the cache key covers the driver identification strings next to all stage sources, and a
+ * binary the driver rejects is simply deleted & recompiled.
+ * \{ */
+
+/**
+ * Return the directory program binaries are cached in, NULL when the cache is unusable
+ * (no driver support, forced workarounds, or no writable user directory).
+ */
+static const char *program_binary_cache_dir_get()
+{
+  /* Function-local static initialization is thread-safe: shaders are also created from the
+   * deferred compilation worker thread (see WM_JOB_TYPE_SHADER_COMPILATION), which must not
+   * observe a half-written directory. */
+  static const std::string cache_dir = []() {
+    std::string dir_result;
+    if (GLEW_ARB_get_program_binary && !(G.debug & G_DEBUG_GPU_FORCE_WORKAROUNDS)) {
+      GLint num_formats = 0;
+      glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats);
+      if (num_formats > 0) {
+        /* There is no dedicated cache location in appdir, so use a sub-folder of the user
+         * config directory which is versioned like the rest of the user files. */
+        const char *dir = BKE_appdir_folder_id_create(BLENDER_USER_CONFIG, "shader-cache");
+        if (dir != nullptr) {
+          dir_result = dir;
+        }
+      }
+    }
+    return dir_result;
+  }();
+  return cache_dir.empty() ? nullptr : cache_dir.c_str();
+}
+
+static int program_binary_stage_index(GLenum gl_stage)
+{
+  switch (gl_stage) {
+    case GL_VERTEX_SHADER:
+      return 0;
+    case GL_GEOMETRY_SHADER:
+      return 1;
+    case GL_FRAGMENT_SHADER:
+      return 2;
+    case GL_COMPUTE_SHADER:
+      return 3;
+    default:
+      BLI_assert(0);
+      return 0;
+  }
+}
+
+/**
+ * Store the stage sources for a later #GLShader::program_binary_load instead of compiling them.
+ * Returns false when the binary cache cannot be used and the stage must compile as usual.
+ */
+bool GLShader::program_binary_defer(GLenum gl_stage, MutableSpan<const char *> sources)
+{
+  if (program_binary_cache_dir_get() == nullptr) {
+    return false;
+  }
+  use_program_binary_cache_ = true;
+
+  std::string &src = deferred_sources_[program_binary_stage_index(gl_stage)];
+  /* Skip the first source slot, it is reserved for the patch header
+   * (see #GLShader::create_shader_stage). */
+  for (const char *source : sources.drop_front(1)) {
+    src += source;
+  }
+  return true;
+}
+
+/** Compile a stage whose sources were kept by #GLShader::program_binary_defer. */
+GLuint GLShader::create_shader_stage_deferred(GLenum gl_stage)
+{
+  std::string &src = deferred_sources_[program_binary_stage_index(gl_stage)];
+  if (src.empty()) {
+    /* Stage not used by this shader. */
+    return 0;
+  }
+  const char *sources[2] = {nullptr, src.c_str()};
+  return this->create_shader_stage(gl_stage, MutableSpan<const char *>(sources, 2));
+}
+
+/** Compile all deferred stages, used on cache miss & for transform feedback shaders. */
+void GLShader::program_binary_defer_flush()
+{
+  if (!use_program_binary_cache_) {
+    return;
+  }
+  vert_shader_ = this->create_shader_stage_deferred(GL_VERTEX_SHADER);
+  geom_shader_ = this->create_shader_stage_deferred(GL_GEOMETRY_SHADER);
+  frag_shader_ = this->create_shader_stage_deferred(GL_FRAGMENT_SHADER);
+  compute_shader_ = this->create_shader_stage_deferred(GL_COMPUTE_SHADER);
+}
+
+/**
+ * Try to load a cached binary into #shader_program_. Also computes #program_binary_path_ for
+ * #GLShader::program_binary_store. Returns true when the program linked from the binary.
+ */
+bool GLShader::program_binary_load()
+{
+  /* The binary is specific to the exact driver, tie the key to its identification strings.
+   * The patch header is derived from them, so it does not need hashing on its own. */
+  std::string key;
+  key += (const char *)glGetString(GL_VENDOR);
+  key += '\n';
+  key += (const char *)glGetString(GL_RENDERER);
+  key += '\n';
+  key += (const char *)glGetString(GL_VERSION);
+  for (const std::string &src : deferred_sources_) {
+    key += '\0';
+    key += src;
+  }
+
+  char digest[16];
+  char hex_digest[33];
+  BLI_hash_md5_buffer(key.data(), key.size(), digest);
+  BLI_hash_md5_to_hexdigest(digest, hex_digest);
+
+  char filename[64];
+  BLI_snprintf(filename, sizeof(filename), "%s.bin", hex_digest);
+  char path[FILE_MAX];
+  BLI_path_join(path, sizeof(path), program_binary_cache_dir_get(), filename, NULL);
+  program_binary_path_ = path;
+
+  FILE *file = BLI_fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  bool success = false;
+  fseek(file, 0, SEEK_END);
+  const long file_size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+
+  uint32_t binary_format = 0;
+  const long binary_size = file_size - (long)sizeof(binary_format);
+  if (binary_size > 0 && fread(&binary_format, sizeof(binary_format), 1, file) == 1) {
+    void *binary = MEM_mallocN(binary_size, __func__);
+    if (fread(binary, 1, binary_size, file) == (size_t)binary_size) {
+      glProgramBinary(shader_program_, binary_format, binary, binary_size);
+
+      GLint status = 0;
+      glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
+      success = (status != 0);
+    }
+    MEM_freeN(binary);
+  }
+  fclose(file);
+
+  if (!success) {
+    /* Stale or corrupt binary (driver update for example), recompile & overwrite. */
+    BLI_delete(path, false, false);
+  }
+  return success;
+}
+
+/** Write the linked program's binary to #program_binary_path_. */
+void GLShader::program_binary_store()
+{
+  GLint binary_size = 0;
+  glGetProgramiv(shader_program_, GL_PROGRAM_BINARY_LENGTH, &binary_size);
+  if (binary_size <= 0 || program_binary_path_.empty()) {
+    return;
+  }
+
+  void *binary = MEM_mallocN(binary_size, __func__);
+  GLenum binary_format = 0;
+  GLsizei binary_len = 0;
+  glGetProgramBinary(shader_program_, binary_size, &binary_len, &binary_format, binary);
+
+  /* Write to a temporary file first so concurrent compilations (deferred compilation threads)
+   * never read a partially written binary. */
+  char path_tmp[FILE_MAX];
+  BLI_snprintf(path_tmp,
+               sizeof(path_tmp),
+               "%s.tmp%llx",
+               program_binary_path_.c_str(),
+               (unsigned long long)(uintptr_t)this);
+
+  FILE *file = BLI_fopen(path_tmp, "wb");
+  if (file != nullptr) {
+    const uint32_t format = binary_format;
+    bool success = (fwrite(&format, sizeof(format), 1, file) == 1) &&
+                   (fwrite(binary, 1, binary_len, file) == (size_t)binary_len);
+    fclose(file);
+    if (success) {
+      BLI_rename(path_tmp, program_binary_path_.c_str());
+    }
+    else {
+      BLI_delete(path_tmp, false, false);
+    }
+  }
+  MEM_freeN(binary);
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Binding
  * \{ */
@@ -262,6 +500,11 @@ void GLShader::unbind()
 void GLShader::transform_feedback_names_set(Span<const char *> name_list,
                                             const eGPUShaderTFBType geom_type)
 {
+  /* A cached program binary would not capture the transform feedback layout (it is not part of
+   * the cache key), so compile these shaders as usual. */
+  this->program_binary_defer_flush();
+  use_program_binary_cache_ = false;
+
   glTransformFeedbackVaryings(
       shader_program_, name_list.size(), name_list.data(), GL_INTERLEAVED_ATTRIBS);
   transform_feedback_type_ = geom_type;
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "MEM_guardedalloc.h"
 
 #include "glew-mx.h"
@@ -47,6 +49,13 @@ class GLShader : public Shader {
   /** True if any shader failed to compile. */
   bool compilation_failed_ = false;
 
+  /** When the program binary cache is usable, stage sources are kept here (without the patch
+   * header) and only compiled on a cache miss, see #GLShader::program_binary_load. */
+  std::string deferred_sources_[4];
+  /** Path the program binary is cached at, set by #GLShader::program_binary_load. */
+  std::string program_binary_path_;
+  bool use_program_binary_cache_ = false;
+
   eGPUShaderTFBType transform_feedback_type_ = GPU_SHADER_TFB_NONE;
 
  public:
@@ -81,6 +90,12 @@ class GLShader : public Shader {
 
   GLuint create_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources);
 
+  bool program_binary_defer(GLenum gl_stage, MutableSpan<const char *> sources);
+  GLuint create_shader_stage_deferred(GLenum gl_stage);
+  void program_binary_defer_flush(void);
+  bool program_binary_load(void);
+  void program_binary_store(void);
+
   MEM_CXX_CLASS_ALLOC_FUNCS("GLShader");
 };
 
@@ -347,19 +347,20 @@ void GLTexture::copy_to(Texture *dst_)
   BLI_assert((dst->w_ == src->w_) && (dst->h_ == src->h_) && (dst->d_ == src->d_));
   BLI_assert(dst->format_ == src->format_);
   BLI_assert(dst->type_ == src->type_);
-  /* TODO: support array / 3D textures. */
-  BLI_assert(dst->d_ == 0);
 
   if (GLContext::copy_image_support) {
     int mip = 0;
-    /* NOTE: mip_size_get() won't override any dimension that is equal to 0. */
+    /* NOTE: mip_size_get() won't override any dimension that is equal to 0.
+     * For array textures the last dimension is the layer count, so this path covers them too. */
     int extent[3] = {1, 1, 1};
     this->mip_size_get(mip, extent);
     glCopyImageSubData(
         src->tex_id_, target_, mip, 0, 0, 0, dst->tex_id_, target_, mip, 0, 0, 0, UNPACK3(extent));
   }
   else {
-    /* Fallback for older GL. */
+    /* Fallback for older GL. Only covers single layer textures, check
+     * #GPU_texture_copy_array_support before using this on array / 3D textures. */
+    BLI_assert(dst->d_ == 0);
     GPU_framebuffer_blit(
         src->framebuffer_get(), 0, dst->framebuffer_get(), 0, to_framebuffer_bits(format_));
   }
@@ -349,6 +349,7 @@ void IMB_anim_get_fname(struct anim *anim, char *file, int size);
 int IMB_anim_index_get_frame_index(struct anim *anim, IMB_Timecode_Type tc, int position);
 
 IMB_Proxy_Size IMB_anim_proxy_get_existing(struct anim *anim);
+IMB_Timecode_Type IMB_anim_timecode_get_existing(struct anim *anim);
 
 struct IndexBuildContext;
 
@@ -130,8 +130,18 @@ struct anim {
   AVFrame *pFrameRGB;
   AVFrame *pFrameDeinterlaced;
   struct SwsContext *img_convert_ctx;
+  /** Pixel format #img_convert_ctx was created for, so the context can be re-created when
+   * hardware decoded frames arrive in a different format than #AVCodecContext.pix_fmt. */
+  enum AVPixelFormat img_convert_pix_fmt;
   int videoStream;
 
+  /** Hardware decode device (VAAPI, NVDEC, VideoToolbox, ...), NULL when decoding in software. */
+  struct AVBufferRef *hw_device_ctx;
+  /** Pixel format negotiated with the hardware decoder, AV_PIX_FMT_NONE when in software. */
+  enum AVPixelFormat hw_pix_fmt;
+  /** Scratch frame for downloading hardware decoded frames into system memory. */
+  AVFrame *pFrame_hw;
+
   struct ImBuf *cur_frame_final;
   int64_t cur_pts;
   int64_t cur_key_frame_pts;
@@ -79,6 +79,7 @@
 
 #  include <libavcodec/avcodec.h>
 #  include <libavformat/avformat.h>
+#  include <libavutil/hwcontext.h>
 #  include <libavutil/imgutils.h>
 #  include <libavutil/rational.h>
 #  include <libswscale/swscale.h>
@@ -507,6 +508,126 @@ BLI_INLINE bool need_aligned_ffmpeg_buffer(struct anim *anim)
   return (anim->x & 31) != 0;
 }
 
+static enum AVPixelFormat ffmpeg_hwaccel_get_format(AVCodecContext *ctx,
+                                                    const enum AVPixelFormat *pix_fmts)
+{
+  struct anim *anim = ctx->opaque;
+
+  for (const enum AVPixelFormat *p = pix_fmts; *p != AV_PIX_FMT_NONE; p++) {
+    if (*p == anim->hw_pix_fmt) {
+      return *p;
+    }
+  }
+
+  /* The codec can not provide the negotiated hardware format for this stream,
+   * fall back to software decoding. */
+  anim->hw_pix_fmt = AV_PIX_FMT_NONE;
+  return avcodec_default_get_format(ctx, pix_fmts);
+}
+
+/* Try to set up hardware decoding (VAAPI, NVDEC, VideoToolbox, ... depending on the platform):
+ * walk the device types FFmpeg knows about until one supports the codec and can be opened.
+ * Decoding stays in software when no device is available, and falls back per stream in
+ * #ffmpeg_hwaccel_get_format when the device refuses the stream. */
+static void ffmpeg_hwaccel_init(struct anim *anim, AVCodecContext *pCodecCtx, AVCodec *pCodec)
+{
+  /* Deinterlacing operates on the codec-native frame layout, see #ffmpeg_postprocess. */
+  if (anim->ib_flags & IB_animdeinterlace) {
+    return;
+  }
+
+  enum AVHWDeviceType type = AV_HWDEVICE_TYPE_NONE;
+  while ((type = av_hwdevice_iterate_types(type)) != AV_HWDEVICE_TYPE_NONE) {
+    const AVCodecHWConfig *config = NULL;
+    for (int i = 0; (config = avcodec_get_hw_config(pCodec, i)) != NULL; i++) {
+      if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) != 0 &&
+          config->device_type == type) {
+        break;
+      }
+    }
+    if (config == NULL) {
+      continue;
+    }
+
+    if (av_hwdevice_ctx_create(&anim->hw_device_ctx, type, NULL, NULL, 0) < 0) {
+      continue;
+    }
+
+    anim->hw_pix_fmt = config->pix_fmt;
+    pCodecCtx->hw_device_ctx = av_buffer_ref(anim->hw_device_ctx);
+    pCodecCtx->get_format = ffmpeg_hwaccel_get_format;
+    pCodecCtx->opaque = anim;
+
+    av_log(NULL,
+           AV_LOG_DEBUG,
+           "ffmpeg: using %s hardware decoding for %s\n",
+           av_hwdevice_get_type_name(type),
+           anim->name);
+    return;
+  }
+}
+
+/* Create (or re-create when `src_format` changes) the RGBA conversion context. The source format
+ * can differ from `anim->pCodecCtx->pix_fmt` when frames are decoded on a hardware device, see
+ * #ffmpeg_hwaccel_transfer_frame. */
+static bool ffmpeg_sws_context_ensure(struct anim *anim, enum AVPixelFormat src_format)
+{
+  /* The following for color space determination */
+  int srcRange, dstRange, brightness, contrast, saturation;
+  int *table;
+  const int *inv_table;
+
+  if (anim->img_convert_ctx != NULL && anim->img_convert_pix_fmt == src_format) {
+    return true;
+  }
+
+  sws_freeContext(anim->img_convert_ctx);
+  anim->img_convert_ctx = sws_getContext(anim->x,
+                                         anim->y,
+                                         src_format,
+                                         anim->x,
+                                         anim->y,
+                                         AV_PIX_FMT_RGBA,
+                                         SWS_BILINEAR | SWS_PRINT_INFO | SWS_FULL_CHR_H_INT,
+                                         NULL,
+                                         NULL,
+                                         NULL);
+  anim->img_convert_pix_fmt = src_format;
+
+  if (!anim->img_convert_ctx) {
+    return false;
+  }
+
+  /* Try do detect if input has 0-255 YCbCR range (JFIF Jpeg MotionJpeg) */
+  if (!sws_getColorspaceDetails(anim->img_convert_ctx,
+                                (int **)&inv_table,
+                                &srcRange,
+                                &table,
+                                &dstRange,
+                                &brightness,
+                                &contrast,
+                                &saturation)) {
+    srcRange = srcRange || anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG;
+    inv_table = sws_getCoefficients(anim->pCodecCtx->colorspace);
+
+    if (sws_setColorspaceDetails(anim->img_convert_ctx,
+                                 (int *)inv_table,
+                                 srcRange,
+                                 table,
+                                 dstRange,
+                                 brightness,
+                                 contrast,
+                                 saturation)) {
+      fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+    }
+  }
+  else {
+    fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+  }
+
+  return true;
+}
+
 static int startffmpeg(struct anim *anim)
 {
   int i, video_stream_index;
@@ -520,11 +641,6 @@ static int startffmpeg(struct anim *anim)
   double frs_den;
   int streamcount;
 
-  /* The following for color space determination */
-  int srcRange, dstRange, brightness, contrast, saturation;
-  int *table;
-  const int *inv_table;
-
   if (anim == NULL) {
     return (-1);
   }
@@ -588,12 +704,18 @@ static int startffmpeg(struct anim *anim)
     pCodecCtx->thread_type = FF_THREAD_SLICE;
   }
 
+  anim->hw_device_ctx = NULL;
+  anim->hw_pix_fmt = AV_PIX_FMT_NONE;
+  ffmpeg_hwaccel_init(anim, pCodecCtx, pCodec);
+
   if (avcodec_open2(pCodecCtx, pCodec, NULL) < 0) {
+    av_buffer_unref(&anim->hw_device_ctx);
     avformat_close_input(&pFormatCtx);
     return -1;
   }
   if (pCodecCtx->pix_fmt == AV_PIX_FMT_NONE) {
     avcodec_free_context(&anim->pCodecCtx);
+    av_buffer_unref(&anim->hw_device_ctx);
     avformat_close_input(&pFormatCtx);
     return -1;
   }
@@ -707,6 +829,7 @@ static int startffmpeg(struct anim *anim)
   anim->cur_packet->stream_index = -1;
 
   anim->pFrame = av_frame_alloc();
+  anim->pFrame_hw = av_frame_alloc();
   anim->pFrameComplete = false;
   anim->pFrameDeinterlaced = av_frame_alloc();
   anim->pFrameRGB = av_frame_alloc();
@@ -724,6 +847,8 @@ static int startffmpeg(struct anim *anim)
       av_frame_free(&anim->pFrameRGB);
       av_frame_free(&anim->pFrameDeinterlaced);
       av_frame_free(&anim->pFrame);
+      av_frame_free(&anim->pFrame_hw);
+      av_buffer_unref(&anim->hw_device_ctx);
       anim->pCodecCtx = NULL;
       return -1;
     }
@@ -737,6 +862,8 @@ static int startffmpeg(struct anim *anim)
     av_frame_free(&anim->pFrameRGB);
     av_frame_free(&anim->pFrameDeinterlaced);
     av_frame_free(&anim->pFrame);
+    av_frame_free(&anim->pFrame_hw);
+    av_buffer_unref(&anim->hw_device_ctx);
     anim->pCodecCtx = NULL;
     return -1;
   }
@@ -755,18 +882,7 @@ static int startffmpeg(struct anim *anim)
                          1);
   }
 
-  anim->img_convert_ctx = sws_getContext(anim->x,
-                                         anim->y,
-                                         anim->pCodecCtx->pix_fmt,
-                                         anim->x,
-                                         anim->y,
-                                         AV_PIX_FMT_RGBA,
-                                         SWS_BILINEAR | SWS_PRINT_INFO | SWS_FULL_CHR_H_INT,
-                                         NULL,
-                                         NULL,
-                                         NULL);
-
-  if (!anim->img_convert_ctx) {
+  if (!ffmpeg_sws_context_ensure(anim, anim->pCodecCtx->pix_fmt)) {
     fprintf(stderr, "Can't transform color space??? Bailing out...\n");
     avcodec_free_context(&anim->pCodecCtx);
     avformat_close_input(&anim->pFormatCtx);
@@ -774,37 +890,12 @@ static int startffmpeg(struct anim *anim)
     av_frame_free(&anim->pFrameRGB);
     av_frame_free(&anim->pFrameDeinterlaced);
     av_frame_free(&anim->pFrame);
+    av_frame_free(&anim->pFrame_hw);
+    av_buffer_unref(&anim->hw_device_ctx);
     anim->pCodecCtx = NULL;
     return -1;
   }
 
-  /* Try do detect if input has 0-255 YCbCR range (JFIF Jpeg MotionJpeg) */
-  if (!sws_getColorspaceDetails(anim->img_convert_ctx,
-                                (int **)&inv_table,
-                                &srcRange,
-                                &table,
-                                &dstRange,
-                                &brightness,
-                                &contrast,
-                                &saturation)) {
-    srcRange = srcRange || anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG;
-    inv_table = sws_getCoefficients(anim->pCodecCtx->colorspace);
-
-    if (sws_setColorspaceDetails(anim->img_convert_ctx,
-                                 (int *)inv_table,
-                                 srcRange,
-                                 table,
-                                 dstRange,
-                                 brightness,
-                                 contrast,
-                                 saturation)) {
-      fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
-    }
-  }
-  else {
-    fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
-  }
-
   return 0;
 }
 
@@ -854,6 +945,11 @@ static void ffmpeg_postprocess(struct anim *anim)
     }
   }
 
+  if (!ffmpeg_sws_context_ensure(anim, input->format)) {
+    fprintf(stderr, "Can't transform color space??? Bailing out...\n");
+    return;
+  }
+
   if (!need_aligned_ffmpeg_buffer(anim)) {
     av_image_fill_arrays(anim->pFrameRGB->data,
                          anim->pFrameRGB->linesize,
@@ -944,6 +1040,25 @@ static void ffmpeg_postprocess(struct anim *anim)
   }
 }
 
+/* Download the frame from the hardware device if it was decoded there, see #ffmpeg_hwaccel_init.
+ * The downloaded copy ends up in anim->pFrame, as if it was decoded in software. */
+static void ffmpeg_hwaccel_transfer_frame(struct anim *anim)
+{
+  if (anim->hw_pix_fmt == AV_PIX_FMT_NONE || anim->pFrame->format != anim->hw_pix_fmt) {
+    return;
+  }
+
+  av_frame_unref(anim->pFrame_hw);
+  if (av_hwframe_transfer_data(anim->pFrame_hw, anim->pFrame, 0) < 0 ||
+      av_frame_copy_props(anim->pFrame_hw, anim->pFrame) < 0) {
+    fprintf(stderr, "Error transferring hardware decoded frame to system memory.\n");
+    anim->pFrameComplete = false;
+    return;
+  }
+
+  SWAP(AVFrame *, anim->pFrame, anim->pFrame_hw);
+}
+
 /* decode one video frame also considering the packet read into cur_packet */
 
 static int ffmpeg_decode_video_frame(struct anim *anim)
@@ -973,6 +1088,10 @@ static int ffmpeg_decode_video_frame(struct anim *anim)
       avcodec_send_packet(anim->pCodecCtx, anim->cur_packet);
       anim->pFrameComplete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
 
+      if (anim->pFrameComplete) {
+        ffmpeg_hwaccel_transfer_frame(anim);
+      }
+
       if (anim->pFrameComplete) {
         anim->cur_pts = av_get_pts_from_frame(anim->pFrame);
 
@@ -998,6 +1117,10 @@ static int ffmpeg_decode_video_frame(struct anim *anim)
     avcodec_send_packet(anim->pCodecCtx, NULL);
     anim->pFrameComplete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
 
+    if (anim->pFrameComplete) {
+      ffmpeg_hwaccel_transfer_frame(anim);
+    }
+
     if (anim->pFrameComplete) {
       anim->cur_pts = av_get_pts_from_frame(anim->pFrame);
 
@@ -1492,8 +1615,11 @@ static void free_anim_ffmpeg(struct anim *anim)
     }
     av_frame_free(&anim->pFrameRGB);
     av_frame_free(&anim->pFrameDeinterlaced);
+    av_frame_free(&anim->pFrame_hw);
+    av_buffer_unref(&anim->hw_device_ctx);
 
     sws_freeContext(anim->img_convert_ctx);
+    anim->img_convert_ctx = NULL;
     IMB_freeImBuf(anim->cur_frame_final);
   }
   anim->duration_in_frames = 0;
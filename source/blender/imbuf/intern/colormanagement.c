@@ -102,10 +102,26 @@ static pthread_mutex_t processor_lock = BLI_MUTEX_INITIALIZER;
 
 typedef struct ColormanageProcessor {
   OCIO_ConstCPUProcessorRcPtr *cpu_processor;
+  /* Processors from the pair cache are shared, only ones created for this
+   * processor specifically are released together with it. */
+  bool owns_cpu_processor;
   CurveMapping *curve_mapping;
   bool is_data_result;
 } ColormanageProcessor;
 
+/* Cached CPU processors for arbitrary color space pairs, keyed by the space names.
+ * Creating an OCIO processor is expensive while the sequencer and image loading
+ * request the same conversion over and over, so entries live until the configuration
+ * is freed and the cached processors are shared between callers. */
+typedef struct ColormanagePairProcessor {
+  struct ColormanagePairProcessor *next, *prev;
+  char from_name[MAX_COLORSPACE_NAME];
+  char to_name[MAX_COLORSPACE_NAME];
+  OCIO_ConstCPUProcessorRcPtr *cpu_processor;
+} ColormanagePairProcessor;
+
+static ListBase global_pair_processors = {NULL, NULL};
+
 static struct global_gpu_state {
   /* GPU shader currently bound. */
   bool gpu_shader_bound;
@@ -587,6 +603,15 @@ static void colormanage_free_config(void)
 {
   ColorSpace *colorspace;
   ColorManagedDisplay *display;
+  ColormanagePairProcessor *pair;
+
+  /* free cached pair processors */
+  for (pair = global_pair_processors.first; pair; pair = pair->next) {
+    if (pair->cpu_processor) {
+      OCIO_cpuProcessorRelease(pair->cpu_processor);
+    }
+  }
+  BLI_freelistN(&global_pair_processors);
 
   /* free color spaces */
   colorspace = global_colorspaces.first;
@@ -868,6 +893,43 @@ static OCIO_ConstProcessorRcPtr *create_colorspace_transform_processor(const cha
   return processor;
 }
 
+/* Returned processor is owned by the pair cache and must not be released by the
+ * caller. A failed creation is cached as well (as a NULL processor), so broken
+ * configurations don't pay the creation cost on every lookup either. */
+static OCIO_ConstCPUProcessorRcPtr *colorspace_transform_cpu_processor(
+    const char *from_colorspace, const char *to_colorspace)
+{
+  ColormanagePairProcessor *pair;
+
+  BLI_mutex_lock(&processor_lock);
+
+  for (pair = global_pair_processors.first; pair; pair = pair->next) {
+    if (STREQ(pair->from_name, from_colorspace) && STREQ(pair->to_name, to_colorspace)) {
+      break;
+    }
+  }
+
+  if (pair == NULL) {
+    OCIO_ConstProcessorRcPtr *processor;
+
+    pair = MEM_callocN(sizeof(ColormanagePairProcessor), "colormanage pair processor");
+    BLI_strncpy(pair->from_name, from_colorspace, sizeof(pair->from_name));
+    BLI_strncpy(pair->to_name, to_colorspace, sizeof(pair->to_name));
+
+    processor = create_colorspace_transform_processor(from_colorspace, to_colorspace);
+    if (processor != NULL) {
+      pair->cpu_processor = OCIO_processorGetCPUProcessor(processor);
+      OCIO_processorRelease(processor);
+    }
+
+    BLI_addtail(&global_pair_processors, pair);
+  }
+
+  BLI_mutex_unlock(&processor_lock);
+
+  return pair->cpu_processor;
+}
+
 static OCIO_ConstCPUProcessorRcPtr *colorspace_to_scene_linear_cpu_processor(
     ColorSpace *colorspace)
 {
@@ -2111,6 +2173,18 @@ void IMB_colormanagement_colorspace_to_scene_linear_v3(float pixel[3], ColorSpac
     return;
   }
 
+  /* Fast path for the builtin spaces which cover almost all loaded images: the OCIO
+   * processor dispatch is measurable when running per pixel, and OCIO_colorSpaceIsBuiltin()
+   * only reports these spaces when their transform matches the builtin curves exactly,
+   * so the output is unchanged. */
+  if (IMB_colormanagement_space_is_scene_linear(colorspace)) {
+    return;
+  }
+  if (IMB_colormanagement_space_is_srgb(colorspace)) {
+    srgb_to_linearrgb_v3_v3(pixel, pixel);
+    return;
+  }
+
   processor = colorspace_to_scene_linear_cpu_processor(colorspace);
 
   if (processor != NULL) {
@@ -2129,6 +2203,15 @@ void IMB_colormanagement_scene_linear_to_colorspace_v3(float pixel[3], ColorSpac
     return;
   }
 
+  /* Fast path for builtin spaces, see IMB_colormanagement_colorspace_to_scene_linear_v3. */
+  if (IMB_colormanagement_space_is_scene_linear(colorspace)) {
+    return;
+  }
+  if (IMB_colormanagement_space_is_srgb(colorspace)) {
+    linearrgb_to_srgb_v3_v3(pixel, pixel);
+    return;
+  }
+
   processor = colorspace_from_scene_linear_cpu_processor(colorspace);
 
   if (processor != NULL) {
@@ -2148,6 +2231,20 @@ void IMB_colormanagement_colorspace_to_scene_linear_v4(float pixel[4],
     return;
   }
 
+  /* Fast path for builtin spaces, see IMB_colormanagement_colorspace_to_scene_linear_v3. */
+  if (IMB_colormanagement_space_is_scene_linear(colorspace)) {
+    return;
+  }
+  if (IMB_colormanagement_space_is_srgb(colorspace)) {
+    if (predivide) {
+      srgb_to_linearrgb_predivide_v4(pixel, pixel);
+    }
+    else {
+      srgb_to_linearrgb_v4(pixel, pixel);
+    }
+    return;
+  }
+
   processor = colorspace_to_scene_linear_cpu_processor(colorspace);
 
   if (processor != NULL) {
@@ -2199,6 +2296,60 @@ void IMB_colormanagement_colorspace_to_scene_linear(float *buffer,
   }
 }
 
+typedef struct ImbufToTextureData {
+  unsigned char *out_byte_buffer;
+  float *out_float_buffer;
+  int offset_x, offset_y, width;
+  const ImBuf *ibuf;
+  OCIO_ConstCPUProcessorRcPtr *processor;
+  bool use_premultiply;
+  bool use_unpremultiply;
+} ImbufToTextureData;
+
+static void imbuf_to_byte_texture_scanline(void *custom_data, int y)
+{
+  ImbufToTextureData *data = custom_data;
+  const ImBuf *ibuf = data->ibuf;
+  const int width = data->width;
+  const unsigned char *in_buffer = (unsigned char *)ibuf->rect;
+  const size_t in_offset = (data->offset_y + y) * ibuf->x + data->offset_x;
+  const size_t out_offset = y * width;
+  const unsigned char *in = in_buffer + in_offset * 4;
+  unsigned char *out = data->out_byte_buffer + out_offset * 4;
+
+  if (data->processor != NULL) {
+    /* Convert to scene linear, to sRGB and premultiply. */
+    for (int x = 0; x < width; x++, in += 4, out += 4) {
+      float pixel[4];
+      rgba_uchar_to_float(pixel, in);
+      OCIO_cpuProcessorApplyRGB(data->processor, pixel);
+      linearrgb_to_srgb_v3_v3(pixel, pixel);
+      if (data->use_premultiply) {
+        mul_v3_fl(pixel, pixel[3]);
+      }
+      rgba_float_to_uchar(out, pixel);
+    }
+  }
+  else if (data->use_premultiply) {
+    /* Premultiply only. */
+    for (int x = 0; x < width; x++, in += 4, out += 4) {
+      out[0] = (in[0] * in[3]) >> 8;
+      out[1] = (in[1] * in[3]) >> 8;
+      out[2] = (in[2] * in[3]) >> 8;
+      out[3] = in[3];
+    }
+  }
+  else {
+    /* Copy only. */
+    for (int x = 0; x < width; x++, in += 4, out += 4) {
+      out[0] = in[0];
+      out[1] = in[1];
+      out[2] = in[2];
+      out[3] = in[3];
+    }
+  }
+}
+
 void IMB_colormanagement_imbuf_to_byte_texture(unsigned char *out_buffer,
                                                const int offset_x,
                                                const int offset_y,
@@ -2219,46 +2370,65 @@ void IMB_colormanagement_imbuf_to_byte_texture(unsigned char *out_buffer,
     processor = colorspace_to_scene_linear_cpu_processor(ibuf->rect_colorspace);
   }
 
-  /* TODO(brecht): make this multi-threaded, or at least process in batches. */
-  const unsigned char *in_buffer = (unsigned char *)ibuf->rect;
-  const bool use_premultiply = IMB_alpha_affects_rgb(ibuf) && store_premultiplied;
+  ImbufToTextureData data = {
+      .out_byte_buffer = out_buffer,
+      .offset_x = offset_x,
+      .offset_y = offset_y,
+      .width = width,
+      .ibuf = ibuf,
+      .processor = processor,
+      .use_premultiply = IMB_alpha_affects_rgb(ibuf) && store_premultiplied,
+  };
 
-  for (int y = 0; y < height; y++) {
-    const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
-    const size_t out_offset = y * width;
-    const unsigned char *in = in_buffer + in_offset * 4;
-    unsigned char *out = out_buffer + out_offset * 4;
+  if (((size_t)width) * height >= 64 * 64) {
+    IMB_processor_apply_threaded_scanlines(height, imbuf_to_byte_texture_scanline, &data);
+  }
+  else {
+    for (int y = 0; y < height; y++) {
+      imbuf_to_byte_texture_scanline(&data, y);
+    }
+  }
+}
 
-    if (processor != NULL) {
-      /* Convert to scene linear, to sRGB and premultiply. */
-      for (int x = 0; x < width; x++, in += 4, out += 4) {
-        float pixel[4];
-        rgba_uchar_to_float(pixel, in);
-        OCIO_cpuProcessorApplyRGB(processor, pixel);
-        linearrgb_to_srgb_v3_v3(pixel, pixel);
-        if (use_premultiply) {
-          mul_v3_fl(pixel, pixel[3]);
-        }
-        rgba_float_to_uchar(out, pixel);
-      }
+static void imbuf_to_float_texture_scanline(void *custom_data, int y)
+{
+  ImbufToTextureData *data = custom_data;
+  const ImBuf *ibuf = data->ibuf;
+  const int width = data->width;
+  const float *in_buffer = ibuf->rect_float;
+  const int in_channels = ibuf->channels;
+  const size_t in_offset = (data->offset_y + y) * ibuf->x + data->offset_x;
+  const size_t out_offset = y * width;
+  const float *in = in_buffer + in_offset * in_channels;
+  float *out = data->out_float_buffer + out_offset * 4;
+
+  if (in_channels == 1) {
+    /* Copy single channel. */
+    for (int x = 0; x < width; x++, in += 1, out += 4) {
+      out[0] = in[0];
+      out[1] = in[0];
+      out[2] = in[0];
+      out[3] = in[0];
     }
-    else if (use_premultiply) {
-      /* Premultiply only. */
+  }
+  else if (in_channels == 3) {
+    /* Copy RGB. */
+    for (int x = 0; x < width; x++, in += 3, out += 4) {
+      out[0] = in[0];
+      out[1] = in[1];
+      out[2] = in[2];
+      out[3] = 1.0f;
+    }
+  }
+  else if (in_channels == 4) {
+    /* Copy or convert RGBA. */
+    if (data->use_unpremultiply) {
       for (int x = 0; x < width; x++, in += 4, out += 4) {
-        out[0] = (in[0] * in[3]) >> 8;
-        out[1] = (in[1] * in[3]) >> 8;
-        out[2] = (in[2] * in[3]) >> 8;
-        out[3] = in[3];
+        premul_to_straight_v4_v4(out, in);
       }
     }
     else {
-      /* Copy only. */
-      for (int x = 0; x < width; x++, in += 4, out += 4) {
-        out[0] = in[0];
-        out[1] = in[1];
-        out[2] = in[2];
-        out[3] = in[3];
-      }
+      memcpy(out, in, sizeof(float[4]) * width);
     }
   }
 }
@@ -2273,44 +2443,21 @@ void IMB_colormanagement_imbuf_to_float_texture(float *out_buffer,
 {
   /* Float texture are stored in scene linear color space, with premultiplied
    * alpha depending on the image alpha mode. */
-  const float *in_buffer = ibuf->rect_float;
-  const int in_channels = ibuf->channels;
-  const bool use_unpremultiply = IMB_alpha_affects_rgb(ibuf) && !store_premultiplied;
-
-  for (int y = 0; y < height; y++) {
-    const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
-    const size_t out_offset = y * width;
-    const float *in = in_buffer + in_offset * in_channels;
-    float *out = out_buffer + out_offset * 4;
-
-    if (in_channels == 1) {
-      /* Copy single channel. */
-      for (int x = 0; x < width; x++, in += 1, out += 4) {
-        out[0] = in[0];
-        out[1] = in[0];
-        out[2] = in[0];
-        out[3] = in[0];
-      }
-    }
-    else if (in_channels == 3) {
-      /* Copy RGB. */
-      for (int x = 0; x < width; x++, in += 3, out += 4) {
-        out[0] = in[0];
-        out[1] = in[1];
-        out[2] = in[2];
-        out[3] = 1.0f;
-      }
-    }
-    else if (in_channels == 4) {
-      /* Copy or convert RGBA. */
-      if (use_unpremultiply) {
-        for (int x = 0; x < width; x++, in += 4, out += 4) {
-          premul_to_straight_v4_v4(out, in);
-        }
-      }
-      else {
-        memcpy(out, in, sizeof(float[4]) * width);
-      }
+  ImbufToTextureData data = {
+      .out_float_buffer = out_buffer,
+      .offset_x = offset_x,
+      .offset_y = offset_y,
+      .width = width,
+      .ibuf = ibuf,
+      .use_unpremultiply = IMB_alpha_affects_rgb(ibuf) && !store_premultiplied,
+  };
+
+  if (((size_t)width) * height >= 64 * 64) {
+    IMB_processor_apply_threaded_scanlines(height, imbuf_to_float_texture_scanline, &data);
+  }
+  else {
+    for (int y = 0; y < height; y++) {
+      imbuf_to_float_texture_scanline(&data, y);
     }
   }
 }
@@ -3771,6 +3918,7 @@ ColormanageProcessor *IMB_colormanagement_display_processor_new(
     cm_processor->is_data_result = display_space->is_data;
   }
 
+  /* Not cached: view settings carry exposure/gamma which change interactively. */
   cm_processor->cpu_processor = create_display_buffer_processor(
       applied_view_settings->look,
       applied_view_settings->view_transform,
@@ -3778,6 +3926,7 @@ ColormanageProcessor *IMB_colormanagement_display_processor_new(
       applied_view_settings->exposure,
       applied_view_settings->gamma,
       global_role_scene_linear);
+  cm_processor->owns_cpu_processor = true;
 
   if (applied_view_settings->flag & COLORMANAGE_VIEW_USE_CURVES) {
     cm_processor->curve_mapping = BKE_curvemapping_copy(applied_view_settings->curve_mapping);
@@ -3798,12 +3947,10 @@ ColormanageProcessor *IMB_colormanagement_colorspace_processor_new(const char *f
   color_space = colormanage_colorspace_get_named(to_colorspace);
   cm_processor->is_data_result = color_space->is_data;
 
-  OCIO_ConstProcessorRcPtr *processor = create_colorspace_transform_processor(from_colorspace,
-                                                                              to_colorspace);
-  if (processor != NULL) {
-    cm_processor->cpu_processor = OCIO_processorGetCPUProcessor(processor);
-  }
-  OCIO_processorRelease(processor);
+  /* Shared with other processors for the same pair of spaces, see ColormanagePairProcessor. */
+  cm_processor->cpu_processor = colorspace_transform_cpu_processor(from_colorspace,
+                                                                   to_colorspace);
+  cm_processor->owns_cpu_processor = false;
 
   return cm_processor;
 }
@@ -3929,7 +4076,7 @@ void IMB_colormanagement_processor_free(ColormanageProcessor *cm_processor)
   if (cm_processor->curve_mapping) {
     BKE_curvemapping_free(cm_processor->curve_mapping);
   }
-  if (cm_processor->cpu_processor) {
+  if (cm_processor->cpu_processor && cm_processor->owns_cpu_processor) {
     OCIO_cpuProcessorRelease(cm_processor->cpu_processor);
   }
 
@@ -56,14 +56,12 @@ static const char temp_ext[] = "_part";
 static const int proxy_sizes[] = {IMB_PROXY_25, IMB_PROXY_50, IMB_PROXY_75, IMB_PROXY_100};
 static const float proxy_fac[] = {0.25, 0.50, 0.75, 1.00};
 
-#ifdef WITH_FFMPEG
-static int tc_types[] = {
+static const int tc_types[] = {
     IMB_TC_RECORD_RUN,
     IMB_TC_FREE_RUN,
     IMB_TC_INTERPOLATED_REC_DATE_FREE_RUN,
     IMB_TC_RECORD_RUN_NO_GAPS,
 };
-#endif
 
 #define INDEX_FILE_VERSION 2
 
@@ -1279,6 +1277,7 @@ IndexBuildContext *IMB_anim_index_rebuild_context(struct anim *anim,
 {
   IndexBuildContext *context = NULL;
   IMB_Proxy_Size proxy_sizes_to_build = proxy_sizes_in_use;
+  IMB_Timecode_Type tcs_to_build = tcs_in_use;
   int i;
 
   /* Don't generate the same file twice! */
@@ -1318,23 +1317,24 @@ IndexBuildContext *IMB_anim_index_rebuild_context(struct anim *anim,
       }
     }
     proxy_sizes_to_build &= ~built_proxies;
+    tcs_to_build &= ~IMB_anim_timecode_get_existing(anim);
   }
 
   fflush(stdout);
 
-  if (proxy_sizes_to_build == 0) {
+  if (proxy_sizes_to_build == 0 && tcs_to_build == 0) {
     return NULL;
   }
 
   switch (anim->curtype) {
 #ifdef WITH_FFMPEG
     case ANIM_FFMPEG:
-      context = index_ffmpeg_create_context(anim, tcs_in_use, proxy_sizes_to_build, quality);
+      context = index_ffmpeg_create_context(anim, tcs_to_build, proxy_sizes_to_build, quality);
       break;
 #endif
 #ifdef WITH_AVI
     default:
-      context = index_fallback_create_context(anim, tcs_in_use, proxy_sizes_to_build, quality);
+      context = index_fallback_create_context(anim, tcs_to_build, proxy_sizes_to_build, quality);
       break;
 #endif
   }
@@ -1487,6 +1487,22 @@ int IMB_anim_index_get_frame_index(struct anim *anim, IMB_Timecode_Type tc, int
   return IMB_indexer_get_frame_index(idx, position);
 }
 
+IMB_Timecode_Type IMB_anim_timecode_get_existing(struct anim *anim)
+{
+  const int num_tc_types = IMB_TC_MAX_SLOT;
+  IMB_Timecode_Type existing = 0;
+  int i;
+  for (i = 0; i < num_tc_types; i++) {
+    IMB_Timecode_Type tc_type = tc_types[i];
+    char filename[FILE_MAX];
+    get_tc_filename(anim, tc_type, filename);
+    if (BLI_exists(filename)) {
+      existing |= tc_type;
+    }
+  }
+  return existing;
+}
+
 IMB_Proxy_Size IMB_anim_proxy_get_existing(struct anim *anim)
 {
   const int num_proxy_sizes = IMB_PROXY_MAX_SLOT;
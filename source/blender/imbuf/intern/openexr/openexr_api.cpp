@@ -78,6 +78,7 @@ _CRTIMP void __cdecl _invalid_parameter_noinfo(void)
 }
 #include "BLI_blenlib.h"
 #include "BLI_math_color.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "BKE_idprop.h"
@@ -408,6 +409,47 @@ static void openexr_header_metadata_callback(void *data,
   header->insert(propname, StringAttribute(prop));
 }
 
+typedef struct ExrHalfConvertData {
+  const ImBuf *ibuf;
+  RGBAZ *pixels;
+} ExrHalfConvertData;
+
+static void imb_save_openexr_half_scanline(void *custom_data, int scanline)
+{
+  ExrHalfConvertData *data = (ExrHalfConvertData *)custom_data;
+  const ImBuf *ibuf = data->ibuf;
+  const int channels = ibuf->channels;
+  const int width = ibuf->x;
+  /* EXR is top to bottom, ImBuf bottom to top. */
+  const int i = ibuf->y - 1 - scanline;
+  RGBAZ *to = data->pixels + (size_t)scanline * width;
+
+  if (ibuf->rect_float) {
+    const float *from = ibuf->rect_float + (size_t)channels * i * width;
+
+    for (int j = width; j > 0; j--) {
+      to->r = float_to_half_safe(from[0]);
+      to->g = float_to_half_safe((channels >= 2) ? from[1] : from[0]);
+      to->b = float_to_half_safe((channels >= 3) ? from[2] : from[0]);
+      to->a = float_to_half_safe((channels >= 4) ? from[3] : 1.0f);
+      to++;
+      from += channels;
+    }
+  }
+  else {
+    const unsigned char *from = (const unsigned char *)ibuf->rect + 4 * (size_t)i * width;
+
+    for (int j = width; j > 0; j--) {
+      to->r = srgb_to_linearrgb((float)from[0] / 255.0f);
+      to->g = srgb_to_linearrgb((float)from[1] / 255.0f);
+      to->b = srgb_to_linearrgb((float)from[2] / 255.0f);
+      to->a = channels >= 4 ? (float)from[3] / 255.0f : 1.0f;
+      to++;
+      from += 4;
+    }
+  }
+}
+
 static bool imb_save_openexr_half(ImBuf *ibuf, const char *name, const int flags)
 {
   const int channels = ibuf->channels;
@@ -466,38 +508,12 @@ static bool imb_save_openexr_half(ImBuf *ibuf, const char *name, const int flags
                                sizeof(float),
                                sizeof(float) * -width));
     }
-    if (ibuf->rect_float) {
-      float *from;
-
-      for (int i = ibuf->y - 1; i >= 0; i--) {
-        from = ibuf->rect_float + channels * i * width;
-
-        for (int j = ibuf->x; j > 0; j--) {
-          to->r = float_to_half_safe(from[0]);
-          to->g = float_to_half_safe((channels >= 2) ? from[1] : from[0]);
-          to->b = float_to_half_safe((channels >= 3) ? from[2] : from[0]);
-          to->a = float_to_half_safe((channels >= 4) ? from[3] : 1.0f);
-          to++;
-          from += channels;
-        }
-      }
-    }
-    else {
-      unsigned char *from;
-
-      for (int i = ibuf->y - 1; i >= 0; i--) {
-        from = (unsigned char *)ibuf->rect + 4 * i * width;
-
-        for (int j = ibuf->x; j > 0; j--) {
-          to->r = srgb_to_linearrgb((float)from[0] / 255.0f);
-          to->g = srgb_to_linearrgb((float)from[1] / 255.0f);
-          to->b = srgb_to_linearrgb((float)from[2] / 255.0f);
-          to->a = channels >= 4 ? (float)from[3] / 255.0f : 1.0f;
-          to++;
-          from += 4;
-        }
-      }
-    }
+    /* Convert to half per scanline, the conversion dominates over the
+     * (internally threaded) compression for large images. */
+    ExrHalfConvertData convert_data;
+    convert_data.ibuf = ibuf;
+    convert_data.pixels = to;
+    IMB_processor_apply_threaded_scanlines(height, imb_save_openexr_half_scanline, &convert_data);
 
     exr_printf("OpenEXR-save: Writing OpenEXR file of height %d.\n", height);
 
@@ -1094,6 +1110,26 @@ void IMB_exr_clear_channels(void *handle)
   BLI_freelistN(&data->channels);
 }
 
+typedef struct ExrWriteHalfData {
+  ExrChannel **channels;
+  half *rect_half;
+  size_t num_pixels;
+} ExrWriteHalfData;
+
+static void exr_write_channels_half_fn(void *__restrict userdata,
+                                       const int n,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ExrWriteHalfData *data = (ExrWriteHalfData *)userdata;
+  const ExrChannel *echan = data->channels[n];
+  const float *rect = echan->rect;
+  half *cur = data->rect_half + (size_t)n * data->num_pixels;
+
+  for (size_t i = 0; i < data->num_pixels; i++, cur++) {
+    *cur = float_to_half_safe(rect[i * echan->xstride]);
+  }
+}
+
 void IMB_exr_write_channels(void *handle)
 {
   ExrHandle *data = (ExrHandle *)handle;
@@ -1103,22 +1139,21 @@ void IMB_exr_write_channels(void *handle)
   if (data->channels.first) {
     const size_t num_pixels = ((size_t)data->width) * data->height;
     half *rect_half = nullptr, *current_rect_half = nullptr;
+    std::vector<ExrChannel *> half_channels;
 
     /* We allocate temporary storage for half pixels for all the channels at once. */
     if (data->num_half_channels != 0) {
       rect_half = (half *)MEM_mallocN(sizeof(half) * data->num_half_channels * num_pixels,
                                       __func__);
       current_rect_half = rect_half;
+      half_channels.reserve(data->num_half_channels);
     }
 
     for (echan = (ExrChannel *)data->channels.first; echan; echan = echan->next) {
       /* Writing starts from last scanline, stride negative. */
       if (echan->use_half_float) {
-        float *rect = echan->rect;
-        half *cur = current_rect_half;
-        for (size_t i = 0; i < num_pixels; i++, cur++) {
-          *cur = float_to_half_safe(rect[i * echan->xstride]);
-        }
+        /* Conversion of all half channels happens in parallel below. */
+        half_channels.push_back(echan);
         half *rect_to_write = current_rect_half + (data->height - 1L) * data->width;
         frameBuffer.insert(
             echan->name,
@@ -1135,6 +1170,18 @@ void IMB_exr_write_channels(void *handle)
       }
     }
 
+    if (!half_channels.empty()) {
+      ExrWriteHalfData convert_data;
+      convert_data.channels = half_channels.data();
+      convert_data.rect_half = rect_half;
+      convert_data.num_pixels = num_pixels;
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      BLI_task_parallel_range(
+          0, (int)half_channels.size(), &convert_data, exr_write_channels_half_fn, &settings);
+    }
+
     data->ofile->setFrameBuffer(frameBuffer);
     try {
       data->ofile->writePixels(data->height);
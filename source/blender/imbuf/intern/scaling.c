@@ -26,6 +26,7 @@
 
 #include "BLI_math_color.h"
 #include "BLI_math_interp.h"
+#include "BLI_simd.h"
 #include "BLI_utildefines.h"
 #include "MEM_guardedalloc.h"
 
@@ -37,6 +38,27 @@
 
 #include "BLI_sys_types.h" /* for intptr_t support */
 
+#ifdef BLI_HAVE_SSE2
+/* Load a 4 channel byte pixel into a float vector. */
+BLI_INLINE __m128 imb_uchar4_to_m128(const uchar *ptr)
+{
+  const __m128i zero = _mm_setzero_si128();
+  __m128i pix = _mm_cvtsi32_si128(*(const int *)ptr);
+  pix = _mm_unpacklo_epi16(_mm_unpacklo_epi8(pix, zero), zero);
+  return _mm_cvtepi32_ps(pix);
+}
+
+/* Round a vector of non-negative channel values and store as a 4 channel byte pixel.
+ * Truncating after adding 0.5 matches roundf() for the non-negative range. */
+BLI_INLINE void imb_m128_to_uchar4_round(uchar *ptr, __m128 pix)
+{
+  __m128i pix_i = _mm_cvttps_epi32(_mm_add_ps(pix, _mm_set1_ps(0.5f)));
+  pix_i = _mm_packs_epi32(pix_i, pix_i);
+  pix_i = _mm_packus_epi16(pix_i, pix_i);
+  *(int *)ptr = _mm_cvtsi128_si32(pix_i);
+}
+#endif /* BLI_HAVE_SSE2 */
+
 static void imb_half_x_no_alloc(struct ImBuf *ibuf2, struct ImBuf *ibuf1)
 {
   uchar *p1, *_p1, *dest;
@@ -434,10 +456,17 @@ void imb_onehalf_no_alloc(struct ImBuf *ibuf2, struct ImBuf *ibuf1)
     for (y = ibuf2->y; y > 0; y--) {
       p2f = p1f + (ibuf1->x << 2);
       for (x = ibuf2->x; x > 0; x--) {
+#ifdef BLI_HAVE_SSE2
+        const __m128 sum = _mm_add_ps(
+            _mm_add_ps(_mm_add_ps(_mm_loadu_ps(p1f), _mm_loadu_ps(p2f)), _mm_loadu_ps(p1f + 4)),
+            _mm_loadu_ps(p2f + 4));
+        _mm_storeu_ps(destf, _mm_mul_ps(_mm_set1_ps(0.25f), sum));
+#else
         destf[0] = 0.25f * (p1f[0] + p2f[0] + p1f[4] + p2f[4]);
         destf[1] = 0.25f * (p1f[1] + p2f[1] + p1f[5] + p2f[5]);
         destf[2] = 0.25f * (p1f[2] + p2f[2] + p1f[6] + p2f[6]);
         destf[3] = 0.25f * (p1f[3] + p2f[3] + p1f[7] + p2f[7]);
+#endif
         p1f += 8;
         p2f += 8;
         destf += 4;
@@ -916,13 +945,18 @@ static ImBuf *scaledownx(struct ImBuf *ibuf, int newx)
 
   uchar *rect, *_newrect, *newrect;
   float *rectf, *_newrectf, *newrectf;
-  float sample, add, val[4], nval[4], valf[4], nvalf[4];
+  float sample, add;
+#ifndef BLI_HAVE_SSE2
+  float val[4], nval[4], valf[4], nvalf[4];
+#endif
   int x, y;
 
   rectf = _newrectf = newrectf = NULL;
   rect = _newrect = newrect = NULL;
+#ifndef BLI_HAVE_SSE2
   nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
   nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
+#endif
 
   if (!do_rect && !do_float) {
     return ibuf;
@@ -955,6 +989,66 @@ static ImBuf *scaledownx(struct ImBuf *ibuf, int newx)
     newrectf = _newrectf;
   }
 
+#ifdef BLI_HAVE_SSE2
+  /* The filter loop is sequential over x (pixels are consumed at a data dependent rate),
+   * so vectorize over the 4 channels of each pixel instead. */
+  for (y = ibuf->y; y > 0; y--) {
+    const __m128 v_add = _mm_set1_ps(add);
+    __m128 v_val = _mm_setzero_ps();
+    __m128 v_valf = _mm_setzero_ps();
+    __m128 v_nval = _mm_setzero_ps();
+    __m128 v_nvalf = _mm_setzero_ps();
+
+    sample = 0.0f;
+
+    for (x = newx; x > 0; x--) {
+      if (do_rect) {
+        v_nval = _mm_mul_ps(v_val, _mm_set1_ps(-sample));
+      }
+      if (do_float) {
+        v_nvalf = _mm_mul_ps(v_valf, _mm_set1_ps(-sample));
+      }
+
+      sample += add;
+
+      while (sample >= 1.0f) {
+        sample -= 1.0f;
+
+        if (do_rect) {
+          v_nval = _mm_add_ps(v_nval, imb_uchar4_to_m128(rect));
+          rect += 4;
+        }
+        if (do_float) {
+          v_nvalf = _mm_add_ps(v_nvalf, _mm_loadu_ps(rectf));
+          rectf += 4;
+        }
+      }
+
+      if (do_rect) {
+        v_val = imb_uchar4_to_m128(rect);
+        rect += 4;
+
+        imb_m128_to_uchar4_round(
+            newrect,
+            _mm_div_ps(_mm_add_ps(v_nval, _mm_mul_ps(_mm_set1_ps(sample), v_val)), v_add));
+
+        newrect += 4;
+      }
+      if (do_float) {
+        v_valf = _mm_loadu_ps(rectf);
+        rectf += 4;
+
+        _mm_storeu_ps(
+            newrectf,
+            _mm_div_ps(_mm_add_ps(v_nvalf, _mm_mul_ps(_mm_set1_ps(sample), v_valf)), v_add));
+
+        newrectf += 4;
+      }
+
+      sample -= 1.0f;
+    }
+  }
+#else
   for (y = ibuf->y; y > 0; y--) {
     sample = 0.0f;
     val[0] = val[1] = val[2] = val[3] = 0.0f;
@@ -1028,6 +1122,7 @@ static ImBuf *scaledownx(struct ImBuf *ibuf, int newx)
       sample -= 1.0f;
     }
   }
+#endif /* BLI_HAVE_SSE2 */
 
   if (do_rect) {
     // printf("%ld %ld\n", (uchar *)rect - ((uchar *)ibuf->rect), rect_size);
@@ -1057,13 +1152,18 @@ static ImBuf *scaledowny(struct ImBuf *ibuf, int newy)
 
   uchar *rect, *_newrect, *newrect;
   float *rectf, *_newrectf, *newrectf;
-  float sample, add, val[4], nval[4], valf[4], nvalf[4];
+  float sample, add;
+#ifndef BLI_HAVE_SSE2
+  float val[4], nval[4], valf[4], nvalf[4];
+#endif
   int x, y, skipx;
 
   rectf = _newrectf = newrectf = NULL;
   rect = _newrect = newrect = NULL;
+#ifndef BLI_HAVE_SSE2
   nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
   nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
+#endif
 
   if (!do_rect && !do_float) {
     return ibuf;
@@ -1088,6 +1188,75 @@ static ImBuf *scaledowny(struct ImBuf *ibuf, int newy)
   add = (ibuf->y - 0.01) / newy;
   skipx = 4 * ibuf->x;
 
+#ifdef BLI_HAVE_SSE2
+  /* As in scaledownx, pixels along the filtered axis are consumed at a data dependent rate,
+   * so vectorize over the 4 channels of each pixel. */
+  for (x = skipx - 4; x >= 0; x -= 4) {
+    const __m128 v_add = _mm_set1_ps(add);
+    __m128 v_val = _mm_setzero_ps();
+    __m128 v_valf = _mm_setzero_ps();
+    __m128 v_nval = _mm_setzero_ps();
+    __m128 v_nvalf = _mm_setzero_ps();
+
+    if (do_rect) {
+      rect = ((uchar *)ibuf->rect) + x;
+      newrect = _newrect + x;
+    }
+    if (do_float) {
+      rectf = ibuf->rect_float + x;
+      newrectf = _newrectf + x;
+    }
+
+    sample = 0.0f;
+
+    for (y = newy; y > 0; y--) {
+      if (do_rect) {
+        v_nval = _mm_mul_ps(v_val, _mm_set1_ps(-sample));
+      }
+      if (do_float) {
+        v_nvalf = _mm_mul_ps(v_valf, _mm_set1_ps(-sample));
+      }
+
+      sample += add;
+
+      while (sample >= 1.0f) {
+        sample -= 1.0f;
+
+        if (do_rect) {
+          v_nval = _mm_add_ps(v_nval, imb_uchar4_to_m128(rect));
+          rect += skipx;
+        }
+        if (do_float) {
+          v_nvalf = _mm_add_ps(v_nvalf, _mm_loadu_ps(rectf));
+          rectf += skipx;
+        }
+      }
+
+      if (do_rect) {
+        v_val = imb_uchar4_to_m128(rect);
+        rect += skipx;
+
+        imb_m128_to_uchar4_round(
+            newrect,
+            _mm_div_ps(_mm_add_ps(v_nval, _mm_mul_ps(_mm_set1_ps(sample), v_val)), v_add));
+
+        newrect += skipx;
+      }
+      if (do_float) {
+        v_valf = _mm_loadu_ps(rectf);
+        rectf += skipx;
+
+        _mm_storeu_ps(
+            newrectf,
+            _mm_div_ps(_mm_add_ps(v_nvalf, _mm_mul_ps(_mm_set1_ps(sample), v_valf)), v_add));
+
+        newrectf += skipx;
+      }
+
+      sample -= 1.0f;
+    }
+  }
+#else
   for (x = skipx - 4; x >= 0; x -= 4) {
     if (do_rect) {
       rect = ((uchar *)ibuf->rect) + x;
@@ -1170,6 +1339,7 @@ static ImBuf *scaledowny(struct ImBuf *ibuf, int newy)
       sample -= 1.0f;
     }
   }
+#endif /* BLI_HAVE_SSE2 */
 
   if (do_rect) {
     // printf("%ld %ld\n", (uchar *)rect - ((uchar *)ibuf->rect), rect_size);
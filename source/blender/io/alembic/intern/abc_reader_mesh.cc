@@ -531,6 +531,26 @@ static bool has_animated_geom_params(const ICompoundProperty arbGeomParams)
   return false;
 }
 
+static bool has_animated_custom_uvs(const ICompoundProperty arbGeomParams)
+{
+  if (!arbGeomParams.valid()) {
+    return false;
+  }
+
+  const int num_props = arbGeomParams.getNumProperties();
+  for (int i = 0; i < num_props; i++) {
+    const PropertyHeader &prop_header = arbGeomParams.getPropertyHeader(i);
+
+    /* These become extra UV layers later (see 'read_custom_data'). */
+    if (Alembic::AbcGeom::isUV(prop_header) &&
+        is_valid_animated<IV2fGeomParam>(arbGeomParams, prop_header)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 /* Specialization of #has_animations() as defined in abc_reader_object.h. */
 template<> bool has_animations(Alembic::AbcGeom::IPolyMeshSchema &schema, ImportSettings *settings)
 {
@@ -556,12 +576,18 @@ template<> bool has_animations(Alembic::AbcGeom::IPolyMeshSchema &schema, Import
   return false;
 }
 
-void AbcMeshReader::readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel)
+void AbcMeshReader::readObjectData(Main *bmain,
+                                   const Alembic::Abc::ISampleSelector & /*sample_sel*/)
 {
   Mesh *mesh = BKE_mesh_add(bmain, m_data_name.c_str());
 
   m_object = BKE_object_add_only_object(bmain, OB_MESH, m_object_name.c_str());
   m_object->data = mesh;
+}
+
+void AbcMeshReader::readObjectGeometry(const Alembic::Abc::ISampleSelector &sample_sel)
+{
+  Mesh *mesh = static_cast<Mesh *>(m_object->data);
 
   Mesh *read_mesh = this->read_mesh(mesh, sample_sel, MOD_MESHSEQ_READ_ALL, nullptr);
   if (read_mesh != mesh) {
@@ -576,7 +602,14 @@ void AbcMeshReader::readObjectData(Main *bmain, const Alembic::Abc::ISampleSelec
     BKE_mesh_validate(mesh, false, false);
   }
 
-  readFaceSetsSample(bmain, mesh, sample_sel);
+  /* Only gather the face set material assignments here, the material IDs themselves are created
+   * in finishObjectData() on the main thread. */
+  assign_facesets_to_mpoly(sample_sel, mesh->mpoly, mesh->totpoly, m_mat_map);
+}
+
+void AbcMeshReader::finishObjectData(Main *bmain)
+{
+  utils::assign_materials(bmain, m_object, m_mat_map);
 
   if (m_settings->always_add_cache_reader || has_animations(m_schema, m_settings)) {
     addCacheModifier();
@@ -674,7 +707,13 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   ImportSettings settings;
   settings.read_flag |= read_flag;
 
-  if (topology_changed(existing_mesh, sample_sel)) {
+  /* Same test as in topology_changed(), using the sample that was decoded above instead of
+   * fetching it from the archive a second time. This runs for every frame of cache playback. */
+  const bool is_topology_changed = positions->size() != existing_mesh->totvert ||
+                                   face_counts->size() != existing_mesh->totpoly ||
+                                   face_indices->size() != existing_mesh->totloop;
+
+  if (is_topology_changed) {
     new_mesh = BKE_mesh_new_nomain_from_template(
         existing_mesh, positions->size(), 0, 0, face_indices->size(), face_counts->size());
 
@@ -694,6 +733,24 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
             " mesh. Only vertices will be read!";
       }
     }
+
+    /* When streaming into an existing mesh, properties that are constant in the archive were
+     * already converted to CustomData when the object was first loaded; re-reading them every
+     * frame only costs conversion time without changing the result. File sequences are excluded
+     * since each file of a sequence stores its samples as "constant". */
+    if (!m_settings->is_sequence) {
+      if ((settings.read_flag & MOD_MESHSEQ_READ_UV) != 0) {
+        const IV2fGeomParam &uvs = m_schema.getUVsParam();
+        if ((!uvs.valid() || uvs.isConstant()) &&
+            !has_animated_custom_uvs(m_schema.getArbGeomParams())) {
+          settings.read_flag &= ~MOD_MESHSEQ_READ_UV;
+        }
+      }
+      if ((settings.read_flag & MOD_MESHSEQ_READ_COLOR) != 0 &&
+          !has_animated_geom_params(m_schema.getArbGeomParams())) {
+        settings.read_flag &= ~MOD_MESHSEQ_READ_COLOR;
+      }
+    }
   }
 
   Mesh *mesh_to_export = new_mesh ? new_mesh : existing_mesh;
@@ -767,13 +824,6 @@ void AbcMeshReader::assign_facesets_to_mpoly(const ISampleSelector &sample_sel,
   }
 }
 
-void AbcMeshReader::readFaceSetsSample(Main *bmain, Mesh *mesh, const ISampleSelector &sample_sel)
-{
-  std::map<std::string, int> mat_map;
-  assign_facesets_to_mpoly(sample_sel, mesh->mpoly, mesh->totpoly, mat_map);
-  utils::assign_materials(bmain, m_object, mat_map);
-}
-
 /* ************************************************************************** */
 
 BLI_INLINE MEdge *find_edge(MEdge *edges, int totedge, int v1, int v2)
@@ -869,12 +919,18 @@ bool AbcSubDReader::accepts_object_type(
   return true;
 }
 
-void AbcSubDReader::readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel)
+void AbcSubDReader::readObjectData(Main *bmain,
+                                   const Alembic::Abc::ISampleSelector & /*sample_sel*/)
 {
   Mesh *mesh = BKE_mesh_add(bmain, m_data_name.c_str());
 
   m_object = BKE_object_add_only_object(bmain, OB_MESH, m_object_name.c_str());
   m_object->data = mesh;
+}
+
+void AbcSubDReader::readObjectGeometry(const Alembic::Abc::ISampleSelector &sample_sel)
+{
+  Mesh *mesh = static_cast<Mesh *>(m_object->data);
 
   Mesh *read_mesh = this->read_mesh(mesh, sample_sel, MOD_MESHSEQ_READ_ALL, nullptr);
   if (read_mesh != mesh) {
@@ -927,7 +983,10 @@ void AbcSubDReader::readObjectData(Main *bmain, const Alembic::Abc::ISampleSelec
   if (m_settings->validate_meshes) {
     BKE_mesh_validate(mesh, false, false);
   }
+}
 
+void AbcSubDReader::finishObjectData(Main * /*bmain*/)
+{
   if (m_settings->always_add_cache_reader || has_animations(m_schema, m_settings)) {
     addCacheModifier();
   }
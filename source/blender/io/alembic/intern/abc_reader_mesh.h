@@ -39,6 +39,8 @@ class AbcMeshReader : public AbcObjectReader {
                            const Object *const ob,
                            const char **err_str) const override;
   void readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel) override;
+  void readObjectGeometry(const Alembic::Abc::ISampleSelector &sample_sel) override;
+  void finishObjectData(Main *bmain) override;
 
   struct Mesh *read_mesh(struct Mesh *existing_mesh,
                          const Alembic::Abc::ISampleSelector &sample_sel,
@@ -48,14 +50,14 @@ class AbcMeshReader : public AbcObjectReader {
                         const Alembic::Abc::ISampleSelector &sample_sel) override;
 
  private:
-  void readFaceSetsSample(Main *bmain,
-                          Mesh *mesh,
-                          const Alembic::AbcGeom::ISampleSelector &sample_sel);
-
   void assign_facesets_to_mpoly(const Alembic::Abc::ISampleSelector &sample_sel,
                                 MPoly *mpoly,
                                 int totpoly,
                                 std::map<std::string, int> &r_mat_map);
+
+  /* Face set material assignments, gathered during readObjectGeometry() and turned into
+   * materials on the main thread in finishObjectData(). */
+  std::map<std::string, int> m_mat_map;
 };
 
 class AbcSubDReader : public AbcObjectReader {
@@ -71,6 +73,8 @@ class AbcSubDReader : public AbcObjectReader {
                            const Object *const ob,
                            const char **err_str) const;
   void readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel);
+  void readObjectGeometry(const Alembic::Abc::ISampleSelector &sample_sel) override;
+  void finishObjectData(Main *bmain) override;
   struct Mesh *read_mesh(struct Mesh *existing_mesh,
                          const Alembic::Abc::ISampleSelector &sample_sel,
                          int read_flag,
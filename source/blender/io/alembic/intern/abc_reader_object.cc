@@ -164,6 +164,16 @@ Imath::M44d get_matrix(const IXformSchema &schema, const float time)
   return s0.getMatrix();
 }
 
+void AbcObjectReader::readObjectGeometry(const Alembic::Abc::ISampleSelector & /*sample_sel*/)
+{
+  /* The default implementation does nothing, readers without a separate geometry decoding step do
+   * all of their work in readObjectData(). */
+}
+
+void AbcObjectReader::finishObjectData(Main * /*bmain*/)
+{
+}
+
 struct Mesh *AbcObjectReader::read_mesh(struct Mesh *existing_mesh,
                                         const Alembic::Abc::ISampleSelector &UNUSED(sample_sel),
                                         int UNUSED(read_flag),
@@ -141,6 +141,19 @@ class AbcObjectReader {
 
   virtual void readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel) = 0;
 
+  /**
+   * Heavy geometry decoding for this object, called after readObjectData() has run for every
+   * reader. May be called from a worker thread, so implementations must only modify their own
+   * object and object data, never bmain or shared IDs. Readers that do not override this do all
+   * of their work in readObjectData().
+   */
+  virtual void readObjectGeometry(const Alembic::Abc::ISampleSelector &sample_sel);
+
+  /**
+   * Main thread finalization that needs the decoded geometry, e.g. material creation.
+   */
+  virtual void finishObjectData(Main *bmain);
+
   virtual struct Mesh *read_mesh(struct Mesh *mesh,
                                  const Alembic::Abc::ISampleSelector &sample_sel,
                                  int read_flag,
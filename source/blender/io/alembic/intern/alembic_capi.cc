@@ -64,6 +64,7 @@
 #include "BLI_math.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "WM_api.h"
 #include "WM_types.h"
@@ -512,7 +513,50 @@ static void import_startjob(void *user_data, short *stop, short *do_update, floa
                 << " is invalid.\n";
     }
 
-    *data->progress = 0.1f + 0.3f * (++i / size);
+    *data->progress = 0.1f + 0.1f * (++i / size);
+    *data->do_update = true;
+
+    if (G.is_break) {
+      data->was_cancelled = true;
+      return;
+    }
+  }
+
+  /* Decode geometry in parallel. readObjectGeometry() implementations only touch their own
+   * object data, so readers can run concurrently; ID creation happened in the loop above and
+   * material/modifier setup runs on this thread below. */
+  blender::threading::parallel_for(
+      blender::IndexRange(data->readers.size()), 1, [&](const blender::IndexRange range) {
+        for (const int64_t reader_index : range) {
+          if (G.is_break) {
+            /* Cannot break out of a parallel loop, skip the remaining readers. */
+            continue;
+          }
+          AbcObjectReader *reader = data->readers[reader_index];
+          if (reader->valid()) {
+            reader->readObjectGeometry(sample_sel);
+          }
+        }
+      });
+
+  *data->progress = 0.35f;
+  *data->do_update = true;
+
+  if (G.is_break) {
+    data->was_cancelled = true;
+    return;
+  }
+
+  /* Create materials and cache modifiers, which has to happen on this thread. */
+  i = 0;
+  for (iter = data->readers.begin(); iter != data->readers.end(); ++iter) {
+    AbcObjectReader *reader = *iter;
+
+    if (reader->valid()) {
+      reader->finishObjectData(data->bmain);
+    }
+
+    *data->progress = 0.35f + 0.05f * (++i / size);
     *data->do_update = true;
 
     if (G.is_break) {
@@ -25,6 +25,7 @@
 
 #include "BLI_assert.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "BKE_customdata.h"
 #include "BKE_lib_id.h"
@@ -130,11 +131,14 @@ void USDGenericMeshWriter::write_uv_maps(const Mesh *mesh, pxr::UsdGeomMesh usd_
     pxr::UsdGeomPrimvar uv_coords_primvar = usd_mesh.CreatePrimvar(
         primvar_name, pxr::SdfValueTypeNames->TexCoord2fArray, pxr::UsdGeomTokens->faceVarying);
 
-    MLoopUV *mloopuv = static_cast<MLoopUV *>(layer->data);
-    pxr::VtArray<pxr::GfVec2f> uv_coords;
-    for (int loop_idx = 0; loop_idx < mesh->totloop; loop_idx++) {
-      uv_coords.push_back(pxr::GfVec2f(mloopuv[loop_idx].uv));
-    }
+    const MLoopUV *mloopuv = static_cast<const MLoopUV *>(layer->data);
+    pxr::VtArray<pxr::GfVec2f> uv_coords(mesh->totloop);
+    pxr::GfVec2f *uv_data = uv_coords.data();
+    threading::parallel_for(IndexRange(mesh->totloop), 4096, [&](const IndexRange range) {
+      for (const int64_t loop_idx : range) {
+        uv_data[loop_idx] = pxr::GfVec2f(mloopuv[loop_idx].uv);
+      }
+    });
 
     if (!uv_coords_primvar.HasValue()) {
       uv_coords_primvar.Set(uv_coords, pxr::UsdTimeCode::Default());
@@ -235,12 +239,15 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
 
 static void get_vertices(const Mesh *mesh, USDMeshData &usd_mesh_data)
 {
-  usd_mesh_data.points.reserve(mesh->totvert);
+  usd_mesh_data.points.resize(mesh->totvert);
 
+  pxr::GfVec3f *points = usd_mesh_data.points.data();
   const MVert *verts = mesh->mvert;
-  for (int i = 0; i < mesh->totvert; ++i) {
-    usd_mesh_data.points.push_back(pxr::GfVec3f(verts[i].co));
-  }
+  threading::parallel_for(IndexRange(mesh->totvert), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      points[i] = pxr::GfVec3f(verts[i].co);
+    }
+  });
 }
 
 static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data)
@@ -249,20 +256,29 @@ static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data)
    * assignments. */
   bool construct_face_groups = mesh->totcol > 1;
 
-  usd_mesh_data.face_vertex_counts.reserve(mesh->totpoly);
-  usd_mesh_data.face_indices.reserve(mesh->totloop);
-
-  MLoop *mloop = mesh->mloop;
-  MPoly *mpoly = mesh->mpoly;
-  for (int i = 0; i < mesh->totpoly; ++i, ++mpoly) {
-    MLoop *loop = mloop + mpoly->loopstart;
-    usd_mesh_data.face_vertex_counts.push_back(mpoly->totloop);
-    for (int j = 0; j < mpoly->totloop; ++j, ++loop) {
-      usd_mesh_data.face_indices.push_back(loop->v);
+  usd_mesh_data.face_vertex_counts.resize(mesh->totpoly);
+  usd_mesh_data.face_indices.resize(mesh->totloop);
+
+  int *face_vertex_counts = usd_mesh_data.face_vertex_counts.data();
+  int *face_indices = usd_mesh_data.face_indices.data();
+  const MLoop *mloop = mesh->mloop;
+  const MPoly *mpoly = mesh->mpoly;
+  threading::parallel_for(IndexRange(mesh->totpoly), 1024, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const MPoly *poly = &mpoly[i];
+      const MLoop *loop = mloop + poly->loopstart;
+      face_vertex_counts[i] = poly->totloop;
+      for (int j = 0; j < poly->totloop; ++j, ++loop) {
+        face_indices[poly->loopstart + j] = loop->v;
+      }
     }
+  });
 
-    if (construct_face_groups) {
-      usd_mesh_data.face_groups[mpoly->mat_nr].push_back(i);
+  if (construct_face_groups) {
+    /* Face groups are stored in a map of growing arrays, so they cannot be scattered to from
+     * multiple threads. */
+    for (int i = 0; i < mesh->totpoly; ++i) {
+      usd_mesh_data.face_groups[mpoly[i].mat_nr].push_back(i);
     }
   }
 }
@@ -366,39 +382,45 @@ void USDGenericMeshWriter::write_normals(const Mesh *mesh, pxr::UsdGeomMesh usd_
   pxr::UsdTimeCode timecode = get_export_time_code();
   const float(*lnors)[3] = static_cast<float(*)[3]>(CustomData_get_layer(&mesh->ldata, CD_NORMAL));
 
-  pxr::VtVec3fArray loop_normals;
-  loop_normals.reserve(mesh->totloop);
+  pxr::VtVec3fArray loop_normals(mesh->totloop);
+  pxr::GfVec3f *normals_data = loop_normals.data();
 
   if (lnors != nullptr) {
     /* Export custom loop normals. */
-    for (int loop_idx = 0, totloop = mesh->totloop; loop_idx < totloop; ++loop_idx) {
-      loop_normals.push_back(pxr::GfVec3f(lnors[loop_idx]));
-    }
+    threading::parallel_for(IndexRange(mesh->totloop), 4096, [&](const IndexRange range) {
+      for (const int64_t loop_idx : range) {
+        normals_data[loop_idx] = pxr::GfVec3f(lnors[loop_idx]);
+      }
+    });
   }
   else {
     /* Compute the loop normals based on the 'smooth' flag. */
-    float normal[3];
-    MPoly *mpoly = mesh->mpoly;
+    const MPoly *mpoly = mesh->mpoly;
     const MVert *mvert = mesh->mvert;
-    for (int poly_idx = 0, totpoly = mesh->totpoly; poly_idx < totpoly; ++poly_idx, ++mpoly) {
-      MLoop *mloop = mesh->mloop + mpoly->loopstart;
-
-      if ((mpoly->flag & ME_SMOOTH) == 0) {
-        /* Flat shaded, use common normal for all verts. */
-        BKE_mesh_calc_poly_normal(mpoly, mloop, mvert, normal);
-        pxr::GfVec3f pxr_normal(normal);
-        for (int loop_idx = 0; loop_idx < mpoly->totloop; ++loop_idx) {
-          loop_normals.push_back(pxr_normal);
+    threading::parallel_for(IndexRange(mesh->totpoly), 1024, [&](const IndexRange range) {
+      float normal[3];
+      for (const int64_t poly_idx : range) {
+        const MPoly *poly = &mpoly[poly_idx];
+        const MLoop *mloop = mesh->mloop + poly->loopstart;
+
+        if ((poly->flag & ME_SMOOTH) == 0) {
+          /* Flat shaded, use common normal for all verts. */
+          BKE_mesh_calc_poly_normal(poly, mloop, mvert, normal);
+          const pxr::GfVec3f pxr_normal(normal);
+          for (int loop_idx = 0; loop_idx < poly->totloop; ++loop_idx) {
+            normals_data[poly->loopstart + loop_idx] = pxr_normal;
+          }
         }
-      }
-      else {
-        /* Smooth shaded, use individual vert normals. */
-        for (int loop_idx = 0; loop_idx < mpoly->totloop; ++loop_idx, ++mloop) {
-          normal_short_to_float_v3(normal, mvert[mloop->v].no);
-          loop_normals.push_back(pxr::GfVec3f(normal));
+        else {
+          /* Smooth shaded, use individual vert normals. */
+          const MLoop *loop = mloop;
+          for (int loop_idx = 0; loop_idx < poly->totloop; ++loop_idx, ++loop) {
+            normal_short_to_float_v3(normal, mvert[loop->v].no);
+            normals_data[poly->loopstart + loop_idx] = pxr::GfVec3f(normal);
+          }
         }
       }
-    }
+    });
   }
 
   pxr::UsdAttribute attr_normals = usd_mesh.CreateNormalsAttr(pxr::VtValue(), true);
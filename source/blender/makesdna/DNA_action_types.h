@@ -682,6 +682,12 @@ typedef struct bAction {
   int idroot;
   char _pad[4];
 
+  /** Baked playback cache, runtime only (see #ACT_BAKED_CACHE). */
+  struct FCurveBakedCache *baked_cache;
+
+  /** Ghash for quicker group name lookups, runtime only. */
+  struct GHash *grouphash;
+
   PreviewImage *preview;
 } bAction;
 
@@ -695,6 +701,9 @@ typedef enum eAction_Flags {
   ACT_MUTED = (1 << 9),
   /* ACT_PROTECTED = (1 << 10), */ /* UNUSED */
   /* ACT_DISABLED = (1 << 11), */  /* UNUSED */
+  /** Playback samples the curves once into a frame-indexed table and evaluates by
+   * lookup + linear interpolation, see #BKE_action_baked_cache_ensure. */
+  ACT_BAKED_CACHE = (1 << 12),
 } eAction_Flags;
 
 /* ************************************************ */
@@ -242,6 +242,9 @@ enum {
   CD_FLAG_EXTERNAL = (1 << 3),
   /* Indicates external data is read into memory */
   CD_FLAG_IN_MEMORY = (1 << 4),
+  /* Indicates the layer data is shared with other layers (reference counted), a private
+   * copy is made before writing, see CD_SHARED in BKE_customdata.h. Runtime only. */
+  CD_FLAG_SHARED = (1 << 5),
 };
 
 /* Limits */
@@ -72,6 +72,14 @@ struct MLoopTri_Store {
   struct MLoopTri *array, *array_wip;
   int len;
   int len_alloc;
+  /** Hash of the mesh topology the array was computed for, see
+   * #BKE_mesh_runtime_looptri_ensure. */
+  unsigned int topology_hash;
+  /** Set instead of freeing the array when geometry changed, the array is revalidated against
+   * #topology_hash on next access (tessellation only depends on topology, so deform-only
+   * updates can keep using it). */
+  char dirty_topology;
+  char _pad[3];
 };
 
 /* not saved in file! */
@@ -103,6 +111,9 @@ typedef struct Mesh_Runtime {
   /** Non-manifold boundary data for Shrinkwrap Target Project. */
   struct ShrinkwrapBoundaryData *shrinkwrap_data;
 
+  /** Cached topology maps (vert to poly etc.), defined in `mesh_runtime.c`. */
+  struct MeshTopologyMapCache *topology_maps;
+
   /** Set by modifier stack if only deformed from original. */
   char deformed_only;
   /**
@@ -122,7 +133,12 @@ typedef struct Mesh_Runtime {
    */
   char wrapper_type_finalize;
 
-  char _pad[4];
+  /**
+   * Bumped whenever the topology (not just the coordinates) of this mesh changes, so
+   * caches derived from connectivity can detect whether they are still valid. Runtime
+   * only, always starts over at zero on file load.
+   */
+  int topology_generation;
 
   /** Needed in case we need to lazily initialize the mesh. */
   CustomData_MeshMasks cd_mask_extra;
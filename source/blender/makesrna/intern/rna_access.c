@@ -4437,23 +4437,64 @@ static int rna_raw_access(ReportList *reports,
 
         size = RNA_raw_type_sizeof(out.type) * arraylen;
 
-        for (a = 0; a < out.len; a++) {
+        if (out.stride == size) {
+          /* The property values are tightly packed, copy the whole array at once. */
           if (set) {
-            memcpy(outp, inp, size);
+            memcpy(outp, inp, (size_t)size * out.len);
           }
           else {
-            memcpy(inp, outp, size);
+            memcpy(inp, outp, (size_t)size * out.len);
           }
+        }
+        else {
+          for (a = 0; a < out.len; a++) {
+            if (set) {
+              memcpy(outp, inp, size);
+            }
+            else {
+              memcpy(inp, outp, size);
+            }
 
-          inp = (char *)inp + size;
-          outp = (char *)outp + out.stride;
+            inp = (char *)inp + size;
+            outp = (char *)outp + out.stride;
+          }
         }
 
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      /* Non-matching raw types: convert per element, still addressing both arrays directly
+       * instead of going through the generic per-item property loop below. A double can
+       * represent every supported raw type without precision loss. */
+      {
+        void *outp = out.array;
+        int a, j, index = 0;
+
+        for (a = 0; a < out.len; a++) {
+          RawArray item;
+          item.array = outp;
+          item.type = out.type;
+          item.len = arraylen;
+          item.stride = 0;
+
+          for (j = 0; j < arraylen; j++, index++) {
+            double value;
+
+            if (set) {
+              RAW_GET(double, value, in, index);
+              RAW_SET(double, item, j, value);
+            }
+            else {
+              RAW_GET(double, value, item, j);
+              RAW_SET(double, in, index, value);
+            }
+          }
+
+          outp = (char *)outp + out.stride;
+        }
+
+        return 1;
+      }
     }
   }
 
@@ -237,6 +237,17 @@ static void rna_Action_active_pose_marker_index_set(PointerRNA *ptr, int value)
   act->active_marker = value + 1;
 }
 
+static void rna_Action_use_baked_cache_update(Main *UNUSED(bmain),
+                                              Scene *UNUSED(scene),
+                                              PointerRNA *ptr)
+{
+  bAction *act = (bAction *)ptr->owner_id;
+
+  /* Always drop the cache: toggling off frees it, toggling on rebuilds it with the current
+   * curves on next evaluation. */
+  BKE_action_baked_cache_free(act);
+}
+
 static void rna_Action_active_pose_marker_index_range(
     PointerRNA *ptr, int *min, int *max, int *UNUSED(softmin), int *UNUSED(softmax))
 {
@@ -847,6 +858,15 @@ static void rna_def_action(BlenderRNA *brna)
   RNA_def_property_float_funcs(prop, "rna_Action_frame_range_get", NULL, NULL);
   RNA_def_property_clear_flag(prop, PROP_EDITABLE);
 
+  prop = RNA_def_property(srna, "use_baked_cache", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, NULL, "flag", ACT_BAKED_CACHE);
+  RNA_def_property_ui_text(prop,
+                           "Baked Playback",
+                           "Sample all F-Curves into per-frame tables on first evaluation and "
+                           "play back by table lookup. Faster for dense actions, but edits to "
+                           "the curves only show up after toggling this setting");
+  RNA_def_property_update(prop, NC_ANIMATION | ND_ANIMCHAN, "rna_Action_use_baked_cache_update");
+
   /* special "type" limiter - should not really be edited in general,
    * but is still available/editable in 'emergencies' */
   prop = RNA_def_property(srna, "id_root", PROP_ENUM, PROP_NONE);
@@ -807,6 +807,12 @@ void RNA_struct_free(BlenderRNA *brna, StructRNA *srna)
   }
 #  endif
 
+  /* Free the hash before the properties, so it never holds keys of freed identifiers. */
+  if (srna->cont.prophash) {
+    BLI_ghash_free(srna->cont.prophash, NULL, NULL);
+    srna->cont.prophash = NULL;
+  }
+
   for (prop = srna->cont.properties.first; prop; prop = nextprop) {
     nextprop = prop->next;
 
@@ -1041,6 +1047,20 @@ StructRNA *RNA_def_struct_ptr(BlenderRNA *brna, const char *identifier, StructRN
     }
   }
 
+#ifdef RNA_RUNTIME
+  if (!DefRNA.preprocess) {
+    /* Runtime defined structs are not handled by #RNA_init, so create the property lookup hash
+     * here. #RNA_def_property and #rna_def_property_free keep it up to date. */
+    srna->cont.prophash = BLI_ghash_str_new(__func__);
+
+    for (prop = srna->cont.properties.first; prop; prop = prop->next) {
+      if (!(prop->flag_internal & PROP_INTERN_BUILTIN)) {
+        BLI_ghash_insert(srna->cont.prophash, (void *)prop->identifier, prop);
+      }
+    }
+  }
+#endif
+
   return srna;
 }
 
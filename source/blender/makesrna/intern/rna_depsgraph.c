@@ -252,6 +252,21 @@ static void rna_Depsgraph_debug_stats_gnuplot(Depsgraph *depsgraph,
   fclose(f);
 }
 
+static void rna_Depsgraph_debug_profile_dump(Depsgraph *depsgraph, const char *filename)
+{
+  FILE *f = fopen(filename, "w");
+  if (f == NULL) {
+    return;
+  }
+  DEG_debug_profile_dump(depsgraph, f);
+  fclose(f);
+}
+
+static void rna_Depsgraph_debug_profile_reset(Depsgraph *depsgraph)
+{
+  DEG_debug_profile_reset(depsgraph);
+}
+
 static void rna_Depsgraph_debug_tag_update(Depsgraph *depsgraph)
 {
   DEG_graph_tag_relations_update(depsgraph);
@@ -665,6 +680,17 @@ static void rna_def_depsgraph(BlenderRNA *brna)
                                   "File name where gnuplot script will save the result");
   RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
 
+  func = RNA_def_function(srna, "debug_profile_dump", "rna_Depsgraph_debug_profile_dump");
+  RNA_def_function_ui_description(func,
+                                  "Write a report of per-operation evaluation times, most "
+                                  "expensive datablocks and operations first");
+  parm = RNA_def_string_file_path(
+      func, "filename", NULL, FILE_MAX, "File Name", "Output path for the profile report");
+  RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
+
+  func = RNA_def_function(srna, "debug_profile_reset", "rna_Depsgraph_debug_profile_reset");
+  RNA_def_function_ui_description(func, "Reset the accumulated evaluation timing information");
+
   func = RNA_def_function(srna, "debug_tag_update", "rna_Depsgraph_debug_tag_update");
 
   func = RNA_def_function(srna, "debug_stats", "rna_Depsgraph_debug_stats");
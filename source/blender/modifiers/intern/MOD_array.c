@@ -28,6 +28,7 @@
 #include "BLI_utildefines.h"
 
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "BLT_translation.h"
 
@@ -355,23 +356,88 @@ static void mesh_merge_transform(Mesh *result,
   }
 }
 
+typedef struct ArrayEmitChunkData {
+  Mesh *mesh;
+  Mesh *result;
+  /* Accumulated offset matrix per copy (index 0 is the identity). */
+  const float (*offsets)[4][4];
+  int chunk_nverts;
+  int chunk_nedges;
+  int chunk_nloops;
+  int chunk_npolys;
+  bool use_recalc_normals;
+} ArrayEmitChunkData;
+
+/* Emit one copy of the source geometry into its pre-sized slice of the result
+ * mesh. Every copy writes a disjoint range, so the copies can be emitted in
+ * parallel. */
+static void array_emit_chunk_cb(void *__restrict userdata,
+                                const int c,
+                                const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ArrayEmitChunkData *data = userdata;
+  Mesh *mesh = data->mesh;
+  Mesh *result = data->result;
+  const int chunk_nverts = data->chunk_nverts;
+  const int chunk_nedges = data->chunk_nedges;
+  const int chunk_nloops = data->chunk_nloops;
+  const int chunk_npolys = data->chunk_npolys;
+  int i;
+
+  /* copy customdata to new geometry */
+  CustomData_copy_data(&mesh->vdata, &result->vdata, 0, c * chunk_nverts, chunk_nverts);
+  CustomData_copy_data(&mesh->edata, &result->edata, 0, c * chunk_nedges, chunk_nedges);
+  CustomData_copy_data(&mesh->ldata, &result->ldata, 0, c * chunk_nloops, chunk_nloops);
+  CustomData_copy_data(&mesh->pdata, &result->pdata, 0, c * chunk_npolys, chunk_npolys);
+
+  /* apply offset to all new verts */
+  MVert *mv = result->mvert + c * chunk_nverts;
+  for (i = 0; i < chunk_nverts; i++, mv++) {
+    mul_m4_v3(data->offsets[c], mv->co);
+
+    /* We have to correct normals too, if we do not tag them as dirty! */
+    if (!data->use_recalc_normals) {
+      float no[3];
+      normal_short_to_float_v3(no, mv->no);
+      mul_mat3_m4_v3(data->offsets[c], no);
+      normalize_v3(no);
+      normal_float_to_short_v3(mv->no, no);
+    }
+  }
+
+  /* adjust edge vertex indices */
+  MEdge *me = result->medge + c * chunk_nedges;
+  for (i = 0; i < chunk_nedges; i++, me++) {
+    me->v1 += c * chunk_nverts;
+    me->v2 += c * chunk_nverts;
+  }
+
+  MPoly *mp = result->mpoly + c * chunk_npolys;
+  for (i = 0; i < chunk_npolys; i++, mp++) {
+    mp->loopstart += c * chunk_nloops;
+  }
+
+  /* adjust loop vertex and edge indices */
+  MLoop *ml = result->mloop + c * chunk_nloops;
+  for (i = 0; i < chunk_nloops; i++, ml++) {
+    ml->v += c * chunk_nverts;
+    ml->e += c * chunk_nedges;
+  }
+}
+
 static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
                                    const ModifierEvalContext *ctx,
                                    Mesh *mesh)
 {
   const MVert *src_mvert;
-  MVert *mv, *mv_prev, *result_dm_verts;
+  MVert *result_dm_verts;
 
-  MEdge *me;
-  MLoop *ml;
-  MPoly *mp;
   int i, j, c, count;
   float length = amd->length;
   /* offset matrix */
   float offset[4][4];
   float scale[3];
   bool offset_has_scale;
-  float current_offset[4][4];
   float final_offset[4][4];
   int *full_doubles_map = NULL;
   int tot_doubles;
@@ -571,55 +637,35 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
   first_chunk_start = 0;
   first_chunk_nverts = chunk_nverts;
 
-  unit_m4(current_offset);
+  /* Accumulate the offset matrix of every copy up front, so the copies can be
+   * emitted in any order by the parallel pass below. */
+  float(*offsets)[4][4] = MEM_malloc_arrayN(count, sizeof(*offsets), "mod array offsets");
+  unit_m4(offsets[0]);
   for (c = 1; c < count; c++) {
-    /* copy customdata to new geometry */
-    CustomData_copy_data(&mesh->vdata, &result->vdata, 0, c * chunk_nverts, chunk_nverts);
-    CustomData_copy_data(&mesh->edata, &result->edata, 0, c * chunk_nedges, chunk_nedges);
-    CustomData_copy_data(&mesh->ldata, &result->ldata, 0, c * chunk_nloops, chunk_nloops);
-    CustomData_copy_data(&mesh->pdata, &result->pdata, 0, c * chunk_npolys, chunk_npolys);
-
-    mv_prev = result_dm_verts;
-    mv = mv_prev + c * chunk_nverts;
-
-    /* recalculate cumulative offset here */
-    mul_m4_m4m4(current_offset, current_offset, offset);
-
-    /* apply offset to all new verts */
-    for (i = 0; i < chunk_nverts; i++, mv++, mv_prev++) {
-      mul_m4_v3(current_offset, mv->co);
-
-      /* We have to correct normals too, if we do not tag them as dirty! */
-      if (!use_recalc_normals) {
-        float no[3];
-        normal_short_to_float_v3(no, mv->no);
-        mul_mat3_m4_v3(current_offset, no);
-        normalize_v3(no);
-        normal_float_to_short_v3(mv->no, no);
-      }
-    }
-
-    /* adjust edge vertex indices */
-    me = result->medge + c * chunk_nedges;
-    for (i = 0; i < chunk_nedges; i++, me++) {
-      me->v1 += c * chunk_nverts;
-      me->v2 += c * chunk_nverts;
-    }
-
-    mp = result->mpoly + c * chunk_npolys;
-    for (i = 0; i < chunk_npolys; i++, mp++) {
-      mp->loopstart += c * chunk_nloops;
-    }
+    mul_m4_m4m4(offsets[c], offsets[c - 1], offset);
+  }
 
-    /* adjust loop vertex and edge indices */
-    ml = result->mloop + c * chunk_nloops;
-    for (i = 0; i < chunk_nloops; i++, ml++) {
-      ml->v += c * chunk_nverts;
-      ml->e += c * chunk_nedges;
-    }
+  {
+    ArrayEmitChunkData data = {
+        .mesh = mesh,
+        .result = result,
+        .offsets = (const float(*)[4][4])offsets,
+        .chunk_nverts = chunk_nverts,
+        .chunk_nedges = chunk_nedges,
+        .chunk_nloops = chunk_nloops,
+        .chunk_npolys = chunk_npolys,
+        .use_recalc_normals = use_recalc_normals,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (count > 8);
+    BLI_task_parallel_range(1, count, &data, array_emit_chunk_cb, &settings);
+  }
 
-    /* Handle merge between chunk n and n-1 */
-    if (use_merge && (c >= 1)) {
+  /* Handle merge between chunk n and n-1. This stays serial and in copy order
+   * since every chunk maps its doubles into the chunk before it. */
+  if (use_merge) {
+    for (c = 1; c < count; c++) {
       if (!offset_has_scale && (c >= 2)) {
         /* Mapping chunk 3 to chunk 2 is a translation of mapping 2 to 1
          * ... that is except if scaling makes the distance grow */
@@ -681,7 +727,8 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
   last_chunk_start = (count - 1) * chunk_nverts;
   last_chunk_nverts = chunk_nverts;
 
-  copy_m4_m4(final_offset, current_offset);
+  copy_m4_m4(final_offset, offsets[count - 1]);
+  MEM_freeN(offsets);
 
   if (use_merge && (amd->flags & MOD_ARR_MERGEFINAL) && (count > 1)) {
     /* Merge first and last copies */
@@ -727,7 +774,7 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
   if (end_cap_mesh) {
     float end_offset[4][4];
     int end_cap_start = result_nverts - end_cap_nverts;
-    mul_m4_m4m4(end_offset, current_offset, offset);
+    mul_m4_m4m4(end_offset, final_offset, offset);
     mesh_merge_transform(result,
                          end_cap_mesh,
                          end_offset,
@@ -26,6 +26,7 @@
 #include "BLI_utildefines.h"
 
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "BLT_translation.h"
 
@@ -43,6 +44,7 @@
 #include "BKE_editmesh.h"
 #include "BKE_lib_id.h"
 #include "BKE_mesh.h"
+#include "BKE_mesh_mapping.h"
 #include "BKE_mesh_wrapper.h"
 #include "BKE_screen.h"
 
@@ -181,7 +183,57 @@ static void mesh_get_boundaries(Mesh *mesh, float *smooth_weights)
 /* Simple Weighted Smoothing
  *
  * (average of surrounding verts)
+ *
+ * Both smoothing methods run their iterations as two parallel passes over the
+ * verts: a gather pass that accumulates the delta of every vert from its
+ * incident edges (reading only the current coordinates), and an apply pass
+ * that moves the verts. Gathering per vert instead of scattering per edge
+ * avoids write conflicts, and keeping the passes separate keeps the result
+ * identical to the serial version (Jacobi style, not Gauss-Seidel).
  */
+
+struct SmoothingData_Simple {
+  float delta[3];
+};
+
+typedef struct SmoothIterData_Simple {
+  const MEdge *edges;
+  const MeshElemMap *vert_edge_map;
+  float (*vertexCos)[3];
+  struct SmoothingData_Simple *smooth_data;
+  const float *vertex_edge_count_div;
+} SmoothIterData_Simple;
+
+static void smooth_iter__simple_gather_cb(void *__restrict userdata,
+                                          const int i,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SmoothIterData_Simple *data = userdata;
+  const MeshElemMap *map = &data->vert_edge_map[i];
+  const float *co = data->vertexCos[i];
+  float delta[3] = {0.0f, 0.0f, 0.0f};
+
+  for (int j = 0; j < map->count; j++) {
+    const MEdge *ed = &data->edges[map->indices[j]];
+    const uint i_other = (ed->v1 == (uint)i) ? ed->v2 : ed->v1;
+
+    float edge_dir[3];
+    sub_v3_v3v3(edge_dir, data->vertexCos[i_other], co);
+    add_v3_v3(delta, edge_dir);
+  }
+
+  copy_v3_v3(data->smooth_data[i].delta, delta);
+}
+
+static void smooth_iter__simple_apply_cb(void *__restrict userdata,
+                                         const int i,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SmoothIterData_Simple *data = userdata;
+
+  madd_v3_v3fl(data->vertexCos[i], data->smooth_data[i].delta, data->vertex_edge_count_div[i]);
+}
+
 static void smooth_iter__simple(CorrectiveSmoothModifierData *csmd,
                                 Mesh *mesh,
                                 float (*vertexCos)[3],
@@ -196,9 +248,8 @@ static void smooth_iter__simple(CorrectiveSmoothModifierData *csmd,
   const MEdge *edges = mesh->medge;
   float *vertex_edge_count_div;
 
-  struct SmoothingData_Simple {
-    float delta[3];
-  } *smooth_data = MEM_calloc_arrayN(numVerts, sizeof(*smooth_data), __func__);
+  struct SmoothingData_Simple *smooth_data = MEM_calloc_arrayN(
+      numVerts, sizeof(*smooth_data), __func__);
 
   vertex_edge_count_div = MEM_calloc_arrayN(numVerts, sizeof(float), __func__);
 
@@ -225,32 +276,32 @@ static void smooth_iter__simple(CorrectiveSmoothModifierData *csmd,
     }
   }
 
+  MeshElemMap *vert_edge_map;
+  int *vert_edge_map_mem;
+  BKE_mesh_vert_edge_map_create(
+      &vert_edge_map, &vert_edge_map_mem, edges, (int)numVerts, (int)numEdges);
+
   /* -------------------------------------------------------------------- */
   /* Main Smoothing Loop */
 
-  while (iterations--) {
-    for (i = 0; i < numEdges; i++) {
-      struct SmoothingData_Simple *sd_v1;
-      struct SmoothingData_Simple *sd_v2;
-      float edge_dir[3];
-
-      sub_v3_v3v3(edge_dir, vertexCos[edges[i].v2], vertexCos[edges[i].v1]);
-
-      sd_v1 = &smooth_data[edges[i].v1];
-      sd_v2 = &smooth_data[edges[i].v2];
-
-      add_v3_v3(sd_v1->delta, edge_dir);
-      sub_v3_v3(sd_v2->delta, edge_dir);
-    }
+  SmoothIterData_Simple data = {
+      .edges = edges,
+      .vert_edge_map = vert_edge_map,
+      .vertexCos = vertexCos,
+      .smooth_data = smooth_data,
+      .vertex_edge_count_div = vertex_edge_count_div,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
 
-    for (i = 0; i < numVerts; i++) {
-      struct SmoothingData_Simple *sd = &smooth_data[i];
-      madd_v3_v3fl(vertexCos[i], sd->delta, vertex_edge_count_div[i]);
-      /* zero for the next iteration (saves memset on entire array) */
-      memset(sd, 0, sizeof(*sd));
-    }
+  while (iterations--) {
+    BLI_task_parallel_range(0, (int)numVerts, &data, smooth_iter__simple_gather_cb, &settings);
+    BLI_task_parallel_range(0, (int)numVerts, &data, smooth_iter__simple_apply_cb, &settings);
   }
 
+  MEM_freeN(vert_edge_map);
+  MEM_freeN(vert_edge_map_mem);
   MEM_freeN(vertex_edge_count_div);
   MEM_freeN(smooth_data);
 }
@@ -258,6 +309,67 @@ static void smooth_iter__simple(CorrectiveSmoothModifierData *csmd,
 /* -------------------------------------------------------------------- */
 /* Edge-Length Weighted Smoothing
  */
+
+struct SmoothingData_Weighted {
+  float delta[3];
+  float edge_length_sum;
+};
+
+typedef struct SmoothIterData_Weighted {
+  const MEdge *edges;
+  const MeshElemMap *vert_edge_map;
+  float (*vertexCos)[3];
+  struct SmoothingData_Weighted *smooth_data;
+  const float *vertex_edge_count;
+  const float *smooth_weights;
+  float lambda;
+  float eps;
+} SmoothIterData_Weighted;
+
+static void smooth_iter__length_weight_gather_cb(void *__restrict userdata,
+                                                 const int i,
+                                                 const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SmoothIterData_Weighted *data = userdata;
+  const MeshElemMap *map = &data->vert_edge_map[i];
+  const float *co = data->vertexCos[i];
+  float delta[3] = {0.0f, 0.0f, 0.0f};
+  float edge_length_sum = 0.0f;
+
+  for (int j = 0; j < map->count; j++) {
+    const MEdge *ed = &data->edges[map->indices[j]];
+    const uint i_other = (ed->v1 == (uint)i) ? ed->v2 : ed->v1;
+
+    float edge_dir[3];
+    sub_v3_v3v3(edge_dir, data->vertexCos[i_other], co);
+    const float edge_dist = len_v3(edge_dir);
+
+    /* weight by distance */
+    madd_v3_v3fl(delta, edge_dir, edge_dist);
+    edge_length_sum += edge_dist;
+  }
+
+  copy_v3_v3(data->smooth_data[i].delta, delta);
+  data->smooth_data[i].edge_length_sum = edge_length_sum;
+}
+
+static void smooth_iter__length_weight_apply_cb(void *__restrict userdata,
+                                                const int i,
+                                                const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SmoothIterData_Weighted *data = userdata;
+  const struct SmoothingData_Weighted *sd = &data->smooth_data[i];
+  /* Divide by sum of all neighbor distances (weighted) and amount of neighbors,
+   * (mean average). */
+  const float div = sd->edge_length_sum * data->vertex_edge_count[i];
+
+  if (div > data->eps) {
+    const float lambda_w = data->smooth_weights ? data->lambda * data->smooth_weights[i] :
+                                                  data->lambda;
+    madd_v3_v3fl(data->vertexCos[i], sd->delta, lambda_w / div);
+  }
+}
+
 static void smooth_iter__length_weight(CorrectiveSmoothModifierData *csmd,
                                        Mesh *mesh,
                                        float (*vertexCos)[3],
@@ -274,10 +386,8 @@ static void smooth_iter__length_weight(CorrectiveSmoothModifierData *csmd,
   float *vertex_edge_count;
   uint i;
 
-  struct SmoothingData_Weighted {
-    float delta[3];
-    float edge_length_sum;
-  } *smooth_data = MEM_calloc_arrayN(numVerts, sizeof(*smooth_data), __func__);
+  struct SmoothingData_Weighted *smooth_data = MEM_calloc_arrayN(
+      numVerts, sizeof(*smooth_data), __func__);
 
   /* calculate as floats to avoid int->float conversion in #smooth_iter */
   vertex_edge_count = MEM_calloc_arrayN(numVerts, sizeof(float), __func__);
@@ -286,68 +396,37 @@ static void smooth_iter__length_weight(CorrectiveSmoothModifierData *csmd,
     vertex_edge_count[edges[i].v2] += 1.0f;
   }
 
+  MeshElemMap *vert_edge_map;
+  int *vert_edge_map_mem;
+  BKE_mesh_vert_edge_map_create(
+      &vert_edge_map, &vert_edge_map_mem, edges, (int)numVerts, (int)numEdges);
+
   /* -------------------------------------------------------------------- */
   /* Main Smoothing Loop */
 
-  while (iterations--) {
-    for (i = 0; i < numEdges; i++) {
-      struct SmoothingData_Weighted *sd_v1;
-      struct SmoothingData_Weighted *sd_v2;
-      float edge_dir[3];
-      float edge_dist;
-
-      sub_v3_v3v3(edge_dir, vertexCos[edges[i].v2], vertexCos[edges[i].v1]);
-      edge_dist = len_v3(edge_dir);
-
-      /* weight by distance */
-      mul_v3_fl(edge_dir, edge_dist);
-
-      sd_v1 = &smooth_data[edges[i].v1];
-      sd_v2 = &smooth_data[edges[i].v2];
-
-      add_v3_v3(sd_v1->delta, edge_dir);
-      sub_v3_v3(sd_v2->delta, edge_dir);
+  SmoothIterData_Weighted data = {
+      .edges = edges,
+      .vert_edge_map = vert_edge_map,
+      .vertexCos = vertexCos,
+      .smooth_data = smooth_data,
+      .vertex_edge_count = vertex_edge_count,
+      .smooth_weights = smooth_weights,
+      .lambda = lambda,
+      .eps = eps,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
 
-      sd_v1->edge_length_sum += edge_dist;
-      sd_v2->edge_length_sum += edge_dist;
-    }
-
-    if (smooth_weights == NULL) {
-      /* fast-path */
-      for (i = 0; i < numVerts; i++) {
-        struct SmoothingData_Weighted *sd = &smooth_data[i];
-        /* Divide by sum of all neighbor distances (weighted) and amount of neighbors,
-         * (mean average). */
-        const float div = sd->edge_length_sum * vertex_edge_count[i];
-        if (div > eps) {
-#if 0
-          /* first calculate the new location */
-          mul_v3_fl(sd->delta, 1.0f / div);
-          /* then interpolate */
-          madd_v3_v3fl(vertexCos[i], sd->delta, lambda);
-#else
-          /* do this in one step */
-          madd_v3_v3fl(vertexCos[i], sd->delta, lambda / div);
-#endif
-        }
-        /* zero for the next iteration (saves memset on entire array) */
-        memset(sd, 0, sizeof(*sd));
-      }
-    }
-    else {
-      for (i = 0; i < numVerts; i++) {
-        struct SmoothingData_Weighted *sd = &smooth_data[i];
-        const float div = sd->edge_length_sum * vertex_edge_count[i];
-        if (div > eps) {
-          const float lambda_w = lambda * smooth_weights[i];
-          madd_v3_v3fl(vertexCos[i], sd->delta, lambda_w / div);
-        }
-
-        memset(sd, 0, sizeof(*sd));
-      }
-    }
+  while (iterations--) {
+    BLI_task_parallel_range(
+        0, (int)numVerts, &data, smooth_iter__length_weight_gather_cb, &settings);
+    BLI_task_parallel_range(
+        0, (int)numVerts, &data, smooth_iter__length_weight_apply_cb, &settings);
   }
 
+  MEM_freeN(vert_edge_map);
+  MEM_freeN(vert_edge_map_mem);
   MEM_freeN(vertex_edge_count);
   MEM_freeN(smooth_data);
 }
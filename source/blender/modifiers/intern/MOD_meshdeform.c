@@ -267,6 +267,25 @@ static float meshdeform_dynamic_bind(MeshDeformModifierData *mmd, float (*dco)[3
   return totweight;
 }
 
+typedef struct MeshdeformCageDeltaData {
+  const MeshDeformModifierData *mmd;
+  float (*dco)[3];
+  const float (*bindcagecos)[3];
+} MeshdeformCageDeltaData;
+
+static void meshdeform_cage_delta_task(void *__restrict userdata,
+                                       const int a,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const MeshdeformCageDeltaData *data = userdata;
+  float co[3];
+
+  /* get cage vertex in world space with binding transform */
+  mul_v3_m4v3(co, data->mmd->bindmat, data->dco[a]);
+  /* compute difference with world space bind coord */
+  sub_v3_v3v3(data->dco[a], co, data->bindcagecos[a]);
+}
+
 typedef struct MeshdeformUserdata {
   /*const*/ MeshDeformModifierData *mmd;
   const MDeformVert *dvert;
@@ -348,7 +367,7 @@ static void meshdeformModifier_do(ModifierData *md,
   MDeformVert *dvert = NULL;
   float imat[4][4], cagemat[4][4], iobmat[4][4], icagemat[3][3], cmat[4][4];
   float(*dco)[3] = NULL, (*bindcagecos)[3];
-  int a, totvert, totcagevert, defgrp_index;
+  int totvert, totcagevert, defgrp_index;
   MeshdeformUserdata data;
 
   static int recursive_bind_sentinel = 0;
@@ -425,12 +444,18 @@ static void meshdeformModifier_do(ModifierData *md,
   BKE_mesh_wrapper_vert_coords_copy(cagemesh, dco, totcagevert);
   bindcagecos = (float(*)[3])mmd->bindcagecos;
 
-  for (a = 0; a < totcagevert; a++) {
-    /* get cage vertex in world space with binding transform */
-    float co[3];
-    mul_v3_m4v3(co, mmd->bindmat, dco[a]);
-    /* compute difference with world space bind coord */
-    sub_v3_v3v3(dco[a], co, bindcagecos[a]);
+  /* Compute the difference of every cage vertex with its world space bind
+   * coordinate. For dense cages this pre-pass is worth threading too. */
+  {
+    MeshdeformCageDeltaData delta_data = {
+        .mmd = mmd,
+        .dco = dco,
+        .bindcagecos = (const float(*)[3])bindcagecos,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 1024;
+    BLI_task_parallel_range(0, totcagevert, &delta_data, meshdeform_cage_delta_task, &settings);
   }
 
   MOD_get_vgroup(ob, mesh, mmd->defgrp_name, &dvert, &defgrp_index);
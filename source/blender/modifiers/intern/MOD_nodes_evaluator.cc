@@ -14,6 +14,8 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+#include <chrono>
+
 #include "MOD_nodes_evaluator.hh"
 
 #include "NOD_geometry_exec.hh"
@@ -819,8 +821,6 @@ class GeometryNodesEvaluator {
    */
   void execute_node(const DNode node, NodeState &node_state)
   {
-    const bNode &bnode = *node->bnode();
-
     if (node_state.has_been_executed) {
       if (!node_supports_laziness(node)) {
         /* Nodes that don't support laziness must not be executed more than once. */
@@ -829,6 +829,23 @@ class GeometryNodesEvaluator {
     }
     node_state.has_been_executed = true;
 
+    /* Timings are logged for every node because they are cheap to measure compared to executing
+     * the node, unlike logged values which can require copies. */
+    if (params_.geo_logger == nullptr) {
+      this->execute_node_impl(node, node_state);
+      return;
+    }
+    const auto start_time = std::chrono::steady_clock::now();
+    this->execute_node_impl(node, node_state);
+    const auto end_time = std::chrono::steady_clock::now();
+    params_.geo_logger->local().log_execution_time(
+        node, std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time));
+  }
+
+  void execute_node_impl(const DNode node, NodeState &node_state)
+  {
+    const bNode &bnode = *node->bnode();
+
     /* Use the geometry node execute callback if it exists. */
     if (bnode.typeinfo->geometry_node_execute != nullptr) {
       this->execute_geometry_node(node, node_state);
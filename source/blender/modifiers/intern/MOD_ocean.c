@@ -322,6 +322,104 @@ static Mesh *generate_ocean_geometry(OceanModifierData *omd, Mesh *mesh_orig, co
   return result;
 }
 
+/* use cached & inverted value for speed
+ * expanded this would read...
+ *
+ * (axis / (omd->size * omd->spatial_size)) + 0.5f) */
+#  define OCEAN_CO(_size_co_inv, _v) ((_v * _size_co_inv) + 0.5f)
+
+typedef struct OceanApplyData {
+  OceanModifierData *omd;
+  MVert *mverts;
+  MLoop *mloops;
+  MPoly *mpolys;
+  MLoopCol *mloopcols;
+  MLoopCol *mloopcols_spray;
+  float size_co_inv;
+  int cfra_for_cache;
+} OceanApplyData;
+
+static void ocean_apply_foam_cb(void *__restrict userdata,
+                                const int i,
+                                const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  OceanApplyData *oad = userdata;
+  OceanModifierData *omd = oad->omd;
+  const MPoly *mp = &oad->mpolys[i];
+  const MLoop *ml = &oad->mloops[mp->loopstart];
+  MLoopCol *mlcol = &oad->mloopcols[mp->loopstart];
+
+  MLoopCol *mlcolspray = NULL;
+  if (omd->flag & MOD_OCEAN_GENERATE_SPRAY) {
+    mlcolspray = &oad->mloopcols_spray[mp->loopstart];
+  }
+
+  for (int j = mp->totloop; j--; ml++, mlcol++) {
+    const float *vco = oad->mverts[ml->v].co;
+    const float u = OCEAN_CO(oad->size_co_inv, vco[0]);
+    const float v = OCEAN_CO(oad->size_co_inv, vco[1]);
+    float foam;
+    OceanResult ocr;
+
+    if (omd->oceancache && omd->cached == true) {
+      BKE_ocean_cache_eval_uv(omd->oceancache, &ocr, oad->cfra_for_cache, u, v);
+      foam = ocr.foam;
+      CLAMP(foam, 0.0f, 1.0f);
+    }
+    else {
+      BKE_ocean_eval_uv_no_lock(omd->ocean, &ocr, u, v);
+      foam = BKE_ocean_jminus_to_foam(ocr.Jminus, omd->foam_coverage);
+    }
+
+    mlcol->r = mlcol->g = mlcol->b = (char)(foam * 255);
+    /* This needs to be set (render engine uses) */
+    mlcol->a = 255;
+
+    if (omd->flag & MOD_OCEAN_GENERATE_SPRAY) {
+      if (omd->flag & MOD_OCEAN_INVERT_SPRAY) {
+        mlcolspray->r = ocr.Eminus[0] * 255;
+      }
+      else {
+        mlcolspray->r = ocr.Eplus[0] * 255;
+      }
+      mlcolspray->g = 0;
+      if (omd->flag & MOD_OCEAN_INVERT_SPRAY) {
+        mlcolspray->b = ocr.Eminus[2] * 255;
+      }
+      else {
+        mlcolspray->b = ocr.Eplus[2] * 255;
+      }
+      mlcolspray->a = 255;
+    }
+  }
+}
+
+static void ocean_apply_displacement_cb(void *__restrict userdata,
+                                        const int i,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  OceanApplyData *oad = userdata;
+  OceanModifierData *omd = oad->omd;
+  float *vco = oad->mverts[i].co;
+  const float u = OCEAN_CO(oad->size_co_inv, vco[0]);
+  const float v = OCEAN_CO(oad->size_co_inv, vco[1]);
+  OceanResult ocr;
+
+  if (omd->oceancache && omd->cached == true) {
+    BKE_ocean_cache_eval_uv(omd->oceancache, &ocr, oad->cfra_for_cache, u, v);
+  }
+  else {
+    BKE_ocean_eval_uv_no_lock(omd->ocean, &ocr, u, v);
+  }
+
+  vco[2] += ocr.disp[1];
+
+  if (omd->chop_amount > 0.0f) {
+    vco[0] += ocr.disp[0];
+    vco[1] += ocr.disp[2];
+  }
+}
+
 static Mesh *doOcean(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mesh)
 {
   OceanModifierData *omd = (OceanModifierData *)md;
@@ -334,7 +432,6 @@ static Mesh *doOcean(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mes
   bool allocated_ocean = false;
 
   Mesh *result = NULL;
-  OceanResult ocr;
 
   const int resolution = (ctx->flag & MOD_APPLY_RENDER) ? omd->resolution :
                                                           omd->viewport_resolution;
@@ -342,13 +439,6 @@ static Mesh *doOcean(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mes
   MVert *mverts;
 
   int cfra_for_cache;
-  int i, j;
-
-  /* use cached & inverted value for speed
-   * expanded this would read...
-   *
-   * (axis / (omd->size * omd->spatial_size)) + 0.5f) */
-#  define OCEAN_CO(_size_co_inv, _v) ((_v * _size_co_inv) + 0.5f)
 
   const float size_co_inv = 1.0f / (omd->size * omd->spatial_size);
 
@@ -388,13 +478,30 @@ static Mesh *doOcean(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mes
 
   mverts = result->mvert;
 
+  /* Evaluating the simulation for every vertex takes the ocean read lock once
+   * around the whole parallel pass instead of once per sample: the per-sample
+   * lock is what used to make these loops slower when threaded. The baked
+   * cache path reads immutable buffers and needs no lock. */
+  const bool use_eval_lock = !(omd->oceancache && omd->cached == true);
+
+  OceanApplyData apply_data = {
+      .omd = omd,
+      .mverts = mverts,
+      .mloops = result->mloop,
+      .mpolys = result->mpoly,
+      .size_co_inv = size_co_inv,
+      .cfra_for_cache = cfra_for_cache,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+
   /* add vcols before displacement - allows lookup based on position */
 
   if (omd->flag & MOD_OCEAN_GENERATE_FOAM) {
     if (CustomData_number_of_layers(&result->ldata, CD_MLOOPCOL) < MAX_MCOL) {
       const int num_polys = result->totpoly;
       const int num_loops = result->totloop;
-      MLoop *mloops = result->mloop;
       MLoopCol *mloopcols = CustomData_add_layer_named(
           &result->ldata, CD_MLOOPCOL, CD_CALLOC, NULL, num_loops, omd->foamlayername);
 
@@ -405,85 +512,30 @@ static Mesh *doOcean(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mes
       }
 
       if (mloopcols) { /* unlikely to fail */
-        MPoly *mpolys = result->mpoly;
-        MPoly *mp;
-
-        for (i = 0, mp = mpolys; i < num_polys; i++, mp++) {
-          MLoop *ml = &mloops[mp->loopstart];
-          MLoopCol *mlcol = &mloopcols[mp->loopstart];
-
-          MLoopCol *mlcolspray = NULL;
-          if (omd->flag & MOD_OCEAN_GENERATE_SPRAY) {
-            mlcolspray = &mloopcols_spray[mp->loopstart];
-          }
-
-          for (j = mp->totloop; j--; ml++, mlcol++) {
-            const float *vco = mverts[ml->v].co;
-            const float u = OCEAN_CO(size_co_inv, vco[0]);
-            const float v = OCEAN_CO(size_co_inv, vco[1]);
-            float foam;
-
-            if (omd->oceancache && omd->cached == true) {
-              BKE_ocean_cache_eval_uv(omd->oceancache, &ocr, cfra_for_cache, u, v);
-              foam = ocr.foam;
-              CLAMP(foam, 0.0f, 1.0f);
-            }
-            else {
-              BKE_ocean_eval_uv(omd->ocean, &ocr, u, v);
-              foam = BKE_ocean_jminus_to_foam(ocr.Jminus, omd->foam_coverage);
-            }
-
-            mlcol->r = mlcol->g = mlcol->b = (char)(foam * 255);
-            /* This needs to be set (render engine uses) */
-            mlcol->a = 255;
-
-            if (omd->flag & MOD_OCEAN_GENERATE_SPRAY) {
-              if (omd->flag & MOD_OCEAN_INVERT_SPRAY) {
-                mlcolspray->r = ocr.Eminus[0] * 255;
-              }
-              else {
-                mlcolspray->r = ocr.Eplus[0] * 255;
-              }
-              mlcolspray->g = 0;
-              if (omd->flag & MOD_OCEAN_INVERT_SPRAY) {
-                mlcolspray->b = ocr.Eminus[2] * 255;
-              }
-              else {
-                mlcolspray->b = ocr.Eplus[2] * 255;
-              }
-              mlcolspray->a = 255;
-            }
-          }
+        apply_data.mloopcols = mloopcols;
+        apply_data.mloopcols_spray = mloopcols_spray;
+
+        if (use_eval_lock) {
+          BKE_ocean_eval_lock(omd->ocean);
+        }
+        BLI_task_parallel_range(0, num_polys, &apply_data, ocean_apply_foam_cb, &settings);
+        if (use_eval_lock) {
+          BKE_ocean_eval_unlock(omd->ocean);
         }
       }
     }
   }
 
   /* displace the geometry */
-
-  /* NOTE: tried to parallelized that one and previous foam loop,
-   * but gives 20% slower results... odd. */
   {
     const int num_verts = result->totvert;
 
-    for (i = 0; i < num_verts; i++) {
-      float *vco = mverts[i].co;
-      const float u = OCEAN_CO(size_co_inv, vco[0]);
-      const float v = OCEAN_CO(size_co_inv, vco[1]);
-
-      if (omd->oceancache && omd->cached == true) {
-        BKE_ocean_cache_eval_uv(omd->oceancache, &ocr, cfra_for_cache, u, v);
-      }
-      else {
-        BKE_ocean_eval_uv(omd->ocean, &ocr, u, v);
-      }
-
-      vco[2] += ocr.disp[1];
-
-      if (omd->chop_amount > 0.0f) {
-        vco[0] += ocr.disp[0];
-        vco[1] += ocr.disp[2];
-      }
+    if (use_eval_lock) {
+      BKE_ocean_eval_lock(omd->ocean);
+    }
+    BLI_task_parallel_range(0, num_verts, &apply_data, ocean_apply_displacement_cb, &settings);
+    if (use_eval_lock) {
+      BKE_ocean_eval_unlock(omd->ocean);
     }
   }
 
@@ -492,10 +544,10 @@ static Mesh *doOcean(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mes
     omd->ocean = NULL;
   }
 
-#  undef OCEAN_CO
-
   return result;
 }
+
+#  undef OCEAN_CO
 #else  /* WITH_OCEANSIM */
 static Mesh *doOcean(ModifierData *UNUSED(md), const ModifierEvalContext *UNUSED(ctx), Mesh *mesh)
 {
@@ -21,6 +21,7 @@
 #include "BLI_utildefines.h"
 
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
@@ -142,6 +143,430 @@ static int comp_float_int_pair(const void *a, const void *b)
   return (int)(x->angle > y->angle) - (int)(x->angle < y->angle);
 }
 
+#define MOD_SOLIDIFY_EMPTY_TAG ((uint)-1)
+
+typedef struct EdgeGroupsCreateData {
+  OldVertEdgeRef **vert_adj_edges;
+  NewEdgeRef ***orig_edge_data_arr;
+  EdgeGroup **orig_vert_groups_arr;
+  const MEdge *orig_medge;
+  const uint *vm;
+} EdgeGroupsCreateData;
+
+/* Create the sorted edge groups for one original vert. Every vert only reads
+ * the shared adjacency data and writes its own slot of #orig_vert_groups_arr,
+ * so the verts can be processed in parallel. */
+static void create_edge_groups_task_cb(void *__restrict userdata,
+                                       const int n,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  EdgeGroupsCreateData *data = userdata;
+  NewEdgeRef ***orig_edge_data_arr = data->orig_edge_data_arr;
+  EdgeGroup **orig_vert_groups_arr = data->orig_vert_groups_arr;
+  const MEdge *orig_medge = data->orig_medge;
+  const uint *vm = data->vm;
+  const uint i = (uint)n;
+
+  OldVertEdgeRef **adj_edges_ptr = &data->vert_adj_edges[i];
+  if (*adj_edges_ptr != NULL && (*adj_edges_ptr)->edges_len >= 2) {
+    EdgeGroup *edge_groups;
+
+    int eg_index = -1;
+    bool contains_long_groups = false;
+    uint topo_groups = 0;
+
+    /* Initial sorted creation. */
+    {
+      const uint *adj_edges = (*adj_edges_ptr)->edges;
+      const uint tot_adj_edges = (*adj_edges_ptr)->edges_len;
+
+      uint unassigned_edges_len = 0;
+      for (uint j = 0; j < tot_adj_edges; j++) {
+        NewEdgeRef **new_edges = orig_edge_data_arr[adj_edges[j]];
+        /* TODO: check where the null pointer come from,
+         * because there should not be any... */
+        if (new_edges) {
+          /* count the number of new edges around the original vert */
+          while (*new_edges) {
+            unassigned_edges_len++;
+            new_edges++;
+          }
+        }
+      }
+      NewEdgeRef **unassigned_edges = MEM_malloc_arrayN(
+          unassigned_edges_len, sizeof(*unassigned_edges), "unassigned_edges in solidify");
+      for (uint j = 0, k = 0; j < tot_adj_edges; j++) {
+        NewEdgeRef **new_edges = orig_edge_data_arr[adj_edges[j]];
+        if (new_edges) {
+          while (*new_edges) {
+            unassigned_edges[k++] = *new_edges;
+            new_edges++;
+          }
+        }
+      }
+
+      /* An edge group will always contain min 2 edges
+       * so max edge group count can be calculated. */
+      uint edge_groups_len = unassigned_edges_len / 2;
+      edge_groups = MEM_calloc_arrayN(
+          edge_groups_len + 1, sizeof(*edge_groups), "edge_groups in solidify");
+
+      uint assigned_edges_len = 0;
+      NewEdgeRef *found_edge = NULL;
+      uint found_edge_index = 0;
+      bool insert_at_start = false;
+      uint eg_capacity = 5;
+      NewFaceRef *eg_track_faces[2] = {NULL, NULL};
+      NewFaceRef *last_open_edge_track = NULL;
+
+      while (assigned_edges_len < unassigned_edges_len) {
+        found_edge = NULL;
+        insert_at_start = false;
+        if (eg_index >= 0 && edge_groups[eg_index].edges_len == 0) {
+          /* Called every time a new group was started in the last iteration. */
+          /* Find an unused edge to start the next group
+           * and setup variables to start creating it. */
+          uint j = 0;
+          NewEdgeRef *edge = NULL;
+          while (!edge && j < unassigned_edges_len) {
+            edge = unassigned_edges[j++];
+            if (edge && last_open_edge_track &&
+                (edge->faces[0] != last_open_edge_track || edge->faces[1] != NULL)) {
+              edge = NULL;
+            }
+          }
+          if (!edge && last_open_edge_track) {
+            topo_groups++;
+            last_open_edge_track = NULL;
+            edge_groups[eg_index].topo_group++;
+            j = 0;
+            while (!edge && j < unassigned_edges_len) {
+              edge = unassigned_edges[j++];
+            }
+          }
+          else if (!last_open_edge_track && eg_index > 0) {
+            topo_groups++;
+            edge_groups[eg_index].topo_group++;
+          }
+          BLI_assert(edge != NULL);
+          found_edge_index = j - 1;
+          found_edge = edge;
+          if (!last_open_edge_track && vm[orig_medge[edge->old_edge].v1] == i) {
+            eg_track_faces[0] = edge->faces[0];
+            eg_track_faces[1] = edge->faces[1];
+            if (edge->faces[1] == NULL) {
+              last_open_edge_track = edge->faces[0]->reversed ? edge->faces[0] - 1 :
+                                                                edge->faces[0] + 1;
+            }
+          }
+          else {
+            eg_track_faces[0] = edge->faces[1];
+            eg_track_faces[1] = edge->faces[0];
+          }
+        }
+        else if (eg_index >= 0) {
+          NewEdgeRef **edge_ptr = unassigned_edges;
+          for (found_edge_index = 0; found_edge_index < unassigned_edges_len;
+               found_edge_index++, edge_ptr++) {
+            if (*edge_ptr) {
+              NewEdgeRef *edge = *edge_ptr;
+              if (edge->faces[0] == eg_track_faces[1]) {
+                insert_at_start = false;
+                eg_track_faces[1] = edge->faces[1];
+                found_edge = edge;
+                if (edge->faces[1] == NULL) {
+                  edge_groups[eg_index].is_orig_closed = false;
+                  last_open_edge_track = edge->faces[0]->reversed ? edge->faces[0] - 1 :
+                                                                    edge->faces[0] + 1;
+                }
+                break;
+              }
+              if (edge->faces[0] == eg_track_faces[0]) {
+                insert_at_start = true;
+                eg_track_faces[0] = edge->faces[1];
+                found_edge = edge;
+                if (edge->faces[1] == NULL) {
+                  edge_groups[eg_index].is_orig_closed = false;
+                }
+                break;
+              }
+              if (edge->faces[1] != NULL) {
+                if (edge->faces[1] == eg_track_faces[1]) {
+                  insert_at_start = false;
+                  eg_track_faces[1] = edge->faces[0];
+                  found_edge = edge;
+                  break;
+                }
+                if (edge->faces[1] == eg_track_faces[0]) {
+                  insert_at_start = true;
+                  eg_track_faces[0] = edge->faces[0];
+                  found_edge = edge;
+                  break;
+                }
+              }
+            }
+          }
+        }
+        if (found_edge) {
+          unassigned_edges[found_edge_index] = NULL;
+          assigned_edges_len++;
+          const uint needed_capacity = edge_groups[eg_index].edges_len + 1;
+          if (needed_capacity > eg_capacity) {
+            eg_capacity = needed_capacity + 1;
+            NewEdgeRef **new_eg = MEM_calloc_arrayN(
+                eg_capacity, sizeof(*new_eg), "edge_group realloc in solidify");
+            if (insert_at_start) {
+              memcpy(new_eg + 1,
+                     edge_groups[eg_index].edges,
+                     edge_groups[eg_index].edges_len * sizeof(*new_eg));
+            }
+            else {
+              memcpy(new_eg,
+                     edge_groups[eg_index].edges,
+                     edge_groups[eg_index].edges_len * sizeof(*new_eg));
+            }
+            MEM_freeN(edge_groups[eg_index].edges);
+            edge_groups[eg_index].edges = new_eg;
+          }
+          else if (insert_at_start) {
+            memmove(edge_groups[eg_index].edges + 1,
+                    edge_groups[eg_index].edges,
+                    edge_groups[eg_index].edges_len * sizeof(*edge_groups[eg_index].edges));
+          }
+          edge_groups[eg_index].edges[insert_at_start ? 0 : edge_groups[eg_index].edges_len] =
+              found_edge;
+          edge_groups[eg_index].edges_len++;
+          if (edge_groups[eg_index].edges[edge_groups[eg_index].edges_len - 1]->faces[1] !=
+              NULL) {
+            last_open_edge_track = NULL;
+          }
+          if (edge_groups[eg_index].edges_len > 3) {
+            contains_long_groups = true;
+          }
+        }
+        else {
+          /* called on first iteration to clean up the eg_index = -1 and start the first group,
+           * or when the current group is found to be complete (no new found_edge) */
+          eg_index++;
+          BLI_assert(eg_index < edge_groups_len);
+          eg_capacity = 5;
+          NewEdgeRef **edges = MEM_calloc_arrayN(
+              eg_capacity, sizeof(*edges), "edge_group in solidify");
+          edge_groups[eg_index] = (EdgeGroup){
+              .valid = true,
+              .edges = edges,
+              .edges_len = 0,
+              .open_face_edge = MOD_SOLIDIFY_EMPTY_TAG,
+              .is_orig_closed = true,
+              .is_even_split = false,
+              .split = 0,
+              .is_singularity = false,
+              .topo_group = topo_groups,
+              .co = {0.0f, 0.0f, 0.0f},
+              .no = {0.0f, 0.0f, 0.0f},
+              .new_vert = MOD_SOLIDIFY_EMPTY_TAG,
+          };
+          eg_track_faces[0] = NULL;
+          eg_track_faces[1] = NULL;
+        }
+      }
+      /* #eg_index is the number of groups from here on. */
+      eg_index++;
+      /* #topo_groups is the number of topo groups from here on. */
+      topo_groups++;
+
+      MEM_freeN(unassigned_edges);
+
+      /* TODO: reshape the edge_groups array to its actual size
+       * after writing is finished to save on memory. */
+    }
+
+    /* Split of long self intersection groups */
+    {
+      uint splits = 0;
+      if (contains_long_groups) {
+        uint add_index = 0;
+        for (uint j = 0; j < eg_index; j++) {
+          const uint edges_len = edge_groups[j + add_index].edges_len;
+          if (edges_len > 3) {
+            bool has_doubles = false;
+            bool *doubles = MEM_calloc_arrayN(
+                edges_len, sizeof(*doubles), "doubles in solidify");
+            EdgeGroup g = edge_groups[j + add_index];
+            for (uint k = 0; k < edges_len; k++) {
+              for (uint l = k + 1; l < edges_len; l++) {
+                if (g.edges[k]->old_edge == g.edges[l]->old_edge) {
+                  doubles[k] = true;
+                  doubles[l] = true;
+                  has_doubles = true;
+                }
+              }
+            }
+            if (has_doubles) {
+              const uint prior_splits = splits;
+              const uint prior_index = add_index;
+              int unique_start = -1;
+              int first_unique_end = -1;
+              int last_split = -1;
+              int first_split = -1;
+              bool first_even_split = false;
+              uint real_k = 0;
+              while (real_k < edges_len ||
+                     (g.is_orig_closed &&
+                      (real_k <=
+                           (first_unique_end == -1 ? 0 : first_unique_end) + (int)edges_len ||
+                       first_split != last_split))) {
+                const uint k = real_k % edges_len;
+                if (!doubles[k]) {
+                  if (first_unique_end != -1 && unique_start == -1) {
+                    unique_start = (int)real_k;
+                  }
+                }
+                else if (first_unique_end == -1) {
+                  first_unique_end = (int)k;
+                }
+                else if (unique_start != -1) {
+                  const uint split = (((uint)unique_start + real_k + 1) / 2) % edges_len;
+                  const bool is_even_split = (((uint)unique_start + real_k) & 1);
+                  if (last_split != -1) {
+                    /* Override g on first split (no insert). */
+                    if (prior_splits != splits) {
+                      memmove(edge_groups + j + add_index + 1,
+                              edge_groups + j + add_index,
+                              ((uint)eg_index - j) * sizeof(*edge_groups));
+                      add_index++;
+                    }
+                    if (last_split > split) {
+                      const uint size = (split + edges_len) - (uint)last_split;
+                      NewEdgeRef **edges = MEM_malloc_arrayN(
+                          size, sizeof(*edges), "edge_group split in solidify");
+                      memcpy(edges,
+                             g.edges + last_split,
+                             (edges_len - (uint)last_split) * sizeof(*edges));
+                      memcpy(edges + (edges_len - (uint)last_split),
+                             g.edges,
+                             split * sizeof(*edges));
+                      edge_groups[j + add_index] = (EdgeGroup){
+                          .valid = true,
+                          .edges = edges,
+                          .edges_len = size,
+                          .open_face_edge = MOD_SOLIDIFY_EMPTY_TAG,
+                          .is_orig_closed = g.is_orig_closed,
+                          .is_even_split = is_even_split,
+                          .split = add_index - prior_index + 1 + (uint)!g.is_orig_closed,
+                          .is_singularity = false,
+                          .topo_group = g.topo_group,
+                          .co = {0.0f, 0.0f, 0.0f},
+                          .no = {0.0f, 0.0f, 0.0f},
+                          .new_vert = MOD_SOLIDIFY_EMPTY_TAG,
+                      };
+                    }
+                    else {
+                      const uint size = split - (uint)last_split;
+                      NewEdgeRef **edges = MEM_malloc_arrayN(
+                          size, sizeof(*edges), "edge_group split in solidify");
+                      memcpy(edges, g.edges + last_split, size * sizeof(*edges));
+                      edge_groups[j + add_index] = (EdgeGroup){
+                          .valid = true,
+                          .edges = edges,
+                          .edges_len = size,
+                          .open_face_edge = MOD_SOLIDIFY_EMPTY_TAG,
+                          .is_orig_closed = g.is_orig_closed,
+                          .is_even_split = is_even_split,
+                          .split = add_index - prior_index + 1 + (uint)!g.is_orig_closed,
+                          .is_singularity = false,
+                          .topo_group = g.topo_group,
+                          .co = {0.0f, 0.0f, 0.0f},
+                          .no = {0.0f, 0.0f, 0.0f},
+                          .new_vert = MOD_SOLIDIFY_EMPTY_TAG,
+                      };
+                    }
+                    splits++;
+                  }
+                  last_split = (int)split;
+                  if (first_split == -1) {
+                    first_split = (int)split;
+                    first_even_split = is_even_split;
+                  }
+                  unique_start = -1;
+                }
+                real_k++;
+              }
+              if (first_split != -1) {
+                if (!g.is_orig_closed) {
+                  if (prior_splits != splits) {
+                    memmove(edge_groups + (j + prior_index + 1),
+                            edge_groups + (j + prior_index),
+                            ((uint)eg_index + add_index - (j + prior_index)) *
+                                sizeof(*edge_groups));
+                    memmove(edge_groups + (j + add_index + 2),
+                            edge_groups + (j + add_index + 1),
+                            ((uint)eg_index - j) * sizeof(*edge_groups));
+                    add_index++;
+                  }
+                  else {
+                    memmove(edge_groups + (j + add_index + 2),
+                            edge_groups + (j + add_index + 1),
+                            ((uint)eg_index - j - 1) * sizeof(*edge_groups));
+                  }
+                  NewEdgeRef **edges = MEM_malloc_arrayN(
+                      (uint)first_split, sizeof(*edges), "edge_group split in solidify");
+                  memcpy(edges, g.edges, (uint)first_split * sizeof(*edges));
+                  edge_groups[j + prior_index] = (EdgeGroup){
+                      .valid = true,
+                      .edges = edges,
+                      .edges_len = (uint)first_split,
+                      .open_face_edge = MOD_SOLIDIFY_EMPTY_TAG,
+                      .is_orig_closed = g.is_orig_closed,
+                      .is_even_split = first_even_split,
+                      .split = 1,
+                      .is_singularity = false,
+                      .topo_group = g.topo_group,
+                      .co = {0.0f, 0.0f, 0.0f},
+                      .no = {0.0f, 0.0f, 0.0f},
+                      .new_vert = MOD_SOLIDIFY_EMPTY_TAG,
+                  };
+                  add_index++;
+                  splits++;
+                  edges = MEM_malloc_arrayN(edges_len - (uint)last_split,
+                                            sizeof(*edges),
+                                            "edge_group split in solidify");
+                  memcpy(edges,
+                         g.edges + last_split,
+                         (edges_len - (uint)last_split) * sizeof(*edges));
+                  edge_groups[j + add_index] = (EdgeGroup){
+                      .valid = true,
+                      .edges = edges,
+                      .edges_len = (edges_len - (uint)last_split),
+                      .open_face_edge = MOD_SOLIDIFY_EMPTY_TAG,
+                      .is_orig_closed = g.is_orig_closed,
+                      .is_even_split = false,
+                      .split = add_index - prior_index + 1,
+                      .is_singularity = false,
+                      .topo_group = g.topo_group,
+                      .co = {0.0f, 0.0f, 0.0f},
+                      .no = {0.0f, 0.0f, 0.0f},
+                      .new_vert = MOD_SOLIDIFY_EMPTY_TAG,
+                  };
+                }
+                if (prior_splits != splits) {
+                  MEM_freeN(g.edges);
+                }
+              }
+              if (first_unique_end != -1 && prior_splits == splits) {
+                edge_groups[j + add_index].is_singularity = true;
+              }
+            }
+            MEM_freeN(doubles);
+          }
+        }
+      }
+    }
+
+    orig_vert_groups_arr[i] = edge_groups;
+  }
+}
+
 /* NOLINTNEXTLINE: readability-function-size */
 Mesh *MOD_solidify_nonmanifold_modifyMesh(ModifierData *md,
                                           const ModifierEvalContext *ctx,
@@ -207,7 +632,6 @@ Mesh *MOD_solidify_nonmanifold_modifyMesh(ModifierData *md,
   uint numNewLoops = 0;
   uint numNewPolys = 0;
 
-#define MOD_SOLIDIFY_EMPTY_TAG ((uint)-1)
 
   /* Calculate only face normals. */
   poly_nors = MEM_malloc_arrayN(numPolys, sizeof(*poly_nors), __func__);
@@ -897,466 +1321,87 @@ Mesh *MOD_solidify_nonmanifold_modifyMesh(ModifierData *md,
 
   /* Create sorted edge groups for every vert. */
   {
-    OldVertEdgeRef **adj_edges_ptr = vert_adj_edges;
-    for (uint i = 0; i < numVerts; i++, adj_edges_ptr++) {
-      if (*adj_edges_ptr != NULL && (*adj_edges_ptr)->edges_len >= 2) {
-        EdgeGroup *edge_groups;
-
-        int eg_index = -1;
-        bool contains_long_groups = false;
-        uint topo_groups = 0;
-
-        /* Initial sorted creation. */
-        {
-          const uint *adj_edges = (*adj_edges_ptr)->edges;
-          const uint tot_adj_edges = (*adj_edges_ptr)->edges_len;
-
-          uint unassigned_edges_len = 0;
-          for (uint j = 0; j < tot_adj_edges; j++) {
-            NewEdgeRef **new_edges = orig_edge_data_arr[adj_edges[j]];
-            /* TODO: check where the null pointer come from,
-             * because there should not be any... */
-            if (new_edges) {
-              /* count the number of new edges around the original vert */
-              while (*new_edges) {
-                unassigned_edges_len++;
-                new_edges++;
-              }
-            }
-          }
-          NewEdgeRef **unassigned_edges = MEM_malloc_arrayN(
-              unassigned_edges_len, sizeof(*unassigned_edges), "unassigned_edges in solidify");
-          for (uint j = 0, k = 0; j < tot_adj_edges; j++) {
-            NewEdgeRef **new_edges = orig_edge_data_arr[adj_edges[j]];
-            if (new_edges) {
-              while (*new_edges) {
-                unassigned_edges[k++] = *new_edges;
-                new_edges++;
-              }
-            }
-          }
+    EdgeGroupsCreateData data = {
+        .vert_adj_edges = vert_adj_edges,
+        .orig_edge_data_arr = orig_edge_data_arr,
+        .orig_vert_groups_arr = orig_vert_groups_arr,
+        .orig_medge = orig_medge,
+        .vm = vm,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (numVerts > 500);
+    BLI_task_parallel_range(0, (int)numVerts, &data, create_edge_groups_task_cb, &settings);
+  }
 
-          /* An edge group will always contain min 2 edges
-           * so max edge group count can be calculated. */
-          uint edge_groups_len = unassigned_edges_len / 2;
-          edge_groups = MEM_calloc_arrayN(
-              edge_groups_len + 1, sizeof(*edge_groups), "edge_groups in solidify");
-
-          uint assigned_edges_len = 0;
-          NewEdgeRef *found_edge = NULL;
-          uint found_edge_index = 0;
-          bool insert_at_start = false;
-          uint eg_capacity = 5;
-          NewFaceRef *eg_track_faces[2] = {NULL, NULL};
-          NewFaceRef *last_open_edge_track = NULL;
-
-          while (assigned_edges_len < unassigned_edges_len) {
-            found_edge = NULL;
-            insert_at_start = false;
-            if (eg_index >= 0 && edge_groups[eg_index].edges_len == 0) {
-              /* Called every time a new group was started in the last iteration. */
-              /* Find an unused edge to start the next group
-               * and setup variables to start creating it. */
-              uint j = 0;
-              NewEdgeRef *edge = NULL;
-              while (!edge && j < unassigned_edges_len) {
-                edge = unassigned_edges[j++];
-                if (edge && last_open_edge_track &&
-                    (edge->faces[0] != last_open_edge_track || edge->faces[1] != NULL)) {
-                  edge = NULL;
-                }
-              }
-              if (!edge && last_open_edge_track) {
-                topo_groups++;
-                last_open_edge_track = NULL;
-                edge_groups[eg_index].topo_group++;
-                j = 0;
-                while (!edge && j < unassigned_edges_len) {
-                  edge = unassigned_edges[j++];
-                }
-              }
-              else if (!last_open_edge_track && eg_index > 0) {
-                topo_groups++;
-                edge_groups[eg_index].topo_group++;
-              }
-              BLI_assert(edge != NULL);
-              found_edge_index = j - 1;
-              found_edge = edge;
-              if (!last_open_edge_track && vm[orig_medge[edge->old_edge].v1] == i) {
-                eg_track_faces[0] = edge->faces[0];
-                eg_track_faces[1] = edge->faces[1];
-                if (edge->faces[1] == NULL) {
-                  last_open_edge_track = edge->faces[0]->reversed ? edge->faces[0] - 1 :
-                                                                    edge->faces[0] + 1;
-                }
-              }
-              else {
-                eg_track_faces[0] = edge->faces[1];
-                eg_track_faces[1] = edge->faces[0];
-              }
-            }
-            else if (eg_index >= 0) {
-              NewEdgeRef **edge_ptr = unassigned_edges;
-              for (found_edge_index = 0; found_edge_index < unassigned_edges_len;
-                   found_edge_index++, edge_ptr++) {
-                if (*edge_ptr) {
-                  NewEdgeRef *edge = *edge_ptr;
-                  if (edge->faces[0] == eg_track_faces[1]) {
-                    insert_at_start = false;
-                    eg_track_faces[1] = edge->faces[1];
-                    found_edge = edge;
-                    if (edge->faces[1] == NULL) {
-                      edge_groups[eg_index].is_orig_closed = false;
-                      last_open_edge_track = edge->faces[0]->reversed ? edge->faces[0] - 1 :
-                                                                        edge->faces[0] + 1;
-                    }
-                    break;
-                  }
-                  if (edge->faces[0] == eg_track_faces[0]) {
-                    insert_at_start = true;
-                    eg_track_faces[0] = edge->faces[1];
-                    found_edge = edge;
-                    if (edge->faces[1] == NULL) {
-                      edge_groups[eg_index].is_orig_closed = false;
-                    }
-                    break;
-                  }
-                  if (edge->faces[1] != NULL) {
-                    if (edge->faces[1] == eg_track_faces[1]) {
-                      insert_at_start = false;
-                      eg_track_faces[1] = edge->faces[0];
-                      found_edge = edge;
-                      break;
-                    }
-                    if (edge->faces[1] == eg_track_faces[0]) {
-                      insert_at_start = true;
-                      eg_track_faces[0] = edge->faces[0];
-                      found_edge = edge;
-                      break;
-                    }
-                  }
-                }
-              }
-            }
-            if (found_edge) {
-              unassigned_edges[found_edge_index] = NULL;
-              assigned_edges_len++;
-              const uint needed_capacity = edge_groups[eg_index].edges_len + 1;
-              if (needed_capacity > eg_capacity) {
-                eg_capacity = needed_capacity + 1;
-                NewEdgeRef **new_eg = MEM_calloc_arrayN(
-                    eg_capacity, sizeof(*new_eg), "edge_group realloc in solidify");
-                if (insert_at_start) {
-                  memcpy(new_eg + 1,
-                         edge_groups[eg_index].edges,
-                         edge_groups[eg_index].edges_len * sizeof(*new_eg));
-                }
-                else {
-                  memcpy(new_eg,
-                         edge_groups[eg_index].edges,
-                         edge_groups[eg_index].edges_len * sizeof(*new_eg));
-                }
-                MEM_freeN(edge_groups[eg_index].edges);
-                edge_groups[eg_index].edges = new_eg;
-              }
-              else if (insert_at_start) {
-                memmove(edge_groups[eg_index].edges + 1,
-                        edge_groups[eg_index].edges,
-                        edge_groups[eg_index].edges_len * sizeof(*edge_groups[eg_index].edges));
-              }
-              edge_groups[eg_index].edges[insert_at_start ? 0 : edge_groups[eg_index].edges_len] =
-                  found_edge;
-              edge_groups[eg_index].edges_len++;
-              if (edge_groups[eg_index].edges[edge_groups[eg_index].edges_len - 1]->faces[1] !=
-                  NULL) {
-                last_open_edge_track = NULL;
-              }
-              if (edge_groups[eg_index].edges_len > 3) {
-                contains_long_groups = true;
-              }
-            }
-            else {
-              /* called on first iteration to clean up the eg_index = -1 and start the first group,
-               * or when the current group is found to be complete (no new found_edge) */
-              eg_index++;
-              BLI_assert(eg_index < edge_groups_len);
-              eg_capacity = 5;
-              NewEdgeRef **edges = MEM_calloc_arrayN(
-                  eg_capacity, sizeof(*edges), "edge_group in solidify");
-              edge_groups[eg_index] = (EdgeGroup){
-                  .valid = true,
-                  .edges = edges,
-                  .edges_len = 0,
-                  .open_face_edge = MOD_SOLIDIFY_EMPTY_TAG,
-                  .is_orig_closed = true,
-                  .is_even_split = false,
-                  .split = 0,
-                  .is_singularity = false,
-                  .topo_group = topo_groups,
-                  .co = {0.0f, 0.0f, 0.0f},
-                  .no = {0.0f, 0.0f, 0.0f},
-                  .new_vert = MOD_SOLIDIFY_EMPTY_TAG,
-              };
-              eg_track_faces[0] = NULL;
-              eg_track_faces[1] = NULL;
-            }
+  /* Count new edges, loops, polys and add to link_edge_groups. This pass
+   * assigns the indices of the new verts, so it stays serial to keep the
+   * result deterministic no matter how the group creation tasks were
+   * scheduled. */
+  {
+    EdgeGroup **gs_p = orig_vert_groups_arr;
+    for (uint i = 0; i < numVerts; i++, gs_p++) {
+      if (*gs_p) {
+        EdgeGroup *edge_groups = *gs_p;
+        uint new_verts = 0;
+        bool contains_open_splits = false;
+        uint open_edges = 0;
+        uint contains_splits = 0;
+        uint last_added = 0;
+        uint first_added = 0;
+        bool first_set = false;
+        for (EdgeGroup *g = edge_groups; g->valid; g++) {
+          has_singularities |= g->is_singularity;
+          NewEdgeRef **e = g->edges;
+          for (uint j = 0; j < g->edges_len; j++, e++) {
+            const uint flip = (uint)(vm[orig_medge[(*e)->old_edge].v2] == i);
+            BLI_assert(flip || vm[orig_medge[(*e)->old_edge].v1] == i);
+            (*e)->link_edge_groups[flip] = g;
           }
-          /* #eg_index is the number of groups from here on. */
-          eg_index++;
-          /* #topo_groups is the number of topo groups from here on. */
-          topo_groups++;
-
-          MEM_freeN(unassigned_edges);
-
-          /* TODO: reshape the edge_groups array to its actual size
-           * after writing is finished to save on memory. */
-        }
-
-        /* Split of long self intersection groups */
-        {
-          uint splits = 0;
-          if (contains_long_groups) {
-            uint add_index = 0;
-            for (uint j = 0; j < eg_index; j++) {
-              const uint edges_len = edge_groups[j + add_index].edges_len;
-              if (edges_len > 3) {
-                bool has_doubles = false;
-                bool *doubles = MEM_calloc_arrayN(
-                    edges_len, sizeof(*doubles), "doubles in solidify");
-                EdgeGroup g = edge_groups[j + add_index];
-                for (uint k = 0; k < edges_len; k++) {
-                  for (uint l = k + 1; l < edges_len; l++) {
-                    if (g.edges[k]->old_edge == g.edges[l]->old_edge) {
-                      doubles[k] = true;
-                      doubles[l] = true;
-                      has_doubles = true;
-                    }
-                  }
-                }
-                if (has_doubles) {
-                  const uint prior_splits = splits;
-                  const uint prior_index = add_index;
-                  int unique_start = -1;
-                  int first_unique_end = -1;
-                  int last_split = -1;
-                  int first_split = -1;
-                  bool first_even_split = false;
-                  uint real_k = 0;
-                  while (real_k < edges_len ||
-                         (g.is_orig_closed &&
-                          (real_k <=
-                               (first_unique_end == -1 ? 0 : first_unique_end) + (int)edges_len ||
-                           first_split != last_split))) {
-                    const uint k = real_k % edges_len;
-                    if (!doubles[k]) {
-                      if (first_unique_end != -1 && unique_start == -1) {
-                        unique_start = (int)real_k;
-                      }
-                    }
-                    else if (first_unique_end == -1) {
-                      first_unique_end = (int)k;
-                    }
-                    else if (unique_start != -1) {
-                      const uint split = (((uint)unique_start + real_k + 1) / 2) % edges_len;
-                      const bool is_even_split = (((uint)unique_start + real_k) & 1);
-                      if (last_split != -1) {
-                        /* Override g on first split (no insert). */
-                        if (prior_splits != splits) {
-                          memmove(edge_groups + j + add_index + 1,
-                                  edge_groups + j + add_index,
-                                  ((uint)eg_index - j) * sizeof(*edge_groups));
-                          add_index++;
-                        }
-                        if (last_split > split) {
-                          const uint size = (split + edges_len) - (uint)last_split;
-                          NewEdgeRef **edges = MEM_malloc_arrayN(
-                              size, sizeof(*edges), "edge_group split in solidify");
-                          memcpy(edges,
-                                 g.edges + last_split,
-                                 (edges_len - (uint)last_split) * sizeof(*edges));
-                          memcpy(edges + (edges_len - (uint)last_split),
-                                 g.edges,
-                                 split * sizeof(*edges));
-                          edge_groups[j + add_index] = (EdgeGroup){
-                              .valid = true,
-                              .edges = edges,
-                              .edges_len = size,
-                              .open_face_edge = MOD_SOLIDIFY_EMPTY_TAG,
-                              .is_orig_closed = g.is_orig_closed,
-                              .is_even_split = is_even_split,
-                              .split = add_index - prior_index + 1 + (uint)!g.is_orig_closed,
-                              .is_singularity = false,
-                              .topo_group = g.topo_group,
-                              .co = {0.0f, 0.0f, 0.0f},
-                              .no = {0.0f, 0.0f, 0.0f},
-                              .new_vert = MOD_SOLIDIFY_EMPTY_TAG,
-                          };
-                        }
-                        else {
-                          const uint size = split - (uint)last_split;
-                          NewEdgeRef **edges = MEM_malloc_arrayN(
-                              size, sizeof(*edges), "edge_group split in solidify");
-                          memcpy(edges, g.edges + last_split, size * sizeof(*edges));
-                          edge_groups[j + add_index] = (EdgeGroup){
-                              .valid = true,
-                              .edges = edges,
-                              .edges_len = size,
-                              .open_face_edge = MOD_SOLIDIFY_EMPTY_TAG,
-                              .is_orig_closed = g.is_orig_closed,
-                              .is_even_split = is_even_split,
-                              .split = add_index - prior_index + 1 + (uint)!g.is_orig_closed,
-                              .is_singularity = false,
-                              .topo_group = g.topo_group,
-                              .co = {0.0f, 0.0f, 0.0f},
-                              .no = {0.0f, 0.0f, 0.0f},
-                              .new_vert = MOD_SOLIDIFY_EMPTY_TAG,
-                          };
-                        }
-                        splits++;
-                      }
-                      last_split = (int)split;
-                      if (first_split == -1) {
-                        first_split = (int)split;
-                        first_even_split = is_even_split;
-                      }
-                      unique_start = -1;
-                    }
-                    real_k++;
-                  }
-                  if (first_split != -1) {
-                    if (!g.is_orig_closed) {
-                      if (prior_splits != splits) {
-                        memmove(edge_groups + (j + prior_index + 1),
-                                edge_groups + (j + prior_index),
-                                ((uint)eg_index + add_index - (j + prior_index)) *
-                                    sizeof(*edge_groups));
-                        memmove(edge_groups + (j + add_index + 2),
-                                edge_groups + (j + add_index + 1),
-                                ((uint)eg_index - j) * sizeof(*edge_groups));
-                        add_index++;
-                      }
-                      else {
-                        memmove(edge_groups + (j + add_index + 2),
-                                edge_groups + (j + add_index + 1),
-                                ((uint)eg_index - j - 1) * sizeof(*edge_groups));
-                      }
-                      NewEdgeRef **edges = MEM_malloc_arrayN(
-                          (uint)first_split, sizeof(*edges), "edge_group split in solidify");
-                      memcpy(edges, g.edges, (uint)first_split * sizeof(*edges));
-                      edge_groups[j + prior_index] = (EdgeGroup){
-                          .valid = true,
-                          .edges = edges,
-                          .edges_len = (uint)first_split,
-                          .open_face_edge = MOD_SOLIDIFY_EMPTY_TAG,
-                          .is_orig_closed = g.is_orig_closed,
-                          .is_even_split = first_even_split,
-                          .split = 1,
-                          .is_singularity = false,
-                          .topo_group = g.topo_group,
-                          .co = {0.0f, 0.0f, 0.0f},
-                          .no = {0.0f, 0.0f, 0.0f},
-                          .new_vert = MOD_SOLIDIFY_EMPTY_TAG,
-                      };
-                      add_index++;
-                      splits++;
-                      edges = MEM_malloc_arrayN(edges_len - (uint)last_split,
-                                                sizeof(*edges),
-                                                "edge_group split in solidify");
-                      memcpy(edges,
-                             g.edges + last_split,
-                             (edges_len - (uint)last_split) * sizeof(*edges));
-                      edge_groups[j + add_index] = (EdgeGroup){
-                          .valid = true,
-                          .edges = edges,
-                          .edges_len = (edges_len - (uint)last_split),
-                          .open_face_edge = MOD_SOLIDIFY_EMPTY_TAG,
-                          .is_orig_closed = g.is_orig_closed,
-                          .is_even_split = false,
-                          .split = add_index - prior_index + 1,
-                          .is_singularity = false,
-                          .topo_group = g.topo_group,
-                          .co = {0.0f, 0.0f, 0.0f},
-                          .no = {0.0f, 0.0f, 0.0f},
-                          .new_vert = MOD_SOLIDIFY_EMPTY_TAG,
-                      };
-                    }
-                    if (prior_splits != splits) {
-                      MEM_freeN(g.edges);
-                    }
-                  }
-                  if (first_unique_end != -1 && prior_splits == splits) {
-                    has_singularities = true;
-                    edge_groups[j + add_index].is_singularity = true;
-                  }
-                }
-                MEM_freeN(doubles);
-              }
+          uint added = 0;
+          if (do_shell || (do_rim && !g->is_orig_closed)) {
+            BLI_assert(g->new_vert == MOD_SOLIDIFY_EMPTY_TAG);
+            g->new_vert = numNewVerts++;
+            if (do_rim || (do_shell && g->split)) {
+              new_verts++;
+              contains_splits += (g->split != 0);
+              contains_open_splits |= g->split && !g->is_orig_closed;
+              added = g->split;
             }
           }
-        }
-
-        orig_vert_groups_arr[i] = edge_groups;
-        /* Count new edges, loops, polys and add to link_edge_groups. */
-        {
-          uint new_verts = 0;
-          bool contains_open_splits = false;
-          uint open_edges = 0;
-          uint contains_splits = 0;
-          uint last_added = 0;
-          uint first_added = 0;
-          bool first_set = false;
-          for (EdgeGroup *g = edge_groups; g->valid; g++) {
-            NewEdgeRef **e = g->edges;
-            for (uint j = 0; j < g->edges_len; j++, e++) {
-              const uint flip = (uint)(vm[orig_medge[(*e)->old_edge].v2] == i);
-              BLI_assert(flip || vm[orig_medge[(*e)->old_edge].v1] == i);
-              (*e)->link_edge_groups[flip] = g;
-            }
-            uint added = 0;
-            if (do_shell || (do_rim && !g->is_orig_closed)) {
-              BLI_assert(g->new_vert == MOD_SOLIDIFY_EMPTY_TAG);
-              g->new_vert = numNewVerts++;
-              if (do_rim || (do_shell && g->split)) {
-                new_verts++;
-                contains_splits += (g->split != 0);
-                contains_open_splits |= g->split && !g->is_orig_closed;
-                added = g->split;
-              }
-            }
-            open_edges += (uint)(added < last_added);
-            if (!first_set) {
-              first_set = true;
-              first_added = added;
-            }
-            last_added = added;
-            if (!(g + 1)->valid || g->topo_group != (g + 1)->topo_group) {
-              if (new_verts > 2) {
-                numNewPolys++;
-                numNewEdges += new_verts;
-                open_edges += (uint)(first_added < last_added);
-                open_edges -= (uint)(open_edges && !contains_open_splits);
-                if (do_shell && do_rim) {
-                  numNewLoops += new_verts * 2;
-                }
-                else if (do_shell) {
-                  numNewLoops += new_verts * 2 - open_edges;
-                }
-                else {  // do_rim
-                  numNewLoops += new_verts * 2 + open_edges - contains_splits;
-                }
-              }
-              else if (new_verts == 2) {
-                numNewEdges++;
-                numNewLoops += 2u - (uint)(!(do_rim && do_shell) && contains_open_splits);
-              }
-              new_verts = 0;
-              contains_open_splits = false;
-              contains_splits = 0;
-              open_edges = 0;
-              last_added = 0;
-              first_added = 0;
-              first_set = false;
-            }
+          open_edges += (uint)(added < last_added);
+          if (!first_set) {
+            first_set = true;
+            first_added = added;
+          }
+          last_added = added;
+          if (!(g + 1)->valid || g->topo_group != (g + 1)->topo_group) {
+            if (new_verts > 2) {
+              numNewPolys++;
+              numNewEdges += new_verts;
+              open_edges += (uint)(first_added < last_added);
+              open_edges -= (uint)(open_edges && !contains_open_splits);
+              if (do_shell && do_rim) {
+                numNewLoops += new_verts * 2;
+              }
+              else if (do_shell) {
+                numNewLoops += new_verts * 2 - open_edges;
+              }
+              else {  // do_rim
+                numNewLoops += new_verts * 2 + open_edges - contains_splits;
+              }
+            }
+            else if (new_verts == 2) {
+              numNewEdges++;
+              numNewLoops += 2u - (uint)(!(do_rim && do_shell) && contains_open_splits);
+            }
+            new_verts = 0;
+            contains_open_splits = false;
+            contains_splits = 0;
+            open_edges = 0;
+            last_added = 0;
+            first_added = 0;
+            first_set = false;
           }
         }
       }
@@ -30,6 +30,8 @@
  * necessary information.
  */
 
+#include <chrono>
+
 #include "BLI_enumerable_thread_specific.hh"
 #include "BLI_function_ref.hh"
 #include "BLI_linear_allocator.hh"
@@ -143,6 +145,11 @@ struct NodeWithWarning {
   NodeWarning warning;
 };
 
+struct NodeWithExecutionTime {
+  DNode node;
+  std::chrono::microseconds exec_time;
+};
+
 /** The same value can be referenced by multiple sockets when they are linked. */
 struct ValueOfSockets {
   Span<DSocket> sockets;
@@ -163,6 +170,7 @@ class LocalGeoLogger {
   std::unique_ptr<LinearAllocator<>> allocator_;
   Vector<ValueOfSockets> values_;
   Vector<NodeWithWarning> node_warnings_;
+  Vector<NodeWithExecutionTime> node_exec_times_;
 
   friend ModifierLog;
 
@@ -175,6 +183,7 @@ class LocalGeoLogger {
   void log_value_for_sockets(Span<DSocket> sockets, GPointer value);
   void log_multi_value_socket(DSocket socket, Span<GPointer> values);
   void log_node_warning(DNode node, NodeWarningType type, std::string message);
+  void log_execution_time(DNode node, std::chrono::microseconds exec_time);
 };
 
 /** The root logger class. */
@@ -231,6 +240,9 @@ class NodeLog {
   Vector<SocketLog> input_logs_;
   Vector<SocketLog> output_logs_;
   Vector<NodeWarning, 0> warnings_;
+  /* Time spent in all executions of this node. Lazy nodes can be executed more than once per
+   * evaluation, in which case the individual times are summed up. */
+  std::chrono::microseconds exec_time_{0};
 
   friend ModifierLog;
 
@@ -253,6 +265,11 @@ class NodeLog {
     return warnings_;
   }
 
+  std::chrono::microseconds execution_time() const
+  {
+    return exec_time_;
+  }
+
   Vector<const GeometryAttributeInfo *> lookup_available_attributes() const;
 };
 
@@ -34,20 +34,6 @@ static void geo_node_curve_endpoints_declare(NodeDeclarationBuilder &b)
   b.add_output<decl::Geometry>("End Points");
 }
 
-/**
- * Evaluate splines in parallel to speed up the rest of the node's execution.
- */
-static void evaluate_splines(Span<SplinePtr> splines)
-{
-  threading::parallel_for_each(splines, [](const SplinePtr &spline) {
-    /* These functions fill the corresponding caches on each spline. */
-    spline->evaluated_positions();
-    spline->evaluated_tangents();
-    spline->evaluated_normals();
-    spline->evaluated_lengths();
-  });
-}
-
 /**
  * \note Use attributes from the curve component rather than the attribute data directly on the
  * attribute storage to allow reading the virtual spline attributes like "cyclic" and "resolution".
@@ -161,7 +147,8 @@ static void geo_node_curve_endpoints_exec(GeoNodeExecParams params)
   const Span<SplinePtr> splines = curve.splines();
   curve.assert_valid_point_attributes();
 
-  evaluate_splines(splines);
+  /* Evaluate splines in parallel to speed up the rest of the node's execution. */
+  curve.ensure_evaluation_cache();
 
   const Vector<int> offsets = get_endpoint_spline_offsets(splines);
   const int total_size = offsets.size();
@@ -62,20 +62,6 @@ static void geo_node_curve_to_points_update(bNodeTree *UNUSED(ntree), bNode *nod
   nodeSetSocketAvailability(length_socket, mode == GEO_NODE_CURVE_SAMPLE_LENGTH);
 }
 
-/**
- * Evaluate splines in parallel to speed up the rest of the node's execution.
- */
-static void evaluate_splines(Span<SplinePtr> splines)
-{
-  threading::parallel_for_each(splines, [](const SplinePtr &spline) {
-    /* These functions fill the corresponding caches on each spline. */
-    spline->evaluated_positions();
-    spline->evaluated_tangents();
-    spline->evaluated_normals();
-    spline->evaluated_lengths();
-  });
-}
-
 static Array<int> calculate_spline_point_offsets(GeoNodeExecParams &params,
                                                  const GeometryNodeCurveSampleMode mode,
                                                  const CurveEval &curve,
@@ -314,7 +300,8 @@ static void geo_node_curve_to_points_exec(GeoNodeExecParams params)
   const Span<SplinePtr> splines = curve.splines();
   curve.assert_valid_point_attributes();
 
-  evaluate_splines(splines);
+  /* Evaluate splines in parallel to speed up the rest of the node's execution. */
+  curve.ensure_evaluation_cache();
 
   const Array<int> offsets = calculate_spline_point_offsets(params, mode, curve, splines);
   const int total_size = offsets.last();
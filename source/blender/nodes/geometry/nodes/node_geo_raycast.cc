@@ -16,6 +16,8 @@
 
 #include "DNA_mesh_types.h"
 
+#include "BLI_task.hh"
+
 #include "BKE_bvhutils.h"
 #include "BKE_mesh_sample.hh"
 
@@ -101,56 +103,60 @@ static void raycast_to_mesh(const Mesh &mesh,
     return;
   }
 
-  for (const int i : ray_origins.index_range()) {
-    const float ray_length = ray_lengths[i];
-    const float3 ray_origin = ray_origins[i];
-    const float3 ray_direction = ray_directions[i].normalized();
-
-    BVHTreeRayHit hit;
-    hit.index = -1;
-    hit.dist = ray_length;
-    if (BLI_bvhtree_ray_cast(tree_data.tree,
-                             ray_origin,
-                             ray_direction,
-                             0.0f,
-                             &hit,
-                             tree_data.raycast_callback,
-                             &tree_data) != -1) {
-      if (!r_hit.is_empty()) {
-        r_hit[i] = hit.index >= 0;
-      }
-      if (!r_hit_indices.is_empty()) {
-        /* Index should always be a valid looptri index, use 0 when hit failed. */
-        r_hit_indices[i] = max_ii(hit.index, 0);
-      }
-      if (!r_hit_positions.is_empty()) {
-        r_hit_positions[i] = hit.co;
+  /* The tree is only read during the ray casts, so the rays can be resolved from multiple
+   * threads. */
+  threading::parallel_for(ray_origins.index_range(), 512, [&](IndexRange range) {
+    for (const int i : range) {
+      const float ray_length = ray_lengths[i];
+      const float3 ray_origin = ray_origins[i];
+      const float3 ray_direction = ray_directions[i].normalized();
+
+      BVHTreeRayHit hit;
+      hit.index = -1;
+      hit.dist = ray_length;
+      if (BLI_bvhtree_ray_cast(tree_data.tree,
+                               ray_origin,
+                               ray_direction,
+                               0.0f,
+                               &hit,
+                               tree_data.raycast_callback,
+                               &tree_data) != -1) {
+        if (!r_hit.is_empty()) {
+          r_hit[i] = hit.index >= 0;
+        }
+        if (!r_hit_indices.is_empty()) {
+          /* Index should always be a valid looptri index, use 0 when hit failed. */
+          r_hit_indices[i] = max_ii(hit.index, 0);
+        }
+        if (!r_hit_positions.is_empty()) {
+          r_hit_positions[i] = hit.co;
+        }
+        if (!r_hit_normals.is_empty()) {
+          r_hit_normals[i] = hit.no;
+        }
+        if (!r_hit_distances.is_empty()) {
+          r_hit_distances[i] = hit.dist;
+        }
       }
-      if (!r_hit_normals.is_empty()) {
-        r_hit_normals[i] = hit.no;
-      }
-      if (!r_hit_distances.is_empty()) {
-        r_hit_distances[i] = hit.dist;
+      else {
+        if (!r_hit.is_empty()) {
+          r_hit[i] = false;
+        }
+        if (!r_hit_indices.is_empty()) {
+          r_hit_indices[i] = 0;
+        }
+        if (!r_hit_positions.is_empty()) {
+          r_hit_positions[i] = float3(0.0f, 0.0f, 0.0f);
+        }
+        if (!r_hit_normals.is_empty()) {
+          r_hit_normals[i] = float3(0.0f, 0.0f, 0.0f);
+        }
+        if (!r_hit_distances.is_empty()) {
+          r_hit_distances[i] = ray_length;
+        }
       }
     }
-    else {
-      if (!r_hit.is_empty()) {
-        r_hit[i] = false;
-      }
-      if (!r_hit_indices.is_empty()) {
-        r_hit_indices[i] = 0;
-      }
-      if (!r_hit_positions.is_empty()) {
-        r_hit_positions[i] = float3(0.0f, 0.0f, 0.0f);
-      }
-      if (!r_hit_normals.is_empty()) {
-        r_hit_normals[i] = float3(0.0f, 0.0f, 0.0f);
-      }
-      if (!r_hit_distances.is_empty()) {
-        r_hit_distances[i] = ray_length;
-      }
-    }
-  }
+  });
 
   free_bvhtree_from_mesh(&tree_data);
 }
@@ -273,6 +273,25 @@ class GVArray_For_ConvertedGVArray : public GVArray {
     old_to_new_conversions_.convert_single_to_uninitialized(buffer, r_value);
     from_type_.destruct(buffer);
   }
+
+  void materialize_impl(const IndexMask mask, void *dst) const override
+  {
+    this->type().destruct_indices(dst, mask);
+    this->materialize_to_uninitialized_impl(mask, dst);
+  }
+
+  void materialize_to_uninitialized_impl(const IndexMask mask, void *dst) const override
+  {
+    /* Convert the whole batch with the conversion multi-function, which runs as a tight
+     * devirtualized loop, instead of going through the virtual array element by element. */
+    const fn::MultiFunction &fn = *old_to_new_conversions_.multi_function;
+    fn::MFParamsBuilder params{fn, mask.min_array_size()};
+    params.add_readonly_single_input(*varray_);
+    params.add_uninitialized_single_output(
+        fn::GMutableSpan(this->type(), dst, mask.min_array_size()));
+    fn::MFContextBuilder context;
+    fn.call(mask, params, context);
+  }
 };
 
 class GVMutableArray_For_ConvertedGVMutableArray : public GVMutableArray {
@@ -317,6 +336,25 @@ class GVMutableArray_For_ConvertedGVMutableArray : public GVMutableArray {
     new_to_old_conversions_.convert_single_to_uninitialized(value, buffer);
     varray_->set_by_relocate(index, buffer);
   }
+
+  void materialize_impl(const IndexMask mask, void *dst) const override
+  {
+    this->type().destruct_indices(dst, mask);
+    this->materialize_to_uninitialized_impl(mask, dst);
+  }
+
+  void materialize_to_uninitialized_impl(const IndexMask mask, void *dst) const override
+  {
+    /* Convert the whole batch with the conversion multi-function, which runs as a tight
+     * devirtualized loop, instead of going through the virtual array element by element. */
+    const fn::MultiFunction &fn = *old_to_new_conversions_.multi_function;
+    fn::MFParamsBuilder params{fn, mask.min_array_size()};
+    params.add_readonly_single_input(*varray_);
+    params.add_uninitialized_single_output(
+        fn::GMutableSpan(this->type(), dst, mask.min_array_size()));
+    fn::MFContextBuilder context;
+    fn.call(mask, params, context);
+  }
 };
 
 fn::GVArrayPtr DataTypeConversions::try_convert(fn::GVArrayPtr varray,
@@ -5196,6 +5196,36 @@ static bool foreach_compat_buffer(RawPropertyType raw_type, int attr_signed, con
   return 0;
 }
 
+/**
+ * The raw type described by a buffer's format, for buffers whose element type does not match the
+ * property exactly. #rna_raw_access converts between raw types, which is still much faster than
+ * the per-element Python fallback. Returns #PROP_RAW_UNSET for unsupported formats.
+ */
+static RawPropertyType foreach_raw_type_from_buffer(const char *format, Py_ssize_t itemsize)
+{
+  const char f = format ? *format : 'B'; /* B is assumed when not set */
+
+  switch (f) {
+    case 'b':
+      return (itemsize == sizeof(char)) ? PROP_RAW_CHAR : PROP_RAW_UNSET;
+    case 'h':
+      return (itemsize == sizeof(short)) ? PROP_RAW_SHORT : PROP_RAW_UNSET;
+    case 'i':
+    case 'l':
+    case 'q':
+      /* 'l'/'q' size is platform dependent, only accept 'int' sized elements. */
+      return (itemsize == sizeof(int)) ? PROP_RAW_INT : PROP_RAW_UNSET;
+    case '?':
+      return (itemsize == sizeof(bool)) ? PROP_RAW_BOOLEAN : PROP_RAW_UNSET;
+    case 'f':
+      return (itemsize == sizeof(float)) ? PROP_RAW_FLOAT : PROP_RAW_UNSET;
+    case 'd':
+      return (itemsize == sizeof(double)) ? PROP_RAW_DOUBLE : PROP_RAW_UNSET;
+    default:
+      return PROP_RAW_UNSET;
+  }
+}
+
 static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
 {
   PyObject *item = NULL;
@@ -5233,6 +5263,16 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
         ok = RNA_property_collection_raw_set(
             NULL, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
       }
+      else {
+        /* A buffer of another supported type (e.g. a double precision NumPy array for a float
+         * property): pass its own raw type so the conversion happens in C. */
+        const RawPropertyType buf_type = foreach_raw_type_from_buffer(buf.format, buf.itemsize);
+        if (buf_type != PROP_RAW_UNSET) {
+          ok = RNA_property_collection_raw_set(
+              NULL, &self->ptr, self->prop, attr, buf.buf, buf_type, tot);
+          buffer_is_compat = true;
+        }
+      }
 
       PyBuffer_Release(&buf);
     }
@@ -5289,6 +5329,15 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
         ok = RNA_property_collection_raw_get(
             NULL, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
       }
+      else {
+        /* See foreach_set(), the values are converted to the buffer's own type in C. */
+        const RawPropertyType buf_type = foreach_raw_type_from_buffer(buf.format, buf.itemsize);
+        if (buf_type != PROP_RAW_UNSET) {
+          ok = RNA_property_collection_raw_get(
+              NULL, &self->ptr, self->prop, attr, buf.buf, buf_type, tot);
+          buffer_is_compat = true;
+        }
+      }
 
       PyBuffer_Release(&buf);
     }
@@ -303,8 +303,10 @@ const char *RE_GetActiveRenderView(struct Render *re);
 /* error reporting */
 void RE_SetReports(struct Render *re, struct ReportList *reports);
 
-/* main preview render call */
-void RE_PreviewRender(struct Render *re, struct Main *bmain, struct Scene *scene);
+/* Main preview render call. When `keep_engine` is true the engine (with its depsgraph) stays
+ * alive for the next preview render; free it with #RE_PreviewRenderFreeEngine when done. */
+void RE_PreviewRender(struct Render *re, struct Main *bmain, struct Scene *scene, bool keep_engine);
+void RE_PreviewRenderFreeEngine(struct Render *re);
 
 bool RE_ReadRenderResult(struct Scene *scene, struct Scene *scenode);
 bool RE_WriteRenderResult(struct ReportList *reports,
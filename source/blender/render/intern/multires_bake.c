@@ -366,22 +366,26 @@ typedef struct MultiresBakeThread {
   float height_min, height_max;
 } MultiresBakeThread;
 
-static int multires_bake_queue_next_tri(MultiresBakeQueue *queue)
-{
-  int face = -1;
+/* Triangles are handed out in small consecutive batches: this keeps spin-lock contention down
+ * and gives every thread neighboring faces, which share grid data in CPU caches. */
+#define MULTIRES_BAKE_TRI_BATCH 32
 
-  /* TODO: it could worth making it so thread will handle neighbor faces
-   *       for better memory cache utilization
-   */
+static int multires_bake_queue_next_tri_batch(MultiresBakeQueue *queue, int *r_tri_count)
+{
+  int tri_first = -1;
 
   BLI_spin_lock(&queue->spin);
   if (queue->cur_tri < queue->tot_tri) {
-    face = queue->cur_tri;
-    queue->cur_tri++;
+    tri_first = queue->cur_tri;
+    *r_tri_count = min_ii(MULTIRES_BAKE_TRI_BATCH, queue->tot_tri - tri_first);
+    queue->cur_tri += *r_tri_count;
+  }
+  else {
+    *r_tri_count = 0;
   }
   BLI_spin_unlock(&queue->spin);
 
-  return face;
+  return tri_first;
 }
 
 static void *do_multires_bake_thread(void *data_v)
@@ -390,49 +394,58 @@ static void *do_multires_bake_thread(void *data_v)
   MResolvePixelData *data = &handle->data;
   MBakeRast *bake_rast = &handle->bake_rast;
   MultiresBakeRender *bkr = handle->bkr;
-  int tri_index;
+  int tri_first, tri_count;
 
-  while ((tri_index = multires_bake_queue_next_tri(handle->queue)) >= 0) {
-    const MLoopTri *lt = &data->mlooptri[tri_index];
-    const MPoly *mp = &data->mpoly[lt->poly];
-    const short mat_nr = mp->mat_nr;
-    const MLoopUV *mloopuv = data->mloopuv;
+  while ((tri_first = multires_bake_queue_next_tri_batch(handle->queue, &tri_count)) >= 0) {
+    int baked_count = 0;
 
-    if (multiresbake_test_break(bkr)) {
-      break;
-    }
+    for (int t = 0; t < tri_count; t++) {
+      const int tri_index = tri_first + t;
+      const MLoopTri *lt = &data->mlooptri[tri_index];
+      const MPoly *mp = &data->mpoly[lt->poly];
+      const short mat_nr = mp->mat_nr;
+      const MLoopUV *mloopuv = data->mloopuv;
 
-    Image *tri_image = mat_nr < bkr->ob_image.len ? bkr->ob_image.array[mat_nr] : NULL;
-    if (tri_image != handle->image) {
-      continue;
-    }
+      if (multiresbake_test_break(bkr)) {
+        return NULL;
+      }
 
-    data->tri_index = tri_index;
+      Image *tri_image = mat_nr < bkr->ob_image.len ? bkr->ob_image.array[mat_nr] : NULL;
+      if (tri_image != handle->image) {
+        continue;
+      }
 
-    bake_rasterize(
-        bake_rast, mloopuv[lt->tri[0]].uv, mloopuv[lt->tri[1]].uv, mloopuv[lt->tri[2]].uv);
+      data->tri_index = tri_index;
 
-    /* tag image buffer for refresh */
-    if (data->ibuf->rect_float) {
-      data->ibuf->userflags |= IB_RECT_INVALID;
-    }
+      bake_rasterize(
+          bake_rast, mloopuv[lt->tri[0]].uv, mloopuv[lt->tri[1]].uv, mloopuv[lt->tri[2]].uv);
 
-    data->ibuf->userflags |= IB_DISPLAY_BUFFER_INVALID;
+      /* tag image buffer for refresh */
+      if (data->ibuf->rect_float) {
+        data->ibuf->userflags |= IB_RECT_INVALID;
+      }
 
-    /* update progress */
-    BLI_spin_lock(&handle->queue->spin);
-    bkr->baked_faces++;
+      data->ibuf->userflags |= IB_DISPLAY_BUFFER_INVALID;
 
-    if (bkr->do_update) {
-      *bkr->do_update = true;
+      baked_count++;
     }
 
-    if (bkr->progress) {
-      *bkr->progress = ((float)bkr->baked_objects +
-                        (float)bkr->baked_faces / handle->queue->tot_tri) /
-                       bkr->tot_obj;
+    if (baked_count != 0) {
+      /* update progress */
+      BLI_spin_lock(&handle->queue->spin);
+      bkr->baked_faces += baked_count;
+
+      if (bkr->do_update) {
+        *bkr->do_update = true;
+      }
+
+      if (bkr->progress) {
+        *bkr->progress = ((float)bkr->baked_objects +
+                          (float)bkr->baked_faces / handle->queue->tot_tri) /
+                         bkr->tot_obj;
+      }
+      BLI_spin_unlock(&handle->queue->spin);
     }
-    BLI_spin_unlock(&handle->queue->spin);
   }
 
   return NULL;
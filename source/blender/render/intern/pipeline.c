@@ -625,12 +625,23 @@ void RE_InitRenderCB(Render *re)
   re->dih = re->dch = re->duh = re->sdh = re->prh = re->tbh = NULL;
 }
 
+/* Free the depsgraph used by the render pipeline, if created. */
+static void render_pipeline_depsgraph_free(Render *re)
+{
+  if (re->pipeline_depsgraph != NULL) {
+    DEG_graph_free(re->pipeline_depsgraph);
+    re->pipeline_depsgraph = NULL;
+    re->pipeline_scene_eval = NULL;
+  }
+}
+
 /* only call this while you know it will remove the link too */
 void RE_FreeRender(Render *re)
 {
   if (re->engine) {
     RE_engine_free(re->engine);
   }
+  render_pipeline_depsgraph_free(re);
 
   BLI_rw_mutex_end(&re->resultmutex);
   BLI_rw_mutex_end(&re->partsmutex);
@@ -692,16 +703,21 @@ void RE_FreeAllPersistentData(void)
       RE_engine_free(re->engine);
       re->engine = NULL;
     }
+    render_pipeline_depsgraph_free(re);
   }
 }
 
 static void re_free_persistent_data(Render *re)
 {
   /* If engine is currently rendering, just wait for it to be freed when it finishes rendering. */
-  if (re->engine && !(re->engine->flag & RE_ENGINE_RENDERING)) {
+  if (re->engine && (re->engine->flag & RE_ENGINE_RENDERING)) {
+    return;
+  }
+  if (re->engine) {
     RE_engine_free(re->engine);
     re->engine = NULL;
   }
+  render_pipeline_depsgraph_free(re);
 }
 
 void RE_FreePersistentData(const Scene *scene)
@@ -1845,11 +1861,28 @@ static void render_init_depsgraph(Render *re)
   Scene *scene = re->scene;
   ViewLayer *view_layer = BKE_view_layer_default_render(re->scene);
 
-  re->pipeline_depsgraph = DEG_graph_new(re->main, scene, view_layer, DAG_EVAL_RENDER);
-  DEG_debug_name_set(re->pipeline_depsgraph, "RENDER PIPELINE");
+  /* A graph kept alive by persistent data can be reused when it matches, so only data-blocks
+   * tagged for changes since the last render get copied and evaluated again. */
+  if (re->pipeline_depsgraph != NULL) {
+    if (DEG_get_bmain(re->pipeline_depsgraph) != re->main ||
+        DEG_get_input_scene(re->pipeline_depsgraph) != scene ||
+        DEG_get_input_view_layer(re->pipeline_depsgraph) != view_layer) {
+      render_pipeline_depsgraph_free(re);
+    }
+    else if (DEG_graph_relations_need_update(re->pipeline_depsgraph)) {
+      /* Note that #DEG_graph_relations_update can't be used here since it rebuilds from the
+       * view layer instead of the render pipeline. */
+      DEG_graph_build_for_render_pipeline(re->pipeline_depsgraph);
+    }
+  }
+
+  if (re->pipeline_depsgraph == NULL) {
+    re->pipeline_depsgraph = DEG_graph_new(re->main, scene, view_layer, DAG_EVAL_RENDER);
+    DEG_debug_name_set(re->pipeline_depsgraph, "RENDER PIPELINE");
 
-  /* Make sure there is a correct evaluated scene pointer. */
-  DEG_graph_build_for_render_pipeline(re->pipeline_depsgraph);
+    /* Make sure there is a correct evaluated scene pointer. */
+    DEG_graph_build_for_render_pipeline(re->pipeline_depsgraph);
+  }
 
   /* Update immediately so we have proper evaluated scene. */
   render_update_depsgraph(re);
@@ -1860,14 +1893,20 @@ static void render_init_depsgraph(Render *re)
 /* Free data only needed during rendering operation. */
 static void render_pipeline_free(Render *re)
 {
+  const bool keep_depsgraph = (re->engine && RE_engine_use_persistent_data(re->engine));
   if (re->engine && !RE_engine_use_persistent_data(re->engine)) {
     RE_engine_free(re->engine);
     re->engine = NULL;
   }
-  if (re->pipeline_depsgraph != NULL) {
-    DEG_graph_free(re->pipeline_depsgraph);
-    re->pipeline_depsgraph = NULL;
-    re->pipeline_scene_eval = NULL;
+  if (keep_depsgraph) {
+    /* Keep the graph for the next render, clear recalc flags so it only updates data tagged for
+     * changes from now on. */
+    if (re->pipeline_depsgraph != NULL) {
+      DEG_ids_clear_recalc(re->pipeline_depsgraph, false);
+    }
+  }
+  else {
+    render_pipeline_depsgraph_free(re);
   }
   /* Destroy the opengl context in the correct thread. */
   RE_gl_context_destroy(re);
@@ -2610,7 +2649,7 @@ void RE_RenderAnim(Render *re,
   G.is_rendering = false;
 }
 
-void RE_PreviewRender(Render *re, Main *bmain, Scene *sce)
+void RE_PreviewRender(Render *re, Main *bmain, Scene *sce, const bool keep_engine)
 {
   Object *camera;
   int winx, winy;
@@ -2623,12 +2662,28 @@ void RE_PreviewRender(Render *re, Main *bmain, Scene *sce)
   re->main = bmain;
   re->scene = sce;
 
+  /* An engine kept alive by a previous preview render must match the scene engine type. */
+  if (re->engine && re->engine->type != RE_engines_find(sce->r.engine)) {
+    RE_engine_free(re->engine);
+    re->engine = NULL;
+  }
+
   camera = RE_GetCamera(re);
   RE_SetCamera(re, camera);
 
   RE_engine_render(re, false);
 
-  /* No persistent data for preview render. */
+  /* No persistent data for preview render, unless the caller renders a batch of previews and
+   * frees the engine with #RE_PreviewRenderFreeEngine when the batch is done. Keeping the engine
+   * alive lets consecutive previews reuse its depsgraph, see #engine_depsgraph_init. */
+  if (re->engine && !keep_engine) {
+    RE_engine_free(re->engine);
+    re->engine = NULL;
+  }
+}
+
+void RE_PreviewRenderFreeEngine(Render *re)
+{
   if (re->engine) {
     RE_engine_free(re->engine);
     re->engine = NULL;
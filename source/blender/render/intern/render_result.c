@@ -35,6 +35,7 @@
 #include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -838,6 +839,27 @@ static void do_merge_tile(
   }
 }
 
+typedef struct MergePassPair {
+  RenderPass *rpass;
+  RenderPass *rpassp;
+} MergePassPair;
+
+typedef struct MergePassesData {
+  RenderResult *rr;
+  RenderResult *rrpart;
+  MergePassPair *pairs;
+} MergePassesData;
+
+static void do_merge_tile_pass_cb(void *__restrict userdata,
+                                  const int i,
+                                  const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  MergePassesData *data = userdata;
+  MergePassPair *pair = &data->pairs[i];
+
+  do_merge_tile(data->rr, data->rrpart, pair->rpass->rect, pair->rpassp->rect, pair->rpass->channels);
+}
+
 /* used when rendering to a full buffer, or when reading the exr part-layer-pass file */
 /* no test happens here if it fits... we also assume layers are in sync */
 /* is used within threads */
@@ -845,7 +867,10 @@ void render_result_merge(RenderResult *rr, RenderResult *rrpart)
 {
   RenderLayer *rl, *rlp;
   RenderPass *rpass, *rpassp;
+  MergePassPair *pairs = NULL;
+  int pairs_len = 0, pairs_alloc = 0;
 
+  /* Collect the pass pairs first, so they can be merged in parallel. */
   for (rl = rr->layers.first; rl; rl = rl->next) {
     rlp = RE_GetRenderLayer(rrpart, rl->name);
     if (rlp) {
@@ -861,13 +886,35 @@ void render_result_merge(RenderResult *rr, RenderResult *rrpart)
           continue;
         }
 
-        do_merge_tile(rr, rrpart, rpass->rect, rpassp->rect, rpass->channels);
+        if (pairs_len == pairs_alloc) {
+          pairs_alloc = MAX2(pairs_alloc * 2, 32);
+          pairs = MEM_recallocN(pairs, sizeof(MergePassPair) * pairs_alloc);
+        }
+        pairs[pairs_len].rpass = rpass;
+        pairs[pairs_len].rpassp = rpassp;
+        pairs_len++;
 
         /* manually get next render pass */
         rpassp = rpassp->next;
       }
     }
   }
+
+  if (pairs_len > 0) {
+    MergePassesData data = {
+        .rr = rr,
+        .rrpart = rrpart,
+        .pairs = pairs,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    /* Not worth spawning tasks for the small tiles of tiled rendering. */
+    settings.use_threading = (pairs_len > 1) &&
+                             ((size_t)rrpart->rectx * rrpart->recty >= 256 * 256);
+    BLI_task_parallel_range(0, pairs_len, &data, do_merge_tile_pass_cb, &settings);
+  }
+
+  MEM_SAFE_FREE(pairs);
 }
 
 /* Called from the UI and render pipeline, to save multilayer and multiview
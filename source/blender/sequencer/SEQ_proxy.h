@@ -43,6 +43,11 @@ bool SEQ_proxy_rebuild_context(struct Main *bmain,
                                struct Sequence *seq,
                                struct GSet *file_list,
                                struct ListBase *queue);
+bool SEQ_index_rebuild_context(struct Main *bmain,
+                               struct Depsgraph *depsgraph,
+                               struct Scene *scene,
+                               struct Sequence *seq,
+                               struct ListBase *queue);
 void SEQ_proxy_rebuild(struct SeqIndexBuildContext *context,
                        short *stop,
                        short *do_update,
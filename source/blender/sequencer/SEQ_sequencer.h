@@ -35,7 +35,9 @@ struct BlendLibReader;
 struct BlendWriter;
 struct Depsgraph;
 struct Editing;
+struct ListBase;
 struct Scene;
+struct SeqCollection;
 struct Sequence;
 struct SequenceLookup;
 struct SequencerToolSettings;
@@ -111,6 +113,9 @@ typedef enum eSequenceLookupTag {
 } eSequenceLookupTag;
 
 struct Sequence *SEQ_sequence_lookup_by_name(const struct Scene *scene, const char *key);
+struct SeqCollection *SEQ_sequence_lookup_strips_at_frame(const struct Scene *scene,
+                                                          const struct ListBase *seqbase,
+                                                          int timeline_frame);
 void SEQ_sequence_lookup_free(const struct Scene *scene);
 void SEQ_sequence_lookup_tag(const struct Scene *scene, eSequenceLookupTag tag);
 
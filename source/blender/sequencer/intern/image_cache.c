@@ -43,6 +43,7 @@
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
 #include "BLI_path_util.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "BKE_main.h"
@@ -124,6 +125,9 @@ typedef struct SeqDiskCache {
   ListBase files;
   ThreadMutex read_write_mutex;
   size_t size_total;
+  /** Writes images on a background thread, so compression and IO don't block rendering threads.
+   * Serial, to keep writes in submission order. */
+  struct TaskPool *write_pool;
 } SeqDiskCache;
 
 typedef struct DiskCacheFile {
@@ -481,6 +485,9 @@ static void seq_disk_cache_invalidate(Scene *scene,
   int end;
   SeqDiskCache *disk_cache = scene->ed->cache->disk_cache;
 
+  /* Finish pending writes, so none of them re-adds an invalidated frame afterwards. */
+  BLI_task_pool_work_and_wait(disk_cache->write_pool);
+
   BLI_mutex_lock(&disk_cache->read_write_mutex);
 
   start = seq_changed->startdisp - DCACHE_IMAGES_PER_FILE;
@@ -662,6 +669,37 @@ static bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key
   return false;
 }
 
+typedef struct DiskCacheWriteTask {
+  SeqDiskCache *disk_cache;
+  /** Copy of the cache key: the cached key can be recycled before this task runs. */
+  SeqCacheKey key;
+  ImBuf *ibuf;
+} DiskCacheWriteTask;
+
+static void seq_disk_cache_write_task_fn(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  DiskCacheWriteTask *task = taskdata;
+
+  BLI_mutex_lock(&task->disk_cache->read_write_mutex);
+  seq_disk_cache_write_file(task->disk_cache, &task->key, task->ibuf);
+  BLI_mutex_unlock(&task->disk_cache->read_write_mutex);
+  seq_disk_cache_enforce_limits(task->disk_cache);
+
+  IMB_freeImBuf(task->ibuf);
+}
+
+static void seq_disk_cache_write_file_async(SeqDiskCache *disk_cache,
+                                            SeqCacheKey *key,
+                                            ImBuf *ibuf)
+{
+  DiskCacheWriteTask *task = MEM_mallocN(sizeof(*task), __func__);
+  task->disk_cache = disk_cache;
+  task->key = *key;
+  task->ibuf = ibuf;
+  IMB_refImBuf(ibuf);
+  BLI_task_pool_push(disk_cache->write_pool, seq_disk_cache_write_task_fn, task, true, NULL);
+}
+
 static ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
 {
   char path[FILE_MAX];
@@ -916,67 +954,54 @@ static void seq_cache_relink_keys(SeqCacheKey *link_next, SeqCacheKey *link_prev
   }
 }
 
-/* Choose a key out of 2 candidates(leftmost and rightmost items)
- * to recycle based on currently used strategy */
-static SeqCacheKey *seq_cache_choose_key(Scene *scene, SeqCacheKey *lkey, SeqCacheKey *rkey)
+/** Eviction priority classes, in order of increasing willingness to evict. */
+typedef enum eSeqCacheItemClass {
+  /** Entries around the current frame, evicted only as a last resort. */
+  SEQ_CACHE_CLASS_PLAYHEAD = 0,
+  /** Entries inside the range a running prefetch job is filling, never evicted while it runs. */
+  SEQ_CACHE_CLASS_PREFETCH = 1,
+  /** Everything else, evicted first. */
+  SEQ_CACHE_CLASS_BACKGROUND = 2,
+  SEQ_CACHE_CLASS_NUM = 3,
+} eSeqCacheItemClass;
+
+/** Entries this close to the playhead (in frames) count as the playhead neighborhood. */
+#define SEQ_CACHE_PLAYHEAD_RADIUS 10
+
+static eSeqCacheItemClass seq_cache_key_class(Scene *scene, const SeqCacheKey *key)
 {
-  SeqCacheKey *finalkey = NULL;
+  float distance = key->timeline_frame - scene->r.cfra;
+  if (distance < 0) {
+    distance = -distance;
+  }
+
+  if (distance <= SEQ_CACHE_PLAYHEAD_RADIUS) {
+    return SEQ_CACHE_CLASS_PLAYHEAD;
+  }
 
-  /* Ideally, cache would not need to check the state of prefetching task
-   * that is tricky to do however, because prefetch would need to know,
-   * if a key, that is about to be created would be removed by itself.
-   *
-   * This can happen because only FINAL_OUT item insertion will trigger recycling
-   * but that is also the point, where prefetch can be suspended.
-   *
-   * We could use temp cache as a shield and later make it a non-temporary entry,
-   * but it is not worth of increasing system complexity.
-   */
   if (scene->ed->cache_flag & SEQ_CACHE_PREFETCH_ENABLE && seq_prefetch_job_is_running(scene)) {
     int pfjob_start, pfjob_end;
     seq_prefetch_get_time_range(scene, &pfjob_start, &pfjob_end);
 
-    if (lkey) {
-      if (lkey->timeline_frame < pfjob_start || lkey->timeline_frame > pfjob_end) {
-        return lkey;
-      }
-    }
-
-    if (rkey) {
-      if (rkey->timeline_frame < pfjob_start || rkey->timeline_frame > pfjob_end) {
-        return rkey;
-      }
+    if (key->timeline_frame >= pfjob_start && key->timeline_frame <= pfjob_end) {
+      return SEQ_CACHE_CLASS_PREFETCH;
     }
-
-    return NULL;
   }
 
-  if (rkey && lkey) {
-    if (lkey->timeline_frame > rkey->timeline_frame) {
-      SeqCacheKey *swapkey = lkey;
-      lkey = rkey;
-      rkey = swapkey;
-    }
-
-    int l_diff = scene->r.cfra - lkey->timeline_frame;
-    int r_diff = rkey->timeline_frame - scene->r.cfra;
+  return SEQ_CACHE_CLASS_BACKGROUND;
+}
 
-    if (l_diff > r_diff) {
-      finalkey = lkey;
-    }
-    else {
-      finalkey = rkey;
-    }
-  }
-  else {
-    if (lkey) {
-      finalkey = lkey;
-    }
-    else {
-      finalkey = rkey;
-    }
+/* Size-weighted distance from the playhead: freeing one distant 8K float frame is preferred
+ * over freeing hundreds of small proxy frames at a similar distance. */
+static size_t seq_cache_eviction_score(Scene *scene, const SeqCacheKey *key, SeqCacheItem *item)
+{
+  float distance = key->timeline_frame - scene->r.cfra;
+  if (distance < 0) {
+    distance = -distance;
   }
-  return finalkey;
+
+  const size_t size_in_kb = IMB_get_size_in_memory(item->ibuf) >> 10;
+  return (size_in_kb + 1) * ((size_t)distance + 1);
 }
 
 static void seq_cache_recycle_linked(Scene *scene, SeqCacheKey *base)
@@ -1025,16 +1050,13 @@ static void seq_cache_recycle_linked(Scene *scene, SeqCacheKey *base)
 static SeqCacheKey *seq_cache_get_item_for_removal(Scene *scene)
 {
   SeqCache *cache = seq_cache_get_from_scene(scene);
-  SeqCacheKey *finalkey = NULL;
-  /* Leftmost key. */
-  SeqCacheKey *lkey = NULL;
-  /* Rightmost key. */
-  SeqCacheKey *rkey = NULL;
   SeqCacheKey *key = NULL;
+  /* Highest scored evictable key of each class. */
+  SeqCacheKey *best_key[SEQ_CACHE_CLASS_NUM] = {NULL};
+  size_t best_score[SEQ_CACHE_CLASS_NUM] = {0};
 
   GHashIterator gh_iter;
   BLI_ghashIterator_init(&gh_iter, cache->hash);
-  int total_count = 0;
 
   while (!BLI_ghashIterator_done(&gh_iter)) {
     key = BLI_ghashIterator_getKey(&gh_iter);
@@ -1053,29 +1075,36 @@ static SeqCacheKey *seq_cache_get_item_for_removal(Scene *scene)
       continue;
     }
 
-    total_count++;
+    const eSeqCacheItemClass class = seq_cache_key_class(scene, key);
+    const size_t score = seq_cache_eviction_score(scene, key, item);
 
-    if (lkey) {
-      if (key->timeline_frame < lkey->timeline_frame) {
-        lkey = key;
-      }
-    }
-    else {
-      lkey = key;
-    }
-    if (rkey) {
-      if (key->timeline_frame > rkey->timeline_frame) {
-        rkey = key;
-      }
-    }
-    else {
-      rkey = key;
+    if (best_key[class] == NULL || score > best_score[class]) {
+      best_key[class] = key;
+      best_score[class] = score;
     }
   }
 
-  finalkey = seq_cache_choose_key(scene, lkey, rkey);
+  /* Ideally, cache would not need to check the state of prefetching task
+   * that is tricky to do however, because prefetch would need to know,
+   * if a key, that is about to be created would be removed by itself.
+   *
+   * This can happen because only FINAL_OUT item insertion will trigger recycling
+   * but that is also the point, where prefetch can be suspended.
+   *
+   * We could use temp cache as a shield and later make it a non-temporary entry,
+   * but it is not worth of increasing system complexity.
+   */
+  if (scene->ed->cache_flag & SEQ_CACHE_PREFETCH_ENABLE && seq_prefetch_job_is_running(scene)) {
+    return best_key[SEQ_CACHE_CLASS_BACKGROUND];
+  }
 
-  return finalkey;
+  if (best_key[SEQ_CACHE_CLASS_BACKGROUND]) {
+    return best_key[SEQ_CACHE_CLASS_BACKGROUND];
+  }
+  if (best_key[SEQ_CACHE_CLASS_PREFETCH]) {
+    return best_key[SEQ_CACHE_CLASS_PREFETCH];
+  }
+  return best_key[SEQ_CACHE_CLASS_PLAYHEAD];
 }
 
 /* Find only "base" keys.
@@ -1145,6 +1174,8 @@ static void seq_disk_cache_create(Main *bmain, Scene *scene)
   cache->disk_cache = MEM_callocN(sizeof(SeqDiskCache), "SeqDiskCache");
   cache->disk_cache->bmain = bmain;
   BLI_mutex_init(&cache->disk_cache->read_write_mutex);
+  cache->disk_cache->write_pool = BLI_task_pool_create_background_serial(cache->disk_cache,
+                                                                         TASK_PRIORITY_LOW);
   seq_disk_cache_handle_versioning(cache->disk_cache);
   seq_disk_cache_get_files(cache->disk_cache, seq_disk_cache_base_dir());
   cache->disk_cache->timestamp = scene->ed->disk_cache_timestamp;
@@ -1243,6 +1274,8 @@ void seq_cache_destruct(Scene *scene)
   BLI_mutex_end(&cache->iterator_mutex);
 
   if (cache->disk_cache != NULL) {
+    BLI_task_pool_work_and_wait(cache->disk_cache->write_pool);
+    BLI_task_pool_free(cache->disk_cache->write_pool);
     BLI_freelistN(&cache->disk_cache->files);
     BLI_mutex_end(&cache->disk_cache->read_write_mutex);
     MEM_freeN(cache->disk_cache);
@@ -1475,10 +1508,7 @@ void seq_cache_put(
         seq_disk_cache_create(context->bmain, context->scene);
       }
 
-      BLI_mutex_lock(&cache->disk_cache->read_write_mutex);
-      seq_disk_cache_write_file(cache->disk_cache, key, i);
-      BLI_mutex_unlock(&cache->disk_cache->read_write_mutex);
-      seq_disk_cache_enforce_limits(cache->disk_cache);
+      seq_disk_cache_write_file_async(cache->disk_cache, key, i);
     }
   }
 }
@@ -34,6 +34,7 @@
 #include "DNA_windowmanager_types.h"
 
 #include "BLI_listbase.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "IMB_imbuf.h"
@@ -400,7 +401,7 @@ static bool seq_prefetch_scene_strip_is_rendered(PrefetchJob *pfjob,
 {
   float cfra = seq_prefetch_cfra(pfjob);
   Sequence *seq_arr[MAXSEQ + 1];
-  int count = seq_get_shown_sequences(seqbase, cfra, 0, seq_arr);
+  int count = seq_get_shown_sequences(pfjob->scene, seqbase, cfra, 0, seq_arr);
 
   /* Iterate over rendered strips. */
   for (int i = 0; i < count; i++) {
@@ -451,6 +452,56 @@ static bool seq_prefetch_must_skip_frame(PrefetchJob *pfjob, ListBase *seqbase)
   return false;
 }
 
+typedef struct PrefetchStripTask {
+  const SeqRenderData *context;
+  Sequence *seq;
+  float timeline_frame;
+} PrefetchStripTask;
+
+static void seq_prefetch_source_strip_task(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  PrefetchStripTask *task = taskdata;
+  ImBuf *ibuf = SEQ_render_give_ibuf_direct(task->context, task->timeline_frame, task->seq);
+  IMB_freeImBuf(ibuf);
+}
+
+/* Decode source movie strips for this frame concurrently before compositing it, so a single slow
+ * decode does not serialize the whole lookahead. Rendered strips are deposited in the strip cache
+ * and the composite in #SEQ_render_give_ibuf picks them up from there. */
+static void seq_prefetch_render_source_strips(PrefetchJob *pfjob)
+{
+  /* Use the scene copy, strips from the original scene must not be rendered with
+   * #PrefetchJob.context_cpy. */
+  ListBase *seqbase = SEQ_active_seqbase_get(SEQ_editing_get(pfjob->context_cpy.scene));
+  Sequence *seq_arr[MAXSEQ + 1];
+  PrefetchStripTask tasks[MAXSEQ];
+  const float timeline_frame = seq_prefetch_cfra(pfjob);
+  const int count = seq_get_shown_sequences(
+      pfjob->context_cpy.scene, seqbase, timeline_frame, 0, seq_arr);
+
+  int task_count = 0;
+  for (int i = 0; i < count; i++) {
+    if (seq_arr[i]->type == SEQ_TYPE_MOVIE) {
+      tasks[task_count].context = &pfjob->context_cpy;
+      tasks[task_count].seq = seq_arr[i];
+      tasks[task_count].timeline_frame = timeline_frame;
+      task_count++;
+    }
+  }
+
+  /* With a single movie strip there is nothing to overlap. */
+  if (task_count < 2) {
+    return;
+  }
+
+  TaskPool *pool = BLI_task_pool_create(NULL, TASK_PRIORITY_LOW);
+  for (int i = 0; i < task_count; i++) {
+    BLI_task_pool_push(pool, seq_prefetch_source_strip_task, &tasks[i], false, NULL);
+  }
+  BLI_task_pool_work_and_wait(pool);
+  BLI_task_pool_free(pool);
+}
+
 static bool seq_prefetch_need_suspend(PrefetchJob *pfjob)
 {
   return seq_prefetch_is_cache_full(pfjob->scene) || seq_prefetch_is_scrubbing(pfjob->bmain) ||
@@ -497,6 +548,8 @@ static void *seq_prefetch_frames(void *job)
       continue;
     }
 
+    seq_prefetch_render_source_strips(pfjob);
+
     ImBuf *ibuf = SEQ_render_give_ibuf(&pfjob->context_cpy, seq_prefetch_cfra(pfjob), 0);
     seq_cache_free_temp_cache(pfjob->scene, pfjob->context.task_id, seq_prefetch_cfra(pfjob));
     IMB_freeImBuf(ibuf);
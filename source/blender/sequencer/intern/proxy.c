@@ -487,6 +487,79 @@ bool SEQ_proxy_rebuild_context(Main *bmain,
   return true;
 }
 
+/**
+ * Queue a rebuild of only the timecode index of \a seq, so scrubbing long-GOP footage can seek
+ * precisely instead of decoding throwaway frames from the closest GOP start. Unlike
+ * #SEQ_proxy_rebuild_context this does not require proxies to be enabled on the strip: the
+ * render path falls back to #IMB_TC_RECORD_RUN lookups whenever the index exists. Strips whose
+ * index is already built are skipped.
+ */
+bool SEQ_index_rebuild_context(
+    Main *bmain, Depsgraph *depsgraph, Scene *scene, Sequence *seq, ListBase *queue)
+{
+  SeqIndexBuildContext *context;
+  Sequence *nseq;
+  StripAnim *sanim;
+  int num_files;
+  int i;
+
+  if (seq->type != SEQ_TYPE_MOVIE || !seq->strip) {
+    return true;
+  }
+
+  num_files = seq_proxy_context_count(seq, scene);
+
+  for (i = 0; i < num_files; i++) {
+    if (seq_proxy_multiview_context_invalid(seq, scene, i)) {
+      continue;
+    }
+
+    seq_open_anim_file(scene, seq, false);
+    sanim = BLI_findlink(&seq->anims, i);
+    if (sanim->anim == NULL ||
+        (IMB_anim_timecode_get_existing(sanim->anim) & IMB_TC_RECORD_RUN) != 0) {
+      continue;
+    }
+
+    SEQ_relations_sequence_free_anim(seq);
+
+    context = MEM_callocN(sizeof(SeqIndexBuildContext), "seq timecode index build context");
+
+    nseq = SEQ_sequence_dupli_recursive(scene, scene, NULL, seq, 0);
+
+    context->tc_flags = IMB_TC_RECORD_RUN;
+    context->size_flags = 0;
+    context->quality = 0; /* Only used for proxy encoding. */
+    context->overwrite = false;
+
+    context->bmain = bmain;
+    context->depsgraph = depsgraph;
+    context->scene = scene;
+    context->orig_seq = seq;
+    context->seq = nseq;
+
+    context->view_id = i;
+
+    seq_open_anim_file(scene, nseq, true);
+    sanim = BLI_findlink(&nseq->anims, i);
+
+    if (sanim->anim) {
+      context->index_context = IMB_anim_index_rebuild_context(
+          sanim->anim, context->tc_flags, 0, context->quality, context->overwrite, NULL);
+    }
+    if (!context->index_context) {
+      /* Nothing to build after all, or the file can not be read. */
+      seq_free_sequence_recurse(NULL, nseq, true, true);
+      MEM_freeN(context);
+      continue;
+    }
+
+    BLI_addtail(queue, BLI_genericNodeN(context));
+  }
+
+  return true;
+}
+
 void SEQ_proxy_rebuild(SeqIndexBuildContext *context,
                        short *stop,
                        short *do_update,
@@ -28,6 +28,7 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
+#include "BLI_task.h"
 #include "BLI_timecode.h"
 
 #include "DNA_scene_types.h"
@@ -57,22 +58,75 @@ static void proxy_freejob(void *pjv)
   MEM_freeN(pj);
 }
 
+typedef struct ProxyBuildTask {
+  struct SeqIndexBuildContext *context;
+  short *stop;
+  short *do_update;
+  /** Progress of this context alone, the aggregate is in #ProxyBuildTaskData. */
+  float progress;
+} ProxyBuildTask;
+
+typedef struct ProxyBuildTaskData {
+  ProxyBuildTask *tasks;
+  int task_count;
+  float *progress;
+} ProxyBuildTaskData;
+
+static void proxy_build_task_fn(TaskPool *__restrict pool, void *taskdata)
+{
+  ProxyBuildTaskData *data = BLI_task_pool_user_data(pool);
+  ProxyBuildTask *task = taskdata;
+
+  SEQ_proxy_rebuild(task->context, task->stop, task->do_update, &task->progress);
+  task->progress = 1.0f;
+
+  /* Aggregate total progress. Reads of the other tasks progress are racy,
+   * which is fine for progress reporting. */
+  float progress = 0.0f;
+  for (int i = 0; i < data->task_count; i++) {
+    progress += data->tasks[i].progress;
+  }
+  *data->progress = progress / data->task_count;
+  *task->do_update = true;
+}
+
 /* Only this runs inside thread. */
 static void proxy_startjob(void *pjv, short *stop, short *do_update, float *progress)
 {
   ProxyJob *pj = pjv;
   LinkData *link;
 
-  for (link = pj->queue.first; link; link = link->next) {
-    struct SeqIndexBuildContext *context = link->data;
-
-    SEQ_proxy_rebuild(context, stop, do_update, progress);
-
-    if (*stop) {
-      pj->stop = 1;
-      fprintf(stderr, "Canceling proxy rebuild on users request...\n");
-      break;
+  const int context_count = BLI_listbase_count(&pj->queue);
+  if (context_count == 1) {
+    /* Single strip, nothing to build concurrently. */
+    link = pj->queue.first;
+    SEQ_proxy_rebuild(link->data, stop, do_update, progress);
+  }
+  else if (context_count > 1) {
+    /* Every context rebuilds its own duplicated strip, so they can run concurrently. The task
+     * scheduler bounds how many FFmpeg index builds are active at the same time. */
+    ProxyBuildTaskData data;
+    data.tasks = MEM_callocN(sizeof(ProxyBuildTask) * context_count, "proxy build tasks");
+    data.task_count = context_count;
+    data.progress = progress;
+
+    TaskPool *task_pool = BLI_task_pool_create(&data, TASK_PRIORITY_LOW);
+    int i = 0;
+    for (link = pj->queue.first; link; link = link->next, i++) {
+      ProxyBuildTask *task = &data.tasks[i];
+      task->context = link->data;
+      task->stop = stop;
+      task->do_update = do_update;
+      BLI_task_pool_push(task_pool, proxy_build_task_fn, task, false, NULL);
     }
+    BLI_task_pool_work_and_wait(task_pool);
+    BLI_task_pool_free(task_pool);
+    MEM_freeN(data.tasks);
+  }
+
+  if (*stop) {
+    pj->stop = 1;
+    fprintf(stderr, "Canceling proxy rebuild on users request...\n");
   }
 }
 
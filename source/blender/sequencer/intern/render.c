@@ -306,9 +306,19 @@ static bool must_render_strip(const Sequence *seq, SeqCollection *strips_at_time
   return true;
 }
 
-static SeqCollection *query_strips_at_frame(ListBase *seqbase, const int timeline_frame)
+static SeqCollection *query_strips_at_frame(const Scene *scene,
+                                            ListBase *seqbase,
+                                            const int timeline_frame)
 {
-  SeqCollection *collection = SEQ_collection_create(__func__);
+  /* Strips are looked up in an index sorted by start frame, so whole timeline does not have to
+   * be scanned for every rendered frame. */
+  SeqCollection *collection = SEQ_sequence_lookup_strips_at_frame(
+      scene, seqbase, timeline_frame);
+  if (collection != NULL) {
+    return collection;
+  }
+
+  collection = SEQ_collection_create(__func__);
 
   LISTBASE_FOREACH (Sequence *, seq, seqbase) {
     if (SEQ_time_strip_intersects_frame(seq, timeline_frame)) {
@@ -355,12 +365,13 @@ static int seq_channel_cmp_fn(const void *a, const void *b)
   return (*(Sequence **)a)->machine - (*(Sequence **)b)->machine;
 }
 
-int seq_get_shown_sequences(ListBase *seqbase,
+int seq_get_shown_sequences(const Scene *scene,
+                            ListBase *seqbase,
                             const int timeline_frame,
                             const int chanshown,
                             Sequence **r_seq_arr)
 {
-  SeqCollection *collection = query_strips_at_frame(seqbase, timeline_frame);
+  SeqCollection *collection = query_strips_at_frame(scene, seqbase, timeline_frame);
 
   if (chanshown != 0) {
     collection_filter_channel_up_to_incl(collection, chanshown);
@@ -1842,7 +1853,8 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
   int i;
   ImBuf *out = NULL;
 
-  count = seq_get_shown_sequences(seqbasep, timeline_frame, chanshown, (Sequence **)&seq_arr);
+  count = seq_get_shown_sequences(
+      context->scene, seqbasep, timeline_frame, chanshown, (Sequence **)&seq_arr);
 
   if (count == 0) {
     return NULL;
@@ -1943,7 +1955,7 @@ ImBuf *SEQ_render_give_ibuf(const SeqRenderData *context, float timeline_frame,
   Sequence *seq_arr[MAXSEQ + 1];
   int count;
 
-  count = seq_get_shown_sequences(seqbasep, timeline_frame, chanshown, seq_arr);
+  count = seq_get_shown_sequences(context->scene, seqbasep, timeline_frame, chanshown, seq_arr);
 
   if (count) {
     out = seq_cache_get(context, seq_arr[count - 1], timeline_frame, SEQ_CACHE_STORE_FINAL_OUT);
@@ -30,26 +30,91 @@
 #include "SEQ_iterator.h"
 
 #include "BLI_ghash.h"
+#include "BLI_listbase.h"
 #include "BLI_string.h"
 #include "BLI_sys_types.h"
 #include "BLI_threads.h"
+#include <limits.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "MEM_guardedalloc.h"
 
 static ThreadMutex lookup_lock = BLI_MUTEX_INITIALIZER;
 
+/* Strips of one seqbase ordered by start frame, so strips rendered at a timeline frame can be
+ * found without scanning the whole seqbase. */
+typedef struct SeqTimelineIndex {
+  /** Strips sorted by start frame. */
+  Sequence **strips;
+  /** Running maximum of the end frame over `strips[0..i]`. Strips before index i can not
+   * intersect a timeline frame that is past this value, which bounds the backwards scan. */
+  int *max_enddisp;
+  int strips_len;
+} SeqTimelineIndex;
+
 typedef struct SequenceLookup {
   GHash *by_name;
+  /** Maps a seqbase #ListBase to the #SeqTimelineIndex of its strips. */
+  GHash *index_by_seqbase;
   eSequenceLookupTag tag;
 } SequenceLookup;
 
 static void seq_sequence_lookup_init(struct SequenceLookup *lookup)
 {
   lookup->by_name = BLI_ghash_str_new(__func__);
+  lookup->index_by_seqbase = BLI_ghash_ptr_new(__func__);
   lookup->tag |= SEQ_LOOKUP_TAG_INVALID;
 }
 
+static int seq_timeline_index_cmp_fn(const void *a, const void *b)
+{
+  return (*(const Sequence **)a)->startdisp - (*(const Sequence **)b)->startdisp;
+}
+
+static void seq_timeline_index_free(void *val)
+{
+  SeqTimelineIndex *index = val;
+  MEM_SAFE_FREE(index->strips);
+  MEM_SAFE_FREE(index->max_enddisp);
+  MEM_freeN(index);
+}
+
+static void seq_timeline_index_build(GHash *index_by_seqbase, ListBase *seqbase)
+{
+  SeqTimelineIndex *index = MEM_callocN(sizeof(*index), __func__);
+  const int strips_len = BLI_listbase_count(seqbase);
+
+  if (strips_len > 0) {
+    index->strips = MEM_mallocN(sizeof(*index->strips) * strips_len, __func__);
+    index->max_enddisp = MEM_mallocN(sizeof(*index->max_enddisp) * strips_len, __func__);
+    index->strips_len = strips_len;
+
+    int i = 0;
+    LISTBASE_FOREACH (Sequence *, seq, seqbase) {
+      index->strips[i++] = seq;
+    }
+    qsort(index->strips, strips_len, sizeof(*index->strips), seq_timeline_index_cmp_fn);
+
+    int max_enddisp = INT_MIN;
+    for (i = 0; i < strips_len; i++) {
+      if (index->strips[i]->enddisp > max_enddisp) {
+        max_enddisp = index->strips[i]->enddisp;
+      }
+      index->max_enddisp[i] = max_enddisp;
+    }
+  }
+
+  BLI_ghash_insert(index_by_seqbase, seqbase, index);
+
+  /* Strips inside meta strips are queried with the meta seqbase, index these as well. */
+  LISTBASE_FOREACH (Sequence *, seq, seqbase) {
+    if (seq->type == SEQ_TYPE_META) {
+      seq_timeline_index_build(index_by_seqbase, &seq->seqbase);
+    }
+  }
+}
+
 static void seq_sequence_lookup_build(const struct Scene *scene, struct SequenceLookup *lookup)
 {
   SeqCollection *all_strips = SEQ_query_all_strips_recursive(&scene->ed->seqbase);
@@ -58,6 +123,7 @@ static void seq_sequence_lookup_build(const struct Scene *scene, struct Sequence
     BLI_ghash_insert(lookup->by_name, seq->name + 2, seq);
   }
   SEQ_collection_free(all_strips);
+  seq_timeline_index_build(lookup->index_by_seqbase, &scene->ed->seqbase);
   lookup->tag &= ~SEQ_LOOKUP_TAG_INVALID;
 }
 
@@ -76,6 +142,8 @@ static void seq_sequence_lookup_free(struct SequenceLookup **lookup)
 
   BLI_ghash_free((*lookup)->by_name, NULL, NULL);
   (*lookup)->by_name = NULL;
+  BLI_ghash_free((*lookup)->index_by_seqbase, NULL, seq_timeline_index_free);
+  (*lookup)->index_by_seqbase = NULL;
   MEM_freeN(*lookup);
   *lookup = NULL;
 }
@@ -140,6 +208,56 @@ Sequence *SEQ_sequence_lookup_by_name(const Scene *scene, const char *key)
   return seq;
 }
 
+/**
+ * Find all strips in a seqbase that are rendered at a given timeline frame, i.e. those for which
+ * #SEQ_time_strip_intersects_frame is true. The lookup uses an index of strips sorted by start
+ * frame, so on large timelines this visits only the strips around the queried frame instead of
+ * the whole seqbase. If the lookup doesn't exist, it will be created. If it is tagged as invalid,
+ * it will be rebuilt.
+ *
+ * \param scene: scene that owns lookup hash
+ * \param seqbase: ListBase in which strips are queried, must be owned by scene
+ * \param timeline_frame: absolute frame position
+ *
+ * \return strip collection, or NULL when the seqbase is not indexed
+ */
+SeqCollection *SEQ_sequence_lookup_strips_at_frame(const Scene *scene,
+                                                   const ListBase *seqbase,
+                                                   const int timeline_frame)
+{
+  if (scene->ed == NULL) {
+    return NULL;
+  }
+  BLI_mutex_lock(&lookup_lock);
+  seq_sequence_lookup_update_if_needed(scene, &scene->ed->runtime.sequence_lookup);
+  SequenceLookup *lookup = scene->ed->runtime.sequence_lookup;
+  SeqCollection *collection = NULL;
+  SeqTimelineIndex *index = BLI_ghash_lookup(lookup->index_by_seqbase, seqbase);
+  if (index != NULL) {
+    collection = SEQ_collection_create(__func__);
+    /* Binary search for the first strip that starts past timeline_frame. */
+    int lo = 0, hi = index->strips_len;
+    while (lo < hi) {
+      const int mid = (lo + hi) / 2;
+      if (index->strips[mid]->startdisp <= timeline_frame) {
+        lo = mid + 1;
+      }
+      else {
+        hi = mid;
+      }
+    }
+    /* Scan backwards over strips that start on or before the frame, stopping as soon as the
+     * running maximum of end frames shows no earlier strip can reach the frame anymore. */
+    for (int i = lo - 1; i >= 0 && index->max_enddisp[i] > timeline_frame; i--) {
+      if (index->strips[i]->enddisp > timeline_frame) {
+        SEQ_collection_append_strip(index->strips[i], collection);
+      }
+    }
+  }
+  BLI_mutex_unlock(&lookup_lock);
+  return collection;
+}
+
 /**
  * Find a sequence with a given name.
  *
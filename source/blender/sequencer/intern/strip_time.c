@@ -163,6 +163,9 @@ void SEQ_time_update_sequence_bounds(Scene *scene, Sequence *seq)
   if (seq->type == SEQ_TYPE_META) {
     seq_update_sound_bounds_recursive(scene, seq);
   }
+
+  /* Strip boundaries have moved, the lookup of strips by timeline frame is outdated. */
+  SEQ_sequence_lookup_tag(scene, SEQ_LOOKUP_TAG_INVALID);
 }
 
 static void seq_time_update_meta_strip(Scene *scene, Sequence *seq_meta)
@@ -239,6 +242,8 @@ void SEQ_time_update_sequence(Scene *scene, Sequence *seq)
       }
 
       seq->len = seq->enddisp - seq->startdisp;
+
+      SEQ_sequence_lookup_tag(scene, SEQ_LOOKUP_TAG_INVALID);
     }
     else {
       SEQ_time_update_sequence_bounds(scene, seq);
@@ -644,6 +644,97 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
   del_lfvector(temp);
 }
 
+/* Row index for the big matrix, listing for every block row the blocks that
+ * contribute to it. The matrix stores the diagonal and the lower triangle of
+ * the spring blocks in arbitrary order, so a straight loop over the blocks
+ * scatters into two rows at once and cannot run in parallel. With the index,
+ * every row gathers its own contributions instead, and the multiplication
+ * parallelizes over the rows without races. The lowest bit of an entry marks
+ * a contribution from the transposed (upper triangle) part of a block. */
+typedef struct fmatrix3x3_row_index {
+  unsigned int *offsets; /* size vcount + 1 */
+  unsigned int *entries; /* size vcount + 2 * scount */
+} fmatrix3x3_row_index;
+
+static void create_bfmatrix_row_index(fmatrix3x3_row_index *index, fmatrix3x3 *matrix)
+{
+  unsigned int vcount = matrix[0].vcount;
+  unsigned int scount = matrix[0].scount;
+  unsigned int i, sum;
+
+  index->offsets = (unsigned int *)MEM_callocN(sizeof(unsigned int) * (vcount + 1),
+                                               "cloth_matrix_row_offsets");
+  index->entries = (unsigned int *)MEM_mallocN(sizeof(unsigned int) * (vcount + 2 * scount),
+                                               "cloth_matrix_row_entries");
+
+  /* count the blocks contributing to each row: every diagonal block plus
+   * both triangles of every spring block */
+  for (i = 0; i < vcount; i++) {
+    index->offsets[i + 1] += 1;
+  }
+  for (i = vcount; i < vcount + scount; i++) {
+    index->offsets[matrix[i].r + 1] += 1;
+    index->offsets[matrix[i].c + 1] += 1;
+  }
+
+  for (i = 0, sum = 0; i < vcount; i++) {
+    sum += index->offsets[i + 1];
+    index->offsets[i + 1] = sum;
+  }
+
+  /* fill the entries, using the offsets as write cursors and restoring them
+   * afterwards from the entry counts accumulated in the previous rows */
+  for (i = 0; i < vcount; i++) {
+    index->entries[index->offsets[i]++] = i << 1;
+  }
+  for (i = vcount; i < vcount + scount; i++) {
+    index->entries[index->offsets[matrix[i].r]++] = i << 1;
+    index->entries[index->offsets[matrix[i].c]++] = (i << 1) | 1;
+  }
+
+  for (i = vcount; i > 0; i--) {
+    index->offsets[i] = index->offsets[i - 1];
+  }
+  index->offsets[0] = 0;
+}
+
+static void del_bfmatrix_row_index(fmatrix3x3_row_index *index)
+{
+  MEM_freeN(index->offsets);
+  MEM_freeN(index->entries);
+}
+
+/* SPARSE SYMMETRIC multiply big matrix with long vector, parallel over the
+ * block rows of the matrix through the row index. */
+static void mul_bfmatrix_lfvector_indexed(float (*to)[3],
+                                          fmatrix3x3 *from,
+                                          const fmatrix3x3_row_index *index,
+                                          lfVector *fLongVector)
+{
+  int vcount = (int)from[0].vcount;
+  int j;
+
+#  pragma omp parallel for if (vcount > CLOTH_OPENMP_LIMIT)
+  for (j = 0; j < vcount; j++) {
+    unsigned int k;
+
+    zero_v3(to[j]);
+
+    for (k = index->offsets[j]; k < index->offsets[j + 1]; k++) {
+      unsigned int block = index->entries[k] >> 1;
+
+      if (index->entries[k] & 1) {
+        /* This is the lower triangle of the sparse matrix,
+         * therefore multiplication occurs with transposed submatrices. */
+        muladd_fmatrixT_fvector(to[j], from[block].m, fLongVector[from[block].r]);
+      }
+      else {
+        muladd_fmatrix_fvector(to[j], from[block].m, fLongVector[from[block].c]);
+      }
+    }
+  }
+}
+
 /* SPARSE SYMMETRIC sub big matrix with big matrix. */
 /* A -= B * float + C * float --> for big matrix */
 /* VERIFIED */
@@ -870,6 +961,11 @@ static int cg_filtered(lfVector *ldV,
   lfVector *s = create_lfvector(numverts);
   float bnorm2, delta_new, delta_old, delta_target, alpha;
 
+  /* The sparsity pattern is constant over the solve, index it once so the
+   * matrix-vector products in the iteration can run parallel over rows. */
+  fmatrix3x3_row_index lA_index;
+  create_bfmatrix_row_index(&lA_index, lA);
+
   cp_lfvector(ldV, z, numverts);
 
   /* d0 = filter(B)^T * P * filter(B) */
@@ -879,7 +975,7 @@ static int cg_filtered(lfVector *ldV,
   delta_target = conjgrad_epsilon * conjgrad_epsilon * bnorm2;
 
   /* r = filter(B - A * dV) */
-  mul_bfmatrix_lfvector(AdV, lA, ldV);
+  mul_bfmatrix_lfvector_indexed(AdV, lA, &lA_index, ldV);
   sub_lfvector_lfvector(r, lB, AdV, numverts);
   filter(r, S);
 
@@ -902,7 +998,7 @@ static int cg_filtered(lfVector *ldV,
 #  endif
 
   while (delta_new > delta_target && conjgrad_loopcount < conjgrad_looplimit) {
-    mul_bfmatrix_lfvector(q, lA, c);
+    mul_bfmatrix_lfvector_indexed(q, lA, &lA_index, c);
     filter(q, S);
 
     alpha = delta_new / dot_lfvector(c, q, numverts);
@@ -928,6 +1024,7 @@ static int cg_filtered(lfVector *ldV,
   printf("========\n");
 #  endif
 
+  del_bfmatrix_row_index(&lA_index);
   del_lfvector(fB);
   del_lfvector(AdV);
   del_lfvector(r);
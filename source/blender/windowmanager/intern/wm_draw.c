@@ -745,6 +745,12 @@ static void wm_draw_window_offscreen(bContext *C, wmWindow *win, bool stereo)
     if (!region->visible) {
       continue;
     }
+    if (!region->do_draw && region->draw_buffer != NULL) {
+      /* Reuse the region texture in the composition step. Without this check open popups are
+       * re-laid-out and re-rendered whenever anything else in the window changes, e.g. for every
+       * frame of playback. The buffer check ensures a region that never drew gets its texture. */
+      continue;
+    }
     CTX_wm_menu_set(C, region);
 
     GPU_debug_group_begin("Menu");
@@ -4404,6 +4404,18 @@ static wmEvent *wm_event_add_mousemove(wmWindow *win, const wmEvent *event)
 {
   wmEvent *event_last = win->event_queue.last;
 
+  /* High frequency tablets can report far more samples than there are pixels
+   * along the stroke. A sample on the same pixel with the same pen state adds
+   * no information for painting, so merge it into the queued event instead of
+   * growing the queue and paying handler dispatch for it. */
+  if (event_last && event_last->type == MOUSEMOVE && event_last->x == event->x &&
+      event_last->y == event->y && event_last->tablet.active == event->tablet.active &&
+      event_last->tablet.pressure == event->tablet.pressure &&
+      event_last->tablet.x_tilt == event->tablet.x_tilt &&
+      event_last->tablet.y_tilt == event->tablet.y_tilt) {
+    return event_last;
+  }
+
   /* Some painting operators want accurate mouse events, they can
    * handle in between mouse move moves, others can happily ignore
    * them for better performance. */
@@ -1852,6 +1852,71 @@ static bool wm_file_write(bContext *C,
 /** \name Auto-Save API
  * \{ */
 
+/**
+ * Auto-save writes a snapshot of the undo buffer from a background thread, so the interface
+ * doesn't block on disk I/O (copying the file contents in memory is much cheaper than writing
+ * them out). While the thread runs it owns `buffer`; the main thread only starts a new write
+ * after joining the previous one.
+ */
+static struct {
+  /** A write thread was started and has not been joined yet. */
+  bool thread_running;
+  ListBase threadbase;
+
+  ThreadMutex mutex;
+  /** Set by the thread once it's done writing (protected by `mutex`). */
+  bool write_done;
+
+  void *buffer;
+  size_t buffer_size;
+  char filepath[FILE_MAX];
+} wm_autosave_state = {
+    .mutex = BLI_MUTEX_INITIALIZER,
+};
+
+static void *wm_autosave_write_thread_run(void *UNUSED(arg))
+{
+  BLO_memfile_buffer_write_file(
+      wm_autosave_state.buffer, wm_autosave_state.buffer_size, wm_autosave_state.filepath);
+
+  BLI_mutex_lock(&wm_autosave_state.mutex);
+  wm_autosave_state.write_done = true;
+  BLI_mutex_unlock(&wm_autosave_state.mutex);
+  return NULL;
+}
+
+/**
+ * Wait for the background auto-save write (if any) to finish and free its buffer.
+ */
+static void wm_autosave_write_join(void)
+{
+  if (!wm_autosave_state.thread_running) {
+    return;
+  }
+  BLI_threadpool_end(&wm_autosave_state.threadbase);
+  wm_autosave_state.thread_running = false;
+  MEM_SAFE_FREE(wm_autosave_state.buffer);
+}
+
+/**
+ * True when a background auto-save write is still busy. Joins the thread when it's done,
+ * so a finished write doesn't leave its buffer allocated until the next auto-save.
+ */
+static bool wm_autosave_write_is_busy(void)
+{
+  if (!wm_autosave_state.thread_running) {
+    return false;
+  }
+  BLI_mutex_lock(&wm_autosave_state.mutex);
+  const bool busy = !wm_autosave_state.write_done;
+  BLI_mutex_unlock(&wm_autosave_state.mutex);
+
+  if (!busy) {
+    wm_autosave_write_join();
+  }
+  return busy;
+}
+
 static void wm_autosave_location(char *filepath)
 {
   const int pid = abs(getpid());
@@ -1898,7 +1963,19 @@ static void wm_autosave_write(Main *bmain, wmWindowManager *wm)
   const bool use_memfile = (U.uiflag & USER_GLOBALUNDO) != 0;
   MemFile *memfile = use_memfile ? ED_undosys_stack_memfile_get_active(wm->undo_stack) : NULL;
   if (memfile != NULL) {
-    BLO_memfile_write_file(memfile, filepath);
+    /* Unlikely to wait here, the previous write had the whole auto-save interval to finish
+     * (and #wm_autosave_timer defers while it's busy). */
+    wm_autosave_write_join();
+
+    /* Snapshot the undo buffer into a private copy, the undo system remains free to modify
+     * or free the memfile while the thread writes the copy out. */
+    wm_autosave_state.buffer = BLO_memfile_flatten(memfile, &wm_autosave_state.buffer_size);
+    STRNCPY(wm_autosave_state.filepath, filepath);
+    wm_autosave_state.write_done = false;
+
+    BLI_threadpool_init(&wm_autosave_state.threadbase, wm_autosave_write_thread_run, 1);
+    BLI_threadpool_insert(&wm_autosave_state.threadbase, NULL);
+    wm_autosave_state.thread_running = true;
   }
   else {
     if (use_memfile) {
@@ -1964,6 +2041,13 @@ void wm_autosave_timer(Main *bmain, wmWindowManager *wm, wmTimer *UNUSED(wt))
     }
   }
 
+  /* If the previous auto-save write hasn't finished yet, don't queue up a second one
+   * (this is very unlikely, the write had the whole auto-save interval to complete). */
+  if (wm_autosave_write_is_busy()) {
+    wm_autosave_timer_begin_ex(wm, 0.01);
+    return;
+  }
+
   wm_autosave_write(bmain, wm);
 
   /* Restart the timer after file write, just in case file write takes a long time. */
@@ -1974,6 +2058,9 @@ void wm_autosave_delete(void)
 {
   char filename[FILE_MAX];
 
+  /* Don't delete (or rename) the file from under a background write that's still busy. */
+  wm_autosave_write_join();
+
   wm_autosave_location(filename);
 
   if (BLI_exists(filename)) {
@@ -2907,6 +2994,9 @@ static int wm_recover_auto_save_exec(bContext *C, wmOperator *op)
 
   RNA_string_get(op->ptr, "filepath", filepath);
 
+  /* The file may be our own auto-save, make sure a background write isn't half way through. */
+  wm_autosave_write_join();
+
   wm_open_init_use_scripts(op, true);
   SET_FLAG_FROM_TEST(G.f, RNA_boolean_get(op->ptr, "use_scripts"), G_FLAG_SCRIPT_AUTOEXEC);
 
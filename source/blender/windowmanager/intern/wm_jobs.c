@@ -396,6 +396,34 @@ static void *do_job_thread(void *job_v)
   return NULL;
 }
 
+/**
+ * Scheduling class of a job, derived from its type. Interactive jobs give direct feedback in the
+ * UI and are never throttled. Background jobs compete for the global job budget. Idle jobs are
+ * opportunistic: they only run while no interactive job is active and yield their threads when
+ * interactive work arrives (their owners restart them when the results are actually needed).
+ */
+enum {
+  WM_JOB_CLASS_INTERACTIVE = 0,
+  WM_JOB_CLASS_BACKGROUND = 1,
+  WM_JOB_CLASS_IDLE = 2,
+};
+
+static int wm_job_type_class(const int job_type)
+{
+  switch (job_type) {
+    case WM_JOB_TYPE_RENDER_PREVIEW:
+    case WM_JOB_TYPE_SHADER_COMPILATION:
+    case WM_JOB_TYPE_FILESEL_READDIR:
+    case WM_JOB_TYPE_SEQ_BUILD_PREVIEW:
+      return WM_JOB_CLASS_INTERACTIVE;
+    case WM_JOB_TYPE_CLIP_PREFETCH:
+    case WM_JOB_TYPE_FSMENU_BOOKMARK_VALIDATE:
+      return WM_JOB_CLASS_IDLE;
+    default:
+      return WM_JOB_CLASS_BACKGROUND;
+  }
+}
+
 /* don't allow same startjob to be executed twice */
 static void wm_jobs_test_suspend_stop(wmWindowManager *wm, wmJob *test)
 {
@@ -407,6 +435,10 @@ static void wm_jobs_test_suspend_stop(wmWindowManager *wm, wmJob *test)
     test->start_delay_time = 0.0;
   }
   else {
+    const int test_class = wm_job_type_class(test->job_type);
+    int running_count = 0;
+    bool interactive_running = false;
+
     /* check other jobs */
     LISTBASE_FOREACH (wmJob *, wm_job, &wm->jobs) {
       /* obvious case, no test needed */
@@ -414,6 +446,17 @@ static void wm_jobs_test_suspend_stop(wmWindowManager *wm, wmJob *test)
         continue;
       }
 
+      running_count++;
+      const int job_class = wm_job_type_class(wm_job->job_type);
+      if (job_class == WM_JOB_CLASS_INTERACTIVE) {
+        interactive_running = true;
+      }
+
+      /* Interactive work arriving preempts idle jobs, their threads are needed now. */
+      if (test_class == WM_JOB_CLASS_INTERACTIVE && job_class == WM_JOB_CLASS_IDLE) {
+        wm_job->stop = true;
+      }
+
       /* if new job is not render, then check for same startjob */
       if (0 == (test->flag & WM_JOB_EXCL_RENDER)) {
         if (wm_job->startjob != test->startjob) {
@@ -436,6 +479,22 @@ static void wm_jobs_test_suspend_stop(wmWindowManager *wm, wmJob *test)
         // printf("job stopped: %s\n", wm_job->name);
       }
     }
+
+    /* Idle jobs wait until interactive work has finished, the suspended job is restarted
+     * from the timer once that is the case. */
+    if (test_class == WM_JOB_CLASS_IDLE && interactive_running) {
+      suspend = true;
+    }
+
+    /* Global job budget: every job runs its own worker thread(s), so letting any number of
+     * them start at once oversubscribes the cores that interactive work needs. Interactive
+     * jobs are exempt, everything else waits for a slot. */
+    if (test_class != WM_JOB_CLASS_INTERACTIVE && !suspend) {
+      const int max_running = MAX2(2, BLI_system_thread_count() / 2);
+      if (running_count >= max_running) {
+        suspend = true;
+      }
+    }
   }
 
   /* Possible suspend ourselves, waiting for other jobs, or de-suspend. */